@@ -45,6 +45,7 @@ from ..modules.resources.string_replaces import StringReplacesModule
 from ..modules.resources.resources import ResourcesModule
 from ..modules.extensions import BundledExtensionsModule
 from ..modules.storage import UploadModule, DownloadResourcesModule
+from ..modules.perf import StepLatencyModule
 
 # Platform-specific modules (imported unconditionally - validation handles platform checks)
 from ..modules.sign.macos import MacOSSignModule
@@ -72,6 +73,8 @@ AVAILABLE_MODULES = {
     # Build
     "compile": CompileModule,
     "universal_build": UniversalBuildModule,  # macOS universal binary (arm64 + x64)
+    # Perf (opt-in, runs on the built browser)
+    "step_latency": StepLatencyModule,  # End-to-end agent step latency benchmark
     # Sign (platform-specific, validated at runtime)
     "sign_macos": MacOSSignModule,
     "sign_windows": WindowsSignModule,
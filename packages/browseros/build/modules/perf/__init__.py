@@ -0,0 +1,5 @@
+"""Performance benchmark modules"""
+
+from .step_latency import StepLatencyModule
+
+__all__ = ["StepLatencyModule"]
@@ -0,0 +1,320 @@
+#!/usr/bin/env python3
+"""End-to-end agent step latency benchmark module for BrowserOS
+
+Launches the built browser headless with a generated driver extension,
+runs a scripted snapshot -> action -> detect loop over fixture pages via
+the chrome.browserOS API, and writes step-latency percentiles to
+step_latency.json in the output directory. This measures the number the
+agent loop actually experiences end to end - IPC, tree serialization,
+processing, action injection and stability detection together - which no
+per-component benchmark captures.
+"""
+
+import json
+import shutil
+import subprocess
+import tempfile
+from pathlib import Path
+from ...common.module import CommandModule, ValidationError
+from ...common.context import Context
+from ...common.utils import (
+    log_info,
+    log_success,
+    log_warning,
+    join_paths,
+    IS_WINDOWS,
+    IS_MACOS,
+)
+
+# Marker the driver extension logs when the run completes; everything after
+# it on the line is the JSON sample payload.
+RESULT_MARKER = "BROWSEROS_STEP_LATENCY_RESULT"
+
+# Steps per fixture page. Enough for stable percentiles without making the
+# module slow enough that people skip it.
+STEPS_PER_FIXTURE = 40
+
+# Hard wall for the whole browser run; a hung renderer must fail the module
+# rather than the pipeline.
+RUN_TIMEOUT_SECS = 600
+
+
+class StepLatencyModule(CommandModule):
+    produces = ["step_latency_report"]
+    requires = []
+    description = "Run the end-to-end agent step latency benchmark on the built browser"
+
+    def validate(self, ctx: Context) -> None:
+        if not ctx.chromium_src.exists():
+            raise ValidationError(f"Chromium source not found: {ctx.chromium_src}")
+
+        binary = self._browser_binary(ctx)
+        if not binary.exists():
+            raise ValidationError(f"Built browser not found: {binary} (run compile first)")
+
+    def execute(self, ctx: Context) -> None:
+        log_info("\n⏱️  Running agent step latency benchmark...")
+
+        work_dir = Path(tempfile.mkdtemp(prefix="browseros_step_latency_"))
+        try:
+            fixtures = self._write_fixture_pages(work_dir / "fixtures")
+            extension_dir = self._write_driver_extension(
+                work_dir / "driver", fixtures
+            )
+            output = self._run_browser(ctx, work_dir, extension_dir)
+            samples = self._parse_samples(output)
+            report = self._build_report(ctx, samples)
+        finally:
+            shutil.rmtree(work_dir, ignore_errors=True)
+
+        report_path = join_paths(ctx.chromium_src, ctx.out_dir, "step_latency.json")
+        report_path.write_text(json.dumps(report, indent=2) + "\n")
+        ctx.artifact_registry.add("step_latency_report", report_path)
+
+        p = report["percentiles_ms"]
+        log_success(
+            f"Step latency over {report['samples']} steps: "
+            f"p50={p['p50']:.0f}ms p95={p['p95']:.0f}ms p99={p['p99']:.0f}ms "
+            f"-> {report_path}"
+        )
+
+    def _browser_binary(self, ctx: Context) -> Path:
+        """Path to the browser executable inside the built app"""
+        app_path = ctx.get_app_path()
+        if IS_MACOS():
+            return app_path / "Contents" / "MacOS" / ctx.BROWSEROS_APP_BASE_NAME
+        return app_path
+
+    def _write_fixture_pages(self, fixtures_dir: Path) -> list:
+        """Generate fixture pages covering the page shapes agents hit
+
+        Each page has buttons that mutate the DOM on click so the detect
+        half of the loop (waitForStable after the action) does real work.
+        """
+        fixtures_dir.mkdir(parents=True)
+
+        def button_grid(count: int) -> str:
+            return "\n".join(
+                f'<button onclick="mutate({i})">Action {i}</button>'
+                for i in range(count)
+            )
+
+        mutate_script = """
+<script>
+function mutate(i) {
+  const d = document.createElement('div');
+  d.textContent = 'result ' + i + ' ' + Date.now();
+  document.getElementById('log').appendChild(d);
+}
+</script>
+<div id="log"></div>
+"""
+
+        # Small page: the fast path, dominated by fixed per-step overhead.
+        (fixtures_dir / "small.html").write_text(
+            "<html><body><h1>Small fixture</h1>"
+            + button_grid(10)
+            + mutate_script
+            + "</body></html>"
+        )
+
+        # Dense page: hundreds of interactive elements plus off-screen
+        # content, the shape where snapshot cost dominates.
+        rows = "\n".join(
+            f'<li><a href="#r{i}">Row {i}</a> <input id="f{i}" value="v{i}"></li>'
+            for i in range(400)
+        )
+        (fixtures_dir / "dense.html").write_text(
+            "<html><body><h1>Dense fixture</h1>"
+            + button_grid(50)
+            + f"<ul>{rows}</ul>"
+            + mutate_script
+            + "</body></html>"
+        )
+
+        # Form page: typeable-heavy, the shape the relevance ranking and
+        # typeable-first ordering were built for.
+        fields = "\n".join(
+            f'<label>Field {i} <input name="n{i}"></label><br>' for i in range(60)
+        )
+        (fixtures_dir / "form.html").write_text(
+            "<html><body><h1>Form fixture</h1><form>"
+            + fields
+            + "</form>"
+            + button_grid(5)
+            + mutate_script
+            + "</body></html>"
+        )
+
+        return sorted(fixtures_dir.glob("*.html"))
+
+    def _write_driver_extension(self, ext_dir: Path, fixtures: list) -> Path:
+        """Generate the MV3 extension that drives the benchmark loop"""
+        ext_dir.mkdir(parents=True)
+
+        manifest = {
+            "manifest_version": 3,
+            "name": "BrowserOS step latency driver",
+            "version": "1.0",
+            "permissions": ["browserOS", "tabs"],
+            "background": {"service_worker": "driver.js"},
+        }
+        (ext_dir / "manifest.json").write_text(json.dumps(manifest, indent=2))
+
+        fixture_urls = [p.resolve().as_uri() for p in fixtures]
+        driver_js = (
+            "const FIXTURES = " + json.dumps(fixture_urls) + ";\n"
+            "const STEPS = " + str(STEPS_PER_FIXTURE) + ";\n"
+            + """
+function call(fn, ...args) {
+  return new Promise((resolve, reject) => {
+    fn(...args, (result) => {
+      if (chrome.runtime.lastError) {
+        reject(new Error(chrome.runtime.lastError.message));
+      } else {
+        resolve(result);
+      }
+    });
+  });
+}
+
+function waitForLoad(tabId) {
+  return new Promise((resolve) => {
+    const listener = (updatedId, info) => {
+      if (updatedId === tabId && info.status === 'complete') {
+        chrome.tabs.onUpdated.removeListener(listener);
+        resolve();
+      }
+    };
+    chrome.tabs.onUpdated.addListener(listener);
+  });
+}
+
+// One agent step: snapshot the page, act on a clickable node, wait for
+// the page to settle. The elapsed time is what an agent waits between
+// deciding an action and being able to observe its effect.
+async function runStep(tabId, stepIndex) {
+  const start = performance.now();
+  const snapshot = await call(
+      chrome.browserOS.getInteractiveSnapshot, tabId, {viewportOnly: true});
+  const clickable =
+      snapshot.elements.filter((e) => e.type === 'clickable');
+  if (clickable.length === 0) {
+    throw new Error('no clickable nodes in snapshot');
+  }
+  const node = clickable[stepIndex % clickable.length];
+  await call(chrome.browserOS.click, tabId, node.nodeId);
+  await call(chrome.browserOS.waitForStable, tabId, 100, 2000);
+  return performance.now() - start;
+}
+
+async function main() {
+  const samples = [];
+  try {
+    for (const url of FIXTURES) {
+      const tab = await chrome.tabs.create({url});
+      await waitForLoad(tab.id);
+      for (let i = 0; i < STEPS; i++) {
+        samples.push({fixture: url.split('/').pop(),
+                      ms: await runStep(tab.id, i)});
+      }
+      await chrome.tabs.remove(tab.id);
+    }
+    console.log('"""
+            + RESULT_MARKER
+            + """ ' + JSON.stringify({ok: true, samples}));
+  } catch (e) {
+    console.log('"""
+            + RESULT_MARKER
+            + """ ' + JSON.stringify({ok: false, error: String(e)}));
+  }
+}
+
+main();
+"""
+        )
+        (ext_dir / "driver.js").write_text(driver_js)
+        return ext_dir
+
+    def _run_browser(self, ctx: Context, work_dir: Path, extension_dir: Path) -> str:
+        binary = self._browser_binary(ctx)
+        profile_dir = work_dir / "profile"
+        cmd = [
+            str(binary),
+            "--headless=new",
+            "--disable-gpu",
+            "--no-first-run",
+            "--no-default-browser-check",
+            f"--user-data-dir={profile_dir}",
+            f"--load-extension={extension_dir}",
+            # Console messages (including the result marker) land on stderr.
+            "--enable-logging=stderr",
+            "--v=0",
+        ]
+        if not IS_WINDOWS():
+            cmd.append("--no-sandbox")
+
+        log_info(f"🔧 Running: {binary.name} headless with driver extension")
+        try:
+            result = subprocess.run(
+                cmd,
+                capture_output=True,
+                text=True,
+                timeout=RUN_TIMEOUT_SECS,
+            )
+        except subprocess.TimeoutExpired as e:
+            raise RuntimeError(
+                f"Benchmark browser run exceeded {RUN_TIMEOUT_SECS}s"
+            ) from e
+        return (result.stdout or "") + (result.stderr or "")
+
+    def _parse_samples(self, output: str) -> list:
+        for line in output.splitlines():
+            if RESULT_MARKER not in line:
+                continue
+            # Console lines arrive as: ...CONSOLE(1)] "<marker> <json>", source: ...
+            text = line.split(RESULT_MARKER, 1)[1]
+            if '", source:' in text:
+                text = text.split('", source:', 1)[0]
+            payload = json.loads(text.strip())
+            if not payload.get("ok"):
+                raise RuntimeError(f"Driver extension failed: {payload.get('error')}")
+            return payload["samples"]
+        raise RuntimeError(
+            "Benchmark produced no result marker - browser exited before the "
+            "driver extension finished"
+        )
+
+    def _build_report(self, ctx: Context, samples: list) -> dict:
+        latencies = sorted(s["ms"] for s in samples)
+
+        def percentile(pct: int) -> float:
+            index = min(len(latencies) - 1, len(latencies) * pct // 100)
+            return latencies[index]
+
+        per_fixture = {}
+        for sample in samples:
+            per_fixture.setdefault(sample["fixture"], []).append(sample["ms"])
+        if len(latencies) < STEPS_PER_FIXTURE:
+            log_warning(f"Low sample count ({len(latencies)}); percentiles are noisy")
+
+        return {
+            "benchmark": "agent_step_latency",
+            "browseros_version": ctx.get_browseros_version(),
+            "steps_per_fixture": STEPS_PER_FIXTURE,
+            "samples": len(latencies),
+            "percentiles_ms": {
+                "p50": percentile(50),
+                "p90": percentile(90),
+                "p95": percentile(95),
+                "p99": percentile(99),
+                "max": latencies[-1],
+            },
+            "per_fixture_ms": {
+                name: {
+                    "p50": sorted(vals)[min(len(vals) - 1, len(vals) * 50 // 100)],
+                    "max": max(vals),
+                }
+                for name, vals in per_fixture.items()
+            },
+        }
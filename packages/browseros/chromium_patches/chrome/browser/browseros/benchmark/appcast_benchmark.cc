@@ -0,0 +1,231 @@
+diff --git a/chrome/browser/browseros/benchmark/appcast_benchmark.cc b/chrome/browser/browseros/benchmark/appcast_benchmark.cc
+new file mode 100644
+index 0000000000000..9411345d25d54
+--- /dev/null
++++ b/chrome/browser/browseros/benchmark/appcast_benchmark.cc
+@@ -0,0 +1,225 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++// Corpus benchmark and robustness harness for BrowserOSAppcastParser.
++// Runs a generated corpus of realistic and adversarial appcast documents
++// through ParseLatestItem and ParseAllItems, reporting throughput and
++// worst-case per-document latency, then soaks the parser on deterministic
++// random mutations of the corpus. A malformed appcast once spiked updater
++// CPU fleet-wide; the point here is that parse cost stays bounded no
++// matter what the feed contains, and that we notice when it doesn't.
++//
++// Doubles as a fuzz entry point: --input=<file> parses one document and
++// exits, which is the shape external fuzz drivers want.
++//
++// Usage:
++//   browseros_appcast_benchmark [--iterations=200] [--mutations=20000]
++//   browseros_appcast_benchmark --input=crash-case.xml
++
++#include <algorithm>
++#include <cinttypes>
++#include <cstdio>
++#include <optional>
++#include <string>
++#include <vector>
++
++#include "base/at_exit.h"
++#include "base/command_line.h"
++#include "base/files/file_util.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/strings/stringprintf.h"
++#include "base/time/time.h"
++#include "base/timer/elapsed_timer.h"
++#include "chrome/browser/browseros/server/browseros_appcast_parser.h"
++
++namespace {
++
++using browseros_server::BrowserOSAppcastParser;
++
++// Deterministic xorshift generator so mutation runs are reproducible; a
++// failing seed can be replayed by rebuilding the same corpus.
++uint64_t g_rng_state = 0x2545F4914F6CDD1Dull;
++uint64_t NextRand() {
++  g_rng_state ^= g_rng_state << 13;
++  g_rng_state ^= g_rng_state >> 7;
++  g_rng_state ^= g_rng_state << 17;
++  return g_rng_state;
++}
++
++std::string MakeEnclosure(const char* os, const char* arch, int length) {
++  return base::StringPrintf(
++      "      <enclosure url=\"https://dl.example.com/b-%s-%s.zip\" "
++      "sparkle:os=\"%s\" sparkle:arch=\"%s\" "
++      "sparkle:edSignature=\"c2lnbmF0dXJl\" length=\"%d\" "
++      "type=\"application/zip\"/>\n",
++      os, arch, os, arch, length);
++}
++
++std::string MakeItem(int major, int minor, int enclosures) {
++  std::string item = base::StringPrintf(
++      "    <item>\n      <sparkle:version>%d.%d.0</sparkle:version>\n"
++      "      <pubDate>Wed, 13 Nov 2025 17:30:00 -0700</pubDate>\n",
++      major, minor);
++  static const char* kOs[] = {"macos", "linux", "windows"};
++  static const char* kArch[] = {"arm64", "x86_64"};
++  for (int i = 0; i < enclosures; ++i) {
++    item += MakeEnclosure(kOs[i % 3], kArch[i % 2], 10000000 + i);
++  }
++  item += "    </item>\n";
++  return item;
++}
++
++std::string WrapFeed(const std::string& items) {
++  return "<rss xmlns:sparkle=\"http://www.andymatuschak.org/"
++         "xml-namespaces/sparkle\">\n  <channel>\n" +
++         items + "  </channel>\n</rss>\n";
++}
++
++// Realistic and adversarial documents. The adversarial ones are the
++// shapes that historically hurt XML consumers: long version histories,
++// enclosure floods, deep element nesting, oversized attributes, and
++// truncations that cut the document mid-tag.
++std::vector<std::string> BuildCorpus() {
++  std::vector<std::string> corpus;
++
++  // Typical single-item feed.
++  corpus.push_back(WrapFeed(MakeItem(1, 0, 6)));
++
++  // Long version history: 500 items. ParseLatestItem must cost the same
++  // as the single-item feed; ParseAllItems is the linear baseline.
++  std::string history;
++  for (int i = 0; i < 500; ++i) {
++    history += MakeItem(1, 500 - i, 6);
++  }
++  corpus.push_back(WrapFeed(history));
++
++  // Enclosure flood in one item.
++  corpus.push_back(WrapFeed(MakeItem(2, 0, 2000)));
++
++  // Deeply nested garbage elements inside the channel.
++  std::string nested;
++  for (int i = 0; i < 2000; ++i) {
++    nested += "<x>";
++  }
++  for (int i = 0; i < 2000; ++i) {
++    nested += "</x>";
++  }
++  corpus.push_back(WrapFeed(nested + MakeItem(3, 0, 2)));
++
++  // Oversized attribute value (8 MB url).
++  std::string big_url(8 * 1024 * 1024, 'a');
++  corpus.push_back(WrapFeed(
++      "    <item>\n      <sparkle:version>4.0.0</sparkle:version>\n"
++      "      <enclosure url=\"" +
++      big_url + "\" sparkle:os=\"macos\" sparkle:arch=\"arm64\"/>\n"
++                "    </item>\n"));
++
++  // Truncations of the typical feed at awkward offsets.
++  const std::string& whole = corpus[0];
++  for (size_t cut : {whole.size() / 3, whole.size() / 2, whole.size() - 5}) {
++    corpus.push_back(whole.substr(0, cut));
++  }
++
++  // Not XML at all.
++  corpus.push_back(std::string(65536, '<'));
++
++  return corpus;
++}
++
++// Parses one document both ways and returns the elapsed wall time.
++base::TimeDelta ParseOnce(const std::string& doc) {
++  base::ElapsedTimer timer;
++  std::optional<browseros_server::AppcastItem> latest =
++      BrowserOSAppcastParser::ParseLatestItem(doc);
++  std::vector<browseros_server::AppcastItem> all =
++      BrowserOSAppcastParser::ParseAllItems(doc);
++  // Keep the results alive past the timer so the work can't be elided.
++  if (latest && !latest->version.IsValid() && all.size() > 1u) {
++    fprintf(stderr, "unexpected parse result\n");
++  }
++  return timer.Elapsed();
++}
++
++}  // namespace
++
++int main(int argc, char** argv) {
++  base::AtExitManager at_exit;
++  base::CommandLine::Init(argc, argv);
++  const base::CommandLine* command_line =
++      base::CommandLine::ForCurrentProcess();
++
++  // Fuzz-driver mode: parse one document from disk and exit. Exit code
++  // only reflects harness problems - a parse returning nullopt is a
++  // valid outcome for malformed input.
++  if (command_line->HasSwitch("input")) {
++    std::string doc;
++    if (!base::ReadFileToString(command_line->GetSwitchValuePath("input"),
++                                &doc)) {
++      fprintf(stderr, "failed to read --input file\n");
++      return 1;
++    }
++    base::TimeDelta elapsed = ParseOnce(doc);
++    printf("parsed %zu bytes in %" PRId64 "us\n", doc.size(),
++           elapsed.InMicroseconds());
++    return 0;
++  }
++
++  int iterations = 200;
++  if (command_line->HasSwitch("iterations")) {
++    base::StringToInt(command_line->GetSwitchValueASCII("iterations"),
++                      &iterations);
++  }
++  int mutations = 20000;
++  if (command_line->HasSwitch("mutations")) {
++    base::StringToInt(command_line->GetSwitchValueASCII("mutations"),
++                      &mutations);
++  }
++
++  const std::vector<std::string> corpus = BuildCorpus();
++
++  // Throughput and worst-case latency over the fixed corpus.
++  bool ok = true;
++  for (size_t d = 0; d < corpus.size(); ++d) {
++    const std::string& doc = corpus[d];
++    base::TimeDelta best = base::TimeDelta::Max();
++    base::TimeDelta worst;
++    for (int i = 0; i < iterations; ++i) {
++      const base::TimeDelta elapsed = ParseOnce(doc);
++      best = std::min(best, elapsed);
++      worst = std::max(worst, elapsed);
++    }
++    const double mib = doc.size() / (1024.0 * 1024.0);
++    printf("doc=%zu bytes=%zu best=%" PRId64 "us worst=%" PRId64
++           "us throughput=%.1f MiB/s\n",
++           d, doc.size(), best.InMicroseconds(), worst.InMicroseconds(),
++           best.is_positive() ? mib / best.InSecondsF() : 0.0);
++    // The bound that matters for the updater fleet: no document in the
++    // corpus may take longer than a second to reject or parse.
++    if (worst > base::Seconds(1)) {
++      fprintf(stderr, "doc %zu exceeded the 1s parse bound\n", d);
++      ok = false;
++    }
++  }
++
++  // Mutation soak: random byte edits of corpus documents. Asserts only
++  // that the parser returns (no hang, no crash) within the same bound.
++  const std::string& base_doc = corpus[0];
++  for (int i = 0; i < mutations; ++i) {
++    std::string doc = base_doc;
++    const int edits = 1 + (NextRand() % 8);
++    for (int e = 0; e < edits; ++e) {
++      doc[NextRand() % doc.size()] = static_cast<char>(NextRand() & 0xff);
++    }
++    const base::TimeDelta elapsed = ParseOnce(doc);
++    if (elapsed > base::Seconds(1)) {
++      fprintf(stderr, "mutation %d exceeded the 1s parse bound\n", i);
++      ok = false;
++      break;
++    }
++  }
++  printf("mutations=%d ok=%d\n", mutations, ok ? 1 : 0);
++
++  printf("%s\n", ok ? "PASS" : "FAIL");
++  return ok ? 0 : 1;
++}
@@ -0,0 +1,440 @@
+diff --git a/chrome/browser/browseros/benchmark/importer_benchmark.cc b/chrome/browser/browseros/benchmark/importer_benchmark.cc
+new file mode 100644
+index 0000000000000..a9fefa651dd5d
+--- /dev/null
++++ b/chrome/browser/browseros/benchmark/importer_benchmark.cc
+@@ -0,0 +1,434 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++// Benchmark for the Chrome profile importer. Generates a synthetic source
++// profile (History and Favicons databases, Bookmarks JSON, Web Data autofill
++// table, Preferences with extension entries), drives ChromeImporter
++// end-to-end against a counting bridge, and reports rows/sec per data type.
++// Row counts are parameterized so regressions show up before a customer's
++// 500MB profile does.
++//
++// Usage:
++//   browseros_importer_benchmark [--history=100000] [--bookmarks=10000]
++//       [--favicons=2000] [--autofill=20000] [--iterations=3]
++
++#include <cinttypes>
++#include <cstdint>
++#include <cstdio>
++#include <map>
++#include <string>
++#include <vector>
++
++#include "base/at_exit.h"
++#include "base/command_line.h"
++#include "base/files/file_path.h"
++#include "base/files/file_util.h"
++#include "base/files/scoped_temp_dir.h"
++#include "base/json/json_writer.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/strings/stringprintf.h"
++#include "base/synchronization/lock.h"
++#include "base/task/thread_pool/thread_pool_instance.h"
++#include "base/time/time.h"
++#include "base/values.h"
++#include "chrome/common/importer/importer_autofill_form_data_entry.h"
++#include "chrome/common/importer/importer_bridge.h"
++#include "chrome/utility/importer/chrome_importer.h"
++#include "components/favicon_base/favicon_usage_data.h"
++#include "components/user_data_importer/common/imported_bookmark_entry.h"
++#include "components/user_data_importer/common/importer_data_types.h"
++#include "components/user_data_importer/common/importer_url_row.h"
++#include "sql/database.h"
++#include "sql/statement.h"
++#include "sql/transaction.h"
++#include "ui/base/page_transition_types.h"
++#include "url/gurl.h"
++
++namespace {
++
++inline constexpr sql::Database::Tag kDatabaseTag{"ImporterBenchmark"};
++
++// A valid 1x1 opaque PNG; enough for the favicon re-encode path without
++// pulling image encoders into the generator.
++constexpr uint8_t kMinimalPng[] = {
++    0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
++    0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
++    0x08, 0x02, 0x00, 0x00, 0x00, 0x90, 0x77, 0x53, 0xde, 0x00, 0x00, 0x00,
++    0x0c, 0x49, 0x44, 0x41, 0x54, 0x08, 0xd7, 0x63, 0xf8, 0xcf, 0xc0, 0x00,
++    0x00, 0x00, 0x03, 0x00, 0x01, 0x9a, 0x60, 0xe1, 0xd5, 0x00, 0x00, 0x00,
++    0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82};
++
++// Counts rows as the importer hands them over and times each item type
++// between its started/ended notifications. The importer runs phases on
++// worker threads, so everything is guarded by a lock.
++class CountingBridge : public ImporterBridge {
++ public:
++  struct TypeStats {
++    base::TimeTicks started;
++    base::TimeDelta elapsed;
++    size_t rows = 0;
++  };
++
++  CountingBridge() = default;
++
++  void AddBookmarks(
++      const std::vector<user_data_importer::ImportedBookmarkEntry>& bookmarks,
++      const std::u16string& first_folder_name) override {
++    AddRows(user_data_importer::FAVORITES, bookmarks.size());
++  }
++  void AddHomePage(const GURL& home_page) override {}
++  void SetFavicons(
++      const favicon_base::FaviconUsageDataList& favicons) override {
++    // Favicons ride along with the FAVORITES item; track them separately.
++    base::AutoLock auto_lock(lock_);
++    favicon_rows_ += favicons.size();
++  }
++  void SetHistoryItems(
++      const std::vector<user_data_importer::ImporterURLRow>& rows,
++      user_data_importer::VisitSource visit_source) override {
++    AddRows(user_data_importer::HISTORY, rows.size());
++  }
++  void SetKeywords(
++      const std::vector<user_data_importer::SearchEngineInfo>& search_engines,
++      bool unique_on_host_and_path) override {}
++  void SetPasswordForm(
++      const user_data_importer::ImportedPasswordForm& form) override {}
++  void SetAutofillFormData(
++      const std::vector<ImporterAutofillFormDataEntry>& entries) override {
++    AddRows(user_data_importer::AUTOFILL_FORM_DATA, entries.size());
++  }
++  void SetExtensions(const std::vector<std::string>& extension_ids) override {
++    AddRows(user_data_importer::EXTENSIONS, extension_ids.size());
++  }
++
++  void NotifyStarted() override {}
++  void NotifyItemStarted(user_data_importer::ImportItem item) override {
++    base::AutoLock auto_lock(lock_);
++    stats_[item].started = base::TimeTicks::Now();
++  }
++  void NotifyItemEnded(user_data_importer::ImportItem item) override {
++    base::AutoLock auto_lock(lock_);
++    stats_[item].elapsed = base::TimeTicks::Now() - stats_[item].started;
++  }
++  void NotifyEnded() override {}
++
++  std::u16string GetLocalizedString(int message_id) override {
++    return std::u16string();
++  }
++
++  std::map<user_data_importer::ImportItem, TypeStats> stats() {
++    base::AutoLock auto_lock(lock_);
++    return stats_;
++  }
++  size_t favicon_rows() {
++    base::AutoLock auto_lock(lock_);
++    return favicon_rows_;
++  }
++
++ private:
++  ~CountingBridge() override = default;
++
++  void AddRows(user_data_importer::ImportItem item, size_t rows) {
++    base::AutoLock auto_lock(lock_);
++    stats_[item].rows += rows;
++  }
++
++  base::Lock lock_;
++  std::map<user_data_importer::ImportItem, TypeStats> stats_;
++  size_t favicon_rows_ = 0;
++};
++
++bool GenerateHistoryDb(const base::FilePath& profile_dir, size_t rows) {
++  sql::Database db(kDatabaseTag);
++  if (!db.Open(profile_dir.Append(FILE_PATH_LITERAL("History"))))
++    return false;
++  if (!db.Execute("CREATE TABLE urls (id INTEGER PRIMARY KEY, url TEXT, "
++                  "title TEXT, visit_count INTEGER, typed_count INTEGER, "
++                  "hidden INTEGER DEFAULT 0)") ||
++      !db.Execute("CREATE TABLE visits (id INTEGER PRIMARY KEY, url INTEGER, "
++                  "visit_time INTEGER, transition INTEGER)")) {
++    return false;
++  }
++
++  sql::Transaction transaction(&db);
++  if (!transaction.Begin())
++    return false;
++  sql::Statement url_insert(db.GetUniqueStatement(
++      "INSERT INTO urls (id, url, title, visit_count, typed_count, hidden) "
++      "VALUES (?, ?, ?, ?, ?, 0)"));
++  sql::Statement visit_insert(db.GetUniqueStatement(
++      "INSERT INTO visits (url, visit_time, transition) VALUES (?, ?, ?)"));
++  constexpr int64_t kTransition =
++      ui::PAGE_TRANSITION_TYPED | ui::PAGE_TRANSITION_CHAIN_END;
++  for (size_t i = 0; i < rows; ++i) {
++    url_insert.BindInt64(0, static_cast<int64_t>(i) + 1);
++    url_insert.BindString(
++        1, base::StringPrintf("https://site%zu.example.com/page", i));
++    url_insert.BindString(2, base::StringPrintf("Page %zu", i));
++    url_insert.BindInt(3, static_cast<int>(i % 50) + 1);
++    url_insert.BindInt(4, static_cast<int>(i % 5));
++    if (!url_insert.Run())
++      return false;
++    url_insert.Reset(true);
++
++    visit_insert.BindInt64(0, static_cast<int64_t>(i) + 1);
++    visit_insert.BindInt64(1, 13320000000000000 + static_cast<int64_t>(i));
++    visit_insert.BindInt64(2, kTransition);
++    if (!visit_insert.Run())
++      return false;
++    visit_insert.Reset(true);
++  }
++  return transaction.Commit();
++}
++
++base::Value::Dict MakeBookmarkUrlNode(size_t id) {
++  base::Value::Dict node;
++  node.Set("type", "url");
++  node.Set("name", base::StringPrintf("Bookmark %zu", id));
++  node.Set("url", base::StringPrintf("https://site%zu.example.com/page", id));
++  node.Set("date_added", "13320000000000000");
++  return node;
++}
++
++bool GenerateBookmarksJson(const base::FilePath& profile_dir, size_t count) {
++  // Shape the tree like a heavy real profile: folders of 20 bookmarks,
++  // nested 10 folders deep before starting a new branch.
++  constexpr size_t kPerFolder = 20;
++  constexpr size_t kMaxDepth = 10;
++
++  base::Value::Dict bookmark_bar;
++  bookmark_bar.Set("type", "folder");
++  bookmark_bar.Set("name", "Bookmarks Bar");
++  bookmark_bar.Set("date_added", "13320000000000000");
++
++  base::Value::List* children =
++      bookmark_bar.Set("children", base::Value::List())->GetIfList();
++  size_t id = 0;
++  size_t depth = 0;
++  while (id < count) {
++    for (size_t i = 0; i < kPerFolder && id < count; ++i)
++      children->Append(MakeBookmarkUrlNode(id++));
++    if (id >= count)
++      break;
++    base::Value::Dict folder;
++    folder.Set("type", "folder");
++    folder.Set("name", base::StringPrintf("Folder %zu", id));
++    folder.Set("date_added", "13320000000000000");
++    // Dict values are heap-allocated, so |next| stays valid across the
++    // move of |folder| into the list.
++    base::Value::List* next =
++        folder.Set("children", base::Value::List())->GetIfList();
++    children->Append(std::move(folder));
++    if (++depth < kMaxDepth) {
++      children = next;
++    } else {
++      // Restart from the top for the next branch.
++      children = bookmark_bar.FindList("children");
++      depth = 0;
++    }
++  }
++
++  base::Value::Dict roots;
++  roots.Set("bookmark_bar", std::move(bookmark_bar));
++  base::Value::Dict root;
++  root.Set("roots", std::move(roots));
++
++  std::string json;
++  if (!base::JSONWriter::Write(root, &json))
++    return false;
++  return base::WriteFile(profile_dir.Append(FILE_PATH_LITERAL("Bookmarks")),
++                         json);
++}
++
++// The importer looks for Favicons and Web Data next to the profile
++// directory (source_path.DirName()), not inside it.
++bool GenerateFaviconsDb(const base::FilePath& profile_dir, size_t count) {
++  sql::Database db(kDatabaseTag);
++  if (!db.Open(profile_dir.DirName().Append(FILE_PATH_LITERAL("Favicons"))))
++    return false;
++  if (!db.Execute("CREATE TABLE favicons (id INTEGER PRIMARY KEY, url TEXT)") ||
++      !db.Execute("CREATE TABLE favicon_bitmaps (id INTEGER PRIMARY KEY, "
++                  "icon_id INTEGER, image_data BLOB)") ||
++      !db.Execute("CREATE TABLE icon_mapping (id INTEGER PRIMARY KEY, "
++                  "icon_id INTEGER, page_url TEXT)")) {
++    return false;
++  }
++
++  sql::Transaction transaction(&db);
++  if (!transaction.Begin())
++    return false;
++  sql::Statement icon_insert(
++      db.GetUniqueStatement("INSERT INTO favicons (id, url) VALUES (?, ?)"));
++  sql::Statement bitmap_insert(db.GetUniqueStatement(
++      "INSERT INTO favicon_bitmaps (icon_id, image_data) VALUES (?, ?)"));
++  sql::Statement mapping_insert(db.GetUniqueStatement(
++      "INSERT INTO icon_mapping (icon_id, page_url) VALUES (?, ?)"));
++  for (size_t i = 0; i < count; ++i) {
++    const int64_t icon_id = static_cast<int64_t>(i) + 1;
++    icon_insert.BindInt64(0, icon_id);
++    icon_insert.BindString(
++        1, base::StringPrintf("https://site%zu.example.com/favicon.ico", i));
++    if (!icon_insert.Run())
++      return false;
++    icon_insert.Reset(true);
++
++    bitmap_insert.BindInt64(0, icon_id);
++    bitmap_insert.BindBlob(1, kMinimalPng);
++    if (!bitmap_insert.Run())
++      return false;
++    bitmap_insert.Reset(true);
++
++    mapping_insert.BindInt64(0, icon_id);
++    mapping_insert.BindString(
++        1, base::StringPrintf("https://site%zu.example.com/page", i));
++    if (!mapping_insert.Run())
++      return false;
++    mapping_insert.Reset(true);
++  }
++  return transaction.Commit();
++}
++
++bool GenerateWebDataDb(const base::FilePath& profile_dir, size_t rows) {
++  sql::Database db(kDatabaseTag);
++  if (!db.Open(profile_dir.DirName().Append(FILE_PATH_LITERAL("Web Data"))))
++    return false;
++  if (!db.Execute("CREATE TABLE autofill (name VARCHAR, value VARCHAR, "
++                  "count INTEGER, date_created INTEGER, "
++                  "date_last_used INTEGER)")) {
++    return false;
++  }
++
++  sql::Transaction transaction(&db);
++  if (!transaction.Begin())
++    return false;
++  sql::Statement insert(db.GetUniqueStatement(
++      "INSERT INTO autofill (name, value, count, date_created, "
++      "date_last_used) VALUES (?, ?, ?, ?, ?)"));
++  for (size_t i = 0; i < rows; ++i) {
++    insert.BindString(0, base::StringPrintf("field%zu", i % 100));
++    insert.BindString(1, base::StringPrintf("value %zu", i));
++    insert.BindInt(2, static_cast<int>(i % 20) + 1);
++    insert.BindInt64(3, 13320000000000000);
++    insert.BindInt64(4, 13320000000000000);
++    if (!insert.Run())
++      return false;
++    insert.Reset(true);
++  }
++  return transaction.Commit();
++}
++
++bool GeneratePreferences(const base::FilePath& profile_dir, size_t count) {
++  base::Value::Dict settings;
++  for (size_t i = 0; i < count; ++i) {
++    base::Value::Dict extension;
++    extension.Set("was_installed_by_default", false);
++    extension.Set("from_webstore", true);
++    settings.Set(base::StringPrintf("benchmarkextension%026zu", i),
++                 std::move(extension));
++  }
++  base::Value::Dict extensions;
++  extensions.Set("settings", std::move(settings));
++  base::Value::Dict root;
++  root.Set("extensions", std::move(extensions));
++
++  std::string json;
++  if (!base::JSONWriter::Write(root, &json))
++    return false;
++  return base::WriteFile(profile_dir.Append(FILE_PATH_LITERAL("Preferences")),
++                         json);
++}
++
++size_t SwitchValueOr(const base::CommandLine* command_line,
++                     const char* name,
++                     size_t default_value) {
++  if (!command_line->HasSwitch(name))
++    return default_value;
++  size_t value = 0;
++  if (!base::StringToSizeT(command_line->GetSwitchValueASCII(name), &value)) {
++    fprintf(stderr, "invalid --%s value\n", name);
++    exit(1);
++  }
++  return value;
++}
++
++const char* ItemName(user_data_importer::ImportItem item) {
++  switch (item) {
++    case user_data_importer::HISTORY:
++      return "history";
++    case user_data_importer::FAVORITES:
++      return "bookmarks";
++    case user_data_importer::PASSWORDS:
++      return "passwords";
++    case user_data_importer::AUTOFILL_FORM_DATA:
++      return "autofill";
++    case user_data_importer::EXTENSIONS:
++      return "extensions";
++    default:
++      return "other";
++  }
++}
++
++}  // namespace
++
++int main(int argc, char** argv) {
++  base::AtExitManager at_exit;
++  base::CommandLine::Init(argc, argv);
++  const base::CommandLine* command_line =
++      base::CommandLine::ForCurrentProcess();
++  base::ThreadPoolInstance::CreateAndStartWithDefaultParams(
++      "importer_benchmark");
++
++  const size_t history_rows = SwitchValueOr(command_line, "history", 100000);
++  const size_t bookmark_rows = SwitchValueOr(command_line, "bookmarks", 10000);
++  const size_t favicon_rows = SwitchValueOr(command_line, "favicons", 2000);
++  const size_t autofill_rows = SwitchValueOr(command_line, "autofill", 20000);
++  const size_t iterations = SwitchValueOr(command_line, "iterations", 3);
++
++  base::ScopedTempDir temp_dir;
++  if (!temp_dir.CreateUniqueTempDir()) {
++    fprintf(stderr, "failed to create temp dir\n");
++    return 1;
++  }
++  const base::FilePath profile_dir =
++      temp_dir.GetPath().Append(FILE_PATH_LITERAL("Default"));
++  if (!base::CreateDirectory(profile_dir) ||
++      !GenerateHistoryDb(profile_dir, history_rows) ||
++      !GenerateBookmarksJson(profile_dir, bookmark_rows) ||
++      !GenerateFaviconsDb(profile_dir, favicon_rows) ||
++      !GenerateWebDataDb(profile_dir, autofill_rows) ||
++      !GeneratePreferences(profile_dir, 20)) {
++    fprintf(stderr, "failed to generate synthetic profile\n");
++    return 1;
++  }
++
++  for (size_t iteration = 0; iteration < iterations; ++iteration) {
++    auto bridge = base::MakeRefCounted<CountingBridge>();
++    auto importer = base::MakeRefCounted<ChromeImporter>();
++
++    user_data_importer::SourceProfile source_profile;
++    source_profile.source_path = profile_dir;
++
++    const uint16_t items =
++        user_data_importer::HISTORY | user_data_importer::FAVORITES |
++        user_data_importer::AUTOFILL_FORM_DATA | user_data_importer::EXTENSIONS;
++
++    const base::TimeTicks start = base::TimeTicks::Now();
++    importer->StartImport(source_profile, items, bridge.get());
++    const base::TimeDelta total = base::TimeTicks::Now() - start;
++
++    printf("iteration=%zu total=%.0f ms", iteration, total.InMillisecondsF());
++    for (const auto& [item, stats] : bridge->stats()) {
++      const double seconds = stats.elapsed.InSecondsF();
++      printf(" %s=%zu rows (%.0f rows/sec)", ItemName(item), stats.rows,
++             seconds > 0 ? stats.rows / seconds : 0.0);
++    }
++    if (bridge->favicon_rows() > 0)
++      printf(" favicons=%zu", bridge->favicon_rows());
++    printf("\n");
++  }
++
++  base::ThreadPoolInstance::Get()->Shutdown();
++  return 0;
++}
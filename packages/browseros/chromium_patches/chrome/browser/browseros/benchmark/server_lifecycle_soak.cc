@@ -0,0 +1,264 @@
+diff --git a/chrome/browser/browseros/benchmark/server_lifecycle_soak.cc b/chrome/browser/browseros/benchmark/server_lifecycle_soak.cc
+new file mode 100644
+index 0000000000000..2da823b8660dd
+--- /dev/null
++++ b/chrome/browser/browseros/benchmark/server_lifecycle_soak.cc
+@@ -0,0 +1,258 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++// Soak harness for the BrowserOS server manager lifecycle. Drives the
++// environment-free pieces of the restart path through thousands of cycles
++// with fault injection and fails (non-zero exit) when an invariant breaks:
++//
++//   backoff   - crash-loop restart delays via the production
++//               ComputeRestartBackoff computation, asserting the jitter
++//               envelope, the cap, and delay percentiles across simulated
++//               crash-on-start loops.
++//   lock      - the server.lock exclusive-lock protocol under repeated
++//               steal/reacquire cycles (the "another process took the
++//               resource" fault), asserting exclusivity every cycle.
++//   config    - config.json write/parse round trips in the shape
++//               TryAttachToSharedServer consumes, asserting adopted port
++//               values and bounded memory across the run.
++//
++// Launching real server processes needs the browser environment (prefs,
++// profiles, UI thread), so process spawning itself is not driven here;
++// crash-on-start and slow-launch faults are represented by the exponent
++// ramps the production code feeds ComputeRestartBackoff in those cases.
++//
++// Usage:
++//   browseros_server_soak [--cycles=5000]
++
++#include <algorithm>
++#include <cinttypes>
++#include <cstdio>
++#include <optional>
++#include <string>
++#include <vector>
++
++#include "base/at_exit.h"
++#include "base/command_line.h"
++#include "base/files/file.h"
++#include "base/files/file_util.h"
++#include "base/files/scoped_temp_dir.h"
++#include "base/json/json_reader.h"
++#include "base/json/json_writer.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/time/time.h"
++#include "base/timer/elapsed_timer.h"
++#include "base/values.h"
++#include "build/build_config.h"
++#include "chrome/browser/browseros/server/browseros_server_manager.h"
++
++#if BUILDFLAG(IS_POSIX)
++#include <sys/resource.h>
++#endif
++
++namespace {
++
++using browseros::BrowserOSServerManager;
++
++// Mirrors the production crash-loop clamp (kMaxRestartBackoffExponent).
++constexpr int kMaxExponent = 6;
++
++double PeakRssMib() {
++#if BUILDFLAG(IS_POSIX)
++  struct rusage usage;
++  if (getrusage(RUSAGE_SELF, &usage) == 0) {
++#if BUILDFLAG(IS_APPLE)
++    return usage.ru_maxrss / (1024.0 * 1024.0);
++#else
++    return usage.ru_maxrss / 1024.0;
++#endif
++  }
++#endif
++  return 0.0;
++}
++
++base::TimeDelta Percentile(std::vector<base::TimeDelta>& samples, int pct) {
++  std::sort(samples.begin(), samples.end());
++  const size_t index =
++      std::min(samples.size() - 1, samples.size() * pct / 100);
++  return samples[index];
++}
++
++// Crash-on-start loop: the process dies inside the startup grace period
++// every time, so the exponent ramps to the cap and stays there. Asserts
++// every delay stays inside the jitter envelope of its capped base and
++// reports the delay distribution.
++bool SoakBackoff(int cycles) {
++  std::vector<base::TimeDelta> delays;
++  delays.reserve(cycles);
++
++  int exponent = 0;
++  for (int i = 0; i < cycles; ++i) {
++    exponent = std::min(exponent + 1, kMaxExponent);
++    const base::TimeDelta delay =
++        BrowserOSServerManager::ComputeRestartBackoff(exponent);
++    const base::TimeDelta base_delay =
++        std::min(base::Seconds(1) * (1 << (exponent - 1)), base::Seconds(30));
++    if (delay < base_delay * 0.75 || delay > base_delay * 1.25) {
++      fprintf(stderr,
++              "backoff: delay %" PRId64 "ms outside jitter envelope of %" PRId64
++              "ms at exponent %d\n",
++              delay.InMilliseconds(), base_delay.InMilliseconds(), exponent);
++      return false;
++    }
++    delays.push_back(delay);
++    // A healthy run between crash loops resets the ramp, like the
++    // production path does after the grace period; exercise both shapes.
++    if (i % 97 == 0) {
++      exponent = 0;
++    }
++  }
++
++  std::vector<base::TimeDelta> sorted = delays;
++  printf("backoff: cycles=%d p50=%" PRId64 "ms p95=%" PRId64 "ms p99=%" PRId64
++         "ms max=%" PRId64 "ms\n",
++         cycles, Percentile(sorted, 50).InMilliseconds(),
++         Percentile(sorted, 95).InMilliseconds(),
++         Percentile(sorted, 99).InMilliseconds(),
++         sorted.back().InMilliseconds());
++  // The cap bounds worst-case restart latency; with jitter it can never
++  // legitimately exceed 1.25x the 30s ceiling.
++  return sorted.back() <= base::Seconds(30) * 1.25;
++}
++
++// Lock-theft loop: the same exclusive-lock protocol AcquireLock runs on
++// server.lock, with a second handle playing the other Chrome process.
++// Every cycle the owner must hold exclusively, the thief must fail, and
++// after release the thief must succeed.
++bool SoakLock(int cycles, const base::FilePath& dir) {
++  const base::FilePath lock_path = dir.AppendASCII("server.lock");
++  std::vector<base::TimeDelta> acquire_times;
++  acquire_times.reserve(cycles);
++
++  for (int i = 0; i < cycles; ++i) {
++    base::ElapsedTimer timer;
++    base::File owner(lock_path, base::File::FLAG_OPEN_ALWAYS |
++                                    base::File::FLAG_READ |
++                                    base::File::FLAG_WRITE);
++    if (!owner.IsValid() ||
++        owner.Lock(base::File::LockMode::kExclusive) != base::File::FILE_OK) {
++      fprintf(stderr, "lock: owner failed to acquire on cycle %d\n", i);
++      return false;
++    }
++    acquire_times.push_back(timer.Elapsed());
++
++    base::File thief(lock_path, base::File::FLAG_OPEN_ALWAYS |
++                                    base::File::FLAG_READ |
++                                    base::File::FLAG_WRITE);
++    if (thief.IsValid() &&
++        thief.Lock(base::File::LockMode::kExclusive) == base::File::FILE_OK) {
++      fprintf(stderr, "lock: exclusivity violated on cycle %d\n", i);
++      return false;
++    }
++    thief.Close();
++
++    owner.Close();  // Releases the lock.
++
++    base::File successor(lock_path, base::File::FLAG_OPEN_ALWAYS |
++                                        base::File::FLAG_READ |
++                                        base::File::FLAG_WRITE);
++    if (!successor.IsValid() ||
++        successor.Lock(base::File::LockMode::kExclusive) !=
++            base::File::FILE_OK) {
++      fprintf(stderr, "lock: reacquire after release failed on cycle %d\n", i);
++      return false;
++    }
++    successor.Close();
++  }
++
++  printf("lock: cycles=%d acquire p50=%" PRId64 "us p99=%" PRId64 "us\n",
++         cycles, Percentile(acquire_times, 50).InMicroseconds(),
++         Percentile(acquire_times, 99).InMicroseconds());
++  return true;
++}
++
++// Config round-trip loop in the shape TryAttachToSharedServer parses.
++// Port values rotate every cycle so a stale read would be caught.
++bool SoakConfig(int cycles, const base::FilePath& dir) {
++  const base::FilePath config_path = dir.AppendASCII("config.json");
++
++  for (int i = 0; i < cycles; ++i) {
++    const int base_port = 9222 + (i % 1000);
++    base::Value::Dict ports;
++    ports.Set("cdp", base_port);
++    ports.Set("http_mcp", base_port + 1);
++    ports.Set("agent", base_port + 2);
++    ports.Set("extension", base_port + 3);
++    base::Value::Dict config;
++    config.Set("ports", std::move(ports));
++
++    std::optional<std::string> json = base::WriteJson(config);
++    if (!json || !base::WriteFile(config_path, *json)) {
++      fprintf(stderr, "config: write failed on cycle %d\n", i);
++      return false;
++    }
++
++    std::string read_back;
++    if (!base::ReadFileToString(config_path, &read_back)) {
++      fprintf(stderr, "config: read failed on cycle %d\n", i);
++      return false;
++    }
++    std::optional<base::Value> parsed = base::JSONReader::Read(read_back);
++    const base::Value::Dict* parsed_ports =
++        parsed && parsed->is_dict() ? parsed->GetDict().FindDict("ports")
++                                    : nullptr;
++    if (!parsed_ports ||
++        parsed_ports->FindInt("cdp").value_or(0) != base_port ||
++        parsed_ports->FindInt("extension").value_or(0) != base_port + 3) {
++      fprintf(stderr, "config: round trip mismatch on cycle %d\n", i);
++      return false;
++    }
++  }
++
++  printf("config: cycles=%d ok\n", cycles);
++  return true;
++}
++
++}  // namespace
++
++int main(int argc, char** argv) {
++  base::AtExitManager at_exit;
++  base::CommandLine::Init(argc, argv);
++  const base::CommandLine* command_line =
++      base::CommandLine::ForCurrentProcess();
++
++  int cycles = 5000;
++  if (command_line->HasSwitch("cycles")) {
++    base::StringToInt(command_line->GetSwitchValueASCII("cycles"), &cycles);
++  }
++  if (cycles <= 0) {
++    fprintf(stderr, "invalid --cycles\n");
++    return 1;
++  }
++
++  base::ScopedTempDir temp_dir;
++  if (!temp_dir.CreateUniqueTempDir()) {
++    fprintf(stderr, "failed to create temp dir\n");
++    return 1;
++  }
++
++  const double rss_before = PeakRssMib();
++  bool ok = SoakBackoff(cycles);
++  ok = SoakLock(cycles, temp_dir.GetPath()) && ok;
++  ok = SoakConfig(cycles, temp_dir.GetPath()) && ok;
++  const double rss_after = PeakRssMib();
++
++  // A restart-path leak shows up as peak RSS climbing with the cycle
++  // count; thousands of cycles should cost no more than a few MiB of
++  // transient allocations.
++  const double rss_growth = rss_after - rss_before;
++  printf("rss: before=%.1f MiB after=%.1f MiB growth=%.1f MiB\n", rss_before,
++         rss_after, rss_growth);
++  if (rss_growth > 32.0) {
++    fprintf(stderr, "rss growth exceeds bound\n");
++    ok = false;
++  }
++
++  printf("%s\n", ok ? "PASS" : "FAIL");
++  return ok ? 0 : 1;
++}
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/core/browseros_action_utils.h b/chrome/browser/browseros/core/browseros_action_utils.h
 new file mode 100644
-index 0000000000000..0adfaa4a8ac83
+index 0000000000000..c0ae7482c6d4f
 --- /dev/null
 +++ b/chrome/browser/browseros/core/browseros_action_utils.h
-@@ -0,0 +1,71 @@
+@@ -0,0 +1,87 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -13,9 +13,11 @@ index 0000000000000..0adfaa4a8ac83
 +
 +#include <string>
 +#include <string_view>
++#include <vector>
 +
 +#include "base/containers/contains.h"
 +#include "base/containers/fixed_flat_set.h"
++#include "base/no_destructor.h"
 +#include "chrome/browser/browseros/core/browseros_constants.h"
 +#include "chrome/browser/ui/actions/chrome_action_id.h"
 +#include "chrome/browser/ui/ui_features.h"
@@ -38,19 +40,33 @@ index 0000000000000..0adfaa4a8ac83
 +    });
 +
 +// Check if an action ID is a BrowserOS action (native or extension).
++// Called per action from toolbar update paths on the UI thread, so the
++// extension side is kept to map lookups over precomputed keys.
 +inline bool IsBrowserOSAction(actions::ActionId id) {
 +  // Check native actions
 +  if (kBrowserOSNativeActionIds.contains(id)) {
 +    return true;
 +  }
 +
-+  // Only labelled extensions are considered for BrowserOS actions
-+  for (const auto& ext_id : browseros::GetBrowserOSExtensionIds()) {
-+    if (!browseros::IsBrowserOSLabelledExtension(ext_id)) {
-+      continue;
-+    }
-+    auto ext_action_id = actions::ActionIdMap::StringToActionId(
-+        SidePanelEntryKey(SidePanelEntryId::kExtension, ext_id).ToString());
++  // Only labelled extensions are considered for BrowserOS actions. The
++  // labelled set and their side-panel key strings are fixed for the life
++  // of the process, so build the strings once; the ActionIdMap lookup
++  // stays per-call because the map grows as actions register.
++  static const base::NoDestructor<std::vector<std::string>> extension_keys(
++      [] {
++        std::vector<std::string> keys;
++        for (const auto& ext_id : browseros::GetBrowserOSExtensionIds()) {
++          if (!browseros::IsBrowserOSLabelledExtension(ext_id)) {
++            continue;
++          }
++          keys.push_back(
++              SidePanelEntryKey(SidePanelEntryId::kExtension, ext_id)
++                  .ToString());
++        }
++        return keys;
++      }());
++  for (const std::string& key : *extension_keys) {
++    auto ext_action_id = actions::ActionIdMap::StringToActionId(key);
 +    if (ext_action_id && id == *ext_action_id) {
 +      return true;
 +    }
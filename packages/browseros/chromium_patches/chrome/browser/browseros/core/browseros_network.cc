@@ -0,0 +1,112 @@
+diff --git a/chrome/browser/browseros/core/browseros_network.cc b/chrome/browser/browseros/core/browseros_network.cc
+new file mode 100644
+index 0000000000000..b841062af2a9e
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_network.cc
+@@ -0,0 +1,106 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/core/browseros_network.h"
++
++#include <utility>
++
++#include "base/no_destructor.h"
++#include "chrome/browser/browser_process.h"
++#include "chrome/browser/net/system_network_context_manager.h"
++#include "content/public/browser/network_service_instance.h"
++#include "mojo/public/cpp/bindings/remote.h"
++#include "net/proxy_resolution/proxy_config.h"
++#include "net/proxy_resolution/proxy_config_with_annotation.h"
++#include "net/traffic_annotation/network_traffic_annotation.h"
++#include "services/cert_verifier/public/mojom/cert_verifier_service_factory.mojom.h"
++#include "services/network/public/cpp/shared_url_loader_factory.h"
++#include "services/network/public/cpp/wrapper_shared_url_loader_factory.h"
++#include "services/network/public/mojom/network_context.mojom.h"
++#include "services/network/public/mojom/url_loader_factory.mojom.h"
++
++namespace browseros {
++
++namespace {
++
++// The loopback context and its factory live for the browser process; the
++// context remote doubles as the network-service-crash signal, at which
++// point both are rebuilt on the next use.
++struct LoopbackNetworkState {
++  mojo::Remote<network::mojom::NetworkContext> network_context;
++  scoped_refptr<network::SharedURLLoaderFactory> loader_factory;
++};
++
++LoopbackNetworkState& GetLoopbackNetworkState() {
++  static base::NoDestructor<LoopbackNetworkState> state;
++  return *state;
++}
++
++}  // namespace
++
++scoped_refptr<network::SharedURLLoaderFactory> GetSharedURLLoaderFactory() {
++  return g_browser_process->system_network_context_manager()
++      ->GetSharedURLLoaderFactory();
++}
++
++scoped_refptr<network::SharedURLLoaderFactory> GetLoopbackURLLoaderFactory() {
++  LoopbackNetworkState& state = GetLoopbackNetworkState();
++  if (state.loader_factory && state.network_context.is_connected()) {
++    return state.loader_factory;
++  }
++
++  // First use, or the network service crashed and took the context with
++  // it; build a fresh one.
++  state.network_context.reset();
++
++  net::NetworkTrafficAnnotationTag traffic_annotation =
++      net::DefineNetworkTrafficAnnotation("browseros_loopback_context", R"(
++        semantics {
++          sender: "BrowserOS Server Manager"
++          description:
++            "Dedicated network context for HTTP requests to the local "
++            "BrowserOS server. Carries only loopback traffic."
++          trigger: "BrowserOS server health checks and config pushes."
++          data: "No data beyond what the individual requests send."
++          destination: LOCAL
++        }
++        policy {
++          cookies_allowed: NO
++          setting: "This feature cannot be disabled by settings."
++          policy_exception_justification:
++            "Internal plumbing for BrowserOS server monitoring."
++        })");
++
++  network::mojom::NetworkContextParamsPtr params =
++      network::mojom::NetworkContextParams::New();
++  params->cert_verifier_params = content::GetCertVerifierParams(
++      cert_verifier::mojom::CertVerifierCreationParams::New());
++  // Loopback traffic never legitimately goes through a proxy. Pinning a
++  // direct config skips proxy resolution entirely - including PAC
++  // evaluation, which corporate setups run even for 127.0.0.1.
++  params->initial_proxy_config = net::ProxyConfigWithAnnotation(
++      net::ProxyConfig::CreateDirect(), traffic_annotation);
++  // Health and config responses are never cacheable, and with no file
++  // paths set nothing touches disk.
++  params->http_cache_enabled = false;
++
++  content::CreateNetworkContextInNetworkService(
++      state.network_context.BindNewPipeAndPassReceiver(), std::move(params));
++
++  network::mojom::URLLoaderFactoryParamsPtr factory_params =
++      network::mojom::URLLoaderFactoryParams::New();
++  factory_params->process_id = network::mojom::kBrowserProcessId;
++  factory_params->is_orb_enabled = false;
++
++  mojo::PendingRemote<network::mojom::URLLoaderFactory> factory_remote;
++  state.network_context->CreateURLLoaderFactory(
++      factory_remote.InitWithNewPipeAndPassReceiver(),
++      std::move(factory_params));
++  state.loader_factory =
++      base::MakeRefCounted<network::WrapperSharedURLLoaderFactory>(
++          std::move(factory_remote));
++  return state.loader_factory;
++}
++
++}  // namespace browseros
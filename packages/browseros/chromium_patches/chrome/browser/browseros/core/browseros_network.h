@@ -0,0 +1,43 @@
+diff --git a/chrome/browser/browseros/core/browseros_network.h b/chrome/browser/browseros/core/browseros_network.h
+new file mode 100644
+index 0000000000000..12bfaafec1baa
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_network.h
+@@ -0,0 +1,37 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_NETWORK_H_
++#define CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_NETWORK_H_
++
++#include "base/memory/scoped_refptr.h"
++
++namespace network {
++class SharedURLLoaderFactory;
++}  // namespace network
++
++namespace browseros {
++
++// Returns the loader factory shared by all BrowserOS background fetches
++// (server updater, server health checks, metrics uploads). Routing them
++// through one factory on the system network context keeps them in a single
++// socket pool, so back-to-back requests to the same endpoint reuse a
++// kept-alive connection instead of each caller's loaders opening fresh TLS
++// connections. Callers keep their own per-request traffic annotations.
++// Must be called on the UI thread.
++scoped_refptr<network::SharedURLLoaderFactory> GetSharedURLLoaderFactory();
++
++// Returns the loader factory for HTTP traffic to the local BrowserOS
++// server (health checks, config pushes). It runs on a dedicated network
++// context tuned for loopback: a pinned direct proxy config, so requests
++// never wait on system proxy resolution (corporate PAC files have been
++// traced stalling loopback fetches by 200ms), no HTTP cache, and nothing
++// persisted to disk. External fetches (updater, metrics) stay on
++// GetSharedURLLoaderFactory(), which follows the system proxy.
++// Must be called on the UI thread.
++scoped_refptr<network::SharedURLLoaderFactory> GetLoopbackURLLoaderFactory();
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_NETWORK_H_
@@ -1,20 +1,76 @@
 diff --git a/chrome/browser/browseros/core/browseros_prefs.cc b/chrome/browser/browseros/core/browseros_prefs.cc
 new file mode 100644
-index 0000000000000..9ebd1e2429ac0
+index 0000000000000..4ad3c96475fe5
 --- /dev/null
 +++ b/chrome/browser/browseros/core/browseros_prefs.cc
-@@ -0,0 +1,55 @@
+@@ -0,0 +1,159 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/browseros/core/browseros_prefs.h"
 +
++#include <atomic>
++
++#include "base/functional/bind.h"
++#include "base/no_destructor.h"
 +#include "chrome/browser/ui/actions/chrome_action_id.h"
 +#include "components/pref_registry/pref_registry_syncable.h"
++#include "components/prefs/pref_change_registrar.h"
 +
 +namespace browseros {
 +
++namespace {
++
++// In-memory snapshot of the toolbar-visibility prefs. The ShouldShow*
++// helpers are called on per-action hot paths (toolbar updates, API
++// dispatch), where a string-keyed PrefService lookup per call adds up at
++// agent call rates. Pref observers update the snapshot once per change;
++// readers pay a single relaxed atomic load.
++struct FeatureState {
++  // The PrefService whose observers currently feed the snapshot, or null
++  // when no watcher is attached. Doubles as the publication flag for the
++  // bools. Set by AttachFeatureState and cleared by DetachFeatureState
++  // before the service is destroyed, so a stale pointer is never compared
++  // against a live PrefService.
++  std::atomic<const PrefService*> attached_prefs{nullptr};
++
++  std::atomic<bool> show_llm_chat{true};
++  std::atomic<bool> show_llm_hub{true};
++  std::atomic<bool> show_toolbar_labels{true};
++};
++
++FeatureState& GetFeatureState() {
++  static base::NoDestructor<FeatureState> state;
++  return *state;
++}
++
++void RefreshFeatureState(PrefService* pref_service) {
++  FeatureState& state = GetFeatureState();
++  state.show_llm_chat.store(pref_service->GetBoolean(prefs::kShowLLMChat),
++                            std::memory_order_relaxed);
++  state.show_llm_hub.store(pref_service->GetBoolean(prefs::kShowLLMHub),
++                           std::memory_order_relaxed);
++  state.show_toolbar_labels.store(
++      pref_service->GetBoolean(prefs::kShowToolbarLabels),
++      std::memory_order_relaxed);
++}
++
++// Returns the cached value for one visibility pref, or falls back to a
++// PrefService lookup when |pref_service| is not the attached one (another
++// profile's prefs, or no watcher attached yet).
++bool ReadVisibilityPref(PrefService* pref_service,
++                        const std::atomic<bool>& cached,
++                        const char* pref_key) {
++  if (GetFeatureState().attached_prefs.load(std::memory_order_acquire) ==
++      pref_service) {
++    return cached.load(std::memory_order_relaxed);
++  }
++  return pref_service->GetBoolean(pref_key);
++}
++
++}  // namespace
++
 +void RegisterProfilePrefs(user_prefs::PrefRegistrySyncable* registry) {
 +  // Toolbar visibility prefs
 +  registry->RegisterBooleanPref(prefs::kShowLLMChat, true);
@@ -28,15 +84,18 @@ index 0000000000000..9ebd1e2429ac0
 +}
 +
 +bool ShouldShowLLMChat(PrefService* pref_service) {
-+  return pref_service->GetBoolean(prefs::kShowLLMChat);
++  return ReadVisibilityPref(pref_service, GetFeatureState().show_llm_chat,
++                            prefs::kShowLLMChat);
 +}
 +
 +bool ShouldShowLLMHub(PrefService* pref_service) {
-+  return pref_service->GetBoolean(prefs::kShowLLMHub);
++  return ReadVisibilityPref(pref_service, GetFeatureState().show_llm_hub,
++                            prefs::kShowLLMHub);
 +}
 +
 +bool ShouldShowToolbarLabels(PrefService* pref_service) {
-+  return pref_service->GetBoolean(prefs::kShowToolbarLabels);
++  return ReadVisibilityPref(pref_service, GetFeatureState().show_toolbar_labels,
++                            prefs::kShowToolbarLabels);
 +}
 +
 +const char* GetVisibilityPrefForAction(actions::ActionId id) {
@@ -51,11 +110,56 @@ index 0000000000000..9ebd1e2429ac0
 +}
 +
 +bool ShouldShowToolbarAction(actions::ActionId id, PrefService* pref_service) {
-+  const char* pref_key = GetVisibilityPrefForAction(id);
-+  if (!pref_key) {
-+    return true;  // No pref means always show
++  switch (id) {
++    case kActionSidePanelShowThirdPartyLlm:
++      return ShouldShowLLMChat(pref_service);
++    case kActionSidePanelShowClashOfGpts:
++      return ShouldShowLLMHub(pref_service);
++    default:
++      return true;  // No pref means always show
 +  }
-+  return pref_service->GetBoolean(pref_key);
 +}
 +
++namespace internal {
++
++// Wires |registrar| (owned by BrowserOSPrefsWatcher, so profile-scoped)
++// up to |pref_service| and primes the snapshot. All pref access happens
++// on the UI thread, so no locking is needed; the atomics only make the
++// cached reads cheap, not cross-thread. The snapshot follows the first
++// watcher that attaches - in practice the primary profile - and helpers
++// called with a different profile's prefs fall back to direct lookups.
++void AttachFeatureState(PrefService* pref_service,
++                        PrefChangeRegistrar* registrar) {
++  FeatureState& state = GetFeatureState();
++  if (state.attached_prefs.load(std::memory_order_acquire)) {
++    // Another profile's watcher already feeds the snapshot; observing a
++    // second PrefService would let its changes clobber the cached values.
++    // Helpers called with this profile's prefs fall back to direct
++    // lookups, and the watcher's empty registrar makes Shutdown() a no-op.
++    return;
++  }
++
++  registrar->Init(pref_service);
++  auto refresh =
++      base::BindRepeating(&RefreshFeatureState, base::Unretained(pref_service));
++  registrar->Add(prefs::kShowLLMChat, refresh);
++  registrar->Add(prefs::kShowLLMHub, refresh);
++  registrar->Add(prefs::kShowToolbarLabels, refresh);
++  RefreshFeatureState(pref_service);
++  state.attached_prefs.store(pref_service, std::memory_order_release);
++}
++
++// Drops the snapshot's association with |pref_service| (no-op for any
++// other service). Called from the watcher's Shutdown(), before the
++// PrefService is destroyed, so ReadVisibilityPref never compares a
++// dangling pointer against a live service.
++void DetachFeatureState(PrefService* pref_service) {
++  FeatureState& state = GetFeatureState();
++  const PrefService* expected = pref_service;
++  state.attached_prefs.compare_exchange_strong(expected, nullptr,
++                                               std::memory_order_acq_rel);
++}
++
++}  // namespace internal
++
 +}  // namespace browseros
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/core/browseros_prefs.h b/chrome/browser/browseros/core/browseros_prefs.h
 new file mode 100644
-index 0000000000000..3d2c46562d783
+index 0000000000000..8ec03a701472f
 --- /dev/null
 +++ b/chrome/browser/browseros/core/browseros_prefs.h
-@@ -0,0 +1,65 @@
+@@ -0,0 +1,83 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -14,6 +14,8 @@ index 0000000000000..3d2c46562d783
 +#include "components/prefs/pref_service.h"
 +#include "ui/actions/action_id.h"
 +
++class PrefChangeRegistrar;
++
 +namespace user_prefs {
 +class PrefRegistrySyncable;
 +}  // namespace user_prefs
@@ -47,7 +49,9 @@ index 0000000000000..3d2c46562d783
 +// Registers BrowserOS profile preferences.
 +void RegisterProfilePrefs(user_prefs::PrefRegistrySyncable* registry);
 +
-+// Check if LLM Chat should be shown in toolbar.
++// Check if LLM Chat should be shown in toolbar. This and the helpers
++// below answer from a pref-observer-maintained in-memory snapshot, so
++// they are cheap enough for per-action hot paths.
 +bool ShouldShowLLMChat(PrefService* pref_service);
 +
 +// Check if LLM Hub should be shown in toolbar.
@@ -66,6 +70,20 @@ index 0000000000000..3d2c46562d783
 +// Get the visibility pref key for an action, or nullptr if none exists.
 +const char* GetVisibilityPrefForAction(actions::ActionId id);
 +
++namespace internal {
++
++// Hooks for BrowserOSPrefsWatcher, the per-profile KeyedService that owns
++// the pref observer keeping the visibility snapshot fresh. Attach wires
++// |registrar| up to |pref_service| and primes the snapshot; Detach clears
++// the snapshot's association with |pref_service| so reads fall back to
++// the PrefService until another profile attaches. The registrar itself is
++// owned by the watcher and unregisters before its PrefService dies.
++void AttachFeatureState(PrefService* pref_service,
++                        PrefChangeRegistrar* registrar);
++void DetachFeatureState(PrefService* pref_service);
++
++}  // namespace internal
++
 +}  // namespace browseros
 +
 +#endif  // CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_PREFS_H_
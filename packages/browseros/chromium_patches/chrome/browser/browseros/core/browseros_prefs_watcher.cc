@@ -0,0 +1,70 @@
+diff --git a/chrome/browser/browseros/core/browseros_prefs_watcher.cc b/chrome/browser/browseros/core/browseros_prefs_watcher.cc
+new file mode 100644
+index 0000000000000..ac8a9c6ecfd2f
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_prefs_watcher.cc
+@@ -0,0 +1,64 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/core/browseros_prefs_watcher.h"
++
++#include <memory>
++
++#include "base/no_destructor.h"
++#include "chrome/browser/browseros/core/browseros_prefs.h"
++#include "chrome/browser/profiles/profile.h"
++#include "components/keyed_service/content/browser_context_dependency_manager.h"
++#include "components/prefs/pref_service.h"
++#include "content/public/browser/browser_context.h"
++
++namespace browseros {
++
++BrowserOSPrefsWatcher::BrowserOSPrefsWatcher(PrefService* pref_service)
++    : prefs_(pref_service) {
++  internal::AttachFeatureState(prefs_, &registrar_);
++}
++
++BrowserOSPrefsWatcher::~BrowserOSPrefsWatcher() = default;
++
++void BrowserOSPrefsWatcher::Shutdown() {
++  // Detach before the registrar unregisters so no read between the two
++  // steps can serve cached values that nothing refreshes anymore.
++  internal::DetachFeatureState(prefs_);
++  registrar_.RemoveAll();
++  prefs_ = nullptr;
++}
++
++// static
++BrowserOSPrefsWatcherFactory* BrowserOSPrefsWatcherFactory::GetInstance() {
++  static base::NoDestructor<BrowserOSPrefsWatcherFactory> instance;
++  return instance.get();
++}
++
++BrowserOSPrefsWatcherFactory::BrowserOSPrefsWatcherFactory()
++    : BrowserContextKeyedServiceFactory(
++          "BrowserOSPrefsWatcher",
++          BrowserContextDependencyManager::GetInstance()) {}
++
++BrowserOSPrefsWatcherFactory::~BrowserOSPrefsWatcherFactory() = default;
++
++std::unique_ptr<KeyedService>
++BrowserOSPrefsWatcherFactory::BuildServiceInstanceForBrowserContext(
++    content::BrowserContext* context) const {
++  Profile* profile = Profile::FromBrowserContext(context);
++
++  // Incognito profiles share the parent's prefs; the parent's watcher
++  // already covers them.
++  if (profile->IsOffTheRecord()) {
++    return nullptr;
++  }
++
++  return std::make_unique<BrowserOSPrefsWatcher>(profile->GetPrefs());
++}
++
++bool BrowserOSPrefsWatcherFactory::ServiceIsCreatedWithBrowserContext() const {
++  return true;
++}
++
++}  // namespace browseros
@@ -0,0 +1,78 @@
+diff --git a/chrome/browser/browseros/core/browseros_prefs_watcher.h b/chrome/browser/browseros/core/browseros_prefs_watcher.h
+new file mode 100644
+index 0000000000000..60324afde4dab
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_prefs_watcher.h
+@@ -0,0 +1,72 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_PREFS_WATCHER_H_
++#define CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_PREFS_WATCHER_H_
++
++#include <memory>
++
++#include "base/memory/raw_ptr.h"
++#include "base/no_destructor.h"
++#include "components/keyed_service/content/browser_context_keyed_service_factory.h"
++#include "components/keyed_service/core/keyed_service.h"
++#include "components/prefs/pref_change_registrar.h"
++
++class PrefService;
++
++namespace content {
++class BrowserContext;
++}  // namespace content
++
++namespace browseros {
++
++// Per-profile service that keeps the toolbar-visibility pref snapshot in
++// browseros_prefs.cc fresh. It owns the PrefChangeRegistrar so the
++// observers live exactly as long as the profile: Shutdown() detaches the
++// snapshot and unregisters before the profile's PrefService is torn down,
++// which a process-global registrar cannot do.
++class BrowserOSPrefsWatcher : public KeyedService {
++ public:
++  explicit BrowserOSPrefsWatcher(PrefService* pref_service);
++
++  BrowserOSPrefsWatcher(const BrowserOSPrefsWatcher&) = delete;
++  BrowserOSPrefsWatcher& operator=(const BrowserOSPrefsWatcher&) = delete;
++
++  ~BrowserOSPrefsWatcher() override;
++
++  // KeyedService:
++  void Shutdown() override;
++
++ private:
++  raw_ptr<PrefService> prefs_;
++  PrefChangeRegistrar registrar_;
++};
++
++// Factory for creating BrowserOSPrefsWatcher instances per profile. The
++// watcher is created with the profile so the snapshot is attached before
++// the first toolbar query, not lazily from a read path.
++class BrowserOSPrefsWatcherFactory : public BrowserContextKeyedServiceFactory {
++ public:
++  BrowserOSPrefsWatcherFactory(const BrowserOSPrefsWatcherFactory&) = delete;
++  BrowserOSPrefsWatcherFactory& operator=(const BrowserOSPrefsWatcherFactory&) =
++      delete;
++
++  // Returns the singleton factory instance.
++  static BrowserOSPrefsWatcherFactory* GetInstance();
++
++ private:
++  friend base::NoDestructor<BrowserOSPrefsWatcherFactory>;
++
++  BrowserOSPrefsWatcherFactory();
++  ~BrowserOSPrefsWatcherFactory() override;
++
++  // BrowserContextKeyedServiceFactory:
++  std::unique_ptr<KeyedService> BuildServiceInstanceForBrowserContext(
++      content::BrowserContext* context) const override;
++  bool ServiceIsCreatedWithBrowserContext() const override;
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_PREFS_WATCHER_H_
@@ -0,0 +1,175 @@
+diff --git a/chrome/browser/browseros/core/browseros_step_profiler.cc b/chrome/browser/browseros/core/browseros_step_profiler.cc
+new file mode 100644
+index 0000000000000..68d1cddd80a09
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_step_profiler.cc
+@@ -0,0 +1,169 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/core/browseros_step_profiler.h"
++
++#include <algorithm>
++#include <utility>
++
++#include "base/command_line.h"
++#include "base/files/file_util.h"
++#include "base/functional/bind.h"
++#include "base/json/json_writer.h"
++#include "base/logging.h"
++#include "base/strings/string_number_conversions.h"
++#include "base/task/thread_pool.h"
++#include "chrome/browser/browseros/core/browseros_switches.h"
++
++namespace browseros {
++
++namespace {
++
++// Gaps between consecutive phases shorter than this are attributed to the
++// preceding phase rather than emitted as think time; anything longer is the
++// extension deciding what to do next (LLM latency, planning).
++constexpr base::TimeDelta kMinThinkGap = base::Milliseconds(5);
++
++// Hard cap on buffered phases so a forgotten session can't grow without
++// bound; long production runs hit EndSession() well before this.
++constexpr size_t kMaxPhases = 100000;
++
++// Serializes |phases| (sorted by start time) to the Chrome trace event
++// format, inserting synthetic "extension_think" slices into the gaps.
++std::string SerializeTrace(std::vector<BrowserOSStepProfiler::Phase> phases,
++                           base::TimeTicks session_start) {
++  base::Value::List events;
++  base::TimeTicks last_end = session_start;
++  for (auto& phase : phases) {
++    if (phase.start - last_end >= kMinThinkGap) {
++      base::Value::Dict think;
++      think.Set("name", "extension_think");
++      think.Set("cat", "browseros");
++      think.Set("ph", "X");
++      think.Set("ts",
++                static_cast<double>((last_end - session_start).InMicroseconds()));
++      think.Set("dur",
++                static_cast<double>((phase.start - last_end).InMicroseconds()));
++      think.Set("pid", 1);
++      think.Set("tid", 1);
++      events.Append(std::move(think));
++    }
++    last_end = std::max(last_end, phase.end);
++
++    base::Value::Dict event;
++    event.Set("name", phase.name);
++    event.Set("cat", "browseros");
++    event.Set("ph", "X");
++    event.Set("ts",
++              static_cast<double>((phase.start - session_start).InMicroseconds()));
++    event.Set("dur",
++              static_cast<double>((phase.end - phase.start).InMicroseconds()));
++    event.Set("pid", 1);
++    event.Set("tid", 1);
++    if (!phase.args.empty()) {
++      event.Set("args", std::move(phase.args));
++    }
++    events.Append(std::move(event));
++  }
++
++  std::string json;
++  base::JSONWriter::Write(events, &json);
++  return json;
++}
++
++void WriteTraceFile(const base::FilePath& path, const std::string& json) {
++  if (!base::WriteFile(path, json)) {
++    LOG(WARNING) << "browseros: Failed to write step profile to "
++                 << path.value();
++    return;
++  }
++  LOG(INFO) << "browseros: Step profile written to " << path.value();
++}
++
++}  // namespace
++
++// static
++BrowserOSStepProfiler* BrowserOSStepProfiler::GetInstance() {
++  static base::NoDestructor<BrowserOSStepProfiler> instance;
++  return instance.get();
++}
++
++BrowserOSStepProfiler::BrowserOSStepProfiler()
++    : enabled_(base::CommandLine::ForCurrentProcess()->HasSwitch(
++          kProfileSteps)) {}
++
++void BrowserOSStepProfiler::StartSession(const base::FilePath& output_dir) {
++  if (!enabled_) {
++    return;
++  }
++  EndSession();  // Export a dangling session rather than dropping it.
++
++  base::AutoLock lock(lock_);
++  session_open_ = true;
++  session_start_ = base::TimeTicks::Now();
++  session_start_wall_ = base::Time::Now();
++  output_dir_ = output_dir;
++  phases_.clear();
++}
++
++void BrowserOSStepProfiler::RecordPhase(std::string_view name,
++                                        base::TimeTicks start,
++                                        base::TimeTicks end,
++                                        base::Value::Dict args) {
++  if (!enabled_) {
++    return;
++  }
++  base::AutoLock lock(lock_);
++  if (!session_open_ || phases_.size() >= kMaxPhases) {
++    return;
++  }
++  // Phases started before the session (e.g. a snapshot already in flight
++  // when the server restarted) would serialize with a negative timestamp.
++  if (start < session_start_) {
++    return;
++  }
++  phases_.push_back({std::string(name), start, end, std::move(args)});
++}
++
++void BrowserOSStepProfiler::EndSession() {
++  if (!enabled_) {
++    return;
++  }
++
++  std::vector<Phase> phases;
++  base::TimeTicks session_start;
++  base::FilePath path;
++  {
++    base::AutoLock lock(lock_);
++    if (!session_open_) {
++      return;
++    }
++    session_open_ = false;
++    phases = std::move(phases_);
++    phases_.clear();
++    session_start = session_start_;
++    path = output_dir_.AppendASCII(
++        "browseros_steps_" +
++        base::NumberToString(session_start_wall_.ToTimeT()) + ".json");
++  }
++
++  // Phases are appended at completion time, so overlapping async work can
++  // land out of order; the trace format wants ascending timestamps.
++  std::sort(phases.begin(), phases.end(),
++            [](const Phase& a, const Phase& b) { return a.start < b.start; });
++
++  // Serialize on the pool too: a long session can hold tens of thousands
++  // of phases and EndSession() is called from the UI thread at shutdown.
++  base::ThreadPool::PostTask(
++      FROM_HERE, {base::MayBlock(), base::TaskPriority::BEST_EFFORT},
++      base::BindOnce(
++          [](std::vector<Phase> phases, base::TimeTicks session_start,
++             base::FilePath path) {
++            WriteTraceFile(path,
++                           SerializeTrace(std::move(phases), session_start));
++          },
++          std::move(phases), session_start, std::move(path)));
++}
++
++}  // namespace browseros
@@ -0,0 +1,93 @@
+diff --git a/chrome/browser/browseros/core/browseros_step_profiler.h b/chrome/browser/browseros/core/browseros_step_profiler.h
+new file mode 100644
+index 0000000000000..376d8e3729154
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_step_profiler.h
+@@ -0,0 +1,87 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_STEP_PROFILER_H_
++#define CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_STEP_PROFILER_H_
++
++#include <string>
++#include <string_view>
++#include <vector>
++
++#include "base/files/file_path.h"
++#include "base/no_destructor.h"
++#include "base/synchronization/lock.h"
++#include "base/thread_annotations.h"
++#include "base/time/time.h"
++#include "base/values.h"
++
++namespace browseros {
++
++// Records a per-step timeline of agent work — snapshot processing, action
++// dispatch, change waits, screenshots — and exports one Chrome trace-format
++// JSON file per server session, loadable in Perfetto or chrome://tracing.
++// Gaps between recorded phases are emitted as synthetic "extension_think"
++// slices, so the exported flame view accounts for the full wall time of a
++// session, not just the browser-side work.
++//
++// Enabled with --browseros-profile-steps; a disabled profiler costs one
++// branch per phase boundary. Sessions are opened and closed by
++// BrowserOSServerManager alongside the server process it coordinates.
++class BrowserOSStepProfiler {
++ public:
++  static BrowserOSStepProfiler* GetInstance();
++
++  BrowserOSStepProfiler(const BrowserOSStepProfiler&) = delete;
++  BrowserOSStepProfiler& operator=(const BrowserOSStepProfiler&) = delete;
++
++  // Whether --browseros-profile-steps was passed. Callers should check this
++  // before assembling args for RecordPhase().
++  bool enabled() const { return enabled_; }
++
++  // Opens a new session; EndSession() writes the trace file into
++  // |output_dir|. Phases recorded while no session is open are dropped.
++  // Reopening an unclosed session exports it first.
++  void StartSession(const base::FilePath& output_dir);
++
++  // Records one completed phase spanning [start, end). |args| lands in the
++  // trace event's "args" object. No-op when disabled or no session is open.
++  // Thread-safe; phases may be reported from any thread.
++  void RecordPhase(std::string_view name,
++                   base::TimeTicks start,
++                   base::TimeTicks end,
++                   base::Value::Dict args = {});
++
++  // Serializes the session to browseros_steps_<unix-time>.json in the
++  // session's output dir (written on the thread pool) and clears the
++  // buffer. No-op when no session is open.
++  void EndSession();
++
++  // One recorded slice. Public so the serialization helpers in the .cc can
++  // take buffers of them off the instance.
++  struct Phase {
++    std::string name;
++    base::TimeTicks start;
++    base::TimeTicks end;
++    base::Value::Dict args;
++  };
++
++ private:
++  friend class base::NoDestructor<BrowserOSStepProfiler>;
++
++  BrowserOSStepProfiler();
++  ~BrowserOSStepProfiler() = default;
++
++  const bool enabled_;
++
++  base::Lock lock_;
++  bool session_open_ GUARDED_BY(lock_) = false;
++  base::TimeTicks session_start_ GUARDED_BY(lock_);
++  base::Time session_start_wall_ GUARDED_BY(lock_);
++  base::FilePath output_dir_ GUARDED_BY(lock_);
++  std::vector<Phase> phases_ GUARDED_BY(lock_);
++};
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_STEP_PROFILER_H_
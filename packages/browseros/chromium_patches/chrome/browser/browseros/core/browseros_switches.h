@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/core/browseros_switches.h b/chrome/browser/browseros/core/browseros_switches.h
 new file mode 100644
-index 0000000000000..4e7932596534c
+index 0000000000000..820437bba9994
 --- /dev/null
 +++ b/chrome/browser/browseros/core/browseros_switches.h
-@@ -0,0 +1,83 @@
+@@ -0,0 +1,125 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -24,6 +24,37 @@ index 0000000000000..4e7932596534c
 +// Disables the BrowserOS server entirely.
 +inline constexpr char kDisableServer[] = "disable-browseros-server";
 +
++// Defers the BrowserOS server launch until the first browserOS API call
++// instead of starting it during browser startup.
++inline constexpr char kDeferServerStart[] = "browseros-defer-server-start";
++
++// Shared-server mode: when another browser process of this installation
++// already holds the server lock, attach to its running server (reading
++// the endpoints from the shared config) instead of running without one.
++// Three profiles then share one server process rather than racing for
++// the lock. Opt-in while server-side per-profile namespacing matures.
++inline constexpr char kSharedServer[] = "browseros-shared-server";
++
++// Serves the CDP endpoint over a Unix domain socket instead of a
++// localhost TCP port, skipping the TCP stack and port management (POSIX
++// only; Windows keeps the TCP transport). The socket path is advertised
++// to the server via config JSON and a --cdp-uds argument.
++inline constexpr char kUDSTransport[] = "browseros-uds-transport";
++
++// Disables CDP session multiplexing: the server falls back to opening one
++// DevTools connection per agent session instead of fanning flat Target
++// sessions out over a single shared connection. Escape hatch for
++// debugging per-session traffic with external tooling.
++inline constexpr char kDisableCDPMultiplex[] =
++    "browseros-disable-cdp-multiplex";
++
++// Overrides the CDP write-coalescing window, in microseconds. The server
++// holds small protocol messages for up to this long so bursts drain in
++// one socket write; latency-critical commands flush immediately. 0
++// disables coalescing. Defaults to 500.
++inline constexpr char kCDPWriteCoalesceUs[] =
++    "browseros-cdp-write-coalesce-us";
++
 +// Disables the BrowserOS server OTA updater.
 +inline constexpr char kDisableServerUpdater[] = "disable-browseros-server-updater";
 +
@@ -81,9 +112,20 @@ index 0000000000000..4e7932596534c
 +
 +// === Misc Switches ===
 +
++// Lets same-origin Clash of GPTs panes share one renderer process by
++// creating their WebContents in related SiteInstances. Trades per-pane
++// process isolation for memory; three panes of the same provider then
++// cost one renderer instead of three.
++inline constexpr char kSharePaneProcesses[] = "browseros-share-pane-processes";
++
 +// Indicates this is the first run of BrowserOS.
 +inline constexpr char kFirstRun[] = "browseros-first-run";
 +
++// Records a per-step timeline of agent work (snapshot, action, change
++// wait, screenshot, extension think time) and writes one trace-format JSON
++// file per server session, loadable in Perfetto or chrome://tracing.
++inline constexpr char kProfileSteps[] = "browseros-profile-steps";
++
 +}  // namespace browseros
 +
 +#endif  // CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_SWITCHES_H_
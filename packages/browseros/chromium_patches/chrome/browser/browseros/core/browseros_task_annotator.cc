@@ -0,0 +1,25 @@
+diff --git a/chrome/browser/browseros/core/browseros_task_annotator.cc b/chrome/browser/browseros/core/browseros_task_annotator.cc
+new file mode 100644
+index 0000000000000..1d60ba1bc0290
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_task_annotator.cc
+@@ -0,0 +1,19 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/core/browseros_task_annotator.h"
++
++#include "base/metrics/histogram_functions.h"
++#include "base/strings/strcat.h"
++
++namespace browseros {
++namespace internal {
++
++void RecordTaskQueueDelay(const char* subsystem, base::TimeDelta queue_delay) {
++  base::UmaHistogramTimes(
++      base::StrCat({"BrowserOS.TaskQueueDelay.", subsystem}), queue_delay);
++}
++
++}  // namespace internal
++}  // namespace browseros
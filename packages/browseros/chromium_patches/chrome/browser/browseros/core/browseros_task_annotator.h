@@ -0,0 +1,63 @@
+diff --git a/chrome/browser/browseros/core/browseros_task_annotator.h b/chrome/browser/browseros/core/browseros_task_annotator.h
+new file mode 100644
+index 0000000000000..d5ba5faac1b60
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_task_annotator.h
+@@ -0,0 +1,57 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_TASK_ANNOTATOR_H_
++#define CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_TASK_ANNOTATOR_H_
++
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/functional/callback.h"
++#include "base/time/time.h"
++#include "base/trace_event/trace_event.h"
++
++namespace browseros {
++
++namespace internal {
++
++// Records |queue_delay| for |subsystem| in the
++// BrowserOS.TaskQueueDelay.<subsystem> histogram.
++void RecordTaskQueueDelay(const char* subsystem, base::TimeDelta queue_delay);
++
++}  // namespace internal
++
++// Wraps a task about to be posted to the thread pool so its scheduling is
++// attributable. The wrap stamps the post time; when the task runs, its
++// execution is bracketed by a "browseros"-category trace event carrying the
++// subsystem tag and measured queue delay, and the delay lands in the
++// BrowserOS.TaskQueueDelay.<subsystem> histogram. This is how thread-pool
++// contention behind agent work becomes visible - queue delay is exactly the
++// time a snapshot or update step sat waiting for a worker.
++//
++// |subsystem| must be a string literal (it is kept as a raw pointer and
++// used as a histogram suffix). Usage:
++//   base::ThreadPool::PostTask(
++//       FROM_HERE, {...},
++//       browseros::AnnotateTask("ServerUpdater", base::BindOnce(...)));
++template <typename ReturnType>
++base::OnceCallback<ReturnType()> AnnotateTask(
++    const char* subsystem,
++    base::OnceCallback<ReturnType()> task) {
++  return base::BindOnce(
++      [](const char* subsystem, base::TimeTicks post_time,
++         base::OnceCallback<ReturnType()> task) -> ReturnType {
++        const base::TimeDelta queue_delay =
++            base::TimeTicks::Now() - post_time;
++        TRACE_EVENT2("browseros", "BrowserOSTask", "subsystem", subsystem,
++                     "queue_delay_us", queue_delay.InMicroseconds());
++        internal::RecordTaskQueueDelay(subsystem, queue_delay);
++        return std::move(task).Run();
++      },
++      subsystem, base::TimeTicks::Now(), std::move(task));
++}
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_TASK_ANNOTATOR_H_
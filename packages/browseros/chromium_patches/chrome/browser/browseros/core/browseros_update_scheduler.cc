@@ -0,0 +1,98 @@
+diff --git a/chrome/browser/browseros/core/browseros_update_scheduler.cc b/chrome/browser/browseros/core/browseros_update_scheduler.cc
+new file mode 100644
+index 0000000000000..16d1c30007883
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_update_scheduler.cc
+@@ -0,0 +1,92 @@
++// Copyright 2024 BrowserOS Authors. All rights reserved.
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/browseros/core/browseros_update_scheduler.h"
++
++#include "base/logging.h"
++#include "base/no_destructor.h"
++#include "base/power_monitor/power_monitor.h"
++#include "base/time/time.h"
++#include "net/base/network_change_notifier.h"
++
++namespace browseros {
++
++namespace {
++
++// Minimum spacing between any two scheduled update checks, regardless of
++// which updater runs them. Wide enough to keep the appcast fetches (and
++// the downloads they trigger) out of each other's traffic window, narrow
++// enough that neither updater's own cadence is visibly delayed.
++constexpr base::TimeDelta kUpdateCheckSpacing = base::Minutes(10);
++
++// Combined bytes both updaters may start downloading per 24-hour window.
++// A browser update plus a server update fits comfortably; the cap exists
++// to stop retry loops and release-day rechecks from re-downloading the
++// same payloads all day.
++constexpr int64_t kDailyDownloadBudgetBytes = 2LL * 1024 * 1024 * 1024;
++
++struct SchedulerState {
++  base::TimeTicks last_check_start;
++  base::TimeTicks budget_window_start;
++  int64_t bytes_charged = 0;
++};
++
++SchedulerState& GetState() {
++  static base::NoDestructor<SchedulerState> state;
++  return *state;
++}
++
++}  // namespace
++
++bool ShouldDeferBackgroundUpdateWork() {
++  if (base::PowerMonitor::GetInstance()->IsOnBatteryPower()) {
++    VLOG(1) << "browseros: Deferring update work, on battery power";
++    return true;
++  }
++  if (net::NetworkChangeNotifier::GetConnectionCost() ==
++      net::NetworkChangeNotifier::CONNECTION_COST_METERED) {
++    VLOG(1) << "browseros: Deferring update work, metered connection";
++    return true;
++  }
++  return false;
++}
++
++bool TryBeginUpdateCheck(const char* client) {
++  SchedulerState& state = GetState();
++  base::TimeTicks now = base::TimeTicks::Now();
++  if (!state.last_check_start.is_null() &&
++      now - state.last_check_start < kUpdateCheckSpacing) {
++    LOG(INFO) << "browseros: Update check (" << client
++              << ") yielded, another check ran "
++              << (now - state.last_check_start).InSeconds() << "s ago";
++    return false;
++  }
++  state.last_check_start = now;
++  return true;
++}
++
++bool HasDownloadBudget() {
++  SchedulerState& state = GetState();
++  if (!state.budget_window_start.is_null() &&
++      base::TimeTicks::Now() - state.budget_window_start > base::Hours(24)) {
++    state.budget_window_start = base::TimeTicks();
++    state.bytes_charged = 0;
++  }
++  return state.bytes_charged < kDailyDownloadBudgetBytes;
++}
++
++void ChargeDownloadBudget(int64_t bytes) {
++  SchedulerState& state = GetState();
++  if (state.budget_window_start.is_null()) {
++    state.budget_window_start = base::TimeTicks::Now();
++  }
++  state.bytes_charged += bytes;
++  if (state.bytes_charged >= kDailyDownloadBudgetBytes) {
++    LOG(WARNING) << "browseros: Daily update download budget exhausted ("
++                 << (state.bytes_charged / 1024 / 1024)
++                 << " MB), new downloads deferred";
++  }
++}
++
++}  // namespace browseros
@@ -0,0 +1,46 @@
+diff --git a/chrome/browser/browseros/core/browseros_update_scheduler.h b/chrome/browser/browseros/core/browseros_update_scheduler.h
+new file mode 100644
+index 0000000000000..10b289291bc79
+--- /dev/null
++++ b/chrome/browser/browseros/core/browseros_update_scheduler.h
+@@ -0,0 +1,40 @@
++// Copyright 2024 BrowserOS Authors. All rights reserved.
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_UPDATE_SCHEDULER_H_
++#define CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_UPDATE_SCHEDULER_H_
++
++#include <stdint.h>
++
++namespace browseros {
++
++// Process-wide coordination between the two updaters that talk to the
++// BrowserOS CDN: Sparkle (browser, macOS) and BrowserOSServerUpdater
++// (server binary). Without it they check and download on independent
++// schedules, which doubles peak bandwidth on release days. All functions
++// must be called on the UI thread (both updaters run there), so no
++// locking is needed.
++
++// Returns true if background update work should be deferred right now:
++// the machine is on battery power or the connection is metered.
++// User-initiated checks should ignore this.
++bool ShouldDeferBackgroundUpdateWork();
++
++// Serializes scheduled checks across updaters. Returns true and opens a
++// new check window unless another updater began one recently; callers
++// that get false simply wait for their next timer tick. |client| is only
++// used for logging.
++bool TryBeginUpdateCheck(const char* client);
++
++// Shared downloaded-bytes budget across both updaters, reset every 24
++// hours. HasDownloadBudget() gates starting (or resuming) a download;
++// ChargeDownloadBudget() records bytes as they arrive. An in-flight
++// download is allowed to finish once started - the budget caps how much
++// new traffic a single day can begin, not mid-stream.
++bool HasDownloadBudget();
++void ChargeDownloadBudget(int64_t bytes);
++
++}  // namespace browseros
++
++#endif  // CHROME_BROWSER_BROWSEROS_CORE_BROWSEROS_UPDATE_SCHEDULER_H_
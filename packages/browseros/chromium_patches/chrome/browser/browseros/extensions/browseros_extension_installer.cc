@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/extensions/browseros_extension_installer.cc b/chrome/browser/browseros/extensions/browseros_extension_installer.cc
 new file mode 100644
-index 0000000000000..56a3fb65d5348
+index 0000000000000..f73b59636a0af
 --- /dev/null
 +++ b/chrome/browser/browseros/extensions/browseros_extension_installer.cc
-@@ -0,0 +1,298 @@
+@@ -0,0 +1,362 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,11 +11,16 @@ index 0000000000000..56a3fb65d5348
 +#include "chrome/browser/browseros/extensions/browseros_extension_installer.h"
 +
 +#include <utility>
++#include <vector>
 +
++#include "base/containers/flat_set.h"
++#include "base/files/file_enumerator.h"
 +#include "base/files/file_util.h"
 +#include "base/json/json_reader.h"
 +#include "base/logging.h"
++#include "base/no_destructor.h"
 +#include "base/path_service.h"
++#include "base/synchronization/lock.h"
 +#include "base/task/thread_pool.h"
 +#include "chrome/browser/browseros/core/browseros_constants.h"
 +#include "chrome/browser/extensions/external_provider_impl.h"
@@ -49,6 +54,24 @@ index 0000000000000..56a3fb65d5348
 +          policy_exception_justification: "BrowserOS feature."
 +        })");
 +
++// Process-wide cache of the parsed bundled manifest. The bundle ships
++// once per install, but every profile re-reads and re-parses it at
++// startup; (mtime, size) validation lets profile N reuse profile 1's
++// parse. Guarded by a lock because ReadBundledManifest runs on the
++// thread pool.
++struct BundledManifestCache {
++  base::Lock lock;
++  base::FilePath path;
++  base::Time mtime;
++  int64_t size = -1;
++  base::Value::Dict prefs;
++};
++
++BundledManifestCache& GetBundledManifestCache() {
++  static base::NoDestructor<BundledManifestCache> cache;
++  return *cache;
++}
++
 +}  // namespace
 +
 +InstallResult::InstallResult() = default;
@@ -102,8 +125,11 @@ index 0000000000000..56a3fb65d5348
 +
 +  LOG(INFO) << "browseros: Loading from bundled at " << bundled_path.value();
 +
++  // USER_VISIBLE, not USER_BLOCKING: the extensions are not needed
++  // before the first window, so the manifest read should not compete
++  // with startup-critical disk work.
 +  base::ThreadPool::PostTaskAndReplyWithResult(
-+      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
++      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
 +      base::BindOnce(&BrowserOSExtensionInstaller::ReadBundledManifest,
 +                     manifest_path, bundled_path),
 +      base::BindOnce(&BrowserOSExtensionInstaller::OnBundledLoadComplete,
@@ -116,6 +142,21 @@ index 0000000000000..56a3fb65d5348
 +base::Value::Dict BrowserOSExtensionInstaller::ReadBundledManifest(
 +    const base::FilePath& manifest_path,
 +    const base::FilePath& bundled_path) {
++  // Unchanged manifest: hand back the cached parse. Only the manifest
++  // itself is revalidated; the CRX files it points at are immutable
++  // parts of the same bundle.
++  base::File::Info info;
++  const bool have_info = base::GetFileInfo(manifest_path, &info);
++  if (have_info) {
++    BundledManifestCache& cache = GetBundledManifestCache();
++    base::AutoLock auto_lock(cache.lock);
++    if (cache.path == manifest_path && cache.mtime == info.last_modified &&
++        cache.size == info.size) {
++      VLOG(1) << "browseros: Bundled manifest unchanged, reusing parse";
++      return cache.prefs.Clone();
++    }
++  }
++
 +  std::string json_content;
 +  if (!base::ReadFileToString(manifest_path, &json_content)) {
 +    LOG(ERROR) << "browseros: Failed to read bundled manifest";
@@ -128,6 +169,20 @@ index 0000000000000..56a3fb65d5348
 +    return base::Value::Dict();
 +  }
 +
++  // One enumeration of the bundle directory replaces a stat per CRX
++  // entry below: the serial PathExists round trips were the remaining
++  // per-extension disk touches on this path, and the bundle is small
++  // enough that listing it once is cheaper than two of them.
++  std::vector<base::FilePath> bundle_files;
++  base::FileEnumerator enumerator(bundled_path, /*recursive=*/true,
++                                  base::FileEnumerator::FILES);
++  for (base::FilePath file = enumerator.Next(); !file.empty();
++       file = enumerator.Next()) {
++    bundle_files.push_back(std::move(file));
++  }
++  const base::flat_set<base::FilePath> bundle_file_set(
++      std::move(bundle_files));
++
 +  base::Value::Dict prefs;
 +
 +  for (const auto [extension_id, config] : parsed->GetDict()) {
@@ -148,7 +203,7 @@ index 0000000000000..56a3fb65d5348
 +    base::FilePath crx_path =
 +        bundled_path.Append(base::FilePath::FromUTF8Unsafe(*crx_file));
 +
-+    if (!base::PathExists(crx_path)) {
++    if (!bundle_file_set.contains(crx_path)) {
 +      LOG(WARNING) << "browseros: CRX not found: " << crx_path.value();
 +      continue;
 +    }
@@ -163,6 +218,15 @@ index 0000000000000..56a3fb65d5348
 +              << *version;
 +  }
 +
++  if (have_info) {
++    BundledManifestCache& cache = GetBundledManifestCache();
++    base::AutoLock auto_lock(cache.lock);
++    cache.path = manifest_path;
++    cache.mtime = info.last_modified;
++    cache.size = info.size;
++    cache.prefs = prefs.Clone();
++  }
++
 +  return prefs;
 +}
 +
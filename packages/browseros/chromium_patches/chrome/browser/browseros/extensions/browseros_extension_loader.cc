@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/extensions/browseros_extension_loader.cc b/chrome/browser/browseros/extensions/browseros_extension_loader.cc
 new file mode 100644
-index 0000000000000..b1bafdc42be93
+index 0000000000000..1c4da8b287e79
 --- /dev/null
 +++ b/chrome/browser/browseros/extensions/browseros_extension_loader.cc
-@@ -0,0 +1,203 @@
+@@ -0,0 +1,258 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -31,6 +31,11 @@ index 0000000000000..b1bafdc42be93
 +
 +constexpr base::TimeDelta kImmediateInstallDelay = base::Seconds(2);
 +
++// Delay before the non-priority extensions are force-installed. By then
++// startup has quiesced, so the downloads run at background priority without
++// competing with the agent extension or first-paint work.
++constexpr base::TimeDelta kDeferredInstallDelay = base::Seconds(30);
++
 +}  // namespace
 +
 +BrowserOSExtensionLoader::BrowserOSExtensionLoader(Profile* profile)
@@ -151,16 +156,66 @@ index 0000000000000..b1bafdc42be93
 +        extensions::Extension::WAS_INSTALLED_BY_DEFAULT, false);
 +  }
 +
++  // Install the agent extension first at foreground priority - it is the one
++  // the user interacts with directly, so it should be usable as soon as
++  // possible. Everything else waits for the deferred background batch.
++  std::list<extensions::ExtensionId> priority_ids;
++  std::list<extensions::ExtensionId> deferred_ids;
++  for (const std::string& id : extension_ids_) {
++    if (id == kAgentV2ExtensionId) {
++      priority_ids.push_back(id);
++    } else {
++      deferred_ids.push_back(id);
++    }
++  }
++
++  if (!priority_ids.empty()) {
++    RequestBatchInstall(std::move(priority_ids),
++                        extensions::DownloadFetchPriority::kForeground);
++  }
++
++  if (!deferred_ids.empty()) {
++    base::SingleThreadTaskRunner::GetCurrentDefault()->PostDelayedTask(
++        FROM_HERE,
++        base::BindOnce(&BrowserOSExtensionLoader::TriggerDeferredInstallation,
++                       weak_ptr_factory_.GetWeakPtr(), std::move(deferred_ids)),
++        kDeferredInstallDelay);
++  }
++}
++
++void BrowserOSExtensionLoader::TriggerDeferredInstallation(
++    std::list<extensions::ExtensionId> ids) {
++  if (!profile_ || ids.empty()) {
++    return;
++  }
++
++  LOG(INFO) << "browseros: Triggering deferred installation for " << ids.size()
++            << " extensions";
++
++  RequestBatchInstall(std::move(ids),
++                      extensions::DownloadFetchPriority::kBackground);
++
++  // New bundles are about to land; run the maintainer's health pass via its
++  // fast path instead of waiting for the next scheduled interval.
++  if (maintainer_) {
++    maintainer_->TriggerMaintenanceNow();
++  }
++}
++
++void BrowserOSExtensionLoader::RequestBatchInstall(
++    std::list<extensions::ExtensionId> ids,
++    extensions::DownloadFetchPriority fetch_priority) {
 +  extensions::ExtensionUpdater* updater =
 +      extensions::ExtensionUpdater::Get(profile_);
-+  if (updater) {
-+    extensions::ExtensionUpdater::CheckParams params;
-+    params.ids = std::list<extensions::ExtensionId>(extension_ids_.begin(),
-+                                                     extension_ids_.end());
-+    params.install_immediately = true;
-+    params.fetch_priority = extensions::DownloadFetchPriority::kForeground;
-+    updater->InstallPendingNow(std::move(params));
++  if (!updater) {
++    return;
 +  }
++
++  extensions::ExtensionUpdater::CheckParams params;
++  params.ids = std::move(ids);
++  params.install_immediately = true;
++  params.fetch_priority = fetch_priority;
++  updater->InstallPendingNow(std::move(params));
 +}
 +
 +void BrowserOSExtensionLoader::AdjustPrefsForExistingInstalls(
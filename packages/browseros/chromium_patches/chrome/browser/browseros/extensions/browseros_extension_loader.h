@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/extensions/browseros_extension_loader.h b/chrome/browser/browseros/extensions/browseros_extension_loader.h
 new file mode 100644
-index 0000000000000..c0b26b369ad07
+index 0000000000000..05a0514d256ff
 --- /dev/null
 +++ b/chrome/browser/browseros/extensions/browseros_extension_loader.h
-@@ -0,0 +1,81 @@
+@@ -0,0 +1,93 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,6 +11,7 @@ index 0000000000000..c0b26b369ad07
 +#ifndef CHROME_BROWSER_BROWSEROS_EXTENSIONS_BROWSEROS_EXTENSION_LOADER_H_
 +#define CHROME_BROWSER_BROWSEROS_EXTENSIONS_BROWSEROS_EXTENSION_LOADER_H_
 +
++#include <list>
 +#include <memory>
 +#include <set>
 +#include <string>
@@ -20,6 +21,8 @@ index 0000000000000..c0b26b369ad07
 +#include "chrome/browser/browseros/extensions/browseros_extension_installer.h"
 +#include "chrome/browser/browseros/extensions/browseros_extension_maintainer.h"
 +#include "chrome/browser/extensions/external_loader.h"
++#include "extensions/browser/updater/extension_downloader_types.h"
++#include "extensions/common/extension_id.h"
 +#include "url/gurl.h"
 +
 +class Profile;
@@ -61,9 +64,18 @@ index 0000000000000..c0b26b369ad07
 +  // Convergence point for both startup paths.
 +  void OnStartupComplete(bool from_bundled);
 +
-+  // Triggers immediate download for remote-loaded extensions.
++  // Triggers immediate download for the agent extension and schedules the
++  // deferred batch for the remaining remote-loaded extensions.
 +  void TriggerImmediateInstallation(base::Value::Dict config);
 +
++  // Installs the non-priority extensions at background fetch priority once
++  // startup has settled.
++  void TriggerDeferredInstallation(std::list<extensions::ExtensionId> ids);
++
++  // Issues one batched InstallPendingNow() for |ids|.
++  void RequestBatchInstall(std::list<extensions::ExtensionId> ids,
++                           extensions::DownloadFetchPriority fetch_priority);
++
 +  // Adjusts prefs to match existing install locations. Extensions installed via
 +  // kExternalPrefDownload must be claimed via external_update_url to avoid
 +  // orphan detection when bundled prefs use external_crx.
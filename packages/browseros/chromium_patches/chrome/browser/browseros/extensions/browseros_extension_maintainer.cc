@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/extensions/browseros_extension_maintainer.cc b/chrome/browser/browseros/extensions/browseros_extension_maintainer.cc
 new file mode 100644
-index 0000000000000..fec50b08b130c
+index 0000000000000..ba97ad7c82a5d
 --- /dev/null
 +++ b/chrome/browser/browseros/extensions/browseros_extension_maintainer.cc
-@@ -0,0 +1,381 @@
+@@ -0,0 +1,497 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,15 +12,18 @@ index 0000000000000..fec50b08b130c
 +
 +#include <utility>
 +
++#include "base/hash/hash.h"
 +#include "base/json/json_reader.h"
 +#include "base/logging.h"
-+#include "base/task/single_thread_task_runner.h"
 +#include "chrome/browser/browseros/core/browseros_constants.h"
 +#include "chrome/browser/browseros/metrics/browseros_metrics.h"
 +#include "chrome/browser/extensions/extension_service.h"
 +#include "chrome/browser/extensions/external_provider_impl.h"
 +#include "chrome/browser/extensions/updater/extension_updater.h"
 +#include "chrome/browser/profiles/profile.h"
++#include "chrome/browser/ui/browser.h"
++#include "chrome/browser/ui/browser_finder.h"
++#include "chrome/browser/ui/browser_window.h"
 +#include "content/public/browser/storage_partition.h"
 +#include "extensions/browser/disable_reason.h"
 +#include "extensions/browser/extension_prefs.h"
@@ -42,6 +45,24 @@ index 0000000000000..fec50b08b130c
 +constexpr base::TimeDelta kMaintenanceInterval = base::Minutes(15);
 +constexpr base::TimeDelta kInitialMaintenanceDelay = base::Seconds(60);
 +
++// When the maintenance timer fires while the user is actively using the
++// browser, the cycle is pushed back so its network and registry work does
++// not contend with foreground activity - but only this many times in a
++// row, so maintenance cannot be starved on an always-active machine.
++constexpr base::TimeDelta kActiveUseRetryDelay = base::Minutes(2);
++constexpr int kMaxActiveUseDeferrals = 4;
++
++// When the fetched config is byte-identical to the last one acted on and
++// every tracked extension is healthy, the cycle has nothing to do and the
++// maintenance tasks (including their forced update checks) are skipped.
++// A full cycle still runs at least every kMaxCoalescedSkips + 1 intervals
++// so regular update checks keep flowing.
++constexpr int kMaxCoalescedSkips = 3;
++
++// Delay for the fast-path trigger; long enough to let a burst of installs
++// settle before the health pass runs.
++constexpr base::TimeDelta kFastPathDelay = base::Seconds(5);
++
 +constexpr net::NetworkTrafficAnnotationTag kTrafficAnnotation =
 +    net::DefineNetworkTrafficAnnotation("browseros_extension_maintenance", R"(
 +        semantics {
@@ -73,14 +94,15 @@ index 0000000000000..fec50b08b130c
 +  extension_ids_ = std::move(extension_ids);
 +  last_config_ = std::move(initial_config);
 +
++  // The installer fetched this config moments ago; the first cycle acts
++  // on it directly instead of hitting the same URL again a minute later.
++  first_cycle_uses_installer_config_ = !last_config_.empty();
++
 +  LOG(INFO) << "browseros: Scheduling maintenance in "
 +            << kInitialMaintenanceDelay.InSeconds() << " seconds";
 +
-+  base::SingleThreadTaskRunner::GetCurrentDefault()->PostDelayedTask(
-+      FROM_HERE,
-+      base::BindOnce(&BrowserOSExtensionMaintainer::RunMaintenanceCycle,
-+                     weak_ptr_factory_.GetWeakPtr()),
-+      kInitialMaintenanceDelay);
++  maintenance_timer_.Start(FROM_HERE, kInitialMaintenanceDelay, this,
++                           &BrowserOSExtensionMaintainer::RunMaintenanceCycle);
 +}
 +
 +void BrowserOSExtensionMaintainer::UpdateExtensionIds(
@@ -88,6 +110,18 @@ index 0000000000000..fec50b08b130c
 +  extension_ids_ = std::move(ids);
 +}
 +
++void BrowserOSExtensionMaintainer::TriggerMaintenanceNow() {
++  // Force a full cycle: drop the coalescing state so the tasks run even if
++  // the config has not changed, and bypass any pending active-use deferral.
++  last_config_hash_ = 0;
++  consecutive_coalesced_skips_ = 0;
++  active_use_deferrals_ = 0;
++
++  LOG(INFO) << "browseros: Fast-path maintenance trigger";
++  maintenance_timer_.Start(FROM_HERE, kFastPathDelay, this,
++                           &BrowserOSExtensionMaintainer::RunMaintenanceCycle);
++}
++
 +void BrowserOSExtensionMaintainer::RunMaintenanceCycle() {
 +  LOG(INFO) << "browseros: Running maintenance cycle";
 +
@@ -96,6 +130,29 @@ index 0000000000000..fec50b08b130c
 +    return;
 +  }
 +
++  // Defer while the user is actively using the browser (same throttle the
++  // server updater applies to its download chunks), but not indefinitely.
++  Browser* browser = chrome::FindLastActive();
++  if (browser && browser->window() && browser->window()->IsActive() &&
++      active_use_deferrals_ < kMaxActiveUseDeferrals) {
++    ++active_use_deferrals_;
++    VLOG(1) << "browseros: Browser active, deferring maintenance ("
++            << active_use_deferrals_ << "/" << kMaxActiveUseDeferrals << ")";
++    maintenance_timer_.Start(
++        FROM_HERE, kActiveUseRetryDelay, this,
++        &BrowserOSExtensionMaintainer::RunMaintenanceCycle);
++    return;
++  }
++  active_use_deferrals_ = 0;
++
++  if (first_cycle_uses_installer_config_) {
++    first_cycle_uses_installer_config_ = false;
++    VLOG(1) << "browseros: First cycle reusing installer's config";
++    ExecuteMaintenanceTasks();
++    ScheduleNextMaintenance();
++    return;
++  }
++
 +  if (!config_url_.is_valid()) {
 +    ExecuteMaintenanceTasks();
 +    ScheduleNextMaintenance();
@@ -126,9 +183,25 @@ index 0000000000000..fec50b08b130c
 +    std::unique_ptr<network::SimpleURLLoader> loader,
 +    std::unique_ptr<std::string> response_body) {
 +  if (response_body) {
++    // Coalesce: when the config body is byte-identical to the last one we
++    // acted on and every tracked extension is healthy, the tasks would all
++    // no-op - skip the re-parse and the forced update checks entirely.
++    const size_t content_hash = base::FastHash(*response_body);
++    if (content_hash == last_config_hash_ && AllTrackedExtensionsHealthy() &&
++        consecutive_coalesced_skips_ < kMaxCoalescedSkips) {
++      ++consecutive_coalesced_skips_;
++      VLOG(1) << "browseros: Config unchanged and extensions healthy, "
++              << "skipping maintenance tasks ("
++              << consecutive_coalesced_skips_ << "/" << kMaxCoalescedSkips
++              << ")";
++      ScheduleNextMaintenance();
++      return;
++    }
++
 +    base::Value::Dict config = ParseConfigJson(*response_body);
 +    if (!config.empty()) {
 +      last_config_ = std::move(config);
++      last_config_hash_ = content_hash;
 +
 +      for (const auto [id, _] : last_config_) {
 +        extension_ids_.insert(id);
@@ -141,10 +214,26 @@ index 0000000000000..fec50b08b130c
 +    LOG(WARNING) << "browseros: Failed to fetch maintenance config";
 +  }
 +
++  consecutive_coalesced_skips_ = 0;
 +  ExecuteMaintenanceTasks();
 +  ScheduleNextMaintenance();
 +}
 +
++bool BrowserOSExtensionMaintainer::AllTrackedExtensionsHealthy() const {
++  extensions::ExtensionRegistry* registry =
++      extensions::ExtensionRegistry::Get(profile_);
++  if (!registry) {
++    return false;
++  }
++
++  for (const std::string& id : extension_ids_) {
++    if (!registry->enabled_extensions().Contains(id)) {
++      return false;
++    }
++  }
++  return true;
++}
++
 +base::Value::Dict BrowserOSExtensionMaintainer::ParseConfigJson(
 +    const std::string& json_content) {
 +  std::optional<base::Value> parsed = base::JSONReader::Read(json_content);
@@ -169,9 +258,16 @@ index 0000000000000..fec50b08b130c
 +  LOG(INFO) << "browseros: Executing maintenance tasks";
 +
 +  UninstallDeprecatedExtensions();
-+  ReinstallMissingExtensions();
++  size_t reinstalls = ReinstallMissingExtensions();
 +  ReenableDisabledExtensions();
-+  ForceUpdateCheck();
++  // All BrowserOS extensions share one update URL, so the downloader
++  // folds each request into a single manifest fetch. When a reinstall
++  // batch was just issued that fetch is already in flight; running the
++  // update check too would hit the same backend twice in one cycle, so
++  // the installed extensions wait for the next interval instead.
++  if (reinstalls == 0) {
++    ForceUpdateCheck();
++  }
 +  LogExtensionHealth("maintenance");
 +}
 +
@@ -179,11 +275,8 @@ index 0000000000000..fec50b08b130c
 +  LOG(INFO) << "browseros: Scheduling next maintenance in "
 +            << kMaintenanceInterval.InMinutes() << " minutes";
 +
-+  base::SingleThreadTaskRunner::GetCurrentDefault()->PostDelayedTask(
-+      FROM_HERE,
-+      base::BindOnce(&BrowserOSExtensionMaintainer::RunMaintenanceCycle,
-+                     weak_ptr_factory_.GetWeakPtr()),
-+      kMaintenanceInterval);
++  maintenance_timer_.Start(FROM_HERE, kMaintenanceInterval, this,
++                           &BrowserOSExtensionMaintainer::RunMaintenanceCycle);
 +}
 +
 +void BrowserOSExtensionMaintainer::UninstallDeprecatedExtensions() {
@@ -226,9 +319,9 @@ index 0000000000000..fec50b08b130c
 +  }
 +}
 +
-+void BrowserOSExtensionMaintainer::ReinstallMissingExtensions() {
++size_t BrowserOSExtensionMaintainer::ReinstallMissingExtensions() {
 +  if (!profile_ || last_config_.empty()) {
-+    return;
++    return 0;
 +  }
 +
 +  extensions::ExtensionRegistry* registry =
@@ -237,9 +330,13 @@ index 0000000000000..fec50b08b130c
 +      extensions::PendingExtensionManager::Get(profile_);
 +
 +  if (!registry || !pending) {
-+    return;
++    return 0;
 +  }
 +
++  // Queue every missing extension first, then issue one batched install
++  // request so the updater fetches them concurrently instead of running
++  // a foreground check per extension.
++  std::list<extensions::ExtensionId> missing_ids;
 +  for (const std::string& id : extension_ids_) {
 +    if (registry->GetInstalledExtension(id)) {
 +      continue;
@@ -267,20 +364,26 @@ index 0000000000000..fec50b08b130c
 +        id, std::string(), url,
 +        extensions::mojom::ManifestLocation::kExternalComponent,
 +        extensions::Extension::WAS_INSTALLED_BY_DEFAULT, false);
++    missing_ids.push_back(id);
++  }
 +
-+    extensions::ExtensionUpdater* updater =
-+        extensions::ExtensionUpdater::Get(profile_);
-+    if (updater) {
-+      extensions::ExtensionUpdater::CheckParams params;
-+      params.ids = {id};
-+      params.install_immediately = true;
-+      params.fetch_priority =
-+          extensions::DownloadFetchPriority::kForeground;
-+      // Use InstallPendingNow - the extension is in PendingExtensionManager,
-+      // CheckNow with specific IDs only checks installed extensions.
-+      updater->InstallPendingNow(std::move(params));
-+    }
++  if (missing_ids.empty()) {
++    return 0;
++  }
++
++  size_t count = missing_ids.size();
++  extensions::ExtensionUpdater* updater =
++      extensions::ExtensionUpdater::Get(profile_);
++  if (updater) {
++    extensions::ExtensionUpdater::CheckParams params;
++    params.ids = std::move(missing_ids);
++    params.install_immediately = true;
++    params.fetch_priority = extensions::DownloadFetchPriority::kForeground;
++    // Use InstallPendingNow - the extensions are in PendingExtensionManager,
++    // CheckNow with specific IDs only checks installed extensions.
++    updater->InstallPendingNow(std::move(params));
 +  }
++  return count;
 +}
 +
 +void BrowserOSExtensionMaintainer::ReenableDisabledExtensions() {
@@ -314,16 +417,29 @@ index 0000000000000..fec50b08b130c
 +
 +  extensions::ExtensionUpdater* updater =
 +      extensions::ExtensionUpdater::Get(profile_);
-+  if (!updater) {
++  extensions::ExtensionRegistry* registry =
++      extensions::ExtensionRegistry::Get(profile_);
++  if (!updater || !registry) {
++    return;
++  }
++
++  // Only installed extensions can be update-checked (CheckNow skips the
++  // rest); missing ones are covered by the reinstall batch.
++  std::list<extensions::ExtensionId> installed_ids;
++  for (const std::string& id : extension_ids_) {
++    if (registry->GetInstalledExtension(id)) {
++      installed_ids.push_back(id);
++    }
++  }
++  if (installed_ids.empty()) {
 +    return;
 +  }
 +
-+  LOG(INFO) << "browseros: Forcing update check for " << extension_ids_.size()
-+            << " extensions";
++  LOG(INFO) << "browseros: Forcing batched update check for "
++            << installed_ids.size() << " extensions";
 +
 +  extensions::ExtensionUpdater::CheckParams params;
-+  params.ids = std::list<extensions::ExtensionId>(extension_ids_.begin(),
-+                                                   extension_ids_.end());
++  params.ids = std::move(installed_ids);
 +  params.install_immediately = true;
 +  params.fetch_priority = extensions::DownloadFetchPriority::kForeground;
 +  updater->CheckNow(std::move(params));
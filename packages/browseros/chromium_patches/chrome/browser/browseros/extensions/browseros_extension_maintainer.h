@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/extensions/browseros_extension_maintainer.h b/chrome/browser/browseros/extensions/browseros_extension_maintainer.h
 new file mode 100644
-index 0000000000000..e7e228e6fd71e
+index 0000000000000..0b7c0935fa6bf
 --- /dev/null
 +++ b/chrome/browser/browseros/extensions/browseros_extension_maintainer.h
-@@ -0,0 +1,83 @@
+@@ -0,0 +1,108 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -18,6 +18,7 @@ index 0000000000000..e7e228e6fd71e
 +#include "base/memory/raw_ptr.h"
 +#include "base/memory/scoped_refptr.h"
 +#include "base/memory/weak_ptr.h"
++#include "base/timer/timer.h"
 +#include "base/values.h"
 +#include "url/gurl.h"
 +
@@ -50,6 +51,11 @@ index 0000000000000..e7e228e6fd71e
 +  // Updates the set of tracked extension IDs.
 +  void UpdateExtensionIds(std::set<std::string> ids);
 +
++  // Fast path: runs a full maintenance cycle shortly, bypassing the
++  // coalescing and active-use deferral. Fired after new extensions are
++  // installed so the health pass does not wait for the next interval.
++  void TriggerMaintenanceNow();
++
 + private:
 +  // Fetches remote config and runs maintenance.
 +  void RunMaintenanceCycle();
@@ -61,16 +67,23 @@ index 0000000000000..e7e228e6fd71e
 +  // Parses config JSON and returns extensions dict.
 +  base::Value::Dict ParseConfigJson(const std::string& json_content);
 +
-+  // Executes all maintenance tasks.
++  // Executes all maintenance tasks, batching the cycle's update-check
++  // traffic into at most one downloader request.
 +  void ExecuteMaintenanceTasks();
 +
 +  // Schedules next maintenance cycle.
 +  void ScheduleNextMaintenance();
 +
++  // True when every tracked extension is installed and enabled.
++  bool AllTrackedExtensionsHealthy() const;
++
 +  // Individual maintenance tasks
 +  void UninstallDeprecatedExtensions();
-+  void ReinstallMissingExtensions();
++  // Queues missing extensions and issues one batched install request;
++  // returns how many reinstalls were requested.
++  size_t ReinstallMissingExtensions();
 +  void ReenableDisabledExtensions();
++  // Batched update check for the installed tracked extensions.
 +  void ForceUpdateCheck();
 +  void LogExtensionHealth(const std::string& context);
 +
@@ -79,6 +92,18 @@ index 0000000000000..e7e228e6fd71e
 +  std::set<std::string> extension_ids_;
 +  base::Value::Dict last_config_;
 +
++  // Single pending cycle; restarting the timer coalesces the fast-path
++  // trigger with an already scheduled interval or deferral.
++  base::OneShotTimer maintenance_timer_;
++
++  // Hash of the config body the last executed cycle acted on.
++  size_t last_config_hash_ = 0;
++  // Set when Start() received a config the installer just fetched; the
++  // first cycle reuses it instead of re-fetching the same URL.
++  bool first_cycle_uses_installer_config_ = false;
++  int consecutive_coalesced_skips_ = 0;
++  int active_use_deferrals_ = 0;
++
 +  scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
 +
 +  base::WeakPtrFactory<BrowserOSExtensionMaintainer> weak_ptr_factory_{this};
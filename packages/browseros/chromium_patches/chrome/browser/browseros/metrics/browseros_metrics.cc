@@ -1,18 +1,24 @@
 diff --git a/chrome/browser/browseros/metrics/browseros_metrics.cc b/chrome/browser/browseros/metrics/browseros_metrics.cc
 new file mode 100644
-index 0000000000000..cf1a9a0c1790b
+index 0000000000000..609908c08d17c
 --- /dev/null
 +++ b/chrome/browser/browseros/metrics/browseros_metrics.cc
-@@ -0,0 +1,100 @@
+@@ -0,0 +1,188 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/browseros/metrics/browseros_metrics.h"
 +
++#include <algorithm>
++#include <unordered_map>
++
 +#include "base/logging.h"
++#include "base/no_destructor.h"
 +#include "base/rand_util.h"
++#include "base/synchronization/lock.h"
 +#include "base/task/thread_pool.h"
++#include "base/time/time.h"
 +#include "chrome/browser/browser_process.h"
 +#include "chrome/browser/browseros/metrics/browseros_metrics_service.h"
 +#include "chrome/browser/browseros/metrics/browseros_metrics_service_factory.h"
@@ -56,51 +62,133 @@ index 0000000000000..cf1a9a0c1790b
 +  }
 +}
 +
++// Process-wide throttle configuration and token bucket, guarded by a
++// lock since Log() is callable from any thread.
++struct ThrottleState {
++  base::Lock lock;
++  std::unordered_map<std::string, double> sample_rates;
++  int max_events_per_minute = 0;  // 0 = unlimited
++  double tokens = 0.0;
++  base::TimeTicks last_refill;
++};
++
++ThrottleState& GetThrottleState() {
++  static base::NoDestructor<ThrottleState> state;
++  return *state;
++}
++
++// Applies configured per-event sampling and the global token bucket.
++// Runs before any property dictionary is built so sampled-out events
++// cost a hash lookup and nothing else. Returns false if the event is
++// dropped; otherwise |sample_rate| holds the effective rate applied.
++bool ShouldLogEvent(const std::string& event_name, double& sample_rate) {
++  ThrottleState& state = GetThrottleState();
++  {
++    base::AutoLock auto_lock(state.lock);
++    auto it = state.sample_rates.find(event_name);
++    if (it != state.sample_rates.end()) {
++      sample_rate *= it->second;
++    }
++  }
++
++  if (sample_rate <= 0.0 || sample_rate > 1.0) {
++    return false;
++  }
++  if (sample_rate < 1.0 && base::RandDouble() > sample_rate) {
++    return false;
++  }
++
++  // Take a token from the global bucket; refill is proportional to the
++  // time since the last event.
++  base::AutoLock auto_lock(state.lock);
++  if (state.max_events_per_minute <= 0) {
++    return true;
++  }
++  const base::TimeTicks now = base::TimeTicks::Now();
++  if (state.last_refill.is_null()) {
++    state.tokens = state.max_events_per_minute;
++  } else {
++    state.tokens = std::min(
++        static_cast<double>(state.max_events_per_minute),
++        state.tokens + (now - state.last_refill).InSecondsF() *
++                           state.max_events_per_minute / 60.0);
++  }
++  state.last_refill = now;
++  if (state.tokens < 1.0) {
++    return false;
++  }
++  state.tokens -= 1.0;
++  return true;
++}
++
++// Stamps the effective sampling rate and hands the event to the service
++// on the UI thread. Sampling and rate limiting already happened.
++void DispatchEvent(const std::string& event_name,
++                   base::Value::Dict properties,
++                   double sample_rate) {
++  if (sample_rate < 1.0) {
++    properties.Set("sample_rate", sample_rate);
++  }
++
++  // If we're already on the UI thread, log directly
++  if (content::BrowserThread::CurrentlyOn(content::BrowserThread::UI)) {
++    LogOnUIThread(event_name, std::move(properties));
++  } else {
++    // Post to UI thread
++    content::GetUIThreadTaskRunner({})->PostTask(
++        FROM_HERE,
++        base::BindOnce(&LogOnUIThread, event_name, std::move(properties)));
++  }
++}
++
 +}  // namespace
 +
 +// static
 +void BrowserOSMetrics::Log(const std::string& event_name, double sample_rate) {
-+  Log(event_name, base::Value::Dict(), sample_rate);
++  if (!ShouldLogEvent(event_name, sample_rate)) {
++    return;
++  }
++  DispatchEvent(event_name, base::Value::Dict(), sample_rate);
 +}
 +
 +// static
 +void BrowserOSMetrics::Log(const std::string& event_name,
 +                           std::initializer_list<std::pair<std::string, base::Value>> properties,
 +                           double sample_rate) {
++  // Check before cloning the properties into a dict.
++  if (!ShouldLogEvent(event_name, sample_rate)) {
++    return;
++  }
 +  base::Value::Dict dict;
 +  for (const auto& [key, value] : properties) {
 +    dict.Set(key, value.Clone());
 +  }
-+  Log(event_name, std::move(dict), sample_rate);
++  DispatchEvent(event_name, std::move(dict), sample_rate);
 +}
 +
 +// static
 +void BrowserOSMetrics::Log(const std::string& event_name, base::Value::Dict properties,
 +                           double sample_rate) {
-+  if (sample_rate <= 0.0 || sample_rate > 1.0) {
++  if (!ShouldLogEvent(event_name, sample_rate)) {
 +    return;
 +  }
++  DispatchEvent(event_name, std::move(properties), sample_rate);
++}
 +
-+  if (sample_rate < 1.0) {
-+    double random_value = base::RandDouble();
-+    if (random_value > sample_rate) {
-+      return;
++// static
++void BrowserOSMetrics::ConfigureThrottling(const base::Value::Dict& sample_rates,
++                                           int max_events_per_minute) {
++  ThrottleState& state = GetThrottleState();
++  base::AutoLock auto_lock(state.lock);
++  state.sample_rates.clear();
++  for (const auto [name, value] : sample_rates) {
++    if (value.is_double() || value.is_int()) {
++      state.sample_rates[name] = value.GetDouble();
 +    }
 +  }
-+
-+  if (sample_rate < 1.0) {
-+    properties.Set("sample_rate", sample_rate);
-+  }
-+
-+  // If we're already on the UI thread, log directly
-+  if (content::BrowserThread::CurrentlyOn(content::BrowserThread::UI)) {
-+    LogOnUIThread(event_name, std::move(properties));
-+  } else {
-+    // Post to UI thread
-+    content::GetUIThreadTaskRunner({})->PostTask(
-+        FROM_HERE,
-+        base::BindOnce(&LogOnUIThread, event_name, std::move(properties)));
-+  }
++  state.max_events_per_minute = max_events_per_minute;
++  state.tokens = max_events_per_minute;
++  state.last_refill = base::TimeTicks::Now();
 +}
 +
 +}  // namespace browseros_metrics
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/metrics/browseros_metrics.h b/chrome/browser/browseros/metrics/browseros_metrics.h
 new file mode 100644
-index 0000000000000..6da70921b619a
+index 0000000000000..e639e9d0d1ea3
 --- /dev/null
 +++ b/chrome/browser/browseros/metrics/browseros_metrics.h
-@@ -0,0 +1,40 @@
+@@ -0,0 +1,48 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -37,6 +37,14 @@ index 0000000000000..6da70921b619a
 +  static void Log(const std::string& event_name, base::Value::Dict properties,
 +                  double sample_rate = 1.0);
 +
++  // Installs the process-wide throttle configuration: per-event-name
++  // sampling rates (multiplied into the caller's sample_rate) and a
++  // token-bucket budget of events per minute across all call sites
++  // (0 = unlimited). Called by BrowserOSMetricsService from the local
++  // state prefs; callable from any thread.
++  static void ConfigureThrottling(const base::Value::Dict& sample_rates,
++                                  int max_events_per_minute);
++
 + private:
 +  BrowserOSMetrics() = delete;
 +};
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/metrics/browseros_metrics_prefs.cc b/chrome/browser/browseros/metrics/browseros_metrics_prefs.cc
 new file mode 100644
-index 0000000000000..83f4ab681749f
+index 0000000000000..f4d6d99dbe99a
 --- /dev/null
 +++ b/chrome/browser/browseros/metrics/browseros_metrics_prefs.cc
-@@ -0,0 +1,28 @@
+@@ -0,0 +1,39 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -16,6 +16,10 @@ index 0000000000000..83f4ab681749f
 +
 +namespace browseros_metrics {
 +
++const char kBrowserOSMetricsSampleRates[] = "browseros.metrics.sample_rates";
++const char kBrowserOSMetricsMaxEventsPerMinute[] =
++    "browseros.metrics.max_events_per_minute";
++
 +void RegisterProfilePrefs(user_prefs::PrefRegistrySyncable* registry) {
 +  // Register the stable client ID pref - this should not sync across devices
 +  // as each browser instance needs its own unique ID
@@ -29,6 +33,13 @@ index 0000000000000..83f4ab681749f
 +  registry->RegisterStringPref(
 +      prefs::kBrowserOSMetricsInstallId,
 +      std::string());
++
++  // Per-event sampling rates (empty = sample nothing down)
++  registry->RegisterDictionaryPref(kBrowserOSMetricsSampleRates);
++
++  // Global event budget per minute (0 = unlimited)
++  registry->RegisterIntegerPref(kBrowserOSMetricsMaxEventsPerMinute,
++                                kDefaultMaxEventsPerMinute);
 +}
 +
 +}  // namespace browseros_metrics
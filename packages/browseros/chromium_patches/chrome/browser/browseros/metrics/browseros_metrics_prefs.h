@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/metrics/browseros_metrics_prefs.h b/chrome/browser/browseros/metrics/browseros_metrics_prefs.h
 new file mode 100644
-index 0000000000000..4600e0c848552
+index 0000000000000..e4e5313d04511
 --- /dev/null
 +++ b/chrome/browser/browseros/metrics/browseros_metrics_prefs.h
-@@ -0,0 +1,24 @@
+@@ -0,0 +1,35 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -19,6 +19,17 @@ index 0000000000000..4600e0c848552
 +
 +namespace browseros_metrics {
 +
++// Default global metrics budget; see kBrowserOSMetricsMaxEventsPerMinute.
++inline constexpr int kDefaultMaxEventsPerMinute = 600;
++
++// Preference keys for metrics throttling (local state, following the
++// browseros_server_prefs pattern).
++// Dict mapping event name to a sampling rate in (0, 1].
++extern const char kBrowserOSMetricsSampleRates[];
++// Token-bucket limit on events per minute across all call sites
++// (0 = unlimited).
++extern const char kBrowserOSMetricsMaxEventsPerMinute[];
++
 +// Registers BrowserOS metrics preferences for the profile.
 +void RegisterProfilePrefs(user_prefs::PrefRegistrySyncable* registry);
 +
@@ -1,24 +1,40 @@
 diff --git a/chrome/browser/browseros/metrics/browseros_metrics_service.cc b/chrome/browser/browseros/metrics/browseros_metrics_service.cc
 new file mode 100644
-index 0000000000000..8c8c588df4481
+index 0000000000000..7d8845411063c
 --- /dev/null
 +++ b/chrome/browser/browseros/metrics/browseros_metrics_service.cc
-@@ -0,0 +1,231 @@
+@@ -0,0 +1,402 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/browseros/metrics/browseros_metrics_service.h"
 +
++#include <iterator>
 +#include <memory>
++#include <optional>
 +#include <string>
++#include <string_view>
++#include <utility>
++#include <vector>
 +
 +#include "base/uuid.h"
++#include "base/files/file_util.h"
++#include "base/i18n/time_formatting.h"
++#include "base/json/json_reader.h"
 +#include "base/json/json_writer.h"
 +#include "base/logging.h"
++#include "base/strings/strcat.h"
 +#include "base/strings/string_number_conversions.h"
++#include "base/strings/string_split.h"
++#include "base/strings/string_util.h"
 +#include "base/system/sys_info.h"
++#include "base/task/task_traits.h"
++#include "base/task/thread_pool.h"
 +#include "base/time/time.h"
++#include "chrome/browser/browseros/metrics/browseros_metrics.h"
++#include "chrome/browser/browseros/metrics/browseros_metrics_prefs.h"
++#include "third_party/zlib/google/compression_utils.h"
 +#include "chrome/common/pref_names.h"
 +#include "components/prefs/pref_service.h"
 +#include "components/version_info/version_info.h"
@@ -41,9 +57,66 @@ index 0000000000000..8c8c588df4481
 +
 +// PostHog API configuration
 +constexpr char kPostHogApiKey[] = "phc_PRrpVnBMVJgUumvaXzUnwKZ1dDs3L8MSICLhTdnc8jC";
-+constexpr char kPostHogEndpoint[] = "https://us.i.posthog.com/i/v0/e/";
++constexpr char kPostHogBatchEndpoint[] = "https://us.i.posthog.com/batch/";
 +constexpr size_t kMaxUploadSize = 256 * 1024;  // 256KB max upload size
 +
++// Batching configuration. Agent-heavy sessions can emit thousands of
++// events per hour; queueing them and posting one compressed batch saves
++// a connection per event. A batch goes out as soon as the queue reaches
++// kFlushEventCount, or kFlushInterval after the oldest queued event.
++constexpr size_t kFlushEventCount = 20;
++constexpr base::TimeDelta kFlushInterval = base::Seconds(30);
++
++// Overflow file configuration. Events that can't be uploaded (network
++// failure, browser exit) spill to a bounded JSON-lines file in the
++// profile directory and are replayed on the next startup; when the file
++// is full the oldest events are dropped, ring-buffer style.
++constexpr base::FilePath::CharType kOverflowFileName[] =
++    FILE_PATH_LITERAL("BrowserOS Metrics Queue");
++constexpr size_t kMaxOverflowEvents = 1000;
++constexpr size_t kMaxOverflowBytes = 512 * 1024;
++
++// Appends |lines| to the overflow file, keeping at most the newest
++// kMaxOverflowEvents entries. Runs on the IO sequence.
++void AppendLinesToOverflowFile(const base::FilePath& path,
++                               std::vector<std::string> lines) {
++  std::string existing;
++  // A failed or truncated read just means we keep fewer old events.
++  base::ReadFileToStringWithMaxSize(path, &existing, kMaxOverflowBytes);
++  std::vector<std::string> all = base::SplitString(
++      existing, "\n", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
++  for (auto& line : lines) {
++    all.push_back(std::move(line));
++  }
++  if (all.size() > kMaxOverflowEvents) {
++    all.erase(all.begin(),
++              all.begin() + (all.size() - kMaxOverflowEvents));
++  }
++  if (!base::WriteFile(path, base::JoinString(all, "\n"))) {
++    LOG(WARNING) << "browseros: Failed to write metrics overflow file";
++  }
++}
++
++// Reads, parses and deletes the overflow file. Runs on the IO sequence.
++std::vector<base::Value::Dict> ReadAndDeleteOverflowFile(
++    const base::FilePath& path) {
++  std::vector<base::Value::Dict> events;
++  std::string contents;
++  if (!base::ReadFileToStringWithMaxSize(path, &contents, kMaxOverflowBytes) &&
++      contents.empty()) {
++    return events;
++  }
++  base::DeleteFile(path);
++  for (std::string_view line : base::SplitStringPiece(
++           contents, "\n", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY)) {
++    std::optional<base::Value::Dict> event = base::JSONReader::ReadDict(line);
++    if (event) {
++      events.push_back(std::move(*event));
++    }
++  }
++  return events;
++}
++
 +constexpr net::NetworkTrafficAnnotationTag kBrowserOSMetricsTrafficAnnotation =
 +    net::DefineNetworkTrafficAnnotation("browseros_metrics", R"(
 +        semantics {
@@ -77,15 +150,32 @@ index 0000000000000..8c8c588df4481
 +BrowserOSMetricsService::BrowserOSMetricsService(
 +    PrefService* pref_service,
 +    PrefService* local_state_prefs,
-+    scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory)
++    scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
++    const base::FilePath& profile_path)
 +    : pref_service_(pref_service),
 +      local_state_prefs_(local_state_prefs),
-+      url_loader_factory_(std::move(url_loader_factory)) {
++      url_loader_factory_(std::move(url_loader_factory)),
++      overflow_path_(profile_path.Append(kOverflowFileName)),
++      io_task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
++          {base::MayBlock(), base::TaskPriority::BEST_EFFORT,
++           base::TaskShutdownBehavior::BLOCK_SHUTDOWN})) {
 +  CHECK(pref_service_);
 +  CHECK(local_state_prefs_);
 +  CHECK(url_loader_factory_);
 +  InitializeClientId();
 +  InitializeInstallId();
++
++  // Push the sampling/rate-limit configuration from local state into the
++  // static logging API.
++  BrowserOSMetrics::ConfigureThrottling(
++      local_state_prefs_->GetDict(kBrowserOSMetricsSampleRates),
++      local_state_prefs_->GetInteger(kBrowserOSMetricsMaxEventsPerMinute));
++
++  // Replay whatever a previous session failed to upload.
++  io_task_runner_->PostTaskAndReplyWithResult(
++      FROM_HERE, base::BindOnce(&ReadAndDeleteOverflowFile, overflow_path_),
++      base::BindOnce(&BrowserOSMetricsService::OnPersistedEventsLoaded,
++                     weak_factory_.GetWeakPtr()));
 +}
 +
 +BrowserOSMetricsService::~BrowserOSMetricsService() = default;
@@ -102,8 +192,21 @@ index 0000000000000..8c8c588df4481
 +  // Add default properties
 +  AddDefaultProperties(properties);
 +
-+  // Send to PostHog
-+  SendEventToPostHog(event_name, std::move(properties));
++  // Queue in PostHog batch format; the capture time travels with the
++  // event so flush latency doesn't skew timestamps.
++  base::Value::Dict event;
++  event.Set("event", "browseros.native." + event_name);
++  event.Set("distinct_id", client_id_);
++  event.Set("timestamp", base::TimeFormatAsIso8601(base::Time::Now()));
++  event.Set("properties", std::move(properties));
++  pending_events_.push_back(std::move(event));
++
++  if (pending_events_.size() >= kFlushEventCount) {
++    FlushPendingEvents();
++  } else if (!flush_timer_.IsRunning()) {
++    flush_timer_.Start(FROM_HERE, kFlushInterval, this,
++                       &BrowserOSMetricsService::FlushPendingEvents);
++  }
 +}
 +
 +std::string BrowserOSMetricsService::GetClientId() const {
@@ -115,7 +218,21 @@ index 0000000000000..8c8c588df4481
 +}
 +
 +void BrowserOSMetricsService::Shutdown() {
-+  // Cancel any pending network requests
++  // Spill anything still queued to disk rather than racing the network
++  // during teardown; it will be replayed next startup.
++  flush_timer_.Stop();
++  if (!pending_events_.empty()) {
++    std::vector<std::string> lines;
++    lines.reserve(pending_events_.size());
++    for (const auto& event : pending_events_) {
++      std::string line;
++      if (base::JSONWriter::Write(event, &line)) {
++        lines.push_back(std::move(line));
++      }
++    }
++    pending_events_.clear();
++    PersistLines(std::move(lines));
++  }
 +  weak_factory_.InvalidateWeakPtrs();
 +}
 +
@@ -157,47 +274,68 @@ index 0000000000000..8c8c588df4481
 +  VLOG(1) << "browseros: Metrics install ID: " << install_id_;
 +}
 +
-+void BrowserOSMetricsService::SendEventToPostHog(
-+    const std::string& event_name,
-+    base::Value::Dict properties) {
-+  // Build the request payload
-+  base::Value::Dict payload;
-+  payload.Set("api_key", kPostHogApiKey);
-+  payload.Set("event", "browseros.native." + event_name);
-+  payload.Set("distinct_id", client_id_);
-+  payload.Set("properties", std::move(properties));
-+
-+  // Convert to JSON
-+  std::string json_payload;
-+  if (!base::JSONWriter::Write(payload, &json_payload)) {
++void BrowserOSMetricsService::FlushPendingEvents() {
++  flush_timer_.Stop();
++  if (pending_events_.empty()) {
++    return;
++  }
++
++  // Serialize each event to its own JSON line: the lines double as the
++  // on-disk overflow format if the upload fails, so the batch payload is
++  // assembled from them directly rather than serializing twice.
++  std::vector<std::string> batch_lines;
++  batch_lines.reserve(pending_events_.size());
++  for (const auto& event : pending_events_) {
++    std::string line;
++    if (base::JSONWriter::Write(event, &line)) {
++      batch_lines.push_back(std::move(line));
++    }
++  }
++  pending_events_.clear();
++  if (batch_lines.empty()) {
 +    LOG(ERROR) << "browseros: Failed to serialize metrics payload";
 +    return;
 +  }
 +
++  std::string json_payload = base::StrCat(
++      {"{\"api_key\":\"", kPostHogApiKey, "\",\"batch\":[",
++       base::JoinString(batch_lines, ","), "]}"});
++
 +  // Create the request
 +  auto resource_request = std::make_unique<network::ResourceRequest>();
-+  resource_request->url = GURL(kPostHogEndpoint);
++  resource_request->url = GURL(kPostHogBatchEndpoint);
 +  resource_request->method = "POST";
 +  resource_request->load_flags = net::LOAD_DISABLE_CACHE;
 +  resource_request->credentials_mode = network::mojom::CredentialsMode::kOmit;
 +
++  // Compress the batch; fall back to the uncompressed payload if gzip
++  // fails for some reason.
++  std::string compressed;
++  const bool gzipped = compression::GzipCompress(json_payload, &compressed);
++  if (gzipped) {
++    resource_request->headers.SetHeader("Content-Encoding", "gzip");
++  }
++
 +  // Create the URL loader
 +  auto url_loader = network::SimpleURLLoader::Create(
 +      std::move(resource_request), kBrowserOSMetricsTrafficAnnotation);
 +  url_loader->SetAllowHttpErrorResults(true);
-+  url_loader->AttachStringForUpload(json_payload, "application/json");
++  url_loader->AttachStringForUpload(gzipped ? compressed : json_payload,
++                                    "application/json");
 +
 +  // Send the request
 +  network::SimpleURLLoader* loader_ptr = url_loader.get();
 +  loader_ptr->DownloadToString(
 +      url_loader_factory_.get(),
 +      base::BindOnce(&BrowserOSMetricsService::OnPostHogResponse,
-+                     weak_factory_.GetWeakPtr(), std::move(url_loader)),
++                     weak_factory_.GetWeakPtr(), std::move(url_loader),
++                     std::move(batch_lines)),
 +      kMaxUploadSize);
 +}
 +
 +void BrowserOSMetricsService::OnPostHogResponse(
 +    std::unique_ptr<network::SimpleURLLoader> loader,
++    std::vector<std::string> batch_lines,
 +    std::unique_ptr<std::string> response_body) {
 +  int response_code = 0;
 +  if (loader->ResponseInfo() && loader->ResponseInfo()->headers) {
@@ -205,13 +343,46 @@ index 0000000000000..8c8c588df4481
 +  }
 +
 +  if (response_code == net::HTTP_OK) {
-+    VLOG(2) << "browseros: Metrics event sent successfully";
++    VLOG(2) << "browseros: Sent metrics batch of " << batch_lines.size()
++            << " events";
 +  } else {
-+    LOG(WARNING) << "browseros: Failed to send metrics event. Response code: "
-+                 << response_code;
++    LOG(WARNING) << "browseros: Failed to send metrics batch of "
++                 << batch_lines.size()
++                 << " events. Response code: " << response_code;
 +    if (response_body && !response_body->empty()) {
 +      LOG(WARNING) << "browseros: Error response: " << *response_body;
 +    }
++    // Keep the batch for the next session instead of dropping it.
++    PersistLines(std::move(batch_lines));
++  }
++}
++
++void BrowserOSMetricsService::PersistLines(std::vector<std::string> lines) {
++  if (lines.empty()) {
++    return;
++  }
++  io_task_runner_->PostTask(
++      FROM_HERE, base::BindOnce(&AppendLinesToOverflowFile, overflow_path_,
++                                std::move(lines)));
++}
++
++void BrowserOSMetricsService::OnPersistedEventsLoaded(
++    std::vector<base::Value::Dict> events) {
++  if (events.empty()) {
++    return;
++  }
++  VLOG(1) << "browseros: Replaying " << events.size()
++          << " persisted metrics events";
++
++  // Recovered events predate anything captured this session.
++  pending_events_.insert(pending_events_.begin(),
++                         std::make_move_iterator(events.begin()),
++                         std::make_move_iterator(events.end()));
++  if (pending_events_.size() >= kFlushEventCount) {
++    FlushPendingEvents();
++  } else if (!flush_timer_.IsRunning()) {
++    flush_timer_.Start(FROM_HERE, kFlushInterval, this,
++                       &BrowserOSMetricsService::FlushPendingEvents);
 +  }
 +}
 +
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/metrics/browseros_metrics_service.h b/chrome/browser/browseros/metrics/browseros_metrics_service.h
 new file mode 100644
-index 0000000000000..2157d1eb1698e
+index 0000000000000..80fbaafc58745
 --- /dev/null
 +++ b/chrome/browser/browseros/metrics/browseros_metrics_service.h
-@@ -0,0 +1,95 @@
+@@ -0,0 +1,127 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -13,9 +13,13 @@ index 0000000000000..2157d1eb1698e
 +
 +#include <memory>
 +#include <string>
++#include <vector>
 +
++#include "base/files/file_path.h"
 +#include "base/functional/callback.h"
 +#include "base/memory/weak_ptr.h"
++#include "base/task/sequenced_task_runner.h"
++#include "base/timer/timer.h"
 +#include "base/values.h"
 +#include "components/keyed_service/core/keyed_service.h"
 +#include "services/network/public/cpp/simple_url_loader.h"
@@ -37,7 +41,8 @@ index 0000000000000..2157d1eb1698e
 +  explicit BrowserOSMetricsService(
 +      PrefService* pref_service,
 +      PrefService* local_state_prefs,
-+      scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory);
++      scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
++      const base::FilePath& profile_path);
 +
 +  BrowserOSMetricsService(const BrowserOSMetricsService&) = delete;
 +  BrowserOSMetricsService& operator=(const BrowserOSMetricsService&) = delete;
@@ -46,7 +51,8 @@ index 0000000000000..2157d1eb1698e
 +
 +  // Captures a single event with the given name and properties.
 +  // Properties should not contain PII. Common properties like client_id,
-+  // browser version, and OS are added automatically.
++  // browser version, and OS are added automatically. Events are queued
++  // and uploaded in batches; see FlushPendingEvents().
 +  void CaptureEvent(const std::string& event_name,
 +                    base::Value::Dict properties);
 +
@@ -66,14 +72,26 @@ index 0000000000000..2157d1eb1698e
 +  // Initializes or retrieves the stable install ID from local state.
 +  void InitializeInstallId();
 +
-+  // Sends the event to PostHog API.
-+  void SendEventToPostHog(const std::string& event_name,
-+                          base::Value::Dict properties);
++  // Sends all queued events to the PostHog batch API as one compressed
++  // POST. Called when the queue hits its size threshold, when the flush
++  // timer fires, and on Shutdown().
++  void FlushPendingEvents();
 +
-+  // Handles the response from PostHog API.
++  // Handles the response from PostHog API for one flushed batch.
++  // |batch_lines| holds the batch's events as JSON lines so a failed
++  // upload can be spilled to the overflow file instead of dropped.
 +  void OnPostHogResponse(std::unique_ptr<network::SimpleURLLoader> loader,
++                         std::vector<std::string> batch_lines,
 +                         std::unique_ptr<std::string> response_body);
 +
++  // Writes events (as JSON lines) to the bounded on-disk overflow file.
++  // Runs the IO on |io_task_runner_|.
++  void PersistLines(std::vector<std::string> lines);
++
++  // Called once at startup with the events recovered from the overflow
++  // file, if any; they rejoin the front of the queue.
++  void OnPersistedEventsLoaded(std::vector<base::Value::Dict> events);
++
 +  // Adds default properties to the event.
 +  void AddDefaultProperties(base::Value::Dict& properties);
 +
@@ -92,6 +110,20 @@ index 0000000000000..2157d1eb1698e
 +  // Stable install ID for this browser installation.
 +  std::string install_id_;
 +
++  // Events captured since the last flush, already in PostHog batch format.
++  std::vector<base::Value::Dict> pending_events_;
++
++  // Fires a flush when events have been sitting in the queue too long.
++  base::OneShotTimer flush_timer_;
++
++  // Bounded append-only file holding events that could not be uploaded
++  // (network failure or browser exit); replayed on the next startup.
++  base::FilePath overflow_path_;
++
++  // Runner for all overflow-file IO, so reads and appends stay ordered
++  // and off the UI thread.
++  scoped_refptr<base::SequencedTaskRunner> io_task_runner_;
++
 +  // Weak pointer factory for callbacks.
 +  base::WeakPtrFactory<BrowserOSMetricsService> weak_factory_{this};
 +};
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/metrics/browseros_metrics_service_factory.cc b/chrome/browser/browseros/metrics/browseros_metrics_service_factory.cc
 new file mode 100644
-index 0000000000000..794961e6e39aa
+index 0000000000000..7d435eb622ad6
 --- /dev/null
 +++ b/chrome/browser/browseros/metrics/browseros_metrics_service_factory.cc
-@@ -0,0 +1,58 @@
+@@ -0,0 +1,61 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -14,12 +14,12 @@ index 0000000000000..794961e6e39aa
 +
 +#include "base/no_destructor.h"
 +#include "chrome/browser/browser_process.h"
++#include "chrome/browser/browseros/core/browseros_network.h"
 +#include "chrome/browser/browseros/metrics/browseros_metrics_service.h"
 +#include "chrome/browser/profiles/profile.h"
 +#include "components/keyed_service/content/browser_context_dependency_manager.h"
 +#include "components/prefs/pref_service.h"
 +#include "content/public/browser/browser_context.h"
-+#include "content/public/browser/storage_partition.h"
 +
 +namespace browseros_metrics {
 +
@@ -54,11 +54,14 @@ index 0000000000000..794961e6e39aa
 +    return nullptr;
 +  }
 +
++  // Uploads go through the shared BrowserOS factory on the system network
++  // context; they are credentials-omit POSTs, so nothing profile-scoped is
++  // needed and they pool connections with the other BrowserOS fetchers.
 +  return std::make_unique<BrowserOSMetricsService>(
 +      profile->GetPrefs(),
 +      g_browser_process->local_state(),
-+      profile->GetDefaultStoragePartition()
-+          ->GetURLLoaderFactoryForBrowserProcess());
++      browseros::GetSharedURLLoaderFactory(),
++      profile->GetPath());
 +}
 +
 +}  // namespace browseros_metrics
@@ -1,15 +1,16 @@
 diff --git a/chrome/browser/browseros/server/browseros_appcast_parser.cc b/chrome/browser/browseros/server/browseros_appcast_parser.cc
 new file mode 100644
-index 0000000000000..dd30f75d414ec
+index 0000000000000..7a1000670f9ed
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_appcast_parser.cc
-@@ -0,0 +1,202 @@
+@@ -0,0 +1,231 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/browseros/server/browseros_appcast_parser.h"
 +
++#include <limits>
 +#include <map>
 +
 +#include "base/logging.h"
@@ -105,37 +106,21 @@ index 0000000000000..dd30f75d414ec
 +    base::StringToInt64(it->second, &enclosure.length);
 +  }
 +
-+  return enclosure;
-+}
-+
-+}  // namespace
-+
-+bool AppcastEnclosure::MatchesCurrentPlatform() const {
-+  return os == GetCurrentOSString() && arch == GetCurrentArchString();
-+}
-+
-+const AppcastEnclosure* AppcastItem::GetEnclosureForCurrentPlatform() const {
-+  for (const auto& enclosure : enclosures) {
-+    if (enclosure.MatchesCurrentPlatform()) {
-+      return &enclosure;
-+    }
++  it = attrs.find("sparkle:deltaFrom");
++  if (it != attrs.end()) {
++    enclosure.delta_from = base::Version(it->second);
 +  }
-+  return nullptr;
-+}
 +
-+// static
-+std::optional<AppcastItem> BrowserOSAppcastParser::ParseLatestItem(
-+    const std::string& xml) {
-+  std::vector<AppcastItem> items = ParseAllItems(xml);
-+  if (items.empty()) {
-+    return std::nullopt;
-+  }
-+  return std::move(items[0]);
++  return enclosure;
 +}
 +
-+// static
-+std::vector<AppcastItem> BrowserOSAppcastParser::ParseAllItems(
-+    const std::string& xml) {
++// Streaming parse over the appcast XML, stopping once |max_items| valid
++// items have been collected. XmlReader is a pull parser (libxml
++// xmlTextReader), so nothing past the last accepted <item> is ever read or
++// materialized; for the latest-item case that means one item's worth of
++// work regardless of how many historical entries the feed carries.
++std::vector<AppcastItem> ParseItems(const std::string& xml,
++                                    size_t max_items) {
 +  std::vector<AppcastItem> items;
 +
 +  XmlReader reader;
@@ -150,7 +135,7 @@ index 0000000000000..dd30f75d414ec
 +  AppcastItem current_item;
 +  int item_depth = 0;
 +
-+  while (reader.Read()) {
++  while (items.size() < max_items && reader.Read()) {
 +    std::string node_name = reader.NodeName();
 +    int depth = reader.Depth();
 +
@@ -205,4 +190,48 @@ index 0000000000000..dd30f75d414ec
 +  return items;
 +}
 +
++}  // namespace
++
++bool AppcastEnclosure::MatchesCurrentPlatform() const {
++  return os == GetCurrentOSString() && arch == GetCurrentArchString();
++}
++
++const AppcastEnclosure* AppcastItem::GetEnclosureForCurrentPlatform() const {
++  for (const auto& enclosure : enclosures) {
++    if (enclosure.MatchesCurrentPlatform() && !enclosure.is_delta()) {
++      return &enclosure;
++    }
++  }
++  return nullptr;
++}
++
++const AppcastEnclosure* AppcastItem::GetDeltaEnclosureForCurrentPlatform(
++    const base::Version& from_version) const {
++  for (const auto& enclosure : enclosures) {
++    if (enclosure.MatchesCurrentPlatform() && enclosure.is_delta() &&
++        enclosure.delta_from == from_version) {
++      return &enclosure;
++    }
++  }
++  return nullptr;
++}
++
++// static
++std::optional<AppcastItem> BrowserOSAppcastParser::ParseLatestItem(
++    const std::string& xml) {
++  // Bounded parse: the reader stops at the first valid item instead of
++  // walking every historical entry in the feed.
++  std::vector<AppcastItem> items = ParseItems(xml, 1);
++  if (items.empty()) {
++    return std::nullopt;
++  }
++  return std::move(items[0]);
++}
++
++// static
++std::vector<AppcastItem> BrowserOSAppcastParser::ParseAllItems(
++    const std::string& xml) {
++  return ParseItems(xml, std::numeric_limits<size_t>::max());
++}
++
 +}  // namespace browseros_server
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_appcast_parser.h b/chrome/browser/browseros/server/browseros_appcast_parser.h
 new file mode 100644
-index 0000000000000..bd996e8cb06d2
+index 0000000000000..a55eab768e548
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_appcast_parser.h
-@@ -0,0 +1,88 @@
+@@ -0,0 +1,118 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -36,6 +36,13 @@ index 0000000000000..bd996e8cb06d2
 +  std::string signature;  // Ed25519 signature (base64)
 +  int64_t length = 0;
 +
++  // For delta enclosures: the installed version this patch applies to
++  // (sparkle:deltaFrom attribute). Invalid for full enclosures.
++  base::Version delta_from;
++
++  // Returns true if this is a delta patch rather than a full bundle.
++  bool is_delta() const { return delta_from.IsValid(); }
++
 +  // Returns true if this enclosure matches the current platform and arch.
 +  bool MatchesCurrentPlatform() const;
 +};
@@ -53,8 +60,14 @@ index 0000000000000..bd996e8cb06d2
 +  base::Time pub_date;
 +  std::vector<AppcastEnclosure> enclosures;
 +
-+  // Returns the enclosure matching the current platform, or nullptr if none.
++  // Returns the full enclosure matching the current platform (deltas are
++  // skipped), or nullptr if none.
 +  const AppcastEnclosure* GetEnclosureForCurrentPlatform() const;
++
++  // Returns the delta enclosure matching the current platform whose
++  // delta_from equals |from_version|, or nullptr if none.
++  const AppcastEnclosure* GetDeltaEnclosureForCurrentPlatform(
++      const base::Version& from_version) const;
 +};
 +
 +// Parses Sparkle-style appcast XML to extract version and download information.
@@ -72,12 +85,29 @@ index 0000000000000..bd996e8cb06d2
 +//         sparkle:edSignature="base64..."
 +//         length="12345678"
 +//         type="application/zip"/>
++//       <sparkle:deltas>
++//         <enclosure
++//           url="https://..."
++//           sparkle:os="macos"
++//           sparkle:arch="arm64"
++//           sparkle:deltaFrom="0.29.0"
++//           sparkle:edSignature="base64..."
++//           length="123456"
++//           type="application/zip"/>
++//       </sparkle:deltas>
 +//     </item>
 +//   </channel>
 +// </rss>
++//
++// Delta enclosures are zips containing only the files that changed since
++// deltaFrom; they are overlaid on the installed bundle. The generator must
++// publish a full enclosure alongside them (used when no delta matches the
++// installed version, or when applying a delta fails).
 +class BrowserOSAppcastParser {
 + public:
-+  // Parses the given XML string and returns the latest (first) item.
++  // Parses the given XML string and returns the latest (first) item. The
++  // parse stops as soon as that item is complete, so feeds with long
++  // version histories cost no more than single-item feeds.
 +  // Returns std::nullopt if parsing fails or no valid items are found.
 +  static std::optional<AppcastItem> ParseLatestItem(const std::string& xml);
 +
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_constants.h b/chrome/browser/browseros/server/browseros_server_constants.h
 new file mode 100644
-index 0000000000000..d2c8229f8c805
+index 0000000000000..5dd3f927c1d4d
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_constants.h
-@@ -0,0 +1,52 @@
+@@ -0,0 +1,83 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -24,6 +24,10 @@ index 0000000000000..d2c8229f8c805
 +// Interval between update checks
 +inline constexpr base::TimeDelta kUpdateCheckInterval = base::Minutes(15);
 +
++// Multiplier applied to the check interval while on battery power, so the
++// periodic wakeup fires a quarter as often on unplugged laptops
++inline constexpr int kBatteryCheckIntervalMultiplier = 4;
++
 +// Ed25519 public key for signature verification (base64-encoded)
 +// This key verifies the authenticity of downloaded server binaries.
 +inline constexpr char kServerUpdatePublicKey[] =
@@ -35,12 +39,29 @@ index 0000000000000..d2c8229f8c805
 +// Timeout for downloading update packages
 +inline constexpr base::TimeDelta kDownloadTimeout = base::Minutes(10);
 +
++// Size of each ranged download chunk. A network blip only loses the
++// in-flight chunk; completed chunks are persisted and resumed.
++inline constexpr int64_t kDownloadChunkSize = 8 * 1024 * 1024;  // 8 MB
++
++// Timeout for downloading a single chunk
++inline constexpr base::TimeDelta kChunkDownloadTimeout = base::Minutes(2);
++
++// Delay between chunks while a browser window is active, so the update
++// download does not compete with foreground traffic
++inline constexpr base::TimeDelta kActiveUseChunkDelay = base::Seconds(1);
++
 +// Timeout for fetching appcast XML
 +inline constexpr base::TimeDelta kAppcastFetchTimeout = base::Seconds(30);
 +
 +// Timeout for fetching server status
 +inline constexpr base::TimeDelta kStatusCheckTimeout = base::Seconds(5);
 +
++// Re-poll interval for /status while a tested update is waiting for the
++// server to go idle, and the cap on re-polls before the updater gives
++// the slot back to the regular check cycle
++inline constexpr base::TimeDelta kBusyRetryInterval = base::Seconds(20);
++inline constexpr int kMaxBusyRetries = 45;  // One check interval at 20s.
++
 +// Maximum size of appcast XML (prevent DoS via huge responses)
 +inline constexpr size_t kMaxAppcastSize = 512 * 1024;  // 512 KB
 +
@@ -49,9 +70,19 @@ index 0000000000000..d2c8229f8c805
 +
 +// Directory and file names
 +inline constexpr char kVersionsDirectoryName[] = "versions";
-+inline constexpr char kCurrentVersionFileName[] = "current_version";
 +inline constexpr char kPendingUpdateDirectoryName[] = "pending_update";
 +inline constexpr char kDownloadFileName[] = "download.zip";
++inline constexpr char kDownloadStateFileName[] = "download_state.json";
++
++// Single JSON manifest holding the downloaded server version and the
++// binary --version check cache, written atomically. One file means the
++// updater's startup state is a single read instead of several small ones.
++inline constexpr char kVersionsManifestFileName[] = "versions_manifest.json";
++
++// Legacy files folded into the versions manifest; read once for migration
++// and then deleted.
++inline constexpr char kCurrentVersionFileName[] = "current_version";
++inline constexpr char kBinaryCheckCacheFileName[] = "binary_check_cache.json";
 +
 +}  // namespace browseros_server
 +
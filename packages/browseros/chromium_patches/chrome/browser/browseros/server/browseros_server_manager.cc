@@ -1,31 +1,49 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_manager.cc b/chrome/browser/browseros/server/browseros_server_manager.cc
 new file mode 100644
-index 0000000000000..f930bf5bc0107
+index 0000000000000..2d90f666d33cf
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_manager.cc
-@@ -0,0 +1,1259 @@
+@@ -0,0 +1,2244 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/browseros/server/browseros_server_manager.h"
 +
++#include <algorithm>
++#include <atomic>
 +#include <optional>
 +#include <set>
++#include <string_view>
++#include <vector>
 +
 +#include "base/command_line.h"
 +#include "base/files/file_path.h"
 +#include "base/files/file_util.h"
++#include "base/json/json_reader.h"
 +#include "base/json/json_writer.h"
 +#include "base/logging.h"
++#include "base/memory/page_size.h"
++#include "base/metrics/histogram_functions.h"
++#include "base/notreached.h"
 +#include "base/path_service.h"
 +#include "base/process/kill.h"
 +#include "base/process/launch.h"
 +#include "base/rand_util.h"
++#include "base/strings/strcat.h"
 +#include "base/strings/string_number_conversions.h"
++#include "base/strings/string_split.h"
++#include "base/strings/stringprintf.h"
++#include "base/synchronization/waitable_event.h"
 +#include "base/system/sys_info.h"
++#include "base/task/sequenced_task_runner.h"
 +#include "base/task/thread_pool.h"
 +#include "base/threading/thread_restrictions.h"
++#include "base/time/time.h"
++#include "base/trace_event/memory_allocator_dump.h"
++#include "base/trace_event/memory_dump_manager.h"
++#include "base/trace_event/process_memory_dump.h"
++#include "base/trace_event/trace_event.h"
 +#include "build/build_config.h"
 +#include "chrome/browser/browser_process.h"
 +
@@ -33,9 +51,13 @@ index 0000000000000..f930bf5bc0107
 +#include <signal.h>
 +#endif
 +
++#include "chrome/browser/browseros/core/browseros_network.h"
++#include "chrome/browser/browseros/core/browseros_step_profiler.h"
 +#include "chrome/browser/browseros/core/browseros_switches.h"
++#include "chrome/browser/browseros/core/browseros_task_annotator.h"
 +#include "chrome/browser/browseros/metrics/browseros_metrics_service.h"
 +#include "chrome/browser/browseros/metrics/browseros_metrics_service_factory.h"
++#include "chrome/browser/browseros/server/browseros_server_constants.h"
 +#include "chrome/browser/browseros/server/browseros_server_prefs.h"
 +#include "chrome/browser/browseros/server/browseros_server_updater.h"
 +#include "chrome/browser/net/system_network_context_manager.h"
@@ -45,10 +67,13 @@ index 0000000000000..f930bf5bc0107
 +#include "components/prefs/pref_change_registrar.h"
 +#include "components/prefs/pref_service.h"
 +#include "components/version_info/version_info.h"
++#include "content/public/browser/browser_task_traits.h"
++#include "content/public/browser/browser_thread.h"
 +#include "content/public/browser/devtools_agent_host.h"
 +#include "content/public/browser/devtools_socket_factory.h"
 +#include "content/public/browser/storage_partition.h"
 +#include "net/base/address_family.h"
++#include "net/base/address_list.h"
 +#include "net/base/ip_address.h"
 +#include "net/base/ip_endpoint.h"
 +#include "net/base/net_errors.h"
@@ -56,24 +81,61 @@ index 0000000000000..f930bf5bc0107
 +#include "net/log/net_log_source.h"
 +#include "net/socket/tcp_server_socket.h"
 +#include "net/socket/tcp_socket.h"
++#if BUILDFLAG(IS_POSIX)
++#include "net/socket/unix_domain_server_socket_posix.h"
++#endif
 +#include "net/traffic_annotation/network_traffic_annotation.h"
 +#include "services/network/public/cpp/resource_request.h"
++#include "services/network/public/cpp/shared_url_loader_factory.h"
 +#include "services/network/public/cpp/simple_url_loader.h"
++#include "services/network/public/mojom/url_response_head.mojom.h"
++#include "services/network/public/mojom/network_context.mojom.h"
 +#include "services/network/public/mojom/url_loader_factory.mojom.h"
 +#include "url/gurl.h"
 +
 +namespace {
 +
-+constexpr int kBackLog = 10;
++// Bounds for the pref-configured CDP accept backlog; values outside this
++// range fall back to the registered default.
++constexpr int kMinCDPBacklog = 1;
++constexpr int kMaxCDPBacklog = 512;
 +constexpr base::FilePath::CharType kConfigFileName[] =
 +    FILE_PATH_LITERAL("server_config.json");
 +
++// The periodic HTTP check is a backstop for a wedged-but-connected
++// server; crashes are caught immediately by the liveness socket, which
++// triggers an out-of-band CheckServerHealth() probe. Against a dead
++// process that probe fails with connection refused in milliseconds, so
++// the timeout only bounds the wedged-server case.
 +constexpr base::TimeDelta kHealthCheckInterval = base::Seconds(30);
-+constexpr base::TimeDelta kHealthCheckTimeout = base::Seconds(15);
++constexpr base::TimeDelta kHealthCheckTimeout = base::Seconds(5);
 +constexpr base::TimeDelta kProcessCheckInterval = base::Seconds(10);
 +
++// Delay before the first liveness connection attempt after a launch,
++// giving the server time to bind its listen socket.
++constexpr base::TimeDelta kLivenessConnectDelay = base::Seconds(2);
++
 +// Crash tracking: if server crashes within grace period, count as startup failure
 +constexpr base::TimeDelta kStartupGracePeriod = base::Seconds(30);
++
++// Memory-pressure signals only report elevations, never the all-clear,
++// so a recorded level decays back to NONE once no new signal has arrived
++// within this window.
++constexpr base::TimeDelta kMemoryPressureWindow = base::Seconds(10);
++
++// Crash-loop backoff: restarts after early crashes are delayed
++// exponentially (1s, 2s, 4s, ... capped) with +/-25% jitter so a
++// flapping server does not burn CPU respawning. A crash after a healthy
++// run restarts immediately.
++constexpr base::TimeDelta kRestartBackoffInitial = base::Seconds(1);
++constexpr base::TimeDelta kRestartBackoffMax = base::Seconds(30);
++constexpr int kMaxRestartBackoffExponent = 6;
++
++// State snapshot written just before a crash restart; the replacement
++// process is pointed at it via --resume-state so its session layer can
++// resume where the crashed instance stopped instead of starting cold.
++constexpr base::FilePath::CharType kRestartStateFileName[] =
++    FILE_PATH_LITERAL("restart_state.json");
 +constexpr int kMaxStartupFailures = 3;
 +
 +// Exit codes from BrowserOS server (must match packages/shared/src/constants/exit-codes.ts)
@@ -86,12 +148,57 @@ index 0000000000000..f930bf5bc0107
 +constexpr int kMaxPortAttempts = 100;
 +constexpr int kMaxPort = 65535;
 +
++// Times one BrowserOS startup step on the UI thread: a "browseros" trace
++// span plus a BrowserOS.Startup.<Step>.Duration histogram, so startup
++// cost can be attributed to a specific step instead of estimated in
++// aggregate. |step| must be a string literal (it becomes the histogram
++// suffix).
++class ScopedStartupStep {
++ public:
++  explicit ScopedStartupStep(const char* step)
++      : step_(step), start_(base::TimeTicks::Now()) {
++    TRACE_EVENT_BEGIN1("browseros", "BrowserOSStartup", "step", step);
++  }
++
++  ScopedStartupStep(const ScopedStartupStep&) = delete;
++  ScopedStartupStep& operator=(const ScopedStartupStep&) = delete;
++
++  ~ScopedStartupStep() {
++    TRACE_EVENT_END0("browseros", "BrowserOSStartup");
++    base::UmaHistogramTimes(
++        base::StrCat({"BrowserOS.Startup.", step_, ".Duration"}),
++        base::TimeTicks::Now() - start_);
++  }
++
++ private:
++  const char* step_;
++  base::TimeTicks start_;
++};
++
 +// Holds configuration data gathered on UI thread, passed to background thread
 +struct ServerConfig {
 +  std::string install_id;
 +  std::string browseros_version;
 +  std::string chromium_version;
 +  bool allow_remote_in_mcp = false;
++  // Non-empty when the CDP endpoint is served over a Unix domain socket
++  // instead of the TCP port (--browseros-uds-transport, POSIX only).
++  std::string cdp_uds_path;
++  // When true the server multiplexes all agent sessions over one DevTools
++  // connection (flat Target sessions keyed by sessionId) instead of one
++  // socket per session. Announced via config and CLI so older server
++  // binaries, which ignore unknown flags, keep their per-session sockets.
++  bool cdp_multiplex_sessions = true;
++  // Microseconds the server may hold small CDP messages so a burst drains
++  // in one socket write instead of one write() and wakeup per message.
++  // Latency-critical commands (input dispatch, screenshots) flush the
++  // queue immediately on the server side. 0 disables coalescing.
++  int cdp_write_coalesce_us = 500;
++  // Namespace (profile directory base name) of each loaded profile.
++  // Written to the config so a server shared across profiles keeps each
++  // profile's sessions and saved state in its own namespace instead of
++  // one shared pool.
++  std::vector<std::string> profile_namespaces;
 +};
 +
 +// Writes the server configuration to a JSON file.
@@ -125,8 +232,18 @@ index 0000000000000..f930bf5bc0107
 +  // flags
 +  base::Value::Dict flags;
 +  flags.Set("allow_remote_in_mcp", server_config.allow_remote_in_mcp);
++  flags.Set("cdp_multiplex_sessions", server_config.cdp_multiplex_sessions);
++  flags.Set("cdp_write_coalesce_us", server_config.cdp_write_coalesce_us);
 +  config.Set("flags", std::move(flags));
 +
++  // transports (only present when UDS is enabled; the server prefers a
++  // listed socket over the corresponding TCP port)
++  if (!server_config.cdp_uds_path.empty()) {
++    base::Value::Dict uds;
++    uds.Set("cdp", server_config.cdp_uds_path);
++    config.Set("uds", std::move(uds));
++  }
++
 +  // instance
 +  base::Value::Dict instance;
 +  instance.Set("install_id", server_config.install_id);
@@ -134,12 +251,31 @@ index 0000000000000..f930bf5bc0107
 +  instance.Set("chromium_version", server_config.chromium_version);
 +  config.Set("instance", std::move(instance));
 +
++  // profiles (per-profile namespaces; the server scopes session state to
++  // the namespace an agent connects under)
++  if (!server_config.profile_namespaces.empty()) {
++    base::Value::List profiles;
++    for (const std::string& ns : server_config.profile_namespaces) {
++      profiles.Append(ns);
++    }
++    config.Set("profiles", std::move(profiles));
++  }
++
 +  std::optional<std::string> json_output = base::WriteJson(config);
 +  if (!json_output.has_value()) {
 +    LOG(ERROR) << "browseros: Failed to serialize config to JSON";
 +    return base::FilePath();
 +  }
 +
++  // Warm path: when ports and config are unchanged from the previous run
++  // the file on disk already matches; skip the write.
++  std::string existing;
++  if (base::ReadFileToString(config_path, &existing) &&
++      existing == json_output.value()) {
++    LOG(INFO) << "browseros: Config unchanged, reusing " << config_path;
++    return config_path;
++  }
++
 +  if (!base::WriteFile(config_path, json_output.value())) {
 +    LOG(ERROR) << "browseros: Failed to write config file: " << config_path;
 +    return base::FilePath();
@@ -149,6 +285,72 @@ index 0000000000000..f930bf5bc0107
 +  return config_path;
 +}
 +
++// Config keys the running server can apply in place when told to reload.
++// Anything not listed here still goes through a full restart: ports and
++// transports are bound at startup, and the instance block is baked into
++// sessions the server has already opened.
++bool IsHotReloadableConfigKey(std::string_view key) {
++  return key == "allow_remote_in_mcp";
++}
++
++// Read-modify-writes a single flag in the on-disk config so the server can
++// re-read it on reload, and so the next launch starts from the current
++// value (blocking I/O, background thread). Returns false when the config
++// file is missing or unwritable, in which case the caller falls back to a
++// full restart.
++bool UpdateConfigFlagOnDisk(const base::FilePath& execution_dir,
++                            const std::string& key,
++                            base::Value value) {
++  base::FilePath config_path = execution_dir.Append(kConfigFileName);
++
++  std::string json;
++  if (!base::ReadFileToString(config_path, &json)) {
++    return false;
++  }
++  std::optional<base::Value> parsed = base::JSONReader::Read(json);
++  if (!parsed || !parsed->is_dict()) {
++    return false;
++  }
++  base::Value::Dict config = std::move(*parsed).TakeDict();
++  config.EnsureDict("flags")->Set(key, std::move(value));
++
++  std::optional<std::string> json_output = base::WriteJson(config);
++  return json_output.has_value() &&
++         base::WriteFile(config_path, json_output.value());
++}
++
++// Writes the crash-restart state snapshot (blocking I/O, background
++// thread). Session state itself lives in the server process; this file
++// carries the endpoint identity and crash metadata its persistence layer
++// needs to associate saved sessions with the restart.
++void WriteRestartStateSnapshot(const base::FilePath& execution_dir,
++                               int exit_code,
++                               int mcp_port,
++                               int agent_port,
++                               int extension_port) {
++  base::Value::Dict state;
++  state.Set("previous_exit_code", exit_code);
++  state.Set("crash_time_ms",
++            base::Time::Now().InMillisecondsFSinceUnixEpoch());
++
++  base::Value::Dict ports;
++  ports.Set("http_mcp", mcp_port);
++  ports.Set("agent", agent_port);
++  ports.Set("extension", extension_port);
++  state.Set("ports", std::move(ports));
++
++  std::optional<std::string> json_output = base::WriteJson(state);
++  if (!json_output.has_value()) {
++    return;
++  }
++
++  base::FilePath state_path = execution_dir.Append(kRestartStateFileName);
++  if (!base::WriteFile(state_path, json_output.value())) {
++    LOG(WARNING) << "browseros: Failed to write restart state snapshot to "
++                 << state_path;
++  }
++}
++
 +// Helper function to check for command-line port override.
 +// Returns the port value if valid override is found, 0 otherwise.
 +int GetPortOverrideFromCommandLine(base::CommandLine* command_line,
@@ -200,13 +402,15 @@ index 0000000000000..f930bf5bc0107
 +    uint16_t mcp_port,
 +    uint16_t agent_port,
 +    uint16_t extension_port,
-+    const ServerConfig& server_config) {
++    const ServerConfig& server_config,
++    bool exe_verified) {
 +  browseros::BrowserOSServerManager::LaunchResult result;
 +  base::FilePath actual_exe_path = exe_path;
 +  base::FilePath actual_resources_dir = resources_dir;
 +
-+  // Check if executable exists, fallback to bundled if not
-+  if (!base::PathExists(actual_exe_path)) {
++  // Check if executable exists, fallback to bundled if not. Skipped when
++  // the prewarm task already verified this exact path at construction.
++  if (!exe_verified && !base::PathExists(actual_exe_path)) {
 +    LOG(WARNING) << "browseros: Binary not found at " << actual_exe_path
 +                 << ", falling back to bundled";
 +    actual_exe_path = fallback_exe_path;
@@ -216,12 +420,16 @@ index 0000000000000..f930bf5bc0107
 +    if (!base::PathExists(actual_exe_path)) {
 +      LOG(ERROR) << "browseros: Bundled binary also not found at: "
 +                 << actual_exe_path;
++      result.failure =
++          browseros::BrowserOSServerManager::LaunchFailure::kBinaryMissing;
 +      return result;
 +    }
 +  }
 +
 +  if (execution_dir.empty()) {
 +    LOG(ERROR) << "browseros: Execution directory path is empty";
++    result.failure = browseros::BrowserOSServerManager::LaunchFailure::
++        kExecutionDirUnavailable;
 +    return result;
 +  }
 +
@@ -229,6 +437,8 @@ index 0000000000000..f930bf5bc0107
 +  if (!base::CreateDirectory(execution_dir)) {
 +    LOG(ERROR) << "browseros: Failed to create execution directory at: "
 +               << execution_dir;
++    result.failure = browseros::BrowserOSServerManager::LaunchFailure::
++        kExecutionDirUnavailable;
 +    return result;
 +  }
 +
@@ -238,6 +448,8 @@ index 0000000000000..f930bf5bc0107
 +      extension_port, server_config);
 +  if (config_path.empty()) {
 +    LOG(ERROR) << "browseros: Failed to write config file, aborting launch";
++    result.failure =
++        browseros::BrowserOSServerManager::LaunchFailure::kConfigWriteFailed;
 +    return result;
 +  }
 +
@@ -250,6 +462,23 @@ index 0000000000000..f930bf5bc0107
 +  cmd.AppendSwitchASCII("http-mcp-port", base::NumberToString(mcp_port));
 +  cmd.AppendSwitchASCII("agent-port", base::NumberToString(agent_port));
 +  cmd.AppendSwitchASCII("extension-port", base::NumberToString(extension_port));
++  if (!server_config.cdp_uds_path.empty()) {
++    cmd.AppendSwitchASCII("cdp-uds", server_config.cdp_uds_path);
++  }
++  if (server_config.cdp_multiplex_sessions) {
++    cmd.AppendSwitch("cdp-multiplex-sessions");
++  }
++  cmd.AppendSwitchASCII(
++      "cdp-write-coalesce-us",
++      base::NumberToString(server_config.cdp_write_coalesce_us));
++
++  // Hand the crash-restart snapshot (if any) to the new process so it
++  // can resume sessions; it is the server's job to consume and remove it.
++  base::FilePath restart_state_path =
++      execution_dir.Append(kRestartStateFileName);
++  if (base::PathExists(restart_state_path)) {
++    cmd.AppendSwitchPath("resume-state", restart_state_path);
++  }
 +
 +  // Set up launch options
 +  base::LaunchOptions options;
@@ -259,13 +488,20 @@ index 0000000000000..f930bf5bc0107
 +
 +  // Launch the process (blocking I/O)
 +  result.process = base::LaunchProcess(cmd, options);
++  if (!result.process.IsValid()) {
++    result.failure = browseros::BrowserOSServerManager::LaunchFailure::
++        kProcessSpawnFailed;
++  }
 +  return result;
 +}
 +
-+// Factory for creating TCP server sockets for CDP
++// Factory for creating CDP server sockets. Listens on a Unix domain
++// socket when |uds_path| is non-empty (POSIX), otherwise on a localhost
++// TCP port.
 +class CDPServerSocketFactory : public content::DevToolsSocketFactory {
 + public:
-+  explicit CDPServerSocketFactory(uint16_t port) : port_(port) {}
++  CDPServerSocketFactory(uint16_t port, base::FilePath uds_path, int backlog)
++      : port_(port), uds_path_(std::move(uds_path)), backlog_(backlog) {}
 +
 +  CDPServerSocketFactory(const CDPServerSocketFactory&) = delete;
 +  CDPServerSocketFactory& operator=(const CDPServerSocketFactory&) = delete;
@@ -274,11 +510,11 @@ index 0000000000000..f930bf5bc0107
 +  std::unique_ptr<net::ServerSocket> CreateLocalHostServerSocket(int port) {
 +    std::unique_ptr<net::ServerSocket> socket(
 +        new net::TCPServerSocket(nullptr, net::NetLogSource()));
-+    if (socket->ListenWithAddressAndPort("127.0.0.1", port, kBackLog) ==
++    if (socket->ListenWithAddressAndPort("127.0.0.1", port, backlog_) ==
 +        net::OK) {
 +      return socket;
 +    }
-+    if (socket->ListenWithAddressAndPort("::1", port, kBackLog) == net::OK) {
++    if (socket->ListenWithAddressAndPort("::1", port, backlog_) == net::OK) {
 +      return socket;
 +    }
 +    return nullptr;
@@ -286,6 +522,23 @@ index 0000000000000..f930bf5bc0107
 +
 +  // content::DevToolsSocketFactory implementation
 +  std::unique_ptr<net::ServerSocket> CreateForHttpServer() override {
++#if BUILDFLAG(IS_POSIX)
++    if (!uds_path_.empty()) {
++      // Same-user access is enforced by the socket file's permissions in
++      // the execution directory, so every local peer is accepted here.
++      auto socket = std::make_unique<net::UnixDomainServerSocket>(
++          base::BindRepeating(
++              [](const net::UnixDomainServerSocket::Credentials&) {
++                return true;
++              }),
++          /*use_abstract_namespace=*/false);
++      if (socket->BindAndListen(uds_path_.value(), backlog_) == net::OK) {
++        return socket;
++      }
++      LOG(WARNING) << "browseros: Failed to listen on UDS " << uds_path_
++                   << ", falling back to TCP port " << port_;
++    }
++#endif
 +    return CreateLocalHostServerSocket(port_);
 +  }
 +
@@ -295,6 +548,8 @@ index 0000000000000..f930bf5bc0107
 +  }
 +
 +  uint16_t port_;
++  base::FilePath uds_path_;
++  int backlog_;
 +};
 +
 +}  // namespace
@@ -307,12 +562,128 @@ index 0000000000000..f930bf5bc0107
 +  return instance.get();
 +}
 +
-+BrowserOSServerManager::BrowserOSServerManager() = default;
++BrowserOSServerManager::BrowserOSServerManager() {
++  // Resolve launch paths and create the execution directory off-thread
++  // now, so LaunchBrowserOSProcess() is left with the config check and
++  // the exec itself.
++  PrewarmLaunchPaths();
++
++  // The dump reads /proc for the external server process, so it runs on a
++  // MayBlock pool sequence rather than the UI thread. The singleton is
++  // never destroyed, so the provider is never unregistered.
++  base::trace_event::MemoryDumpManager::GetInstance()
++      ->RegisterDumpProviderWithSequencedTaskRunner(
++          this, "BrowserOSServer",
++          base::ThreadPool::CreateSequencedTaskRunner(
++              {base::MayBlock(), base::TaskPriority::BEST_EFFORT}),
++          base::trace_event::MemoryDumpProvider::Options());
++
++  // Track system memory pressure so the browserOS API layer can shed
++  // load instead of snapshotting at full rate on a starved machine.
++  // Unretained is safe: the singleton is never destroyed.
++  memory_pressure_listener_ = std::make_unique<base::MemoryPressureListener>(
++      FROM_HERE,
++      base::BindRepeating(&BrowserOSServerManager::OnMemoryPressure,
++                          base::Unretained(this)));
++}
 +
 +BrowserOSServerManager::~BrowserOSServerManager() {
 +  Shutdown();
 +}
 +
++bool BrowserOSServerManager::OnMemoryDump(
++    const base::trace_event::MemoryDumpArgs& args,
++    base::trace_event::ProcessMemoryDump* pmd) {
++  const base::ProcessId pid = dump_pid_.load(std::memory_order_relaxed);
++  auto* dump = pmd->CreateAllocatorDump("browseros/server");
++  dump->AddScalar(base::trace_event::MemoryAllocatorDump::kNameObjectCount,
++                  base::trace_event::MemoryAllocatorDump::kUnitsObjects,
++                  pid != base::kNullProcessId ? 1 : 0);
++  if (pid == base::kNullProcessId) {
++    return true;
++  }
++  dump->AddScalar("pid", base::trace_event::MemoryAllocatorDump::kUnitsObjects,
++                  static_cast<uint64_t>(pid));
++
++#if BUILDFLAG(IS_LINUX)
++  // The server is an external process, so memory-infra can't walk its
++  // allocators; report its resident set from /proc so its cost still shows
++  // up next to the in-browser entries. The process can exit between the pid
++  // load and the read, in which case the scalar is simply omitted.
++  std::string statm;
++  if (base::ReadFileToString(
++          base::FilePath(base::StringPrintf("/proc/%d/statm", pid)), &statm)) {
++    std::vector<std::string_view> fields = base::SplitStringPiece(
++        statm, " ", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY);
++    uint64_t resident_pages = 0;
++    if (fields.size() >= 2 &&
++        base::StringToUint64(fields[1], &resident_pages)) {
++      dump->AddScalar(base::trace_event::MemoryAllocatorDump::kNameSize,
++                      base::trace_event::MemoryAllocatorDump::kUnitsBytes,
++                      resident_pages * base::GetPageSize());
++    }
++  }
++#endif  // BUILDFLAG(IS_LINUX)
++
++  return true;
++}
++
++base::MemoryPressureListener::MemoryPressureLevel
++BrowserOSServerManager::GetMemoryPressureLevel() const {
++  // Pressure notifications carry no all-clear; treat a stale signal as
++  // recovered.
++  if (base::TimeTicks::Now() - last_memory_pressure_time_ >
++      kMemoryPressureWindow) {
++    return base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE;
++  }
++  return memory_pressure_level_;
++}
++
++void BrowserOSServerManager::OnMemoryPressure(
++    base::MemoryPressureListener::MemoryPressureLevel level) {
++  if (level ==
++          base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL &&
++      memory_pressure_level_ != level) {
++    LOG(WARNING) << "browseros: Critical memory pressure; browserOS API "
++                 << "degrades to viewport-only snapshots, no screenshots";
++  }
++  memory_pressure_level_ = level;
++  last_memory_pressure_time_ = base::TimeTicks::Now();
++}
++
++void BrowserOSServerManager::PrewarmLaunchPaths() {
++  // The getters do blocking path checks (and GetBrowserOSExecutionDir
++  // creates the directory), so run them on the pool. The singleton
++  // outlives the task.
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
++      browseros::AnnotateTask("ServerManager", base::BindOnce(
++          [](BrowserOSServerManager* manager) {
++            PrewarmedPaths paths;
++            paths.exe_path = manager->GetBrowserOSServerExecutablePath();
++            paths.resources_dir = manager->GetBrowserOSServerResourcesPath();
++            paths.execution_dir = manager->GetBrowserOSExecutionDir();
++            paths.exe_exists = base::PathExists(paths.exe_path);
++            // Prime the updater's versions manifest into the page cache
++            // while already on the pool; the updater reads it when it
++            // starts, well after construction, and the first open of a
++            // small file is the expensive part on cold AV-scanned disks.
++            std::string manifest;
++            base::ReadFileToString(
++                paths.execution_dir.AppendASCII(
++                    browseros_server::kVersionsManifestFileName),
++                &manifest);
++            return paths;
++          },
++          base::Unretained(this))),
++      base::BindOnce(&BrowserOSServerManager::OnLaunchPathsPrewarmed,
++                     weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSServerManager::OnLaunchPathsPrewarmed(PrewarmedPaths paths) {
++  prewarmed_paths_ = std::move(paths);
++}
++
 +bool BrowserOSServerManager::AcquireLock() {
 +  // Allow blocking for lock file operations (short-duration I/O)
 +  base::ScopedAllowBlocking allow_blocking;
@@ -348,6 +719,47 @@ index 0000000000000..f930bf5bc0107
 +  return true;
 +}
 +
++bool BrowserOSServerManager::TryAttachToSharedServer() {
++  // Short-duration config read, same rationale as the lock I/O above.
++  base::ScopedAllowBlocking allow_blocking;
++
++  base::FilePath config_path =
++      GetBrowserOSExecutionDir().Append(kConfigFileName);
++  std::string json;
++  if (!base::ReadFileToString(config_path, &json)) {
++    LOG(WARNING) << "browseros: Shared-server attach failed, no config at "
++                 << config_path;
++    return false;
++  }
++  std::optional<base::Value> parsed = base::JSONReader::Read(json);
++  if (!parsed || !parsed->is_dict()) {
++    LOG(WARNING) << "browseros: Shared-server attach failed, config at "
++                 << config_path << " is not valid JSON";
++    return false;
++  }
++  const base::Value::Dict* ports = parsed->GetDict().FindDict("ports");
++  if (!ports) {
++    LOG(WARNING) << "browseros: Shared-server attach failed, config has no "
++                 << "ports";
++    return false;
++  }
++
++  // Adopt the owner's endpoints so API consumers in this process reach
++  // the shared server. The owning process keeps launch, health
++  // monitoring and restart duties; this one runs neither a server
++  // process nor a CDP endpoint of its own.
++  cdp_port_ = ports->FindInt("cdp").value_or(cdp_port_);
++  mcp_port_ = ports->FindInt("http_mcp").value_or(mcp_port_);
++  agent_port_ = ports->FindInt("agent").value_or(agent_port_);
++  extension_port_ = ports->FindInt("extension").value_or(extension_port_);
++  attached_to_shared_server_ = true;
++
++  LOG(INFO) << "browseros: Attached to shared server - MCP: " << mcp_port_
++            << ", Agent: " << agent_port_
++            << ", Extension: " << extension_port_;
++  return true;
++}
++
 +void BrowserOSServerManager::LoadPortsFromPrefs() {
 +  PrefService* prefs = g_browser_process->local_state();
 +
@@ -407,6 +819,23 @@ index 0000000000000..f930bf5bc0107
 +}
 +
 +void BrowserOSServerManager::ResolvePortsForStartup() {
++  // Warm path: when the saved ports are distinct and all still free -
++  // the common case when nothing grabbed them since the last run - keep
++  // them as-is and skip the per-service scans.
++  if (cdp_port_ > 0 && agent_port_ > 0 && extension_port_ > 0 &&
++      mcp_port_ > 0) {
++    std::set<int> distinct = {cdp_port_, mcp_port_, agent_port_,
++                              extension_port_};
++    if (distinct.size() == 4 && IsPortAvailable(cdp_port_) &&
++        IsPortAvailable(agent_port_) && IsPortAvailable(extension_port_)) {
++      LOG(INFO) << "browseros: Saved ports still available, reusing - CDP: "
++                << cdp_port_ << ", MCP: " << mcp_port_
++                << ", Agent: " << agent_port_
++                << ", Extension: " << extension_port_;
++      return;
++    }
++  }
++
 +  // Track assigned ports to prevent collisions between our services
 +  std::set<int> assigned_ports;
 +
@@ -485,17 +914,64 @@ index 0000000000000..f930bf5bc0107
 +    return;
 +  }
 +
++  // Deferred mode: skip the launch (process spawn plus startup-grace
++  // monitoring) until a browserOS API call signals that this session
++  // actually uses agent features.
++  if (base::CommandLine::ForCurrentProcess()->HasSwitch(
++          browseros::kDeferServerStart)) {
++    LOG(INFO) << "browseros: Deferring server launch until first API use";
++    start_deferred_ = true;
++    return;
++  }
++
++  // Nothing in StartNow() is needed before the first window paints, so
++  // push it behind startup-critical work by re-posting at BEST_EFFORT
++  // priority. An API call in the gap still starts the server immediately
++  // through EnsureStarted(). Unretained is safe: the singleton is never
++  // destroyed.
++  start_deferred_ = true;
++  content::GetUIThreadTaskRunner({base::TaskPriority::BEST_EFFORT})
++      ->PostTask(FROM_HERE,
++                 base::BindOnce(&BrowserOSServerManager::StartIfStillPending,
++                                base::Unretained(this)));
++}
++
++void BrowserOSServerManager::EnsureStarted() {
++  if (is_running_ || !start_deferred_) {
++    return;
++  }
++
++  LOG(INFO) << "browseros: First API use, starting deferred BrowserOS server";
++  start_deferred_ = false;
++  StartNow();
++}
++
++void BrowserOSServerManager::StartIfStillPending() {
++  // EnsureStarted() may have beaten this idle-priority task to it.
++  if (!start_deferred_) {
++    return;
++  }
++  start_deferred_ = false;
++  StartNow();
++}
++
++void BrowserOSServerManager::StartNow() {
++  ScopedStartupStep total_step("Total");
++
 +  // Initialize ports in clean steps:
 +  // 1. Load saved values from prefs
 +  // 2. Set up pref change observers
 +  // 3. Resolve ports for startup (MCP stays stable, others find available)
 +  // 4. Apply CLI overrides
 +  // 5. Save final values to prefs
-+  LoadPortsFromPrefs();
-+  SetupPrefObservers();
-+  ResolvePortsForStartup();
-+  ApplyCommandLineOverrides();
-+  SavePortsToPrefs();
++  {
++    ScopedStartupStep step("PortSetup");
++    LoadPortsFromPrefs();
++    SetupPrefObservers();
++    ResolvePortsForStartup();
++    ApplyCommandLineOverrides();
++    SavePortsToPrefs();
++  }
 +
 +  base::CommandLine* command_line = base::CommandLine::ForCurrentProcess();
 +  if (command_line->HasSwitch(browseros::kDisableServer)) {
@@ -504,26 +980,54 @@ index 0000000000000..f930bf5bc0107
 +  }
 +
 +  // Try to acquire system-wide lock
-+  if (!AcquireLock()) {
-+    return;  // Another Chrome process already owns the server
++  {
++    ScopedStartupStep step("AcquireLock");
++    if (!AcquireLock()) {
++      // Another Chrome process of this installation already owns the
++      // server. In shared-server mode that is not a failure: attach to
++      // the running server so this process's profiles multiplex onto it
++      // instead of running without one (or spawning a duplicate).
++      if (command_line->HasSwitch(browseros::kSharedServer)) {
++        TryAttachToSharedServer();
++      }
++      return;
++    }
 +  }
 +
 +  LOG(INFO) << "browseros: Starting BrowserOS server";
 +
 +  // Start servers and process
 +  // Note: monitoring timers are started in OnProcessLaunched() after successful launch
-+  StartCDPServer();
-+  LaunchBrowserOSProcess();
++  {
++    ScopedStartupStep step("StartCDPServer");
++    StartCDPServer();
++  }
++  {
++    // UI-thread portion only; the spawn itself completes asynchronously
++    // in OnProcessLaunched().
++    ScopedStartupStep step("LaunchProcess");
++    LaunchBrowserOSProcess();
++  }
 +}
 +
 +void BrowserOSServerManager::Stop() {
++  if (attached_to_shared_server_) {
++    // Nothing runs locally; the owning process manages the shared
++    // server's lifetime.
++    attached_to_shared_server_ = false;
++    return;
++  }
++
 +  if (!is_running_) {
 +    return;
 +  }
 +
 +  LOG(INFO) << "browseros: Stopping BrowserOS server";
++  BrowserOSStepProfiler::GetInstance()->EndSession();
 +  health_check_timer_.Stop();
 +  process_check_timer_.Stop();
++  restart_backoff_timer_.Stop();
++  ResetLivenessSocket();
 +
 +  // Stop the updater
 +  if (updater_) {
@@ -551,10 +1055,34 @@ index 0000000000000..f930bf5bc0107
 +}
 +
 +void BrowserOSServerManager::StartCDPServer() {
-+  LOG(INFO) << "browseros: Starting CDP server on port " << cdp_port_;
++  base::FilePath uds_path = GetCDPSocketPath();
++  if (!uds_path.empty()) {
++    // Remove a stale socket file from a previous run; bind fails on an
++    // existing path.
++    base::ScopedAllowBlocking allow_blocking;
++    base::DeleteFile(uds_path);
++    LOG(INFO) << "browseros: Starting CDP server on UDS " << uds_path;
++  } else {
++    LOG(INFO) << "browseros: Starting CDP server on port " << cdp_port_;
++  }
++
++  // Accept backlog comes from local state so automation hosts that open
++  // deep bursts of parallel CDP connections can raise it without a
++  // rebuild. Out-of-range values fall back to the default.
++  int backlog = browseros_server::kDefaultCDPAcceptBacklog;
++  if (PrefService* prefs = g_browser_process->local_state()) {
++    const int configured =
++        prefs->GetInteger(browseros_server::kCDPAcceptBacklog);
++    if (configured >= kMinCDPBacklog && configured <= kMaxCDPBacklog) {
++      backlog = configured;
++    } else {
++      LOG(WARNING) << "browseros: Ignoring out-of-range CDP accept backlog "
++                   << configured;
++    }
++  }
 +
 +  content::DevToolsAgentHost::StartRemoteDebuggingServer(
-+      std::make_unique<CDPServerSocketFactory>(cdp_port_),
++      std::make_unique<CDPServerSocketFactory>(cdp_port_, uds_path, backlog),
 +      base::FilePath(),
 +      base::FilePath());
 +
@@ -578,9 +1106,18 @@ index 0000000000000..f930bf5bc0107
 +}
 +
 +void BrowserOSServerManager::LaunchBrowserOSProcess() {
-+  // Bundled paths (always available as fallback)
-+  base::FilePath fallback_exe_path = GetBrowserOSServerExecutablePath();
-+  base::FilePath fallback_resources_dir = GetBrowserOSServerResourcesPath();
++  // Bundled paths (always available as fallback). Usually resolved
++  // already by the prewarm task; fall back to the blocking getters if
++  // the launch got here first.
++  base::FilePath fallback_exe_path;
++  base::FilePath fallback_resources_dir;
++  if (prewarmed_paths_) {
++    fallback_exe_path = prewarmed_paths_->exe_path;
++    fallback_resources_dir = prewarmed_paths_->resources_dir;
++  } else {
++    fallback_exe_path = GetBrowserOSServerExecutablePath();
++    fallback_resources_dir = GetBrowserOSServerResourcesPath();
++  }
 +
 +  // Use updater's best paths if available (for OTA updates), otherwise bundled
 +  base::FilePath exe_path;
@@ -593,12 +1130,20 @@ index 0000000000000..f930bf5bc0107
 +    resources_dir = fallback_resources_dir;
 +  }
 +
-+  base::FilePath execution_dir = GetBrowserOSExecutionDir();
++  base::FilePath execution_dir = prewarmed_paths_
++                                     ? prewarmed_paths_->execution_dir
++                                     : GetBrowserOSExecutionDir();
 +  if (execution_dir.empty()) {
 +    LOG(ERROR) << "browseros: Failed to resolve execution directory";
 +    return;
 +  }
 +
++  // The launch task only needs to re-check the binary on disk when the
++  // prewarm didn't already verify this exact path (e.g. the updater
++  // supplied a different one).
++  bool exe_verified = prewarmed_paths_ && prewarmed_paths_->exe_exists &&
++                      exe_path == prewarmed_paths_->exe_path;
++
 +  LOG(INFO) << "browseros: Launching server - binary: " << exe_path;
 +  LOG(INFO) << "browseros: Launching server - resources: " << resources_dir;
 +  LOG(INFO) << "browseros: Launching server - execution dir: " << execution_dir;
@@ -616,6 +1161,24 @@ index 0000000000000..f930bf5bc0107
 +  server_config.chromium_version =
 +      std::string(version_info::GetVersionNumber());
 +  server_config.allow_remote_in_mcp = allow_remote_in_mcp_;
++  server_config.cdp_uds_path = GetCDPSocketPath().AsUTF8Unsafe();
++  server_config.cdp_multiplex_sessions =
++      !base::CommandLine::ForCurrentProcess()->HasSwitch(
++          browseros::kDisableCDPMultiplex);
++  if (base::CommandLine::ForCurrentProcess()->HasSwitch(
++          browseros::kCDPWriteCoalesceUs)) {
++    int coalesce_us = 0;
++    if (base::StringToInt(
++            base::CommandLine::ForCurrentProcess()->GetSwitchValueASCII(
++                browseros::kCDPWriteCoalesceUs),
++            &coalesce_us) &&
++        coalesce_us >= 0) {
++      server_config.cdp_write_coalesce_us = coalesce_us;
++    } else {
++      LOG(WARNING) << "browseros: Ignoring invalid "
++                   << browseros::kCDPWriteCoalesceUs << " value";
++    }
++  }
 +
 +  // Get install_id from BrowserOSMetricsService if available
 +  ProfileManager* profile_manager = g_browser_process->profile_manager();
@@ -629,15 +1192,24 @@ index 0000000000000..f930bf5bc0107
 +        server_config.install_id = metrics_service->GetInstallId();
 +      }
 +    }
++
++    // Announce one namespace per loaded profile so the server partitions
++    // state per profile instead of pooling everything under the install.
++    for (Profile* loaded : profile_manager->GetLoadedProfiles()) {
++      if (!loaded->IsOffTheRecord()) {
++        server_config.profile_namespaces.push_back(
++            loaded->GetBaseName().AsUTF8Unsafe());
++      }
++    }
 +  }
 +
 +  // Post blocking work to background thread, get result back on UI thread
 +  base::ThreadPool::PostTaskAndReplyWithResult(
 +      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
-+      base::BindOnce(&LaunchProcessOnBackgroundThread, exe_path, resources_dir,
++      browseros::AnnotateTask("ServerManager", base::BindOnce(&LaunchProcessOnBackgroundThread, exe_path, resources_dir,
 +                     fallback_exe_path, fallback_resources_dir, execution_dir,
 +                     cdp_port, mcp_port, agent_port, extension_port,
-+                     server_config),
++                     server_config, exe_verified)),
 +      base::BindOnce(&BrowserOSServerManager::OnProcessLaunched,
 +                     weak_factory_.GetWeakPtr()));
 +}
@@ -650,8 +1222,14 @@ index 0000000000000..f930bf5bc0107
 +    updater_->InvalidateDownloadedVersion();
 +  }
 +
++  // One sample per attempt, success included, so failure classes have a
++  // denominator in the fleet dashboards.
++  base::UmaHistogramEnumeration("BrowserOS.Launch.FailureClass",
++                                result.failure);
++
 +  if (!result.process.IsValid()) {
-+    LOG(ERROR) << "browseros: Failed to launch BrowserOS server";
++    LOG(ERROR) << "browseros: Failed to launch BrowserOS server (class "
++               << static_cast<int>(result.failure) << ")";
 +    // Don't stop CDP server - it's independent and may be used by other things
 +    // Leave system in degraded state (CDP up, no browseros_server) rather than
 +    // completely broken state (no CDP, no server)
@@ -664,13 +1242,39 @@ index 0000000000000..f930bf5bc0107
 +        std::move(update_complete_callback_).Run(false);
 +      }
 +    }
++
++    // Retry strategy depends on the failure class. A missing binary or
++    // unusable execution dir will not fix itself in a retry loop; config
++    // writes and process spawns fail transiently (disk contention, AV
++    // scanners holding the exe) and are worth retrying with backoff.
++    switch (result.failure) {
++      case LaunchFailure::kConfigWriteFailed:
++      case LaunchFailure::kProcessSpawnFailed:
++        ScheduleLaunchRetry(result.failure);
++        break;
++      case LaunchFailure::kBinaryMissing:
++      case LaunchFailure::kExecutionDirUnavailable:
++        LOG(ERROR) << "browseros: Launch failure is permanent, not retrying";
++        break;
++      case LaunchFailure::kNone:
++        NOTREACHED();
++    }
 +    return;
 +  }
 +
++  launch_retry_count_ = 0;
 +  process_ = std::move(result.process);
 +  is_running_ = true;
++  dump_pid_.store(process_.Pid(), std::memory_order_relaxed);
 +  last_launch_time_ = base::TimeTicks::Now();
 +
++  // One step-profiler session per server process; the trace lands next to
++  // the server's other artifacts in the execution dir. No-op without
++  // --browseros-profile-steps.
++  BrowserOSStepProfiler::GetInstance()->StartSession(
++      prewarmed_paths_ ? prewarmed_paths_->execution_dir
++                       : GetBrowserOSExecutionDir());
++
 +  LOG(INFO) << "browseros: BrowserOS server started with PID: " << process_.Pid();
 +  LOG(INFO) << "browseros: CDP port: " << cdp_port_;
 +  LOG(INFO) << "browseros: MCP port: " << mcp_port_;
@@ -683,6 +1287,15 @@ index 0000000000000..f930bf5bc0107
 +  process_check_timer_.Start(FROM_HERE, kProcessCheckInterval, this,
 +                             &BrowserOSServerManager::CheckProcessStatus);
 +
++  // Establish the persistent liveness connection once the server has had
++  // time to bind its listen socket; a failed attempt retries on the next
++  // passing health check.
++  base::SequencedTaskRunner::GetCurrentDefault()->PostDelayedTask(
++      FROM_HERE,
++      base::BindOnce(&BrowserOSServerManager::ConnectLivenessSocket,
++                     weak_factory_.GetWeakPtr()),
++      kLivenessConnectDelay);
++
 +  // Reset restart flag and pref after successful launch
 +  if (is_restarting_) {
 +    is_restarting_ = false;
@@ -750,15 +1363,57 @@ index 0000000000000..f930bf5bc0107
 +#endif
 +
 +  is_running_ = false;
++  dump_pid_.store(base::kNullProcessId, std::memory_order_relaxed);
++}
++
++// static
++base::TimeDelta BrowserOSServerManager::ComputeRestartBackoff(
++    int backoff_exponent) {
++  base::TimeDelta delay =
++      std::min(kRestartBackoffInitial * (1 << (backoff_exponent - 1)),
++               kRestartBackoffMax);
++  // +/-25% jitter so a fleet hitting the same fault doesn't retry in
++  // lockstep.
++  return delay * (0.75 + base::RandDouble() * 0.5);
++}
++
++void BrowserOSServerManager::ScheduleLaunchRetry(LaunchFailure failure) {
++  launch_retry_count_++;
++  if (launch_retry_count_ >= kMaxStartupFailures) {
++    LOG(ERROR) << "browseros: " << launch_retry_count_
++               << " launch attempts failed (class "
++               << static_cast<int>(failure) << "), giving up";
++    launch_retry_count_ = 0;
++    return;
++  }
++
++  // Same backoff shape as the crash-restart path: exponential with
++  // jitter, so a fleet hitting the same AV scan or disk stall doesn't
++  // retry in lockstep.
++  restart_backoff_exponent_ =
++      std::min(restart_backoff_exponent_ + 1, kMaxRestartBackoffExponent);
++  base::TimeDelta delay = ComputeRestartBackoff(restart_backoff_exponent_);
++
++  LOG(WARNING) << "browseros: Retrying launch in " << delay.InMilliseconds()
++               << "ms (attempt " << (launch_retry_count_ + 1) << ")";
++  restart_backoff_timer_.Start(
++      FROM_HERE, delay,
++      base::BindOnce(&BrowserOSServerManager::LaunchBrowserOSProcess,
++                     weak_factory_.GetWeakPtr()));
 +}
 +
 +void BrowserOSServerManager::OnProcessExited(int exit_code) {
 +  LOG(INFO) << "browseros: BrowserOS server exited with code: " << exit_code;
 +  is_running_ = false;
++  dump_pid_.store(base::kNullProcessId, std::memory_order_relaxed);
++  // Export the step profile for the session that just ended; a crash
++  // restart opens a fresh session when the new process comes up.
++  BrowserOSStepProfiler::GetInstance()->EndSession();
 +
 +  // Stop timers during restart to prevent races
 +  health_check_timer_.Stop();
 +  process_check_timer_.Stop();
++  ResetLivenessSocket();
 +
 +  // Handle clean shutdown (exit code 0) - don't restart
 +  if (exit_code == kExitCodeSuccess) {
@@ -784,8 +1439,9 @@ index 0000000000000..f930bf5bc0107
 +      consecutive_startup_failures_ = 0;
 +    }
 +  } else {
-+    // Process ran past grace period, reset failure counter
++    // Process ran past grace period, reset failure counter and backoff
 +    consecutive_startup_failures_ = 0;
++    restart_backoff_exponent_ = 0;
 +  }
 +
 +  // Prevent concurrent restarts (e.g., if RestartBrowserOSProcess is in progress)
@@ -805,19 +1461,58 @@ index 0000000000000..f930bf5bc0107
 +                 << "), restarting with same ports";
 +  }
 +
-+  // Capture current ports for background thread
++  // Early crashes back off exponentially with jitter; a crash after a
++  // healthy run restarts right away. Port conflicts are exempt from
++  // backoff: revalidation fixes them, waiting doesn't, and delaying just
++  // extends the no-server window after another app grabbed our port.
++  base::TimeDelta delay;
++  if (uptime < kStartupGracePeriod && !revalidate_all) {
++    restart_backoff_exponent_ =
++        std::min(restart_backoff_exponent_ + 1, kMaxRestartBackoffExponent);
++    delay = ComputeRestartBackoff(restart_backoff_exponent_);
++    LOG(WARNING) << "browseros: Crash loop backoff, delaying restart by "
++                 << delay.InMilliseconds() << "ms";
++  }
++
++  if (delay.is_positive()) {
++    restart_backoff_timer_.Start(
++        FROM_HERE, delay,
++        base::BindOnce(&BrowserOSServerManager::StartCrashRestart,
++                       weak_factory_.GetWeakPtr(), exit_code, revalidate_all));
++  } else {
++    StartCrashRestart(exit_code, revalidate_all);
++  }
++}
++
++void BrowserOSServerManager::StartCrashRestart(int exit_code,
++                                               bool revalidate_all) {
++  // Capture current state for the background thread
 +  int cdp = cdp_port_;
 +  int mcp = mcp_port_;
 +  int agent = agent_port_;
 +  int extension = extension_port_;
++  base::FilePath execution_dir = GetBrowserOSExecutionDir();
 +
-+  // Revalidate ports on background thread, then launch on UI thread
-+  // Process is already dead, no need to terminate
++  // Write the resume snapshot and revalidate ports on the background
++  // thread, then launch on the UI thread. Process is already dead, no
++  // need to terminate.
 +  base::ThreadPool::PostTaskAndReplyWithResult(
 +      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
-+      base::BindOnce(&BrowserOSServerManager::RevalidatePortsForRestart,
-+                     base::Unretained(this), cdp, mcp, agent, extension,
-+                     revalidate_all),
++      browseros::AnnotateTask("ServerManager", base::BindOnce(
++          [](BrowserOSServerManager* manager,
++             const base::FilePath& execution_dir, int exit_code, int cdp,
++             int mcp, int agent, int extension,
++             bool revalidate_all) -> RevalidatedPorts {
++            if (!execution_dir.empty()) {
++              WriteRestartStateSnapshot(execution_dir, exit_code, mcp, agent,
++                                        extension);
++            }
++            return manager->RevalidatePortsForRestart(cdp, mcp, agent,
++                                                      extension,
++                                                      revalidate_all);
++          },
++          base::Unretained(this), execution_dir, exit_code, cdp, mcp, agent,
++          extension, revalidate_all)),
 +      base::BindOnce(&BrowserOSServerManager::OnPortsRevalidated,
 +                     weak_factory_.GetWeakPtr()));
 +}
@@ -859,19 +1554,21 @@ index 0000000000000..f930bf5bc0107
 +      std::move(resource_request), traffic_annotation);
 +  url_loader->SetTimeoutDuration(kHealthCheckTimeout);
 +
-+  // Get URL loader factory from default storage partition
-+  auto* url_loader_factory =
-+      g_browser_process->system_network_context_manager()
-+          ->GetURLLoaderFactory();
++  // Loopback factory: skips proxy resolution (PAC evaluation can stall
++  // loopback requests for hundreds of ms on corporate configs) and keeps
++  // back-to-back health checks on the same kept-alive connection.
++  scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory =
++      browseros::GetLoopbackURLLoaderFactory();
 +
 +  // Keep a raw pointer for the callback
 +  auto* url_loader_ptr = url_loader.get();
 +
 +  // Download response
 +  url_loader_ptr->DownloadHeadersOnly(
-+      url_loader_factory,
++      url_loader_factory.get(),
 +      base::BindOnce(&BrowserOSServerManager::OnHealthCheckComplete,
-+                     weak_factory_.GetWeakPtr(), std::move(url_loader)));
++                     weak_factory_.GetWeakPtr(), std::move(url_loader),
++                     base::TimeTicks::Now()));
 +}
 +
 +void BrowserOSServerManager::CheckProcessStatus() {
@@ -892,6 +1589,7 @@ index 0000000000000..f930bf5bc0107
 +
 +void BrowserOSServerManager::OnHealthCheckComplete(
 +    std::unique_ptr<network::SimpleURLLoader> url_loader,
++    base::TimeTicks start_time,
 +    scoped_refptr<net::HttpResponseHeaders> headers) {
 +  if (!is_running_) {
 +    return;
@@ -905,6 +1603,13 @@ index 0000000000000..f930bf5bc0107
 +
 +  if (response_code == 200) {
 +    LOG(INFO) << "browseros: Health check passed";
++    // Loopback round trip to the server; a creeping RTT is the early
++    // signal of an overloaded server before checks start timing out.
++    base::UmaHistogramTimes("BrowserOS.Server.HealthCheck.Rtt",
++                            base::TimeTicks::Now() - start_time);
++    // (Re)establish the liveness connection if it is not up; no-op when
++    // already connected.
++    ConnectLivenessSocket();
 +    return;
 +  }
 +
@@ -917,6 +1622,109 @@ index 0000000000000..f930bf5bc0107
 +  RestartBrowserOSProcess();
 +}
 +
++void BrowserOSServerManager::ConnectLivenessSocket() {
++  if (!is_running_ || liveness_socket_.is_bound()) {
++    return;
++  }
++
++  auto* context_manager = g_browser_process->system_network_context_manager();
++  if (!context_manager) {
++    return;
++  }
++  network::mojom::NetworkContext* network_context =
++      context_manager->GetContext();
++  if (!network_context) {
++    return;
++  }
++
++  net::NetworkTrafficAnnotationTag traffic_annotation =
++      net::DefineNetworkTrafficAnnotation("browseros_liveness_socket", R"(
++        semantics {
++          sender: "BrowserOS Server Manager"
++          description:
++            "Holds an idle TCP connection to the local BrowserOS MCP "
++            "server so its death is detected immediately instead of on "
++            "the next periodic health check."
++          trigger: "Opened once after the server process launches."
++          data: "No data sent; the connection is only watched for close."
++          destination: LOCAL
++        }
++        policy {
++          cookies_allowed: NO
++          setting: "This feature cannot be disabled by settings."
++          policy_exception_justification:
++            "Internal liveness monitoring for BrowserOS server."
++        })");
++
++  net::AddressList addresses(net::IPEndPoint(
++      net::IPAddress::IPv4Localhost(), static_cast<uint16_t>(mcp_port_)));
++  network_context->CreateTCPConnectedSocket(
++      /*local_addr=*/std::nullopt, addresses,
++      /*tcp_connected_socket_options=*/nullptr,
++      net::MutableNetworkTrafficAnnotationTag(traffic_annotation),
++      liveness_socket_.BindNewPipeAndPassReceiver(),
++      /*observer=*/mojo::NullRemote(),
++      base::BindOnce(&BrowserOSServerManager::OnLivenessSocketConnected,
++                     weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSServerManager::OnLivenessSocketConnected(
++    int result,
++    const std::optional<net::IPEndPoint>& local_addr,
++    const std::optional<net::IPEndPoint>& peer_addr,
++    mojo::ScopedDataPipeConsumerHandle receive_stream,
++    mojo::ScopedDataPipeProducerHandle send_stream) {
++  if (result != net::OK) {
++    // The server may still be binding its listen socket; the next
++    // passing health check retries the connection.
++    LOG(WARNING) << "browseros: Liveness connection failed: "
++                 << net::ErrorToString(result);
++    ResetLivenessSocket();
++    return;
++  }
++
++  liveness_receive_stream_ = std::move(receive_stream);
++  liveness_send_stream_ = std::move(send_stream);
++
++  // Watch for the connection going away. The network service closes the
++  // receive pipe as soon as the TCP connection drops, which is immediate
++  // when the server process dies.
++  liveness_watcher_ = std::make_unique<mojo::SimpleWatcher>(
++      FROM_HERE, mojo::SimpleWatcher::ArmingPolicy::AUTOMATIC);
++  liveness_watcher_->Watch(
++      liveness_receive_stream_.get(), MOJO_HANDLE_SIGNAL_PEER_CLOSED,
++      MOJO_TRIGGER_CONDITION_SIGNALS_SATISFIED,
++      base::BindRepeating(&BrowserOSServerManager::OnLivenessSocketBroken,
++                          weak_factory_.GetWeakPtr()));
++
++  LOG(INFO) << "browseros: Liveness connection to MCP server established";
++}
++
++void BrowserOSServerManager::OnLivenessSocketBroken(
++    MojoResult result,
++    const mojo::HandleSignalsState& state) {
++  ResetLivenessSocket();
++  if (!is_running_) {
++    return;
++  }
++
++  // A dropped connection usually means the server process died, but it
++  // can also be an idle-timeout close on the server side. Confirm over
++  // HTTP before restarting: against a dead process the probe fails with
++  // connection refused within milliseconds, so restart decisions still
++  // fire within a second of a crash.
++  LOG(WARNING) << "browseros: Liveness connection closed, probing server "
++                  "health";
++  CheckServerHealth();
++}
++
++void BrowserOSServerManager::ResetLivenessSocket() {
++  liveness_watcher_.reset();
++  liveness_receive_stream_.reset();
++  liveness_send_stream_.reset();
++  liveness_socket_.reset();
++}
++
 +void BrowserOSServerManager::RestartBrowserOSProcess() {
 +  LOG(INFO) << "browseros: Restarting BrowserOS server process";
 +
@@ -930,6 +1738,7 @@ index 0000000000000..f930bf5bc0107
 +  // Stop all timers during restart to prevent races
 +  health_check_timer_.Stop();
 +  process_check_timer_.Stop();
++  ResetLivenessSocket();
 +
 +  // Capture current ports for background thread
 +  int cdp = cdp_port_;
@@ -940,14 +1749,14 @@ index 0000000000000..f930bf5bc0107
 +  // Kill process on background thread, wait for port release, revalidate, launch
 +  base::ThreadPool::PostTaskAndReplyWithResult(
 +      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
-+      base::BindOnce(
++      browseros::AnnotateTask("ServerManager", base::BindOnce(
 +          [](BrowserOSServerManager* manager, int cdp, int mcp, int agent,
 +             int extension) -> RevalidatedPorts {
 +            manager->TerminateBrowserOSProcess(/*wait=*/true);
 +            return manager->RevalidatePortsForRestart(cdp, mcp, agent, extension,
 +                                            /*revalidate_all=*/false);
 +          },
-+          base::Unretained(this), cdp, mcp, agent, extension),
++          base::Unretained(this), cdp, mcp, agent, extension)),
 +      base::BindOnce(&BrowserOSServerManager::OnPortsRevalidated,
 +                     weak_factory_.GetWeakPtr()));
 +}
@@ -1034,6 +1843,7 @@ index 0000000000000..f930bf5bc0107
 +  is_restarting_ = true;
 +  health_check_timer_.Stop();
 +  process_check_timer_.Stop();
++  ResetLivenessSocket();
 +
 +  int cdp = cdp_port_;
 +  int mcp = mcp_port_;
@@ -1042,14 +1852,14 @@ index 0000000000000..f930bf5bc0107
 +
 +  base::ThreadPool::PostTaskAndReplyWithResult(
 +      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
-+      base::BindOnce(
++      browseros::AnnotateTask("ServerManager", base::BindOnce(
 +          [](BrowserOSServerManager* manager, int cdp, int mcp, int agent,
 +             int extension) -> RevalidatedPorts {
 +            manager->TerminateBrowserOSProcess(/*wait=*/true);
 +            return manager->RevalidatePortsForRestart(cdp, mcp, agent, extension,
 +                                            /*revalidate_all=*/false);
 +          },
-+          base::Unretained(this), cdp, mcp, agent, extension),
++          base::Unretained(this), cdp, mcp, agent, extension)),
 +      base::BindOnce(&BrowserOSServerManager::OnPortsRevalidated,
 +                     weak_factory_.GetWeakPtr()));
 +}
@@ -1069,14 +1879,129 @@ index 0000000000000..f930bf5bc0107
 +  if (new_value != allow_remote_in_mcp_) {
 +    LOG(INFO) << "browseros: allow_remote_in_mcp preference changed from "
 +              << (allow_remote_in_mcp_ ? "true" : "false") << " to "
-+              << (new_value ? "true" : "false")
-+              << ", restarting server...";
++              << (new_value ? "true" : "false");
 +
 +    allow_remote_in_mcp_ = new_value;
 +
-+    // Restart server to apply new config
++    // Push the change to the running server; hot-reloadable keys apply
++    // without bouncing the server (and its sessions), everything else
++    // falls back to a restart.
++    PushConfigUpdate("allow_remote_in_mcp", base::Value(new_value));
++  }
++}
++
++void BrowserOSServerManager::PushConfigUpdate(const std::string& key,
++                                              base::Value value) {
++  if (!is_running_) {
++    return;
++  }
++
++  if (!IsHotReloadableConfigKey(key)) {
++    LOG(INFO) << "browseros: Config key " << key
++              << " requires restart, restarting server...";
++    RestartBrowserOSProcess();
++    return;
++  }
++
++  base::FilePath execution_dir = prewarmed_paths_
++                                     ? prewarmed_paths_->execution_dir
++                                     : GetBrowserOSExecutionDir();
++
++  // Persist the new value first, then tell the server to reload; the
++  // on-disk config stays the single source of truth either way.
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
++      browseros::AnnotateTask(
++          "ServerManager",
++          base::BindOnce(&UpdateConfigFlagOnDisk, execution_dir, key,
++                         std::move(value))),
++      base::BindOnce(&BrowserOSServerManager::OnConfigFlagWritten,
++                     weak_factory_.GetWeakPtr(), key));
++}
++
++void BrowserOSServerManager::OnConfigFlagWritten(const std::string& key,
++                                                 bool success) {
++  if (!is_running_) {
++    return;
++  }
++
++  if (!success) {
++    LOG(WARNING) << "browseros: Failed to update on-disk config for " << key
++                 << ", restarting server...";
 +    RestartBrowserOSProcess();
++    return;
++  }
++
++  GURL reload_url("http://127.0.0.1:" + base::NumberToString(mcp_port_) +
++                  "/config/reload");
++
++  net::NetworkTrafficAnnotationTag traffic_annotation =
++      net::DefineNetworkTrafficAnnotation("browseros_config_reload", R"(
++        semantics {
++          sender: "BrowserOS Server Manager"
++          description:
++            "Notifies the local BrowserOS server that a configuration "
++            "value changed so it can reload config.json in place instead "
++            "of being restarted."
++          trigger: "A BrowserOS server preference changed in settings."
++          data: "The names of the changed configuration keys."
++          destination: LOCAL
++        }
++        policy {
++          cookies_allowed: NO
++          setting: "This feature cannot be disabled by settings."
++          policy_exception_justification:
++            "Internal config propagation for BrowserOS server."
++        })");
++
++  auto resource_request = std::make_unique<network::ResourceRequest>();
++  resource_request->url = reload_url;
++  resource_request->method = "POST";
++  resource_request->credentials_mode = network::mojom::CredentialsMode::kOmit;
++
++  auto url_loader = network::SimpleURLLoader::Create(
++      std::move(resource_request), traffic_annotation);
++  url_loader->AttachStringForUpload("{\"changed\":[\"" + key + "\"]}",
++                                    "application/json");
++  url_loader->SetTimeoutDuration(browseros_server::kStatusCheckTimeout);
++
++  scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory =
++      browseros::GetLoopbackURLLoaderFactory();
++
++  auto* url_loader_ptr = url_loader.get();
++  url_loader_ptr->DownloadToString(
++      url_loader_factory.get(),
++      base::BindOnce(&BrowserOSServerManager::OnConfigPushComplete,
++                     weak_factory_.GetWeakPtr(), key, std::move(url_loader)),
++      1024);
++}
++
++void BrowserOSServerManager::OnConfigPushComplete(
++    const std::string& key,
++    std::unique_ptr<network::SimpleURLLoader> url_loader,
++    std::unique_ptr<std::string> response_body) {
++  if (!is_running_) {
++    return;
 +  }
++
++  int response_code = 0;
++  if (url_loader->ResponseInfo() && url_loader->ResponseInfo()->headers) {
++    response_code = url_loader->ResponseInfo()->headers->response_code();
++  }
++
++  if (response_code == 200) {
++    LOG(INFO) << "browseros: Server applied config change for " << key
++              << " without restart";
++    return;
++  }
++
++  // Older server binaries do not expose /config/reload; they already have
++  // the new value on disk, so a restart applies it the old way.
++  LOG(WARNING) << "browseros: Server could not hot-reload " << key
++               << " (HTTP " << response_code
++               << ", net error: " << net::ErrorToString(url_loader->NetError())
++               << "), restarting server...";
++  RestartBrowserOSProcess();
 +}
 +
 +void BrowserOSServerManager::OnRestartServerRequestedChanged() {
@@ -1101,27 +2026,69 @@ index 0000000000000..f930bf5bc0107
 +    const std::set<int>& excluded_ports) {
 +  LOG(INFO) << "browseros: Finding port starting from " << starting_port;
 +
-+  for (int i = 0; i < kMaxPortAttempts; i++) {
-+    int port_to_try = starting_port + i;
-+
-+    if (port_to_try > kMaxPort) {
++  // Candidates are probed in concurrent batches: each IsPortAvailable()
++  // call makes two bind attempts, and on machines with many reserved
++  // ports walking the range one port at a time stalls startup for
++  // hundreds of milliseconds. The lowest available candidate in the
++  // batch still wins, so the result matches the sequential walk. The
++  // starting port comes from prefs (the last port that worked), so the
++  // common case is a single-probe batch hit on the first candidate.
++  constexpr size_t kPortProbeBatchSize = 8;
++
++  int next_port = starting_port;
++  const int end_port = starting_port + kMaxPortAttempts;
++  while (next_port < end_port && next_port <= kMaxPort) {
++    // Gather the next batch of candidates, skipping ports already
++    // assigned to other BrowserOS services.
++    std::vector<int> candidates;
++    for (; next_port < end_port && next_port <= kMaxPort &&
++           candidates.size() < kPortProbeBatchSize;
++         ++next_port) {
++      if (excluded_ports.count(next_port) > 0) {
++        continue;
++      }
++      candidates.push_back(next_port);
++    }
++    if (candidates.empty()) {
 +      break;
 +    }
 +
-+    // Skip ports already assigned to other BrowserOS services
-+    if (excluded_ports.count(port_to_try) > 0) {
-+      continue;
++    // Probe the whole batch concurrently; the singleton outlives every
++    // task, and all tasks finish before the locals go out of scope.
++    std::vector<uint8_t> available(candidates.size(), 0);
++    std::atomic<size_t> remaining(candidates.size());
++    base::WaitableEvent done;
++    for (size_t i = 0; i < candidates.size(); ++i) {
++      base::ThreadPool::PostTask(
++          FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_BLOCKING},
++          browseros::AnnotateTask("ServerManager", base::BindOnce(
++              [](BrowserOSServerManager* manager, int port, uint8_t* slot,
++                 std::atomic<size_t>* remaining, base::WaitableEvent* done) {
++                *slot = manager->IsPortAvailable(port) ? 1 : 0;
++                if (remaining->fetch_sub(1) == 1) {
++                  done->Signal();
++                }
++              },
++              base::Unretained(this), candidates[i], &available[i],
++              &remaining, &done)));
++    }
++    {
++      base::ScopedAllowBaseSyncPrimitives allow_sync;
++      done.Wait();
 +    }
 +
-+    if (IsPortAvailable(port_to_try)) {
-+      if (port_to_try != starting_port) {
++    for (size_t i = 0; i < candidates.size(); ++i) {
++      if (!available[i]) {
++        continue;
++      }
++      if (candidates[i] != starting_port) {
 +        LOG(INFO) << "browseros: Port " << starting_port
-+                  << " was in use or excluded, using " << port_to_try
++                  << " was in use or excluded, using " << candidates[i]
 +                  << " instead";
 +      } else {
-+        LOG(INFO) << "browseros: Using port " << port_to_try;
++        LOG(INFO) << "browseros: Using port " << candidates[i];
 +      }
-+      return port_to_try;
++      return candidates[i];
 +    }
 +  }
 +
@@ -1249,6 +2216,24 @@ index 0000000000000..f930bf5bc0107
 +  return exec_dir;
 +}
 +
++base::FilePath BrowserOSServerManager::GetCDPSocketPath() const {
++#if BUILDFLAG(IS_POSIX)
++  if (!base::CommandLine::ForCurrentProcess()->HasSwitch(
++          browseros::kUDSTransport)) {
++    return base::FilePath();
++  }
++  base::FilePath exec_dir = GetBrowserOSExecutionDir();
++  if (exec_dir.empty()) {
++    return base::FilePath();
++  }
++  return exec_dir.Append(FILE_PATH_LITERAL("cdp.sock"));
++#else
++  // Named pipes are not wired into the DevTools socket factory on
++  // Windows; the TCP transport stays in use there.
++  return base::FilePath();
++#endif
++}
++
 +base::FilePath BrowserOSServerManager::GetBrowserOSServerExecutablePath() const {
 +  base::FilePath browseros_exe =
 +      GetBrowserOSServerResourcesPath()
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_manager.h b/chrome/browser/browseros/server/browseros_server_manager.h
 new file mode 100644
-index 0000000000000..7d78115c373ef
+index 0000000000000..30da60dbaacc4
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_manager.h
-@@ -0,0 +1,189 @@
+@@ -0,0 +1,353 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,16 +11,25 @@ index 0000000000000..7d78115c373ef
 +#ifndef CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SERVER_MANAGER_H_
 +#define CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SERVER_MANAGER_H_
 +
++#include <atomic>
 +#include <memory>
++#include <optional>
 +#include <set>
 +
 +#include "base/files/file.h"
 +#include "base/files/file_path.h"
++#include "base/memory/memory_pressure_listener.h"
 +#include "base/memory/ref_counted.h"
 +#include "base/memory/weak_ptr.h"
 +#include "base/no_destructor.h"
 +#include "base/process/process.h"
 +#include "base/timer/timer.h"
++#include "base/trace_event/memory_dump_provider.h"
++#include "base/values.h"
++#include "mojo/public/cpp/bindings/remote.h"
++#include "mojo/public/cpp/system/data_pipe.h"
++#include "mojo/public/cpp/system/simple_watcher.h"
++#include "services/network/public/mojom/tcp_socket.mojom.h"
 +
 +class PrefChangeRegistrar;
 +
@@ -30,6 +39,7 @@ index 0000000000000..7d78115c373ef
 +
 +namespace net {
 +class HttpResponseHeaders;
++class IPEndPoint;
 +}
 +
 +namespace network {
@@ -43,7 +53,7 @@ index 0000000000000..7d78115c373ef
 +// 1. Starts Chromium's CDP WebSocket server (port 9222+, auto-discovered)
 +// 2. Launches the bundled BrowserOS server binary with CDP and MCP ports
 +// 3. Monitors MCP server health via HTTP /health endpoint and auto-restarts
-+class BrowserOSServerManager {
++class BrowserOSServerManager : public base::trace_event::MemoryDumpProvider {
 + public:
 +  static BrowserOSServerManager* GetInstance();
 +
@@ -58,6 +68,11 @@ index 0000000000000..7d78115c373ef
 +  // 4. Launch browseros_server binary with discovered ports
 +  void Start();
 +
++  // Starts a launch that Start() deferred (--browseros-defer-server-start).
++  // Called on the first browserOS API use in the session; no-op when the
++  // server is already running or the launch was not deferred.
++  void EnsureStarted();
++
 +  // Stops the BrowserOS server
 +  void Stop();
 +
@@ -79,6 +94,14 @@ index 0000000000000..7d78115c373ef
 +  // Returns whether remote connections are allowed in MCP server
 +  bool IsAllowRemoteInMCP() const { return allow_remote_in_mcp_; }
 +
++  // Current system memory pressure as observed by this process's
++  // base::MemoryPressureListener. A recorded level decays back to NONE
++  // when no fresh signal arrives (the listener only reports elevations).
++  // The browserOS API layer reads this to shed load under critical
++  // pressure: viewport-only snapshots, no screenshots.
++  base::MemoryPressureListener::MemoryPressureLevel GetMemoryPressureLevel()
++      const;
++
 +  // Called when browser is shutting down
 +  void Shutdown();
 +
@@ -92,13 +115,43 @@ index 0000000000000..7d78115c373ef
 +  using UpdateCompleteCallback = base::OnceCallback<void(bool success)>;
 +  void RestartServerForUpdate(UpdateCompleteCallback callback);
 +
++  // Why a launch attempt produced no process. Transient classes (disk or
++  // AV contention) are retried with backoff; permanent ones (nothing on
++  // disk to run) are not retried at all. Values are recorded to the
++  // BrowserOS.Launch.FailureClass histogram, so entries must not be
++  // renumbered.
++  enum class LaunchFailure {
++    kNone = 0,                     // Launch succeeded
++    kBinaryMissing = 1,            // Neither primary nor bundled binary exists
++    kExecutionDirUnavailable = 2,  // Execution dir unresolvable or uncreatable
++    kConfigWriteFailed = 3,        // Could not write the config JSON
++    kProcessSpawnFailed = 4,       // base::LaunchProcess returned no process
++    kMaxValue = kProcessSpawnFailed,
++  };
++
++  // Restart delay for the given backoff exponent (>= 1): exponential from
++  // one second, capped at thirty, with +/-25% jitter so a fleet hitting
++  // the same fault doesn't retry in lockstep. Both the crash-restart and
++  // launch-retry paths compute their delays through this. Static and
++  // environment-free so the lifecycle soak harness can drive thousands of
++  // cycles through the exact production computation.
++  static base::TimeDelta ComputeRestartBackoff(int backoff_exponent);
++
 +  // Result from launching the server process on background thread
 +  // Public because it's used by free function LaunchProcessOnBackgroundThread
 +  struct LaunchResult {
 +    base::Process process;
 +    bool used_fallback = false;  // True if fell back to bundled binary
++    LaunchFailure failure = LaunchFailure::kNone;
 +  };
 +
++  // base::trace_event::MemoryDumpProvider:
++  // Itemizes the tracked server process under "browseros/server" in
++  // chrome://memory-internals. Runs on a thread-pool dump sequence, so it
++  // reads only |dump_pid_|, never the UI-thread state above.
++  bool OnMemoryDump(const base::trace_event::MemoryDumpArgs& args,
++                    base::trace_event::ProcessMemoryDump* pmd) override;
++
 + private:
 +  friend base::NoDestructor<BrowserOSServerManager>;
 +
@@ -109,17 +162,49 @@ index 0000000000000..7d78115c373ef
 +    int extension_port;
 +  };
 +
++  // Launch paths resolved ahead of time on the thread pool so the launch
++  // itself skips the blocking path checks (see PrewarmLaunchPaths()).
++  struct PrewarmedPaths {
++    base::FilePath exe_path;
++    base::FilePath resources_dir;
++    base::FilePath execution_dir;
++    bool exe_exists = false;
++  };
++
 +  BrowserOSServerManager();
-+  ~BrowserOSServerManager();
++  ~BrowserOSServerManager() override;
 +
 +  bool AcquireLock();
 +
++  // Shared-server mode (--browseros-shared-server): called when another
++  // browser process of this installation holds the server lock. Reads
++  // that process's config to adopt the running server's ports so API
++  // consumers here reach it; the owner keeps all lifecycle duties.
++  // Returns false when the owner's config is missing or unreadable.
++  bool TryAttachToSharedServer();
++
++  // The actual startup sequence. Start() reaches it through an
++  // idle-priority post (or not at all with
++  // --browseros-defer-server-start); EnsureStarted() calls it directly on
++  // first API use.
++  void StartNow();
++
++  // Idle-priority continuation of Start(); runs StartNow() unless
++  // EnsureStarted() already did.
++  void StartIfStillPending();
++
 +  // Port initialization for startup (called in order by Start())
 +  void LoadPortsFromPrefs();       // 1. Load saved values from prefs
 +  void SetupPrefObservers();       // 2. Set up pref change observers
 +  void ResolvePortsForStartup();   // 3. MCP stays stable, others find available
 +  void ApplyCommandLineOverrides(); // 4. Apply --cdp-port, --mcp-port, etc.
 +  void SavePortsToPrefs();         // 5. Save final values to prefs
++  // Resolves bundled binary/resources paths and creates the execution
++  // directory on the thread pool at construction, overlapping that I/O
++  // with the rest of browser startup.
++  void PrewarmLaunchPaths();
++  void OnLaunchPathsPrewarmed(PrewarmedPaths paths);
++
 +  void StartCDPServer();
 +  void StopCDPServer();
 +  void LaunchBrowserOSProcess();
@@ -144,16 +229,61 @@ index 0000000000000..7d78115c373ef
 +  // Updates member vars and prefs if changed, then launches process.
 +  void OnPortsRevalidated(RevalidatedPorts ports);
 +
++  // Schedules another launch attempt after a transient launch failure,
++  // using the crash-restart backoff. Gives up (leaving CDP up, no server)
++  // once kMaxStartupFailures attempts in a row have failed.
++  void ScheduleLaunchRetry(LaunchFailure failure);
++
 +  void OnProcessExited(int exit_code);
++  // Performs the restart after a crash (possibly delayed by backoff):
++  // writes the resume snapshot, revalidates ports and relaunches.
++  void StartCrashRestart(int exit_code, bool revalidate_all);
 +  void CheckServerHealth();
++  // |start_time| is when the probe was issued; a successful response
++  // records the round trip under BrowserOS.Server.HealthCheck.Rtt.
 +  void OnHealthCheckComplete(
 +      std::unique_ptr<network::SimpleURLLoader> url_loader,
++      base::TimeTicks start_time,
 +      scoped_refptr<net::HttpResponseHeaders> headers);
++
++  // Config hot-reload: persists the changed key to the on-disk config and
++  // tells the running server to reload it in place, so a settings toggle
++  // does not bounce the server and drop its sessions. Keys the server
++  // cannot apply in place, and servers that fail the reload request, fall
++  // back to a full restart.
++  void PushConfigUpdate(const std::string& key, base::Value value);
++  void OnConfigFlagWritten(const std::string& key, bool success);
++  void OnConfigPushComplete(
++      const std::string& key,
++      std::unique_ptr<network::SimpleURLLoader> url_loader,
++      std::unique_ptr<std::string> response_body);
++
++  // Persistent liveness connection to the MCP port. The TCP connection
++  // closing is observed immediately when the server process dies, so a
++  // crash triggers a health probe (and restart) within a second instead
++  // of waiting out the polling interval.
++  void ConnectLivenessSocket();
++  void OnLivenessSocketConnected(
++      int result,
++      const std::optional<net::IPEndPoint>& local_addr,
++      const std::optional<net::IPEndPoint>& peer_addr,
++      mojo::ScopedDataPipeConsumerHandle receive_stream,
++      mojo::ScopedDataPipeProducerHandle send_stream);
++  void OnLivenessSocketBroken(MojoResult result,
++                              const mojo::HandleSignalsState& state);
++  void ResetLivenessSocket();
++
++  void OnMemoryPressure(
++      base::MemoryPressureListener::MemoryPressureLevel level);
++
 +  void OnAllowRemoteInMCPChanged();
 +  void OnRestartServerRequestedChanged();
 +  void CheckProcessStatus();
 +
 +  base::FilePath GetBrowserOSExecutionDir() const;
++  // Path of the CDP Unix domain socket, or empty when the UDS transport
++  // is not enabled (--browseros-uds-transport, POSIX only).
++  base::FilePath GetCDPSocketPath() const;
 +  // Finds an available port starting from starting_port, excluding ports
 +  // already assigned to other services to prevent collisions.
 +  int FindAvailablePort(int starting_port, const std::set<int>& excluded_ports);
@@ -161,32 +291,66 @@ index 0000000000000..7d78115c373ef
 +
 +  base::File lock_file_;  // System-wide lock to ensure single instance
 +  base::Process process_;
++  // Pid of |process_| mirrored for OnMemoryDump(), which runs off the UI
++  // thread. kNullProcessId while no server process is running.
++  std::atomic<base::ProcessId> dump_pid_{base::kNullProcessId};
 +  int cdp_port_ = 0;  // CDP port (auto-discovered)
 +  int mcp_port_ = 0;  // MCP port (auto-discovered)
 +  int agent_port_ = 0;  // Agent port (auto-discovered)
 +  int extension_port_ = 0;  // Extension port (auto-discovered)
 +  bool allow_remote_in_mcp_ = false;  // Whether remote connections allowed in MCP
 +  bool is_running_ = false;
++  bool start_deferred_ = false;  // Launch postponed until first API use
++  // Riding on another process's server (shared-server mode); no local
++  // process, CDP endpoint or monitoring to manage.
++  bool attached_to_shared_server_ = false;
 +  bool is_restarting_ = false;  // Whether server is currently restarting
 +  bool is_updating_ = false;    // Whether restarting for OTA update
 +  UpdateCompleteCallback update_complete_callback_;
 +
 +  // Crash tracking for automatic rollback
 +  int consecutive_startup_failures_ = 0;
++  // Transient launch failures retried so far (reset on a successful
++  // launch); kept separate from the crash counter above, which tracks
++  // processes that started and then died early.
++  int launch_retry_count_ = 0;
 +  base::TimeTicks last_launch_time_;
 +
++  // Crash-loop restart backoff (exponent grows per early crash, resets
++  // after a healthy run)
++  int restart_backoff_exponent_ = 0;
++  base::OneShotTimer restart_backoff_timer_;
++
 +  // Timer for health checks
 +  base::RepeatingTimer health_check_timer_;
 +
++  // Persistent connection to the MCP port for instant crash detection.
++  // The watcher fires when the network service closes the receive pipe,
++  // which happens as soon as the TCP connection drops.
++  mojo::Remote<network::mojom::TCPConnectedSocket> liveness_socket_;
++  mojo::ScopedDataPipeConsumerHandle liveness_receive_stream_;
++  mojo::ScopedDataPipeProducerHandle liveness_send_stream_;
++  std::unique_ptr<mojo::SimpleWatcher> liveness_watcher_;
++
 +  // Timer for process status checks
 +  base::RepeatingTimer process_check_timer_;
 +
++  // Memory-pressure tracking for API-layer load shedding (UI thread)
++  std::unique_ptr<base::MemoryPressureListener> memory_pressure_listener_;
++  base::MemoryPressureListener::MemoryPressureLevel memory_pressure_level_ =
++      base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE;
++  base::TimeTicks last_memory_pressure_time_;
++
 +  // Preference change registrar for monitoring pref changes
 +  std::unique_ptr<PrefChangeRegistrar> pref_change_registrar_;
 +
 +  // Server updater for OTA updates
 +  std::unique_ptr<browseros_server::BrowserOSServerUpdater> updater_;
 +
++  // Filled in by the prewarm task; unset if the launch wins the race,
++  // in which case paths are resolved inline as before.
++  std::optional<PrewarmedPaths> prewarmed_paths_;
++
 +  base::WeakPtrFactory<BrowserOSServerManager> weak_factory_{this};
 +};
 +
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_prefs.cc b/chrome/browser/browseros/server/browseros_server_prefs.cc
 new file mode 100644
-index 0000000000000..9ea53758657d7
+index 0000000000000..de5416114f81e
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_prefs.cc
-@@ -0,0 +1,58 @@
+@@ -0,0 +1,64 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -17,6 +17,9 @@ index 0000000000000..9ea53758657d7
 +// CDP server port (0 = auto-assign random port on startup)
 +const char kCDPServerPort[] = "browseros.server.cdp_port";
 +
++// Accept backlog for the CDP listen socket
++const char kCDPAcceptBacklog[] = "browseros.server.cdp_accept_backlog";
++
 +// MCP server port (HTTP)
 +const char kMCPServerPort[] = "browseros.server.mcp_port";
 +
@@ -42,6 +45,9 @@ index 0000000000000..9ea53758657d7
 +  // CDP port
 +  registry->RegisterIntegerPref(kCDPServerPort, kDefaultCDPPort);
 +
++  // CDP accept backlog
++  registry->RegisterIntegerPref(kCDPAcceptBacklog, kDefaultCDPAcceptBacklog);
++
 +  // MCP port
 +  registry->RegisterIntegerPref(kMCPServerPort, kDefaultMCPPort);
 +
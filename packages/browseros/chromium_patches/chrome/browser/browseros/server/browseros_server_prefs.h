@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_prefs.h b/chrome/browser/browseros/server/browseros_server_prefs.h
 new file mode 100644
-index 0000000000000..0506a219c6272
+index 0000000000000..bbe3e7ec740dd
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_prefs.h
-@@ -0,0 +1,35 @@
+@@ -0,0 +1,41 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -21,8 +21,14 @@ index 0000000000000..0506a219c6272
 +inline constexpr int kDefaultAgentPort = 9200;
 +inline constexpr int kDefaultExtensionPort = 9300;
 +
++// Default accept backlog for the CDP listen socket. Automation hosts
++// open bursts of parallel CDP connections; a burst deeper than the
++// backlog gets connection resets instead of queueing.
++inline constexpr int kDefaultCDPAcceptBacklog = 64;
++
 +// Preference keys for BrowserOS server configuration
 +extern const char kCDPServerPort[];
++extern const char kCDPAcceptBacklog[];
 +extern const char kMCPServerPort[];
 +extern const char kAgentServerPort[];
 +extern const char kExtensionServerPort[];
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/browseros/server/browseros_server_updater.h b/chrome/browser/browseros/server/browseros_server_updater.h
 new file mode 100644
-index 0000000000000..03bdaf2bb38bc
+index 0000000000000..44e947c79532b
 --- /dev/null
 +++ b/chrome/browser/browseros/server/browseros_server_updater.h
-@@ -0,0 +1,176 @@
+@@ -0,0 +1,242 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,8 +11,12 @@ index 0000000000000..03bdaf2bb38bc
 +#ifndef CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SERVER_UPDATER_H_
 +#define CHROME_BROWSER_BROWSEROS_SERVER_BROWSEROS_SERVER_UPDATER_H_
 +
++#include <stdint.h>
++
 +#include <memory>
++#include <optional>
 +#include <string>
++#include <vector>
 +
 +#include "base/files/file_path.h"
 +#include "base/memory/raw_ptr.h"
@@ -40,7 +44,7 @@ index 0000000000000..03bdaf2bb38bc
 +// 4. Verify Ed25519 signature
 +// 5. Extract to versions/{version}/
 +// 6. Test binary with --version
-+// 7. Update current_version file
++// 7. Record the new version in the versions manifest
 +// 8. Signal manager to use new binary on next restart
 +class BrowserOSServerUpdater {
 + public:
@@ -70,10 +74,27 @@ index 0000000000000..03bdaf2bb38bc
 +  base::FilePath GetBestServerResourcesPath();
 +
 +  // Called by manager when downloaded version is unusable (missing or crashes).
-+  // Nukes all downloaded versions and current_version file, forcing fallback
-+  // to bundled binary until next successful update.
++  // Nukes all downloaded versions and the manifest's recorded version,
++  // forcing fallback to bundled binary until next successful update.
 +  void InvalidateDownloadedVersion();
 +
++  // Partial-download state recovered from the pending update directory.
++  // Public because it's produced by a free function on a background thread.
++  struct ResumeInfo {
++    int64_t offset = 0;
++    std::vector<std::string> chunk_hashes;
++  };
++
++  // Startup state loaded from the versions manifest in one read: the
++  // recorded downloaded version plus the bundled binary's --version check
++  // result. Public because it's produced by a free function on a
++  // background thread.
++  struct VersionCacheState {
++    std::string downloaded_version;
++    int bundled_exit_code = 1;
++    std::string bundled_output;
++  };
++
 + private:
 +  enum class State {
 +    kIdle,
@@ -85,6 +106,9 @@ index 0000000000000..03bdaf2bb38bc
 +  };
 +
 +  void OnUpdateTimer();
++  // Arms the one-shot check timer for the next window; the delay stretches
++  // by kBatteryCheckIntervalMultiplier while on battery power.
++  void ScheduleNextCheck();
 +
 +  // Appcast flow
 +  void FetchAppcast();
@@ -98,6 +122,19 @@ index 0000000000000..03bdaf2bb38bc
 +                            bool exists);
 +  void StartDownload(const AppcastEnclosure& enclosure,
 +                     const base::Version& version);
++  // Resumable chunked download: each HTTP range chunk is appended to the
++  // partial zip and its checksum persisted, so an interrupted download
++  // resumes from the last good chunk on the next update cycle.
++  void OnResumeInfoLoaded(ResumeInfo info);
++  void DownloadNextChunk();
++  void OnChunkDownloaded(std::unique_ptr<std::string> body);
++  void OnChunkPersisted(int64_t chunk_size, std::string chunk_hash);
++  void ScheduleNextChunk();
++  // Single-shot download for servers that ignore the Range header.
++  void StartFullDownload();
++  // Abandons the in-progress delta update and restarts the download with
++  // the full enclosure from the same appcast item.
++  void FallBackToFullDownload(const std::string& reason);
 +  void OnDownloadComplete(const base::Version& version,
 +                          base::FilePath zip_path);
 +
@@ -115,7 +152,9 @@ index 0000000000000..03bdaf2bb38bc
 +                            int exit_code,
 +                            const std::string& output);
 +
-+  // Hot-swap flow
++  // Hot-swap flow. While the server reports busy, the tested update stays
++  // armed and /status is re-polled on a short bounded timer, so the swap
++  // happens near the first idle moment rather than on the next cycle.
 +  void CheckServerStatus();
 +  void OnStatusFetched(std::unique_ptr<std::string> response);
 +  void OnServerStatusChecked(bool can_update);
@@ -129,9 +168,7 @@ index 0000000000000..03bdaf2bb38bc
 +  base::Version GetBundledVersion();
 +  base::Version GetLatestDownloadedVersion();
 +  void LoadVersionCachesAsync();
-+  void OnDownloadedVersionLoaded(const std::string& version_str);
-+  void OnBundledVersionLoaded(int exit_code, const std::string& output);
-+  void CheckVersionCachesAndStart();
++  void OnVersionCachesLoaded(VersionCacheState state);
 +  void WriteCurrentVersionFile(const base::Version& version);
 +
 +  // Path helpers
@@ -139,6 +176,7 @@ index 0000000000000..03bdaf2bb38bc
 +  base::FilePath GetVersionsDir() const;
 +  base::FilePath GetVersionDir(const base::Version& version) const;
 +  base::FilePath GetPendingUpdateDir() const;
++  base::FilePath GetVersionsManifestPath() const;
 +  base::FilePath GetBundledBinaryPath() const;
 +  base::FilePath GetBundledResourcesPath() const;
 +  base::FilePath GetDownloadedBinaryPath(const base::Version& version) const;
@@ -154,7 +192,9 @@ index 0000000000000..03bdaf2bb38bc
 +
 +  raw_ptr<browseros::BrowserOSServerManager> manager_;
 +
-+  base::RepeatingTimer update_check_timer_;
++  // One-shot and re-armed after each check rather than repeating, so each
++  // window's delay can account for the current power state.
++  base::OneShotTimer update_check_timer_;
 +
 +  State state_ = State::kIdle;
 +  bool update_in_progress_ = false;
@@ -168,11 +208,37 @@ index 0000000000000..03bdaf2bb38bc
 +  AppcastItem pending_item_;
 +  std::string pending_signature_;
 +
-+  // Cached versions (loaded async at startup via --version)
++  // Busy-wait for hot-swap: re-polls of /status while the server reports
++  // it cannot be swapped, and the session count from the last response
++  // (when the server provides one) for the busy metrics.
++  base::OneShotTimer busy_retry_timer_;
++  int busy_retry_count_ = 0;
++  std::optional<int> last_active_sessions_;
++
++  // Delta update bookkeeping: whether the current download is a delta
++  // patch, and the full enclosure to fall back to if applying it fails.
++  bool using_delta_ = false;
++  AppcastEnclosure pending_full_enclosure_;
++
++  // Conditional appcast fetching: validators from the last fresh response
++  // (sent back as If-None-Match / If-Modified-Since) and a parse cache for
++  // bodies we have already seen.
++  std::string appcast_etag_;
++  std::string appcast_last_modified_;
++  size_t appcast_content_hash_ = 0;
++  std::optional<AppcastItem> cached_appcast_item_;
++
++  // Resumable download bookkeeping
++  std::string download_url_;
++  base::Version download_version_;
++  int64_t download_offset_ = 0;
++  int64_t download_total_ = -1;  // Unknown until the first 206 response
++  std::vector<std::string> download_chunk_hashes_;
++
++  // Cached versions (loaded async at startup from the versions manifest)
 +  base::Version cached_bundled_version_;
 +  base::Version cached_downloaded_version_;
-+  bool bundled_version_loaded_ = false;
-+  bool downloaded_version_loaded_ = false;
++  bool version_caches_loaded_ = false;
 +
 +  base::WeakPtrFactory<BrowserOSServerUpdater> weak_factory_{this};
 +};
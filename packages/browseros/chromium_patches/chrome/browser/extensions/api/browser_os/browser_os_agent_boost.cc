@@ -0,0 +1,104 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_agent_boost.cc b/chrome/browser/extensions/api/browser_os/browser_os_agent_boost.cc
+new file mode 100644
+index 0000000000000..b6d07dc725fc0
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_agent_boost.cc
+@@ -0,0 +1,98 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_agent_boost.h"
++
++#include "base/logging.h"
++#include "base/process/process.h"
++#include "content/public/browser/render_frame_host.h"
++#include "content/public/browser/render_process_host.h"
++#include "content/public/browser/web_contents.h"
++#include "ui/gfx/geometry/size.h"
++
++namespace extensions {
++namespace api {
++
++BrowserOSAgentBoost::BrowserOSAgentBoost(content::WebContents* web_contents)
++    : content::WebContentsObserver(web_contents),
++      content::WebContentsUserData<BrowserOSAgentBoost>(*web_contents) {}
++
++BrowserOSAgentBoost::~BrowserOSAgentBoost() {
++  ReleasePriorityOverride();
++}
++
++// static
++BrowserOSAgentBoost* BrowserOSAgentBoost::GetOrCreate(
++    content::WebContents* web_contents) {
++  CreateForWebContents(web_contents);
++  return FromWebContents(web_contents);
++}
++
++void BrowserOSAgentBoost::SetActive(bool active) {
++  if (active == active_) {
++    return;
++  }
++  active_ = active;
++
++  if (active_) {
++    // Treat the tab as captured: it stays kVisible regardless of occlusion
++    // or tab switches, so neither background timer throttling nor rAF
++    // display locking applies while the agent drives it. This is the same
++    // lever tab capture uses, so it composes with real capture sessions.
++    capture_handle_ = web_contents()->IncrementCapturerCount(
++        gfx::Size(), /*stay_hidden=*/false, /*stay_awake=*/true,
++        /*is_activity=*/true);
++    ApplyPriorityOverride();
++    LOG(INFO) << "[browseros] Agent boost enabled";
++  } else {
++    ReleasePriorityOverride();
++    capture_handle_.reset();
++    LOG(INFO) << "[browseros] Agent boost released";
++  }
++}
++
++void BrowserOSAgentBoost::ApplyPriorityOverride() {
++  content::RenderFrameHost* rfh = web_contents()->GetPrimaryMainFrame();
++  if (!rfh) {
++    return;
++  }
++  content::RenderProcessHost* rph = rfh->GetProcess();
++  if (rph == boosted_process_) {
++    return;
++  }
++  ReleasePriorityOverride();
++  rph->SetPriorityOverride(base::Process::Priority::kUserBlocking);
++  rph->AddObserver(this);
++  boosted_process_ = rph;
++}
++
++void BrowserOSAgentBoost::ReleasePriorityOverride() {
++  if (!boosted_process_) {
++    return;
++  }
++  boosted_process_->ClearPriorityOverride();
++  boosted_process_->RemoveObserver(this);
++  boosted_process_ = nullptr;
++}
++
++void BrowserOSAgentBoost::PrimaryPageChanged(content::Page& page) {
++  // Cross-process navigation: the boost belongs to the tab, not the
++  // document, so move the override to the new renderer.
++  if (active_) {
++    ApplyPriorityOverride();
++  }
++}
++
++void BrowserOSAgentBoost::RenderProcessHostDestroyed(
++    content::RenderProcessHost* host) {
++  if (host == boosted_process_) {
++    boosted_process_->RemoveObserver(this);
++    boosted_process_ = nullptr;
++  }
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(BrowserOSAgentBoost);
++
++}  // namespace api
++}  // namespace extensions
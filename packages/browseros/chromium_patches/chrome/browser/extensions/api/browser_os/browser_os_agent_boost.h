@@ -0,0 +1,87 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_agent_boost.h b/chrome/browser/extensions/api/browser_os/browser_os_agent_boost.h
+new file mode 100644
+index 0000000000000..eda898117e2b3
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_agent_boost.h
+@@ -0,0 +1,81 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_AGENT_BOOST_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_AGENT_BOOST_H_
++
++#include <optional>
++
++#include "base/functional/callback_helpers.h"
++#include "base/memory/raw_ptr.h"
++#include "content/public/browser/render_process_host_observer.h"
++#include "content/public/browser/web_contents_observer.h"
++#include "content/public/browser/web_contents_user_data.h"
++
++namespace content {
++class RenderProcessHost;
++class WebContents;
++}  // namespace content
++
++namespace extensions {
++namespace api {
++
++// Keeps an agent-driven tab scheduled like a foreground one. Such tabs are
++// routinely occluded or backgrounded, which throttles their timers and
++// display-locks rAF - roughly doubling per-action latency for injected
++// input and the AX updates that confirm it. While a boost is held the
++// WebContents is treated as captured (so visibility-based throttling never
++// kicks in) and its renderer's process priority is pinned high. The boost
++// follows cross-process navigations and drops automatically when the tab
++// closes.
++class BrowserOSAgentBoost
++    : public content::WebContentsObserver,
++      public content::WebContentsUserData<BrowserOSAgentBoost>,
++      public content::RenderProcessHostObserver {
++ public:
++  ~BrowserOSAgentBoost() override;
++
++  BrowserOSAgentBoost(const BrowserOSAgentBoost&) = delete;
++  BrowserOSAgentBoost& operator=(const BrowserOSAgentBoost&) = delete;
++
++  // Returns the boost holder for |web_contents|, creating it on first use.
++  static BrowserOSAgentBoost* GetOrCreate(content::WebContents* web_contents);
++
++  // Enables or disables the boost; idempotent in both directions.
++  void SetActive(bool active);
++
++  bool active() const { return active_; }
++
++ private:
++  explicit BrowserOSAgentBoost(content::WebContents* web_contents);
++  friend class content::WebContentsUserData<BrowserOSAgentBoost>;
++
++  // Moves the priority override onto the current primary main frame's
++  // process, releasing it from the previous one if the process changed.
++  void ApplyPriorityOverride();
++  void ReleasePriorityOverride();
++
++  // content::WebContentsObserver:
++  void PrimaryPageChanged(content::Page& page) override;
++
++  // content::RenderProcessHostObserver:
++  void RenderProcessHostDestroyed(content::RenderProcessHost* host) override;
++
++  bool active_ = false;
++
++  // Holds the capturer count while active; destroying it restores normal
++  // visibility-based scheduling.
++  std::optional<base::ScopedClosureRunner> capture_handle_;
++
++  // Process currently carrying the priority override, observed so the
++  // pointer can't dangle across a renderer crash.
++  raw_ptr<content::RenderProcessHost> boosted_process_ = nullptr;
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_AGENT_BOOST_H_
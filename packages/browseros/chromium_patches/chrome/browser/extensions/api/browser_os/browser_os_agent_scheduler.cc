@@ -0,0 +1,142 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_agent_scheduler.cc b/chrome/browser/extensions/api/browser_os/browser_os_agent_scheduler.cc
+new file mode 100644
+index 0000000000000..32b8146209507
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_agent_scheduler.cc
+@@ -0,0 +1,136 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_agent_scheduler.h"
++
++#include <utility>
++
++#include "base/functional/bind.h"
++#include "base/logging.h"
++#include "base/memory/ptr_util.h"
++#include "base/metrics/histogram_functions.h"
++#include "base/task/sequenced_task_runner.h"
++#include "chrome/browser/extensions/extension_tab_util.h"
++#include "chrome/browser/ui/browser.h"
++#include "chrome/browser/ui/browser_finder.h"
++#include "chrome/browser/ui/tabs/tab_strip_model.h"
++#include "content/public/browser/browser_thread.h"
++#include "content/public/browser/web_contents.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// How many heavy operations may run at once. Snapshots and captures each
++// tie up a renderer round trip plus pool-wide processing; past a handful
++// in flight, extra concurrency only lengthens everyone's tail. Chosen to
++// cover one focused session plus a few background tabs making progress.
++constexpr int kMaxConcurrentOperations = 4;
++
++// Tab id of the tab the user is looking at, or -1 when there is none.
++int GetFocusedTabId() {
++  Browser* browser = chrome::FindLastActive();
++  if (!browser) {
++    return -1;
++  }
++  content::WebContents* active_contents =
++      browser->tab_strip_model()->GetActiveWebContents();
++  if (!active_contents) {
++    return -1;
++  }
++  return ExtensionTabUtil::GetTabId(active_contents);
++}
++
++}  // namespace
++
++AgentScheduler::ScopedOperation::~ScopedOperation() {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  AgentScheduler::GetInstance().OnOperationFinished();
++}
++
++// static
++AgentScheduler& AgentScheduler::GetInstance() {
++  static base::NoDestructor<AgentScheduler> instance;
++  return *instance;
++}
++
++AgentScheduler::AgentScheduler() = default;
++
++void AgentScheduler::Schedule(int tab_id, StartCallback start) {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++
++  // Fast path: a free slot and an empty queue means running immediately
++  // cannot jump anyone. This keeps the single-tab case identical to the
++  // unscheduled code.
++  if (running_ < kMaxConcurrentOperations && queued_total_ == 0) {
++    ++running_;
++    std::move(start).Run(base::WrapUnique(new ScopedOperation()));
++    return;
++  }
++
++  queues_[tab_id].push_back({std::move(start), base::TimeTicks::Now()});
++  ++queued_total_;
++  base::UmaHistogramCounts100("BrowserOS.Agent.Scheduler.QueueDepth",
++                              queued_total_);
++  VLOG(1) << "[browseros] Agent scheduler queued op for tab " << tab_id
++          << " (depth " << queued_total_ << ", running " << running_ << ")";
++}
++
++void AgentScheduler::OnOperationFinished() {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  --running_;
++  if (queued_total_ == 0 || dispatch_pending_) {
++    return;
++  }
++  dispatch_pending_ = true;
++  base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
++      FROM_HERE, base::BindOnce(&AgentScheduler::DispatchQueued,
++                                weak_factory_.GetWeakPtr()));
++}
++
++void AgentScheduler::DispatchQueued() {
++  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
++  dispatch_pending_ = false;
++  while (running_ < kMaxConcurrentOperations && queued_total_ > 0) {
++    const int tab_id = PickNextTab();
++    auto it = queues_.find(tab_id);
++    QueuedOperation op = std::move(it->second.front());
++    it->second.pop_front();
++    if (it->second.empty()) {
++      queues_.erase(it);
++    }
++    --queued_total_;
++    last_served_tab_ = tab_id;
++
++    base::UmaHistogramTimes("BrowserOS.Agent.Scheduler.QueueWait",
++                            base::TimeTicks::Now() - op.enqueue_time);
++    ++running_;
++    // The callback may respond synchronously and release its slot; the
++    // loop condition re-reads |running_| so that slot is reused here
++    // rather than through another posted dispatch.
++    std::move(op.start).Run(base::WrapUnique(new ScopedOperation()));
++  }
++}
++
++int AgentScheduler::PickNextTab() const {
++  // The focused session goes first: its latency is the one the user
++  // perceives directly.
++  const int focused_tab = GetFocusedTabId();
++  if (focused_tab != -1 && queues_.find(focused_tab) != queues_.end()) {
++    return focused_tab;
++  }
++
++  // Round-robin: the first queued tab after the one served last, wrapping
++  // to the beginning. std::map iteration order makes this a stable
++  // rotation by tab id.
++  auto it = queues_.upper_bound(last_served_tab_);
++  if (it == queues_.end()) {
++    it = queues_.begin();
++  }
++  return it->first;
++}
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,125 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_agent_scheduler.h b/chrome/browser/extensions/api/browser_os/browser_os_agent_scheduler.h
+new file mode 100644
+index 0000000000000..26e5239efafcc
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_agent_scheduler.h
+@@ -0,0 +1,119 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_AGENT_SCHEDULER_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_AGENT_SCHEDULER_H_
++
++#include <map>
++#include <memory>
++
++#include "base/containers/circular_deque.h"
++#include "base/functional/callback.h"
++#include "base/memory/weak_ptr.h"
++#include "base/no_destructor.h"
++#include "base/time/time.h"
++
++namespace extensions {
++namespace api {
++
++// Browser-side scheduler for the heavy browserOS operations: interactive
++// snapshots and screenshot captures. When an orchestrator drives many tabs
++// at once, every tab's request used to start the moment it arrived and
++// contend freely for the renderer IPC budget, the UI-thread merge work and
++// the snapshot thread pool; under that load the tail latency of every
++// session blows up even though the median barely moves. The scheduler
++// caps how many heavy operations run concurrently, drains the per-tab
++// queues round-robin so one chatty session cannot starve the rest, and
++// serves the focused tab's queue first since that is the session the user
++// is watching.
++//
++// Cheap calls (actions, cursor pages, cache-served screenshots) do not go
++// through here; only the paths that start a renderer round trip or a
++// surface copy do.
++//
++// Lives on the UI thread.
++class AgentScheduler {
++ public:
++  // Token for one running operation. The owning ExtensionFunction keeps it
++  // until its terminal Respond(); destroying it (normally with the
++  // function itself) frees the concurrency slot and dispatches the next
++  // queued operation. Must be destroyed on the UI thread.
++  class ScopedOperation {
++   public:
++    ScopedOperation(const ScopedOperation&) = delete;
++    ScopedOperation& operator=(const ScopedOperation&) = delete;
++    ~ScopedOperation();
++
++   private:
++    friend class AgentScheduler;
++    ScopedOperation() = default;
++  };
++
++  // Invoked - immediately or once a slot frees up, always on the UI
++  // thread - to start the operation.
++  using StartCallback =
++      base::OnceCallback<void(std::unique_ptr<ScopedOperation>)>;
++
++  static AgentScheduler& GetInstance();
++
++  AgentScheduler(const AgentScheduler&) = delete;
++  AgentScheduler& operator=(const AgentScheduler&) = delete;
++
++  // Runs |start| synchronously when a concurrency slot is free and nothing
++  // is queued, otherwise appends it to |tab_id|'s queue. |start| is never
++  // dropped: if the tab goes away while queued the operation still runs
++  // and fails with its own tab-gone error, exactly as an unscheduled call
++  // would have.
++  void Schedule(int tab_id, StartCallback start);
++
++ private:
++  friend class base::NoDestructor<AgentScheduler>;
++
++  struct QueuedOperation {
++    StartCallback start;
++    base::TimeTicks enqueue_time;
++  };
++
++  AgentScheduler();
++  ~AgentScheduler() = default;
++
++  // Called from ~ScopedOperation when a running operation releases its
++  // slot.
++  void OnOperationFinished();
++
++  // Dispatches queued operations while slots are free. Posted rather than
++  // run inline from ~ScopedOperation so an operation finishing never
++  // starts the next one from inside a destructor chain.
++  void DispatchQueued();
++
++  // Picks the tab whose queue is served next: the focused tab when it has
++  // work queued, otherwise the next non-empty queue after the tab served
++  // last (round-robin by tab id).
++  int PickNextTab() const;
++
++  // Operations currently holding a slot.
++  int running_ = 0;
++
++  // Total operations across all queues, kept alongside |queues_| so the
++  // depth metric and the fast path do not walk the map.
++  int queued_total_ = 0;
++
++  // Per-tab FIFO queues. Entries are erased when drained, so the map only
++  // holds tabs with pending work.
++  std::map<int, base::circular_deque<QueuedOperation>> queues_;
++
++  // Tab id served last, the round-robin cursor.
++  int last_served_tab_ = -1;
++
++  // Collapses redundant DispatchQueued() posts when several operations
++  // finish in one task.
++  bool dispatch_pending_ = false;
++
++  base::WeakPtrFactory<AgentScheduler> weak_factory_{this};
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_AGENT_SCHEDULER_H_
@@ -1,44 +1,63 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api.cc b/chrome/browser/extensions/api/browser_os/browser_os_api.cc
 new file mode 100644
-index 0000000000000..58abbe5b785ed
+index 0000000000000..c5fe0784ae021
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api.cc
-@@ -0,0 +1,1325 @@
+@@ -0,0 +1,3029 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api.h"
 +
++#include <algorithm>
++#include <map>
 +#include <set>
 +#include <string>
 +#include <unordered_map>
 +#include <utility>
 +#include <vector>
 +
++#include "base/base64.h"
 +#include "base/functional/bind.h"
++#include "base/hash/hash.h"
++#include "base/memory/memory_pressure_listener.h"
++#include "base/no_destructor.h"
 +#include "base/threading/platform_thread.h"
 +#include "chrome/browser/browser_process.h"
 +#include "chrome/browser/profiles/profile.h"
 +#include "components/prefs/pref_service.h"
 +#include "base/json/json_writer.h"
++#include "base/metrics/histogram_functions.h"
++#include "base/strings/strcat.h"
 +#include "base/strings/utf_string_conversions.h"
 +#include "base/strings/string_number_conversions.h"
-+#include "base/base64.h"
++#include "base/task/thread_pool.h"
 +#include "base/time/time.h"
++#include "base/trace_event/trace_event.h"
 +#include "base/values.h"
 +#include "base/version_info/version_info.h"
++#include "chrome/browser/browseros/core/browseros_step_profiler.h"
++#include "chrome/browser/browseros/core/browseros_task_annotator.h"
 +#include "chrome/browser/browseros/metrics/browseros_metrics.h"
++#include "chrome/browser/browseros/server/browseros_server_manager.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_agent_boost.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_helpers.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_change_detector.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_change_recorder.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_content_processor.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_screenshot_cache.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_tree_cache.h"
++#include "extensions/browser/event_router.h"
++#include "extensions/browser/extension_event_histogram_value.h"
 +#include "chrome/browser/extensions/extension_tab_util.h"
 +#include "chrome/browser/extensions/window_controller.h"
 +#include "chrome/browser/ui/browser.h"
 +#include "chrome/browser/ui/browser_finder.h"
 +#include "chrome/browser/ui/tabs/tab_strip_model.h"
++#include "base/strings/stringprintf.h"
 +#include "chrome/common/extensions/api/browser_os.h"
 +#include "content/browser/renderer_host/render_widget_host_impl.h"
 +#include "content/public/browser/render_frame_host.h"
@@ -46,8 +65,12 @@ index 0000000000000..58abbe5b785ed
 +#include "content/public/browser/render_widget_host_view.h"
 +#include "content/browser/renderer_host/render_widget_host_view_base.h"
 +#include "content/public/browser/web_contents.h"
++#include "content/public/browser/web_contents_user_data.h"
++#include "content/public/browser/web_contents_observer.h"
++#include "content/public/browser/navigation_handle.h"
 +#include "third_party/blink/public/common/input/web_input_event.h"
 +#include "third_party/blink/public/common/input/web_mouse_event.h"
++#include "third_party/zlib/google/compression_utils.h"
 +#include "ui/accessibility/ax_action_data.h"
 +#include "ui/accessibility/ax_enum_util.h"
 +#include "ui/accessibility/ax_mode.h"
@@ -61,9 +84,10 @@ index 0000000000000..58abbe5b785ed
 +#include "ui/events/keycodes/keyboard_codes.h"
 +#include "ui/gfx/geometry/point_f.h"
 +#include "ui/gfx/geometry/rect.h"
++#include "ui/gfx/geometry/rect_conversions.h"
 +#include "ui/gfx/geometry/rect_f.h"
++#include "ui/gfx/geometry/size_conversions.h"
 +#include "ui/gfx/range/range.h"
-+#include "ui/gfx/codec/png_codec.h"
 +#include "ui/gfx/image/image.h"
 +#include "ui/snapshot/snapshot.h"
 +
@@ -72,6 +96,66 @@ index 0000000000000..58abbe5b785ed
 +
 +namespace {
 +
++// Records one completed API call: a local duration histogram (and a payload
++// size histogram when |size_key| is set), plus a sampled event through the
++// metrics service, which is where fleet-wide percentiles come from. Keyed
++// per function so getInteractiveSnapshot latency is separable from the
++// cheaper calls.
++void LogApiTiming(const char* function_name,
++                  base::TimeTicks start_time,
++                  const char* size_key = nullptr,
++                  int size_value = 0) {
++  const base::TimeDelta elapsed = base::TimeTicks::Now() - start_time;
++
++  base::UmaHistogramTimes(
++      base::StrCat({"BrowserOS.Api.", function_name, ".Duration"}), elapsed);
++
++  base::Value::Dict props;
++  props.Set("function", function_name);
++  props.Set("duration_ms", static_cast<int>(elapsed.InMilliseconds()));
++  if (size_key) {
++    base::UmaHistogramCounts1M(
++        base::StrCat({"BrowserOS.Api.", function_name, ".PayloadSize"}),
++        size_value);
++    props.Set(size_key, size_value);
++  }
++  // Feed the per-session step profiler (--browseros-profile-steps) so the
++  // call shows up as a slice in the exported timeline.
++  auto* profiler = browseros::BrowserOSStepProfiler::GetInstance();
++  if (profiler->enabled()) {
++    profiler->RecordPhase(function_name, start_time, start_time + elapsed,
++                          props.Clone());
++  }
++
++  // These fire on every agent step, so sample down before the event hits
++  // the wire.
++  browseros_metrics::BrowserOSMetrics::Log("api.latency", std::move(props),
++                                           /*sample_rate=*/0.1);
++}
++
++// Serializes |elements| to JSON and returns it gzipped and base64-encoded
++// for InteractiveSnapshot.compressedElements. On (rare) compression failure
++// the elements come back unchanged with an empty string, so the caller can
++// fall back to the structured response. Runs on the thread pool: a large
++// page's element array is megabytes of JSON.
++std::pair<std::vector<browser_os::InteractiveNode>, std::string>
++CompressSnapshotElements(std::vector<browser_os::InteractiveNode> elements) {
++  base::Value::List list;
++  for (const auto& element : elements) {
++    list.Append(element.ToValue());
++  }
++  std::string json;
++  base::JSONWriter::Write(list, &json);
++
++  TRACE_EVENT1("browseros", "InteractiveSnapshot::Compress", "bytes",
++               json.size());
++  std::string gzipped;
++  if (!compression::GzipCompress(json, &gzipped)) {
++    return {std::move(elements), std::string()};
++  }
++  return {{}, base::Base64Encode(gzipped)};
++}
++
 +// Serializes ui::AXNodeData to base::Value::Dict with all fields
 +base::Value::Dict SerializeAXNodeData(const ui::AXNodeData& node) {
 +  base::Value::Dict dict;
@@ -265,10 +349,158 @@ index 0000000000000..58abbe5b785ed
 +  }
 +}
 +
-+}  // namespace
++// Content hash of a serialized interactive node, used to decide whether the
++// node changed between snapshot generations. Attribute order does not matter:
++// per-attribute hashes are combined commutatively.
++size_t HashInteractiveNode(const browser_os::InteractiveNode& node) {
++  size_t hash = base::FastHash(node.name.value_or(std::string()));
++  hash = base::HashInts(hash, static_cast<uint32_t>(node.type));
++  hash = base::HashInts(hash, static_cast<uint32_t>(node.node_id));
++  if (node.rect) {
++    hash = base::HashInts(hash, static_cast<int32_t>(node.rect->x));
++    hash = base::HashInts(hash, static_cast<int32_t>(node.rect->y));
++    hash = base::HashInts(hash, static_cast<int32_t>(node.rect->width));
++    hash = base::HashInts(hash, static_cast<int32_t>(node.rect->height));
++  }
++  if (node.attributes) {
++    size_t attrs_hash = 0;
++    for (const auto& [key, value] : node.attributes->additional_properties) {
++      // Values are strings, or string-table indices when interning is on.
++      std::string value_string =
++          value.is_string() ? value.GetString()
++                            : (value.is_int()
++                                   ? base::NumberToString(value.GetInt())
++                                   : std::string());
++      attrs_hash += base::FastHash(key + "=" + value_string);
++    }
++    hash = base::HashInts(hash, attrs_hash);
++  }
++  return hash;
++}
++
++// Broadcasts one chunk of a streaming interactive snapshot.
++void DispatchSnapshotChunk(content::BrowserContext* browser_context,
++                           browser_os::InteractiveSnapshotChunk chunk) {
++  EventRouter* event_router = EventRouter::Get(browser_context);
++  if (!event_router) {
++    return;
++  }
++  // No histogram value assigned for browserOS events yet.
++  auto event = std::make_unique<Event>(
++      events::UNKNOWN, browser_os::OnSnapshotChunk::kEventName,
++      browser_os::OnSnapshotChunk::Create(chunk), browser_context);
++  event_router->BroadcastEvent(std::move(event));
++}
++
++// Snapshot ids are drawn from one file-wide sequence so they stay unique
++// across getInteractiveSnapshot and getSnapshots.
++uint32_t g_next_snapshot_id = 1;
++
++// Page size when a cursor call doesn't say otherwise; most agent decisions
++// look at well under a hundred nodes.
++constexpr int kDefaultSnapshotPageSize = 100;
++
++// Ranked element list retained for cursor fetches; one per tab, replaced
++// whenever a new paginated snapshot of that tab is taken. A cursor names
++// the snapshot it came from, so a stale cursor is detected rather than
++// silently paging through different content.
++struct PagedSnapshotState {
++  uint32_t snapshot_id = 0;
++  std::vector<browser_os::InteractiveNode> elements;
++};
++
++std::unordered_map<int, PagedSnapshotState>& GetPagedSnapshots() {
++  static base::NoDestructor<std::unordered_map<int, PagedSnapshotState>>
++      paged_snapshots;
++  return *paged_snapshots;
++}
 +
-+// Static member initialization
-+uint32_t BrowserOSGetInteractiveSnapshotFunction::next_snapshot_id_ = 1;
++// Sorts |elements| most-relevant-first: in-viewport nodes before offscreen
++// ones, inputs and controls before static content, then top to bottom.
++// Viewport membership and bounds come from the per-tab NodeInfo mappings
++// the processor has already computed, folded into one packed integer per
++// element so the sort itself never chases pointers.
++void SortElementsByRelevance(
++    int tab_id,
++    std::vector<browser_os::InteractiveNode>& elements) {
++  const NodeRegistry& registry = GetNodeRegistries()[tab_id];
++
++  auto type_rank = [](browser_os::InteractiveNodeType type) -> uint64_t {
++    switch (type) {
++      case browser_os::InteractiveNodeType::kTypeable:
++        return 0;
++      case browser_os::InteractiveNodeType::kClickable:
++        return 1;
++      case browser_os::InteractiveNodeType::kSelectable:
++        return 2;
++      default:
++        return 3;
++    }
++  };
++
++  // Key layout, most significant first: offscreen bit, type rank (2 bits),
++  // y then x clamped to 24 bits each. Lower keys sort first.
++  std::vector<std::pair<uint64_t, size_t>> keys;
++  keys.reserve(elements.size());
++  for (size_t i = 0; i < elements.size(); ++i) {
++    const auto& element = elements[i];
++    bool in_viewport = false;
++    float x = 0;
++    float y = 0;
++    if (const NodeInfo* info = registry.Find(element.node_id)) {
++      in_viewport = info->in_viewport;
++      x = info->bounds.x();
++      y = info->bounds.y();
++    }
++    constexpr float kMaxCoord = static_cast<float>((1 << 24) - 1);
++    const uint64_t key =
++        (in_viewport ? 0ull : 1ull) << 50 |
++        type_rank(element.type) << 48 |
++        static_cast<uint64_t>(std::clamp(y, 0.0f, kMaxCoord)) << 24 |
++        static_cast<uint64_t>(std::clamp(x, 0.0f, kMaxCoord));
++    keys.emplace_back(key, i);
++  }
++  std::stable_sort(keys.begin(), keys.end(),
++                   [](const auto& a, const auto& b) { return a.first < b.first; });
++
++  std::vector<browser_os::InteractiveNode> sorted;
++  sorted.reserve(elements.size());
++  for (const auto& [key, index] : keys) {
++    sorted.push_back(std::move(elements[index]));
++  }
++  elements = std::move(sorted);
++}
++
++// Builds the cursor token for the page starting at |offset|. The format is
++// opaque to callers but deliberately trivial here: snapshot id and offset.
++std::string MakeSnapshotCursor(uint32_t snapshot_id, size_t offset) {
++  return base::StrCat({"p", base::NumberToString(snapshot_id), ":",
++                       base::NumberToString(offset)});
++}
++
++// Maps the server manager's memory-pressure reading onto the API enum.
++browser_os::PressureLevel GetPressureLevel() {
++  switch (browseros::BrowserOSServerManager::GetInstance()
++              ->GetMemoryPressureLevel()) {
++    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL:
++      return browser_os::PressureLevel::kCritical;
++    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE:
++      return browser_os::PressureLevel::kModerate;
++    case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE:
++      return browser_os::PressureLevel::kNone;
++  }
++}
++
++// True when the API layer should shed load: degrade snapshots to
++// viewport-only and refuse screenshots rather than pile more allocation
++// onto a machine already at critical pressure.
++bool IsUnderCriticalPressure() {
++  return browseros::BrowserOSServerManager::GetInstance()
++             ->GetMemoryPressureLevel() ==
++         base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL;
++}
++
++}  // namespace
 +
 +// Constructor and destructor implementations
 +BrowserOSGetInteractiveSnapshotFunction::BrowserOSGetInteractiveSnapshotFunction() = default;
@@ -289,6 +521,7 @@ index 0000000000000..58abbe5b785ed
 +  }
 +  
 +  content::WebContents* web_contents = tab_info->web_contents;
++  web_contents_ = web_contents;
 +
 +  // Enable accessibility if needed
 +  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
@@ -296,6 +529,24 @@ index 0000000000000..58abbe5b785ed
 +    return RespondNow(Error("No render frame"));
 +  }
 +
++  // Spans the renderer round trip (or cache hit) through serialization;
++  // ended in OnAccessibilityTreeReceived.
++  start_time_ = base::TimeTicks::Now();
++  TRACE_EVENT_NESTABLE_ASYNC_BEGIN0("browseros", "GetAccessibilityTree",
++                                    TRACE_ID_LOCAL(this));
++
++  // Serve from the per-tab tree cache when it is current; this skips the
++  // full-tree renderer round trip entirely.
++  ui::AXTreeUpdate cached_update;
++  if (BrowserOSTreeCache::GetOrCreate(web_contents)
++          ->GetCachedTree(&cached_update,
++                          /*require_inline_text_boxes=*/true)) {
++    VLOG(1) << "[browseros] Serving accessibility tree from cache";
++    served_from_cache_ = true;
++    OnAccessibilityTreeReceived(cached_update);
++    return AlreadyResponded();
++  }
++
 +  // Request accessibility tree snapshot
 +  // Use WebContents with extended properties to get a full tree
 +  web_contents->RequestAXTreeSnapshot(
@@ -313,22 +564,40 @@ index 0000000000000..58abbe5b785ed
 +
 +void BrowserOSGetAccessibilityTreeFunction::OnAccessibilityTreeReceived(
 +    ui::AXTreeUpdate& tree_update) {
++  // A fresh renderer snapshot (re-)seeds the per-tab tree cache so later
++  // calls can be answered locally.
++  if (!served_from_cache_ && web_contents_) {
++    BrowserOSTreeCache::GetOrCreate(web_contents_)
++        ->SeedFromSnapshot(tree_update, /*includes_inline_text_boxes=*/true);
++  }
++
 +  browser_os::AccessibilityTree result;
 +  result.root_id = tree_update.root_id;
 +
-+  // Serialize all nodes with complete AX data
-+  base::Value::Dict nodes;
-+  for (const auto& node_data : tree_update.nodes) {
-+    nodes.Set(base::NumberToString(node_data.id),
-+              SerializeAXNodeData(node_data));
-+  }
-+  result.nodes.additional_properties = std::move(nodes);
++  {
++    TRACE_EVENT1("browseros", "GetAccessibilityTree::Serialize", "nodes",
++                 tree_update.nodes.size());
++
++    // Serialize all nodes with complete AX data
++    base::Value::Dict nodes;
++    for (const auto& node_data : tree_update.nodes) {
++      nodes.Set(base::NumberToString(node_data.id),
++                SerializeAXNodeData(node_data));
++    }
++    result.nodes.additional_properties = std::move(nodes);
 +
-+  // Serialize tree-level metadata
-+  browser_os::AccessibilityTree::TreeData tree_data_obj;
-+  tree_data_obj.additional_properties = SerializeAXTreeData(tree_update.tree_data);
-+  result.tree_data = std::move(tree_data_obj);
++    // Serialize tree-level metadata
++    browser_os::AccessibilityTree::TreeData tree_data_obj;
++    tree_data_obj.additional_properties =
++        SerializeAXTreeData(tree_update.tree_data);
++    result.tree_data = std::move(tree_data_obj);
++  }
 +
++  TRACE_EVENT_NESTABLE_ASYNC_END1("browseros", "GetAccessibilityTree",
++                                  TRACE_ID_LOCAL(this), "from_cache",
++                                  served_from_cache_);
++  LogApiTiming("GetAccessibilityTree", start_time_, "nodes",
++               static_cast<int>(tree_update.nodes.size()));
 +  Respond(ArgumentList(
 +      browser_os::GetAccessibilityTree::Results::Create(result)));
 +}
@@ -360,76 +629,640 @@ index 0000000000000..58abbe5b785ed
 +  // Store tab ID for mapping
 +  tab_id_ = tab_info->tab_id;
 +
++  // Remember the caller's generation token for delta mode
++  if (params->options && params->options->since_token) {
++    since_token_ = *params->options->since_token;
++  }
++
++  // Whether to deduplicate repeated attribute strings into a string table
++  intern_strings_ =
++      params->options && params->options->intern_strings.value_or(false);
++
++  // Whether to cull nodes outside the visible viewport before processing
++  viewport_only_ =
++      params->options && params->options->viewport_only.value_or(false);
++
++  // Load shedding: a full-page snapshot is the most allocation-heavy
++  // thing this API does, so under critical memory pressure degrade to
++  // viewport-only regardless of what the caller asked for.
++  if (!viewport_only_ && IsUnderCriticalPressure()) {
++    LOG(WARNING) << "[browseros] Critical memory pressure - degrading "
++                 << "snapshot to viewport-only";
++    viewport_only_ = true;
++  }
++
++  // Whether to stream results viewport-first via onSnapshotChunk events
++  stream_chunks_ =
++      params->options && params->options->stream_chunks.value_or(false);
++
++  // Whether to return the element array gzipped+base64 instead of structured
++  compress_ = params->options && params->options->compress.value_or(false);
++
++  // Pagination cap; 0 means return everything in one response.
++  if (params->options && params->options->max_nodes) {
++    max_nodes_ = std::max(0, *params->options->max_nodes);
++  }
++
++  // Cursor fetch: the ranked elements are already cached browser-side, so
++  // no renderer round trip or processor pass happens at all.
++  if (params->options && params->options->cursor) {
++    return ServeCursorPage(*params->options->cursor);
++  }
++
 +  // Check frame stability before requesting snapshot
 +  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
 +  if (!rfh || !rfh->IsRenderFrameLive() || !rfh->IsActive()) {
 +    LOG(WARNING) << "[browseros] Frame not stable for AX snapshot - skipping";
 +    browser_os::InteractiveSnapshot empty_snapshot;
-+    empty_snapshot.snapshot_id = next_snapshot_id_++;
++    empty_snapshot.snapshot_id = g_next_snapshot_id++;
 +    empty_snapshot.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
 +    empty_snapshot.processing_time_ms = 0;
 +    return RespondNow(ArgumentList(
 +        browser_os::GetInteractiveSnapshot::Results::Create(empty_snapshot)));
 +  }
 +  
-+  // Request accessibility tree snapshot
++  // Heavy path from here: renderer round trip (or cached-tree processing)
++  // plus the processor passes. Goes through the agent scheduler so a
++  // multi-tab orchestrator cannot start unbounded snapshots at once.
++  AgentScheduler::GetInstance().Schedule(
++      tab_id_,
++      base::BindOnce(
++          &BrowserOSGetInteractiveSnapshotFunction::StartScheduledSnapshot,
++          this));
++  return did_respond() ? AlreadyResponded() : RespondLater();
++}
++
++void BrowserOSGetInteractiveSnapshotFunction::StartScheduledSnapshot(
++    std::unique_ptr<AgentScheduler::ScopedOperation> operation) {
++  scheduler_operation_ = std::move(operation);
++
++  // The tab can close while the operation sits in the scheduler queue;
++  // re-resolve it instead of trusting the stored pointer.
++  WindowController* window = nullptr;
++  content::WebContents* web_contents = nullptr;
++  if (!ExtensionTabUtil::GetTabById(tab_id_, browser_context(),
++                                    include_incognito_information(), &window,
++                                    &web_contents, nullptr) ||
++      web_contents != web_contents_) {
++    Respond(Error("Tab was closed while the snapshot was queued"));
++    return;
++  }
++
++  // Spans the whole request: renderer round trip (or cache hit), processor
++  // passes, and delta/serialization work. Ended at every Respond() path.
++  start_time_ = base::TimeTicks::Now();
++  TRACE_EVENT_NESTABLE_ASYNC_BEGIN1("browseros", "InteractiveSnapshot",
++                                    TRACE_ID_LOCAL(this), "tab_id", tab_id_);
++
++  // Serve from the per-tab tree cache when it is current; processing still
++  // happens off-thread but the renderer round trip is skipped.
++  ui::AXTreeUpdate cached_update;
++  if (BrowserOSTreeCache::GetOrCreate(web_contents)
++          ->GetCachedTree(&cached_update)) {
++    VLOG(1) << "[browseros] Serving interactive snapshot from tree cache";
++    served_from_cache_ = true;
++    OnAccessibilityTreeReceived(cached_update);
++    return;
++  }
++
++  // Request accessibility tree snapshot. Inline text boxes are deliberately
++  // left out of the mode: they are pure text geometry that ShouldSkipNode
++  // discards anyway, and omitting the flag stops the renderer from creating
++  // and serializing them at all — on text-heavy pages that is the bulk of
++  // the tree crossing the IPC boundary.
 +  web_contents->RequestAXTreeSnapshot(
 +      base::BindOnce(
 +          &BrowserOSGetInteractiveSnapshotFunction::OnAccessibilityTreeReceived,
 +          this),
-+      ui::AXMode(ui::AXMode::kWebContents | ui::AXMode::kExtendedProperties |
-+                 ui::AXMode::kInlineTextBoxes),
++      ui::AXMode(ui::AXMode::kWebContents | ui::AXMode::kExtendedProperties),
 +      /* max_nodes= */ 0,  // No limit
 +      /* timeout= */ base::TimeDelta(),
 +      content::WebContents::AXTreeSnapshotPolicy::kAll);
 +      // content::WebContents::AXTreeSnapshotPolicy::kSameOriginDirectDescendants);
++}
 +
-+  return RespondLater();
++ExtensionFunction::ResponseAction
++BrowserOSGetInteractiveSnapshotFunction::ServeCursorPage(
++    const std::string& cursor) {
++  uint32_t cursor_snapshot_id = 0;
++  size_t offset = 0;
++  const size_t colon = cursor.find(':');
++  const bool parsed =
++      cursor.size() > 1 && cursor[0] == 'p' && colon != std::string::npos &&
++      base::StringToUint(cursor.substr(1, colon - 1), &cursor_snapshot_id) &&
++      base::StringToSizeT(cursor.substr(colon + 1), &offset);
++
++  auto& paged_snapshots = GetPagedSnapshots();
++  auto it = paged_snapshots.find(tab_id_);
++  if (!parsed || it == paged_snapshots.end() ||
++      it->second.snapshot_id != cursor_snapshot_id ||
++      offset >= it->second.elements.size()) {
++    // A newer snapshot replaced the cached one (or the cursor is garbage);
++    // the caller should take a fresh snapshot rather than mix pages from
++    // different generations.
++    return RespondNow(Error("Snapshot cursor is stale"));
++  }
++
++  const PagedSnapshotState& paged = it->second;
++  const size_t page_size = max_nodes_ > 0
++                               ? static_cast<size_t>(max_nodes_)
++                               : static_cast<size_t>(kDefaultSnapshotPageSize);
++  const size_t end = std::min(offset + page_size, paged.elements.size());
++
++  browser_os::InteractiveSnapshot snapshot;
++  snapshot.snapshot_id = static_cast<int>(paged.snapshot_id);
++  snapshot.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
++  snapshot.processing_time_ms = 0;
++  snapshot.generation_token =
++      "g" + base::NumberToString(paged.snapshot_id);
++  snapshot.total_nodes = static_cast<int>(paged.elements.size());
++  snapshot.elements.reserve(end - offset);
++  for (size_t i = offset; i < end; ++i) {
++    snapshot.elements.push_back(paged.elements[i].Clone());
++  }
++  if (end < paged.elements.size()) {
++    snapshot.next_cursor = MakeSnapshotCursor(paged.snapshot_id, end);
++  }
++
++  VLOG(1) << "[browseros] Snapshot cursor page: elements " << offset << "-"
++          << end << " of " << paged.elements.size();
++  return RespondNow(ArgumentList(
++      browser_os::GetInteractiveSnapshot::Results::Create(snapshot)));
 +}
 +
 +void BrowserOSGetInteractiveSnapshotFunction::OnAccessibilityTreeReceived(
 +    ui::AXTreeUpdate& tree_update) {
++  TRACE_EVENT1("browseros", "InteractiveSnapshot::OnAccessibilityTreeReceived",
++               "nodes", tree_update.nodes.size());
++
 +  // Double-check frame is still valid before processing
 +  if (!web_contents_) {
 +    LOG(WARNING) << "[browseros] WebContents gone during AX snapshot callback";
 +    browser_os::InteractiveSnapshot empty_snapshot;
-+    empty_snapshot.snapshot_id = next_snapshot_id_++;
++    empty_snapshot.snapshot_id = g_next_snapshot_id++;
 +    empty_snapshot.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
 +    empty_snapshot.processing_time_ms = 0;
++    TRACE_EVENT_NESTABLE_ASYNC_END1("browseros", "InteractiveSnapshot",
++                                    TRACE_ID_LOCAL(this), "aborted",
++                                    "no_web_contents");
 +    Respond(ArgumentList(
 +        browser_os::GetInteractiveSnapshot::Results::Create(empty_snapshot)));
 +    return;
 +  }
-+  
++
 +  content::RenderFrameHost* rfh = web_contents_->GetPrimaryMainFrame();
 +  if (!rfh || !rfh->IsRenderFrameLive()) {
 +    LOG(WARNING) << "[browseros] Frame became unstable during AX snapshot callback";
 +    browser_os::InteractiveSnapshot empty_snapshot;
-+    empty_snapshot.snapshot_id = next_snapshot_id_++;
++    empty_snapshot.snapshot_id = g_next_snapshot_id++;
 +    empty_snapshot.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
 +    empty_snapshot.processing_time_ms = 0;
++    TRACE_EVENT_NESTABLE_ASYNC_END1("browseros", "InteractiveSnapshot",
++                                    TRACE_ID_LOCAL(this), "aborted",
++                                    "frame_unstable");
 +    Respond(ArgumentList(
 +        browser_os::GetInteractiveSnapshot::Results::Create(empty_snapshot)));
 +    return;
 +  }
 +  
-+  // Simple API layer - just delegates to the processor
++  // A fresh renderer snapshot (re-)seeds the per-tab tree cache so later
++  // calls can be answered locally.
++  if (!served_from_cache_) {
++    BrowserOSTreeCache::GetOrCreate(web_contents_)
++        ->SeedFromSnapshot(tree_update, /*includes_inline_text_boxes=*/false);
++  }
++
++  snapshot_id_ = g_next_snapshot_id++;
++
++  // Viewport-first streaming: process just the visible region now so the
++  // first chunk goes out as early as possible, then process the full tree.
++  if (stream_chunks_ && !viewport_only_) {
++    tree_update_ = std::move(tree_update);
++    // The viewport pass gets a copy of the update; the stored original is
++    // moved into the full-tree pass afterwards.
++    SnapshotProcessor::ProcessAccessibilityTree(
++        tree_update_,
++        tab_id_,
++        snapshot_id_,
++        web_contents_,
++        base::BindOnce(
++            &BrowserOSGetInteractiveSnapshotFunction::OnViewportChunkProcessed,
++            base::WrapRefCounted(this)),
++        intern_strings_,
++        /*viewport_only=*/true);
++    return;
++  }
++
++  // Simple API layer - just delegates to the processor. The update is
++  // consumed: the processor's flat tree adopts its nodes without copying.
 +  SnapshotProcessor::ProcessAccessibilityTree(
-+      tree_update,
++      std::move(tree_update),
 +      tab_id_,
-+      next_snapshot_id_++,
++      snapshot_id_,
 +      web_contents_,
 +      base::BindOnce(
 +          &BrowserOSGetInteractiveSnapshotFunction::OnSnapshotProcessed,
-+          base::WrapRefCounted(this)));
++          base::WrapRefCounted(this)),
++      intern_strings_,
++      viewport_only_);
++}
++
++void BrowserOSGetInteractiveSnapshotFunction::OnViewportChunkProcessed(
++    SnapshotProcessingResult result) {
++  TRACE_EVENT1("browseros", "InteractiveSnapshot::OnViewportChunkProcessed",
++               "elements", result.snapshot.elements.size());
++
++  // Remember which AX nodes the first chunk covered; the node ids assigned
++  // by the full pass differ, so the remainder is tracked by AX node id.
++  const NodeRegistry& registry = GetNodeRegistries()[tab_id_];
++  for (const auto& element : result.snapshot.elements) {
++    if (const NodeInfo* info = registry.Find(element.node_id)) {
++      streamed_ax_ids_.insert(info->ax_node_id);
++    }
++  }
++
++  browser_os::InteractiveSnapshotChunk chunk;
++  chunk.snapshot_id = snapshot_id_;
++  chunk.sequence = 0;
++  chunk.is_last = false;
++  chunk.elements = std::move(result.snapshot.elements);
++  DispatchSnapshotChunk(browser_context(), std::move(chunk));
++
++  if (!web_contents_) {
++    LOG(WARNING) << "[browseros] WebContents gone between snapshot chunks";
++    browser_os::InteractiveSnapshot empty_snapshot;
++    empty_snapshot.snapshot_id = snapshot_id_;
++    empty_snapshot.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
++    empty_snapshot.processing_time_ms = 0;
++    TRACE_EVENT_NESTABLE_ASYNC_END1("browseros", "InteractiveSnapshot",
++                                    TRACE_ID_LOCAL(this), "aborted",
++                                    "no_web_contents");
++    Respond(ArgumentList(
++        browser_os::GetInteractiveSnapshot::Results::Create(empty_snapshot)));
++    return;
++  }
++
++  // Second pass over the full tree; its result both feeds the final chunk
++  // and answers the callback. The stored update is no longer needed, so the
++  // processor takes it by move.
++  SnapshotProcessor::ProcessAccessibilityTree(
++      std::move(tree_update_),
++      tab_id_,
++      snapshot_id_,
++      web_contents_,
++      base::BindOnce(
++          &BrowserOSGetInteractiveSnapshotFunction::OnSnapshotProcessed,
++          base::WrapRefCounted(this)),
++      intern_strings_,
++      /*viewport_only=*/false);
 +}
 +
 +void BrowserOSGetInteractiveSnapshotFunction::OnSnapshotProcessed(
 +    SnapshotProcessingResult result) {
++  TRACE_EVENT1("browseros", "InteractiveSnapshot::OnSnapshotProcessed",
++               "elements", result.snapshot.elements.size());
++
++  // Streaming mode: emit the final chunk before answering the callback.
++  // Only nodes the viewport chunk did not already deliver are included.
++  if (stream_chunks_) {
++    const NodeRegistry& registry = GetNodeRegistries()[tab_id_];
++    browser_os::InteractiveSnapshotChunk chunk;
++    chunk.snapshot_id = snapshot_id_;
++    chunk.sequence = streamed_ax_ids_.empty() ? 0 : 1;
++    chunk.is_last = true;
++    for (const auto& element : result.snapshot.elements) {
++      const NodeInfo* info = registry.Find(element.node_id);
++      if (info && streamed_ax_ids_.count(info->ax_node_id)) {
++        continue;
++      }
++      chunk.elements.push_back(element.Clone());
++    }
++    DispatchSnapshotChunk(browser_context(), std::move(chunk));
++  }
++
++  // Build this generation's signature map and token.
++  SnapshotGeneration current;
++  current.token = "g" + base::NumberToString(result.snapshot.snapshot_id);
++  const NodeRegistry& registry = GetNodeRegistries()[tab_id_];
++  current.node_hashes.reserve(result.snapshot.elements.size());
++  for (const auto& element : result.snapshot.elements) {
++    current.node_hashes[element.node_id] = HashInteractiveNode(element);
++    if (const NodeInfo* info = registry.Find(element.node_id)) {
++      current.tree_id = info->ax_tree_id;
++    }
++  }
++  result.snapshot.generation_token = current.token;
++
++  // Delta mode: when the caller's token matches the previous generation of
++  // the same tree, strip unchanged nodes from the response and report
++  // removals instead of re-serializing the whole page.
++  auto& generations = GetSnapshotGenerations();
++  auto prev_it = generations.find(tab_id_);
++  if (!since_token_.empty() && prev_it != generations.end() &&
++      prev_it->second.token == since_token_ &&
++      prev_it->second.tree_id == current.tree_id) {
++    const auto& prev_hashes = prev_it->second.node_hashes;
++
++    std::vector<browser_os::InteractiveNode> changed;
++    for (auto& element : result.snapshot.elements) {
++      auto old_it = prev_hashes.find(element.node_id);
++      if (old_it == prev_hashes.end() ||
++          old_it->second != current.node_hashes[element.node_id]) {
++        changed.push_back(std::move(element));
++      }
++    }
++
++    std::vector<int> removed;
++    for (const auto& [node_id, hash] : prev_hashes) {
++      if (current.node_hashes.find(node_id) == current.node_hashes.end()) {
++        removed.push_back(static_cast<int>(node_id));
++      }
++    }
++
++    VLOG(1) << "[browseros] Snapshot delta: " << changed.size()
++            << " changed, " << removed.size() << " removed of "
++            << result.snapshot.elements.size() << " total";
++
++    result.snapshot.elements = std::move(changed);
++    result.snapshot.is_delta = true;
++    result.snapshot.removed_node_ids = std::move(removed);
++  }
++
++  generations[tab_id_] = std::move(current);
++
++  // Pagination: rank the elements, answer with the first page and retain
++  // the rest for cursor fetches. Delta responses are exempt - they are
++  // already trimmed to what changed, and splitting a delta would leave the
++  // caller with an inconsistent view of the tree.
++  if (max_nodes_ > 0 && !result.snapshot.is_delta.value_or(false) &&
++      result.snapshot.elements.size() > static_cast<size_t>(max_nodes_)) {
++    SortElementsByRelevance(tab_id_, result.snapshot.elements);
++
++    PagedSnapshotState& paged = GetPagedSnapshots()[tab_id_];
++    paged.snapshot_id = snapshot_id_;
++    paged.elements = std::move(result.snapshot.elements);
++
++    result.snapshot.elements.clear();
++    result.snapshot.elements.reserve(max_nodes_);
++    for (int i = 0; i < max_nodes_; ++i) {
++      result.snapshot.elements.push_back(paged.elements[i].Clone());
++    }
++    result.snapshot.next_cursor = MakeSnapshotCursor(snapshot_id_, max_nodes_);
++    result.snapshot.total_nodes = static_cast<int>(paged.elements.size());
++
++    VLOG(1) << "[browseros] Snapshot paginated: " << max_nodes_ << " of "
++            << paged.elements.size() << " elements in first page";
++  }
++
++  // Compressed mode: serialize and gzip the element array off-thread, then
++  // answer with compressedElements. Delta and generation bookkeeping above
++  // already ran against the structured elements.
++  if (compress_) {
++    std::vector<browser_os::InteractiveNode> elements =
++        std::move(result.snapshot.elements);
++    result.snapshot.elements.clear();
++    base::ThreadPool::PostTaskAndReplyWithResult(
++        FROM_HERE, {base::TaskPriority::USER_BLOCKING},
++        browseros::AnnotateTask("Api", base::BindOnce(&CompressSnapshotElements, std::move(elements))),
++        base::BindOnce(
++            &BrowserOSGetInteractiveSnapshotFunction::OnElementsCompressed,
++            this, std::move(result)));
++    return;
++  }
++
++  RespondWithSnapshot(std::move(result));
++}
++
++void BrowserOSGetInteractiveSnapshotFunction::OnElementsCompressed(
++    SnapshotProcessingResult result,
++    std::pair<std::vector<browser_os::InteractiveNode>, std::string>
++        compressed) {
++  if (compressed.second.empty()) {
++    // Compression failed; fall back to the structured response.
++    result.snapshot.elements = std::move(compressed.first);
++  } else {
++    result.snapshot.compressed_elements = std::move(compressed.second);
++  }
++  RespondWithSnapshot(std::move(result));
++}
++
++void BrowserOSGetInteractiveSnapshotFunction::RespondWithSnapshot(
++    SnapshotProcessingResult result) {
++  TRACE_EVENT_NESTABLE_ASYNC_END2(
++      "browseros", "InteractiveSnapshot", TRACE_ID_LOCAL(this), "elements",
++      result.snapshot.elements.size(), "from_cache", served_from_cache_);
++  LogApiTiming("GetInteractiveSnapshot", start_time_, "elements",
++               static_cast<int>(result.snapshot.elements.size()));
 +  Respond(ArgumentList(
 +      browser_os::GetInteractiveSnapshot::Results::Create(result.snapshot)));
 +}
 +
++// Implementation of BrowserOSGetSnapshotsFunction
++
++ExtensionFunction::ResponseAction BrowserOSGetSnapshotsFunction::Run() {
++  std::optional<browser_os::GetSnapshots::Params> params =
++      browser_os::GetSnapshots::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  if (params->tab_ids.empty()) {
++    return RespondNow(ArgumentList(browser_os::GetSnapshots::Results::Create(
++        std::vector<browser_os::TabSnapshotResult>())));
++  }
++
++  const size_t tab_count = params->tab_ids.size();
++  results_.resize(tab_count);
++  tab_ids_.resize(tab_count);
++  web_contents_.resize(tab_count);
++  pending_ = tab_count;
++
++  // Issue every renderer request before waiting on any of them, so the
++  // renderers serialize their trees concurrently and the slowest tab bounds
++  // the total latency.
++  for (size_t i = 0; i < tab_count; ++i) {
++    const int tab_id = params->tab_ids[i];
++    tab_ids_[i] = tab_id;
++    results_[i].tab_id = tab_id;
++    results_[i].success = false;
++
++    std::string error_message;
++    auto tab_info = GetTabFromOptionalId(tab_id, browser_context(),
++                                         include_incognito_information(),
++                                         &error_message);
++    if (!tab_info) {
++      results_[i].error = error_message;
++      FinishTab();
++      continue;
++    }
++
++    content::WebContents* web_contents = tab_info->web_contents;
++    web_contents_[i] = web_contents->GetWeakPtr();
++
++    content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
++    if (!rfh || !rfh->IsRenderFrameLive() || !rfh->IsActive()) {
++      results_[i].error = "Frame not stable for snapshot";
++      FinishTab();
++      continue;
++    }
++
++    // Same fast path as getInteractiveSnapshot: a current per-tab tree
++    // cache skips this tab's renderer round trip; processing still happens
++    // off-thread.
++    ui::AXTreeUpdate cached_update;
++    if (BrowserOSTreeCache::GetOrCreate(web_contents)
++            ->GetCachedTree(&cached_update)) {
++      VLOG(1) << "[browseros] getSnapshots serving tab " << tab_id
++              << " from tree cache";
++      ProcessTree(i, cached_update);
++      continue;
++    }
++
++    // Like getInteractiveSnapshot, request the tree without inline text
++    // boxes so the renderer never serializes nodes the processor discards.
++    web_contents->RequestAXTreeSnapshot(
++        base::BindOnce(
++            &BrowserOSGetSnapshotsFunction::OnAccessibilityTreeReceived, this,
++            i),
++        ui::AXMode(ui::AXMode::kWebContents | ui::AXMode::kExtendedProperties),
++        /* max_nodes= */ 0,  // No limit
++        /* timeout= */ base::TimeDelta(),
++        content::WebContents::AXTreeSnapshotPolicy::kAll);
++  }
++
++  // Every tab may have failed synchronously, in which case the response has
++  // already been sent.
++  return did_respond() ? AlreadyResponded() : RespondLater();
++}
++
++void BrowserOSGetSnapshotsFunction::OnAccessibilityTreeReceived(
++    size_t index,
++    ui::AXTreeUpdate& tree_update) {
++  // A fresh renderer snapshot (re-)seeds that tab's tree cache so later
++  // calls can be answered locally.
++  content::WebContents* web_contents = web_contents_[index].get();
++  if (web_contents) {
++    BrowserOSTreeCache::GetOrCreate(web_contents)
++        ->SeedFromSnapshot(tree_update, /*includes_inline_text_boxes=*/false);
++  }
++  ProcessTree(index, tree_update);
++}
++
++void BrowserOSGetSnapshotsFunction::ProcessTree(size_t index,
++                                                ui::AXTreeUpdate& tree_update) {
++  content::WebContents* web_contents = web_contents_[index].get();
++  if (!web_contents) {
++    results_[index].error = "Tab was closed";
++    FinishTab();
++    return;
++  }
++
++  SnapshotProcessor::ProcessAccessibilityTree(
++      std::move(tree_update), tab_ids_[index], g_next_snapshot_id++,
++      web_contents,
++      base::BindOnce(&BrowserOSGetSnapshotsFunction::OnSnapshotProcessed,
++                     base::WrapRefCounted(this), index),
++      /*intern_strings=*/false,
++      /*viewport_only=*/false);
++}
++
++void BrowserOSGetSnapshotsFunction::OnSnapshotProcessed(
++    size_t index,
++    SnapshotProcessingResult result) {
++  results_[index].success = true;
++  results_[index].snapshot = std::move(result.snapshot);
++  FinishTab();
++}
++
++void BrowserOSGetSnapshotsFunction::FinishTab() {
++  if (--pending_ > 0) {
++    return;
++  }
++  Respond(ArgumentList(
++      browser_os::GetSnapshots::Results::Create(std::move(results_))));
++}
++
++// Implementation of BrowserOSWatchChangesFunction
++
++ExtensionFunction::ResponseAction BrowserOSWatchChangesFunction::Run() {
++  std::optional<browser_os::WatchChanges::Params> params =
++      browser_os::WatchChanges::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++
++  BrowserOSChangeRecorder::GetOrCreate(tab_info->web_contents)
++      ->StartRecording();
++  return RespondNow(NoArguments());
++}
++
++// Implementation of BrowserOSUnwatchChangesFunction
++
++ExtensionFunction::ResponseAction BrowserOSUnwatchChangesFunction::Run() {
++  std::optional<browser_os::UnwatchChanges::Params> params =
++      browser_os::UnwatchChanges::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++
++  BrowserOSChangeRecorder* recorder =
++      BrowserOSChangeRecorder::FromWebContents(tab_info->web_contents);
++  if (recorder) {
++    recorder->StopRecording();
++  }
++  return RespondNow(NoArguments());
++}
++
++// Implementation of BrowserOSDrainChangesFunction
++
++ExtensionFunction::ResponseAction BrowserOSDrainChangesFunction::Run() {
++  std::optional<browser_os::DrainChanges::Params> params =
++      browser_os::DrainChanges::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++
++  browser_os::ChangeBatch batch;
++  batch.dropped_count = 0;
++
++  BrowserOSChangeRecorder* recorder =
++      BrowserOSChangeRecorder::FromWebContents(tab_info->web_contents);
++  if (recorder) {
++    uint64_t dropped = 0;
++    std::vector<BrowserOSChangeRecorder::ChangeRecord> records =
++        recorder->Drain(&dropped);
++    batch.dropped_count = static_cast<int>(dropped);
++    batch.records.reserve(records.size());
++    for (const auto& record : records) {
++      browser_os::ChangeRecord out;
++      out.tree_id = record.tree_id.ToString();
++      out.node_id = record.node_id;
++      out.event_type = ui::ToString(record.event);
++      out.timestamp = record.timestamp.InMillisecondsFSinceUnixEpoch();
++      batch.records.push_back(std::move(out));
++    }
++  }
++
++  return RespondNow(
++      ArgumentList(browser_os::DrainChanges::Results::Create(batch)));
++}
++
 +// Implementation of BrowserOSClickFunction
 +
 +ExtensionFunction::ResponseAction BrowserOSClickFunction::Run() {
@@ -449,28 +1282,31 @@ index 0000000000000..58abbe5b785ed
 +  content::WebContents* web_contents = tab_info->web_contents;
 +  int tab_id = tab_info->tab_id;
 +
-+  // Look up the AX node ID from our nodeId
-+  auto tab_it = GetNodeIdMappings().find(tab_id);
-+  if (tab_it == GetNodeIdMappings().end()) {
-+    return RespondNow(Error("No snapshot data for this tab"));
-+  }
-+  
-+  auto node_it = tab_it->second.find(params->node_id);
-+  if (node_it == tab_it->second.end()) {
-+    return RespondNow(Error("Node ID not found"));
++  // Resolve the node handle; a stale handle (snapshot taken before a
++  // navigation) answers with an error instead of acting on whatever node
++  // now occupies the slot.
++  std::string resolve_error;
++  const NodeInfo* resolved =
++      ResolveNodeHandle(tab_id, params->node_id, web_contents, &resolve_error);
++  if (!resolved) {
++    return RespondNow(Error(resolve_error));
 +  }
-+  
-+  const NodeInfo& node_info = node_it->second;
-+  
++
++  const NodeInfo& node_info = *resolved;
++
 +  // Perform click with change detection
-+  bool change_detected = ClickWithDetection(web_contents, node_info);
-+  
++  ClickWithDetection(
++      web_contents, node_info,
++      base::BindOnce(&BrowserOSClickFunction::OnClickComplete, this));
++  return RespondLater();
++}
++
++void BrowserOSClickFunction::OnClickComplete(bool changed) {
 +  // Create interaction response
 +  browser_os::InteractionResponse response;
-+  response.success = change_detected;
-+  
-+  return RespondNow(ArgumentList(
-+      browser_os::Click::Results::Create(response)));
++  response.success = changed;
++
++  Respond(ArgumentList(browser_os::Click::Results::Create(response)));
 +}
 +
 +// Implementation of BrowserOSInputTextFunction
@@ -492,34 +1328,37 @@ index 0000000000000..58abbe5b785ed
 +  content::WebContents* web_contents = tab_info->web_contents;
 +  int tab_id = tab_info->tab_id;
 +
-+  // Look up the AX node ID from our nodeId
-+  auto tab_it = GetNodeIdMappings().find(tab_id);
-+  if (tab_it == GetNodeIdMappings().end()) {
-+    return RespondNow(Error("No snapshot data for this tab"));
-+  }
-+  
-+  auto node_it = tab_it->second.find(params->node_id);
-+  if (node_it == tab_it->second.end()) {
-+    return RespondNow(Error("Node ID not found"));
++  // Resolve the node handle; a stale handle (snapshot taken before a
++  // navigation) answers with an error instead of acting on whatever node
++  // now occupies the slot.
++  std::string resolve_error;
++  const NodeInfo* resolved =
++      ResolveNodeHandle(tab_id, params->node_id, web_contents, &resolve_error);
++  if (!resolved) {
++    return RespondNow(Error(resolve_error));
 +  }
-+  
-+  const NodeInfo& node_info = node_it->second;
++
++  const NodeInfo& node_info = *resolved;
 +  
 +  LOG(INFO) << "[browseros] InputText: Starting input for nodeId: " << params->node_id;
-+  
++
 +  // Use TypeWithDetection which tries both native and JavaScript methods
-+  bool change_detected = TypeWithDetection(web_contents, node_info, params->text);
-+  
-+  if (!change_detected) {
++  TypeWithDetection(
++      web_contents, node_info, params->text,
++      base::BindOnce(&BrowserOSInputTextFunction::OnInputTextComplete, this));
++  return RespondLater();
++}
++
++void BrowserOSInputTextFunction::OnInputTextComplete(bool changed) {
++  if (!changed) {
 +    LOG(WARNING) << "[browseros] InputText: No change detected after typing";
 +  }
-+  
++
 +  // Create interaction response
 +  browser_os::InteractionResponse response;
-+  response.success = change_detected;
-+  
-+  return RespondNow(ArgumentList(
-+      browser_os::InputText::Results::Create(response)));
++  response.success = changed;
++
++  Respond(ArgumentList(browser_os::InputText::Results::Create(response)));
 +}
 +
 +// Implementation of BrowserOSClearFunction
@@ -541,41 +1380,44 @@ index 0000000000000..58abbe5b785ed
 +  content::WebContents* web_contents = tab_info->web_contents;
 +  int tab_id = tab_info->tab_id;
 +
-+  // Look up the AX node ID from our nodeId
-+  auto tab_it = GetNodeIdMappings().find(tab_id);
-+  if (tab_it == GetNodeIdMappings().end()) {
-+    return RespondNow(Error("No snapshot data for this tab"));
-+  }
-+  
-+  auto node_it = tab_it->second.find(params->node_id);
-+  if (node_it == tab_it->second.end()) {
-+    return RespondNow(Error("Node ID not found"));
++  // Resolve the node handle; a stale handle (snapshot taken before a
++  // navigation) answers with an error instead of acting on whatever node
++  // now occupies the slot.
++  std::string resolve_error;
++  const NodeInfo* resolved =
++      ResolveNodeHandle(tab_id, params->node_id, web_contents, &resolve_error);
++  if (!resolved) {
++    return RespondNow(Error(resolve_error));
 +  }
-+  
-+  const NodeInfo& node_info = node_it->second;
++
++  const NodeInfo& node_info = *resolved;
 +  
 +  LOG(INFO) << "[browseros] Clear: Clearing field for nodeId: " << params->node_id;
-+  
++
 +  // Use ClearWithDetection which handles focus and clearing
-+  bool change_detected = ClearWithDetection(web_contents, node_info);
-+  
-+  if (!change_detected) {
++  ClearWithDetection(
++      web_contents, node_info,
++      base::BindOnce(&BrowserOSClearFunction::OnClearComplete, this));
++  return RespondLater();
++}
++
++void BrowserOSClearFunction::OnClearComplete(bool changed) {
++  if (!changed) {
 +    LOG(WARNING) << "[browseros] Clear: No change detected after clearing";
 +  }
-+  
++
 +  // Create interaction response
 +  browser_os::InteractionResponse response;
-+  response.success = change_detected;
-+  
-+  return RespondNow(ArgumentList(
-+      browser_os::Clear::Results::Create(response)));
++  response.success = changed;
++
++  Respond(ArgumentList(browser_os::Clear::Results::Create(response)));
 +}
 +
-+// Implementation of BrowserOSGetPageLoadStatusFunction
++// Implementation of BrowserOSPerformActionsFunction
 +
-+ExtensionFunction::ResponseAction BrowserOSGetPageLoadStatusFunction::Run() {
-+  std::optional<browser_os::GetPageLoadStatus::Params> params =
-+      browser_os::GetPageLoadStatus::Params::Create(args());
++ExtensionFunction::ResponseAction BrowserOSPerformActionsFunction::Run() {
++  std::optional<browser_os::PerformActions::Params> params =
++      browser_os::PerformActions::Params::Create(args());
 +  EXTENSION_FUNCTION_VALIDATE(params);
 +
 +  // Get the target tab
@@ -586,17 +1428,172 @@ index 0000000000000..58abbe5b785ed
 +  if (!tab_info) {
 +    return RespondNow(Error(error_message));
 +  }
-+  
-+  content::WebContents* web_contents = tab_info->web_contents;
-+  
-+  // Get the primary main frame
-+  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
-+  if (!rfh) {
-+    return RespondNow(Error("No render frame"));
-+  }
-+  
-+  // Build the status object
-+  browser_os::PageLoadStatus status;
++
++  web_contents_ = tab_info->web_contents->GetWeakPtr();
++  tab_id_ = tab_info->tab_id;
++
++  actions_ = std::move(params->actions);
++  response_.success = true;
++
++  if (actions_.empty()) {
++    return RespondNow(ArgumentList(
++        browser_os::PerformActions::Results::Create(response_)));
++  }
++
++  RunNextAction();
++  return did_respond() ? AlreadyResponded() : RespondLater();
++}
++
++void BrowserOSPerformActionsFunction::RunNextAction() {
++  if (next_action_ >= actions_.size()) {
++    Finish();
++    return;
++  }
++
++  content::WebContents* web_contents = web_contents_.get();
++  if (!web_contents) {
++    FailCurrentAction("Tab was closed");
++    return;
++  }
++
++  const browser_os::BatchAction& action = actions_[next_action_];
++
++  // Looks up the NodeInfo for a node-targeted action; returns null when the
++  // node can't be resolved (including a stale pre-navigation handle).
++  auto resolve_node = [&]() -> const NodeInfo* {
++    if (!action.node_id) {
++      return nullptr;
++    }
++    std::string resolve_error;
++    return ResolveNodeHandle(tab_id_, *action.node_id, web_contents,
++                             &resolve_error);
++  };
++
++  auto on_complete = base::BindOnce(
++      &BrowserOSPerformActionsFunction::OnActionComplete, this);
++
++  switch (action.type) {
++    case browser_os::BatchActionType::kClick: {
++      const NodeInfo* node_info = resolve_node();
++      if (!node_info) {
++        FailCurrentAction("Node ID not found");
++        return;
++      }
++      ClickWithDetection(web_contents, *node_info, std::move(on_complete));
++      return;
++    }
++    case browser_os::BatchActionType::kInputText: {
++      const NodeInfo* node_info = resolve_node();
++      if (!node_info) {
++        FailCurrentAction("Node ID not found");
++        return;
++      }
++      if (!action.text) {
++        FailCurrentAction("inputText requires text");
++        return;
++      }
++      TypeWithDetection(web_contents, *node_info, *action.text,
++                        std::move(on_complete));
++      return;
++    }
++    case browser_os::BatchActionType::kClear: {
++      const NodeInfo* node_info = resolve_node();
++      if (!node_info) {
++        FailCurrentAction("Node ID not found");
++        return;
++      }
++      ClearWithDetection(web_contents, *node_info, std::move(on_complete));
++      return;
++    }
++    case browser_os::BatchActionType::kSendKeys: {
++      if (!action.text) {
++        FailCurrentAction("sendKeys requires a key name");
++        return;
++      }
++      KeyPressWithDetection(web_contents, *action.text,
++                            std::move(on_complete));
++      return;
++    }
++    case browser_os::BatchActionType::kScrollUp:
++    case browser_os::BatchActionType::kScrollDown: {
++      content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
++      content::RenderWidgetHostView* rwhv =
++          rfh ? rfh->GetRenderWidgetHost()->GetView() : nullptr;
++      if (!rwhv) {
++        FailCurrentAction("No render widget host view");
++        return;
++      }
++      int scroll_amount = rwhv->GetViewBounds().height() * 0.9;
++      if (action.type == browser_os::BatchActionType::kScrollUp) {
++        scroll_amount = -scroll_amount;
++      }
++      Scroll(web_contents, 0, scroll_amount, true);
++      std::move(on_complete).Run(true);
++      return;
++    }
++    case browser_os::BatchActionType::kNone:
++      FailCurrentAction("Unknown action type");
++      return;
++  }
++}
++
++void BrowserOSPerformActionsFunction::OnActionComplete(bool success) {
++  browser_os::BatchActionResult action_result;
++  action_result.success = success;
++  response_.results.push_back(std::move(action_result));
++
++  if (!success) {
++    // Later actions usually depend on earlier ones (focus, navigation),
++    // so stop rather than act on a page in an unexpected state.
++    response_.success = false;
++    Finish();
++    return;
++  }
++
++  ++next_action_;
++  RunNextAction();
++}
++
++void BrowserOSPerformActionsFunction::FailCurrentAction(std::string error) {
++  browser_os::BatchActionResult action_result;
++  action_result.success = false;
++  action_result.error = std::move(error);
++  response_.results.push_back(std::move(action_result));
++  response_.success = false;
++  Finish();
++}
++
++void BrowserOSPerformActionsFunction::Finish() {
++  Respond(ArgumentList(
++      browser_os::PerformActions::Results::Create(response_)));
++}
++
++// Implementation of BrowserOSGetPageLoadStatusFunction
++
++ExtensionFunction::ResponseAction BrowserOSGetPageLoadStatusFunction::Run() {
++  std::optional<browser_os::GetPageLoadStatus::Params> params =
++      browser_os::GetPageLoadStatus::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  // Get the target tab
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++  
++  content::WebContents* web_contents = tab_info->web_contents;
++  
++  // Get the primary main frame
++  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
++  if (!rfh) {
++    return RespondNow(Error("No render frame"));
++  }
++  
++  // Build the status object
++  browser_os::PageLoadStatus status;
 +  
 +  // Check if any resources are still loading
 +  status.is_resources_loading = web_contents->IsLoading();
@@ -606,11 +1603,106 @@ index 0000000000000..58abbe5b785ed
 +  
 +  // Check if onload has completed (all resources loaded)
 +  status.is_page_complete = rfh->IsDocumentOnLoadCompletedInMainFrame();
-+  
++
++  // Surface memory pressure so agents can back off before the API starts
++  // degrading their snapshots for them
++  status.pressure_level = GetPressureLevel();
++
 +  return RespondNow(ArgumentList(
 +      browser_os::GetPageLoadStatus::Results::Create(status)));
 +}
 +
++// Implementation of BrowserOSGetContentFingerprintFunction
++
++ExtensionFunction::ResponseAction BrowserOSGetContentFingerprintFunction::Run() {
++  std::optional<browser_os::GetContentFingerprint::Params> params =
++      browser_os::GetContentFingerprint::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  // Get the target tab
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++
++  // An empty result means the tree cache is cold (no snapshot yet, or a
++  // navigation invalidated it); the caller should snapshot to re-seed.
++  std::string fingerprint;
++  BrowserOSTreeCache* cache =
++      BrowserOSTreeCache::FromWebContents(tab_info->web_contents);
++  uint64_t value = 0;
++  if (cache && cache->GetContentFingerprint(&value)) {
++    fingerprint = base::NumberToString(value);
++  }
++
++  return RespondNow(ArgumentList(
++      browser_os::GetContentFingerprint::Results::Create(fingerprint)));
++}
++
++// Implementation of BrowserOSWaitForStableFunction
++
++ExtensionFunction::ResponseAction BrowserOSWaitForStableFunction::Run() {
++  std::optional<browser_os::WaitForStable::Params> params =
++      browser_os::WaitForStable::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  // Get the target tab
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++
++  // Clamp the knobs to sane ranges; a zero quiet period would resolve on
++  // the first task-queue hop and a huge timeout would pin the callback.
++  const base::TimeDelta quiet_period = base::Milliseconds(
++      std::clamp(static_cast<int>(params->quiet_millis.value_or(300)), 50,
++                 2000));
++  const base::TimeDelta timeout = base::Milliseconds(
++      std::clamp(static_cast<int>(params->timeout_millis.value_or(5000)), 100,
++                 30000));
++
++  BrowserOSChangeDetector::WaitForQuiescenceAsync(
++      tab_info->web_contents,
++      base::BindOnce(&BrowserOSWaitForStableFunction::OnStable, this),
++      quiet_period, timeout);
++  return RespondLater();
++}
++
++void BrowserOSWaitForStableFunction::OnStable(bool stable) {
++  Respond(
++      ArgumentList(browser_os::WaitForStable::Results::Create(stable)));
++}
++
++// Implementation of BrowserOSSetAgentActiveFunction
++
++ExtensionFunction::ResponseAction BrowserOSSetAgentActiveFunction::Run() {
++  std::optional<browser_os::SetAgentActive::Params> params =
++      browser_os::SetAgentActive::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++
++  BrowserOSAgentBoost::GetOrCreate(tab_info->web_contents)
++      ->SetActive(params->active);
++
++  browser_os::InteractionResponse response;
++  response.success = true;
++  return RespondNow(
++      ArgumentList(browser_os::SetAgentActive::Results::Create(response)));
++}
++
 +// Implementation of BrowserOSScrollUpFunction
 +
 +ExtensionFunction::ResponseAction BrowserOSScrollUpFunction::Run() {
@@ -716,18 +1808,17 @@ index 0000000000000..58abbe5b785ed
 +  content::WebContents* web_contents = tab_info->web_contents;
 +  int tab_id = tab_info->tab_id;
 +  
-+  // Look up the AX node ID from our nodeId
-+  auto tab_it = GetNodeIdMappings().find(tab_id);
-+  if (tab_it == GetNodeIdMappings().end()) {
-+    return RespondNow(Error("No snapshot data for this tab"));
++  // Resolve the node handle; a stale handle (snapshot taken before a
++  // navigation) answers with an error instead of acting on whatever node
++  // now occupies the slot.
++  std::string resolve_error;
++  const NodeInfo* resolved =
++      ResolveNodeHandle(tab_id, params->node_id, web_contents, &resolve_error);
++  if (!resolved) {
++    return RespondNow(Error(resolve_error));
 +  }
-+  
-+  auto node_it = tab_it->second.find(params->node_id);
-+  if (node_it == tab_it->second.end()) {
-+    return RespondNow(Error("Node ID not found"));
-+  }
-+  
-+  const NodeInfo& node_info = node_it->second;
++
++  const NodeInfo& node_info = *resolved;
 +  
 +  // Get viewport bounds to check if node is already in view
 +  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
@@ -793,32 +1884,32 @@ index 0000000000000..58abbe5b785ed
 +  
 +  content::WebContents* web_contents = tab_info->web_contents;
 +  
-+  // Validate the key - use a simple check instead of std::set to avoid exit-time destructor
-+  const std::string& key = params->key;
-+  bool is_supported = (key == "Enter" || key == "Delete" || key == "Backspace" ||
-+                       key == "Tab" || key == "Escape" || key == "ArrowUp" ||
-+                       key == "ArrowDown" || key == "ArrowLeft" || key == "ArrowRight" ||
-+                       key == "Home" || key == "End" || key == "PageUp" || key == "PageDown");
-+  
-+  if (!is_supported) {
++  // Compiling the descriptor validates it (single key or whitespace-
++  // separated sequence) and resolves the event parameters once up front.
++  auto sequence = CompileKeySequence(params->key);
++  if (!sequence) {
 +    return RespondNow(Error("Unsupported key: " + params->key));
 +  }
-+  
++
 +  LOG(INFO) << "[browseros] SendKeys: Sending key '" << params->key << "'";
-+  
-+  // Send the key with change detection
-+  bool change_detected = KeyPressWithDetection(web_contents, params->key);
-+  
-+  if (!change_detected) {
++
++  // Replay the compiled sequence with one detection window around it
++  KeySequenceWithDetection(
++      web_contents, std::move(*sequence),
++      base::BindOnce(&BrowserOSSendKeysFunction::OnSendKeysComplete, this));
++  return RespondLater();
++}
++
++void BrowserOSSendKeysFunction::OnSendKeysComplete(bool changed) {
++  if (!changed) {
 +    LOG(WARNING) << "[browseros] SendKeys: No change detected after key press";
 +  }
-+  
++
 +  // Create interaction response
 +  browser_os::InteractionResponse response;
-+  response.success = change_detected;
-+  
-+  return RespondNow(ArgumentList(
-+      browser_os::SendKeys::Results::Create(response)));
++  response.success = changed;
++
++  Respond(ArgumentList(browser_os::SendKeys::Results::Create(response)));
 +}
 +
 +// Implementation of BrowserOSCaptureScreenshotFunction
@@ -830,10 +1921,42 @@ index 0000000000000..58abbe5b785ed
 +  std::optional<browser_os::CaptureScreenshot::Params> params =
 +      browser_os::CaptureScreenshot::Params::Create(args());
 +  EXTENSION_FUNCTION_VALIDATE(params);
-+  
++
++  // Load shedding: a capture allocates a full-viewport bitmap plus its
++  // encoded copy; refuse rather than add that on a machine at critical
++  // pressure. Agents see the pressure level via getPageLoadStatus.
++  if (IsUnderCriticalPressure()) {
++    return RespondNow(
++        Error("Screenshot unavailable under critical memory pressure"));
++  }
++
++  start_time_ = base::TimeTicks::Now();
++
 +  // Store whether to show highlights
 +  show_highlights_ = params->show_highlights.value_or(false);
 +
++  // An explicit candidate list restricts the overlay to those nodes and
++  // implies highlighting.
++  if (params->highlight_node_ids && !params->highlight_node_ids->empty()) {
++    highlight_node_ids_.emplace(params->highlight_node_ids->begin(),
++                                params->highlight_node_ids->end());
++    show_highlights_ = true;
++  }
++
++  // Encoding options: default PNG for lossless output, JPEG on request
++  use_jpeg_ = params->format && *params->format == "jpeg";
++  if (params->quality) {
++    quality_ = std::clamp(static_cast<int>(*params->quality), 1, 100);
++  }
++
++  // Optional capture region (CSS pixels, viewport-relative)
++  if (params->clip_rect) {
++    clip_rect_ = gfx::RectF(params->clip_rect->x, params->clip_rect->y,
++                            params->clip_rect->width,
++                            params->clip_rect->height);
++  }
++  scale_ = static_cast<float>(params->scale.value_or(1.0));
++
 +  // Get the target tab
 +  std::string error_message;
 +  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
@@ -908,40 +2031,70 @@ index 0000000000000..58abbe5b785ed
 +    
 +    target_size_ = thumbnail_size;
 +  }
-+  
-+  // Store target size for later use
-+  
-+  // Draw highlights first, then capture after a short delay
-+  DrawHighlightsAndCapture();
-+  
-+  return RespondLater();
-+}
 +
-+void BrowserOSCaptureScreenshotFunction::DrawHighlightsAndCapture() {
-+  // Only draw highlights if requested via the showHighlights flag
-+  if (show_highlights_) {
-+    // Check if we have snapshot data for this tab to draw highlights
-+    auto tab_it = GetNodeIdMappings().find(tab_id_);
-+    if (tab_it != GetNodeIdMappings().end() && !tab_it->second.empty()) {
-+      LOG(INFO) << "[browseros] Drawing highlights for screenshot with " 
-+                << tab_it->second.size() << " interactive elements";
-+      ShowHighlights(web_contents_, tab_it->second, true /* show_labels */);
-+    } else {
-+      LOG(INFO) << "[browseros] No snapshot data available for highlighting";
++  // A clipped capture sizes its output from the region itself (times the
++  // requested scale) unless exact dimensions were given.
++  if (clip_rect_ && !use_exact_dimensions_ && !params->thumbnail_size) {
++    target_size_ = gfx::ScaleToFlooredSize(
++        gfx::Size(static_cast<int>(clip_rect_->width()),
++                  static_cast<int>(clip_rect_->height())),
++        scale_);
++  }
++
++  // Frame dedup: when the compositor hasn't drawn since the last capture
++  // with these exact parameters, the surface still holds the same frame -
++  // return that capture's encoding instead of re-copying and re-encoding
++  // identical pixels. Highlight captures are exempt: the overlay is drawn
++  // from snapshot state that can change without a new frame.
++  auto* screenshot_cache = BrowserOSScreenshotCache::GetOrCreate(web_contents);
++  capture_frame_sequence_ = screenshot_cache->frame_sequence();
++  if (!show_highlights_) {
++    // Everything besides the frame itself that affects the encoded bytes.
++    params_hash_ = base::FastHash(base::StringPrintf(
++        "%dx%d|j%d|q%d|s%.3f|%.1f,%.1f,%.1f,%.1f", target_size_.width(),
++        target_size_.height(), use_jpeg_ ? 1 : 0, quality_, scale_,
++        clip_rect_ ? clip_rect_->x() : -1.0f,
++        clip_rect_ ? clip_rect_->y() : -1.0f,
++        clip_rect_ ? clip_rect_->width() : -1.0f,
++        clip_rect_ ? clip_rect_->height() : -1.0f));
++    if (const std::string* cached = screenshot_cache->Lookup(params_hash_)) {
++      VLOG(1) << "[browseros] CaptureScreenshot: no new frame since last "
++              << "capture - serving cached encoding";
++      LogApiTiming("CaptureScreenshot", start_time_, "bytes",
++                   static_cast<int>(cached->size()));
++      return RespondNow(
++          ArgumentList(browser_os::CaptureScreenshot::Results::Create(
++              *cached, /*unchanged=*/true)));
 +    }
-+    
-+    // Use PostDelayedTask to allow the renderer to paint the highlights
-+    // This lets the event loop run and process the DOM changes
-+    // Use scoped_refptr to keep the function alive
-+    base::SequencedTaskRunner::GetCurrentDefault()->PostDelayedTask(
-+        FROM_HERE,
-+        base::BindOnce(&BrowserOSCaptureScreenshotFunction::CaptureScreenshotNow,
-+                       base::WrapRefCounted(this)),
-+        base::Milliseconds(1000));  // Give enough time for JS execution and paint
-+  } else {
-+    // No highlights needed, capture immediately
-+    CaptureScreenshotNow();
 +  }
++
++  // Highlights are drawn onto the captured bitmap in the browser process,
++  // so capture can start as soon as the scheduler grants a slot; no
++  // injected script, no renderer repaint, no post-injection settle delay.
++  AgentScheduler::GetInstance().Schedule(
++      tab_id_,
++      base::BindOnce(&BrowserOSCaptureScreenshotFunction::StartScheduledCapture,
++                     this));
++  return did_respond() ? AlreadyResponded() : RespondLater();
++}
++
++void BrowserOSCaptureScreenshotFunction::StartScheduledCapture(
++    std::unique_ptr<AgentScheduler::ScopedOperation> operation) {
++  scheduler_operation_ = std::move(operation);
++
++  // The tab can close while the operation sits in the scheduler queue;
++  // re-resolve it instead of trusting the stored pointer.
++  WindowController* window = nullptr;
++  content::WebContents* web_contents = nullptr;
++  if (!ExtensionTabUtil::GetTabById(tab_id_, browser_context(),
++                                    include_incognito_information(), &window,
++                                    &web_contents, nullptr) ||
++      web_contents != web_contents_) {
++    Respond(Error("Tab was closed while the capture was queued"));
++    return;
++  }
++
++  CaptureScreenshotNow();
 +}
 +
 +void BrowserOSCaptureScreenshotFunction::CaptureScreenshotNow() {
@@ -965,9 +2118,26 @@ index 0000000000000..58abbe5b785ed
 +  content::RenderWidgetHostImpl* rwhi = 
 +      static_cast<content::RenderWidgetHostImpl*>(rwh);
 +  
++  // Clip to the requested region when one was given; the rect arrives in
++  // CSS pixels and CopyFromSurface wants widget coordinates, so apply the
++  // same conversion input events use.
++  gfx::Rect src_rect;  // Empty rect means copy entire surface
++  const float css_to_widget = CssToWidgetScale(web_contents_, rwh);
++  if (clip_rect_) {
++    gfx::RectF widget_rect = *clip_rect_;
++    widget_rect.Scale(css_to_widget);
++    src_rect = gfx::ToEnclosingRect(widget_rect);
++    capture_rect_css_ = *clip_rect_;
++  } else if (css_to_widget > 0) {
++    // Full-surface capture: the bitmap covers the visible viewport.
++    gfx::SizeF view_size(rwhi->GetView()->GetViewBounds().size());
++    capture_rect_css_ = gfx::RectF(view_size.width() / css_to_widget,
++                                   view_size.height() / css_to_widget);
++  }
++
 +  // Request the screenshot
 +  rwhi->GetView()->CopyFromSurface(
-+      gfx::Rect(),  // Empty rect means copy entire surface
++      src_rect,
 +      target_size_,
 +      base::BindOnce(&BrowserOSCaptureScreenshotFunction::OnScreenshotCaptured,
 +                     this));
@@ -975,30 +2145,248 @@ index 0000000000000..58abbe5b785ed
 +
 +void BrowserOSCaptureScreenshotFunction::OnScreenshotCaptured(
 +    const SkBitmap& bitmap) {
-+  // Clean up the highlights immediately after capture (only if we added them)
-+  if (show_highlights_ && web_contents_) {
-+    RemoveHighlights(web_contents_);
++  if (bitmap.empty()) {
++    Respond(Error("Failed to capture screenshot"));
++    return;
++  }
++
++  // Overlay highlights on the bitmap browser-side; the page is untouched.
++  SkBitmap output = bitmap;
++  if (show_highlights_) {
++    auto tab_it = GetNodeRegistries().find(tab_id_);
++    if (tab_it != GetNodeRegistries().end() && !tab_it->second.nodes.empty()) {
++      LOG(INFO) << "[browseros] Overlaying highlights for screenshot with "
++                << (highlight_node_ids_
++                        ? highlight_node_ids_->size()
++                        : tab_it->second.nodes.size())
++                << " elements";
++      DrawHighlightsOnBitmap(
++          &output, tab_it->second.nodes, capture_rect_css_,
++          true /* show_labels */,
++          highlight_node_ids_ ? &*highlight_node_ids_ : nullptr);
++    } else {
++      LOG(INFO) << "[browseros] No snapshot data available for highlighting";
++    }
++  }
++
++  // Encode and base64 off the UI thread; SkBitmap is cheap to copy into
++  // the task (the pixel buffer is refcounted).
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE, {base::TaskPriority::USER_VISIBLE},
++      browseros::AnnotateTask("Api", base::BindOnce(&EncodeScreenshotDataUrl, output, use_jpeg_, quality_)),
++      base::BindOnce(&BrowserOSCaptureScreenshotFunction::OnScreenshotEncoded,
++                     base::WrapRefCounted(this)));
++}
++
++void BrowserOSCaptureScreenshotFunction::OnScreenshotEncoded(
++    std::string data_url) {
++  if (data_url.empty()) {
++    Respond(Error("Failed to encode screenshot"));
++    return;
++  }
++
++  // Feed the dedup cache so an identical capture of this same frame is
++  // answered without touching the compositor.
++  if (!show_highlights_ && web_contents_) {
++    BrowserOSScreenshotCache::GetOrCreate(web_contents_)
++        ->Store(params_hash_, capture_frame_sequence_, data_url);
++  }
++
++  LogApiTiming("CaptureScreenshot", start_time_, "bytes",
++               static_cast<int>(data_url.size()));
++  Respond(ArgumentList(browser_os::CaptureScreenshot::Results::Create(
++      data_url, /*unchanged=*/false)));
++}
++
++// Implementation of BrowserOSCaptureWithSnapshotFunction
++
++BrowserOSCaptureWithSnapshotFunction::BrowserOSCaptureWithSnapshotFunction() =
++    default;
++BrowserOSCaptureWithSnapshotFunction::~BrowserOSCaptureWithSnapshotFunction() =
++    default;
++
++ExtensionFunction::ResponseAction BrowserOSCaptureWithSnapshotFunction::Run() {
++  std::optional<browser_os::CaptureWithSnapshot::Params> params =
++      browser_os::CaptureWithSnapshot::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  // Same load-shedding rule as captureScreenshot.
++  if (IsUnderCriticalPressure()) {
++    return RespondNow(
++        Error("Screenshot unavailable under critical memory pressure"));
++  }
++
++  start_time_ = base::TimeTicks::Now();
++
++  use_jpeg_ = params->format && *params->format == "jpeg";
++  if (params->quality) {
++    quality_ = std::clamp(static_cast<int>(*params->quality), 1, 100);
++  }
++
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++  web_contents_ = tab_info->web_contents;
++  tab_id_ = tab_info->tab_id;
++
++  // Both halves are heavy (a surface copy and a renderer tree walk), so
++  // the whole operation takes one scheduler slot.
++  AgentScheduler::GetInstance().Schedule(
++      tab_id_,
++      base::BindOnce(
++          &BrowserOSCaptureWithSnapshotFunction::StartScheduledCapture, this));
++  return did_respond() ? AlreadyResponded() : RespondLater();
++}
++
++void BrowserOSCaptureWithSnapshotFunction::StartScheduledCapture(
++    std::unique_ptr<AgentScheduler::ScopedOperation> operation) {
++  scheduler_operation_ = std::move(operation);
++
++  // The tab can close while the operation sits in the scheduler queue;
++  // re-resolve it instead of trusting the stored pointer.
++  WindowController* window = nullptr;
++  content::WebContents* web_contents = nullptr;
++  if (!ExtensionTabUtil::GetTabById(tab_id_, browser_context(),
++                                    include_incognito_information(), &window,
++                                    &web_contents, nullptr) ||
++      web_contents != web_contents_) {
++    Respond(Error("Tab was closed while the capture was queued"));
++    return;
++  }
++
++  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
++  if (!rfh || !rfh->IsRenderFrameLive() || !rfh->IsActive()) {
++    Respond(Error("Frame not stable for capture"));
++    return;
++  }
++  content::RenderWidgetHost* rwh = rfh->GetRenderWidgetHost();
++  content::RenderWidgetHostView* rwhv = rwh ? rwh->GetView() : nullptr;
++  if (!rwhv) {
++    Respond(Error("No render widget host view"));
++    return;
++  }
++  target_size_ = rwhv->GetViewBounds().size();
++
++  // Kick both halves back to back: the surface copy pins the pixels, and
++  // the tree read describes the page as it is right now, so the rects line
++  // up with the image instead of with whatever the page looks like one
++  // extension round trip later. The halves complete in either order and
++  // the response waits for both.
++  rwhv->CopyFromSurface(
++      gfx::Rect(), target_size_,
++      base::BindOnce(
++          &BrowserOSCaptureWithSnapshotFunction::OnScreenshotCaptured, this));
++
++  ui::AXTreeUpdate cached_update;
++  if (BrowserOSTreeCache::GetOrCreate(web_contents)
++          ->GetCachedTree(&cached_update)) {
++    VLOG(1) << "[browseros] captureWithSnapshot serving tree from cache";
++    served_from_cache_ = true;
++    OnAccessibilityTreeReceived(cached_update);
++  } else {
++    web_contents->RequestAXTreeSnapshot(
++        base::BindOnce(
++            &BrowserOSCaptureWithSnapshotFunction::OnAccessibilityTreeReceived,
++            this),
++        ui::AXMode(ui::AXMode::kWebContents | ui::AXMode::kExtendedProperties),
++        /* max_nodes= */ 0,
++        /* timeout= */ base::TimeDelta(),
++        content::WebContents::AXTreeSnapshotPolicy::kAll);
++  }
++}
++
++void BrowserOSCaptureWithSnapshotFunction::OnScreenshotCaptured(
++    const SkBitmap& bitmap) {
++  if (did_respond()) {
++    return;
 +  }
-+  
 +  if (bitmap.empty()) {
 +    Respond(Error("Failed to capture screenshot"));
 +    return;
 +  }
-+  
-+  // Convert bitmap to PNG
-+  auto png_data = gfx::PNGCodec::EncodeBGRASkBitmap(bitmap, false);
-+  if (!png_data.has_value()) {
++
++  // Encode and base64 off the UI thread, same as captureScreenshot.
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE, {base::TaskPriority::USER_VISIBLE},
++      browseros::AnnotateTask(
++          "Api",
++          base::BindOnce(&EncodeScreenshotDataUrl, bitmap, use_jpeg_,
++                         quality_)),
++      base::BindOnce(
++          &BrowserOSCaptureWithSnapshotFunction::OnScreenshotEncoded,
++          base::WrapRefCounted(this)));
++}
++
++void BrowserOSCaptureWithSnapshotFunction::OnScreenshotEncoded(
++    std::string data_url) {
++  if (did_respond()) {
++    return;
++  }
++  if (data_url.empty()) {
 +    Respond(Error("Failed to encode screenshot"));
 +    return;
 +  }
-+  
-+  // Convert to base64 data URL
-+  std::string base64_data = base::Base64Encode(png_data.value());
-+  
-+  std::string data_url = "data:image/png;base64," + base64_data;
-+  
++  data_url_ = std::move(data_url);
++  screenshot_done_ = true;
++  MaybeRespond();
++}
++
++void BrowserOSCaptureWithSnapshotFunction::OnAccessibilityTreeReceived(
++    ui::AXTreeUpdate& tree_update) {
++  if (did_respond()) {
++    return;
++  }
++  if (!web_contents_) {
++    Respond(Error("Web contents destroyed"));
++    return;
++  }
++
++  // A fresh renderer snapshot (re-)seeds the per-tab tree cache, same as
++  // the standalone snapshot paths.
++  if (!served_from_cache_) {
++    BrowserOSTreeCache::GetOrCreate(web_contents_)
++        ->SeedFromSnapshot(tree_update, /*includes_inline_text_boxes=*/false);
++  }
++
++  // Viewport-only: the text layer only needs to cover what the image
++  // shows, and the culled pass is what keeps this call cheap enough to
++  // run every step.
++  SnapshotProcessor::ProcessAccessibilityTree(
++      std::move(tree_update), tab_id_, g_next_snapshot_id++, web_contents_,
++      base::BindOnce(
++          &BrowserOSCaptureWithSnapshotFunction::OnSnapshotProcessed,
++          base::WrapRefCounted(this)),
++      /*intern_strings=*/false,
++      /*viewport_only=*/true);
++}
++
++void BrowserOSCaptureWithSnapshotFunction::OnSnapshotProcessed(
++    SnapshotProcessingResult result) {
++  if (did_respond()) {
++    return;
++  }
++  snapshot_ = std::move(result.snapshot);
++  snapshot_done_ = true;
++  MaybeRespond();
++}
++
++void BrowserOSCaptureWithSnapshotFunction::MaybeRespond() {
++  if (!screenshot_done_ || !snapshot_done_) {
++    return;
++  }
++
++  browser_os::CaptureWithSnapshotResult combined;
++  combined.data_url = std::move(data_url_);
++  combined.snapshot = std::move(snapshot_);
++
++  LogApiTiming("CaptureWithSnapshot", start_time_, "bytes",
++               static_cast<int>(combined.data_url.size()));
 +  Respond(ArgumentList(
-+      browser_os::CaptureScreenshot::Results::Create(data_url)));
++      browser_os::CaptureWithSnapshot::Results::Create(combined)));
 +}
 +
 +// BrowserOSGetSnapshotFunction implementation
@@ -1016,7 +2404,21 @@ index 0000000000000..58abbe5b785ed
 +  }
 +  
 +  content::WebContents* web_contents = tab_info->web_contents;
++  web_contents_ = web_contents;  // For the per-tab content cache
 +  
++  // Serve from the per-tab tree cache when it is current: an agent that
++  // requests the interactive and content views of the same page pays the
++  // renderer serialization once and both projections read the shared
++  // ingested tree. Extraction seeds the cache after a renderer fetch, so
++  // either call order gets the fast path on its second leg.
++  ui::AXTreeUpdate cached_update;
++  if (BrowserOSTreeCache::GetOrCreate(web_contents)
++          ->GetCachedTree(&cached_update)) {
++    VLOG(1) << "[browseros] Serving content snapshot from tree cache";
++    OnAccessibilityTreeReceived(cached_update);
++    return RespondLater();
++  }
++
 +  // Request accessibility tree snapshot
 +  web_contents->RequestAXTreeSnapshot(
 +      base::BindOnce(&BrowserOSGetSnapshotFunction::OnAccessibilityTreeReceived,
@@ -1035,11 +2437,18 @@ index 0000000000000..58abbe5b785ed
 +    return;
 +  }
 +
-+  // Extract page content using the processor
-+  base::Time start_time = base::Time::Now();
-+  auto items = ContentProcessor::ExtractPageContent(tree_update);
++  // Extract page content; unchanged top-level sections are reused from the
++  // tab's previous extraction, large trees are split over the thread pool,
++  // and the call completes via OnContentExtracted.
++  ContentProcessor::ExtractPageContentIncrementalAsync(
++      web_contents_, tree_update,
++      base::BindOnce(&BrowserOSGetSnapshotFunction::OnContentExtracted, this,
++                     base::Time::Now()));
++}
 +
-+  // Build result
++void BrowserOSGetSnapshotFunction::OnContentExtracted(
++    base::Time start_time,
++    std::vector<browser_os::ContentItem> items) {
 +  browser_os::PageContent result;
 +  result.items = std::move(items);
 +  result.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
@@ -1049,6 +2458,128 @@ index 0000000000000..58abbe5b785ed
 +  Respond(ArgumentList(browser_os::GetSnapshot::Results::Create(result)));
 +}
 +
++// BrowserOSGetSnapshotBinaryFunction implementation
++ExtensionFunction::ResponseAction BrowserOSGetSnapshotBinaryFunction::Run() {
++  auto params = browser_os::GetSnapshotBinary::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  // Get the target tab
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++
++  content::WebContents* web_contents = tab_info->web_contents;
++  web_contents_ = web_contents;  // For the per-tab content cache
++
++  // Same shared-tree fast path as getSnapshot.
++  ui::AXTreeUpdate cached_update;
++  if (BrowserOSTreeCache::GetOrCreate(web_contents)
++          ->GetCachedTree(&cached_update)) {
++    OnAccessibilityTreeReceived(cached_update);
++    return RespondLater();
++  }
++
++  // Request accessibility tree snapshot
++  web_contents->RequestAXTreeSnapshot(
++      base::BindOnce(
++          &BrowserOSGetSnapshotBinaryFunction::OnAccessibilityTreeReceived,
++          this),
++      ui::AXMode(ui::AXMode::kWebContents | ui::AXMode::kExtendedProperties),
++      /* max_nodes= */ 0,  // No limit
++      /* timeout= */ base::TimeDelta(),
++      content::WebContents::AXTreeSnapshotPolicy::kAll);
++
++  return RespondLater();
++}
++
++void BrowserOSGetSnapshotBinaryFunction::OnAccessibilityTreeReceived(
++    ui::AXTreeUpdate& tree_update) {
++  if (!has_callback()) {
++    return;
++  }
++
++  // Extract items (large trees are split over the thread pool), then emit
++  // the flat binary form instead of the per-item base::Value tree
++  // getSnapshot builds.
++  ContentProcessor::ExtractPageContentIncrementalAsync(
++      web_contents_, tree_update,
++      base::BindOnce(&BrowserOSGetSnapshotBinaryFunction::OnContentExtracted,
++                     this));
++}
++
++void BrowserOSGetSnapshotBinaryFunction::OnContentExtracted(
++    std::vector<browser_os::ContentItem> items) {
++  std::vector<uint8_t> buffer = ContentProcessor::SerializeToBinary(items);
++
++  Respond(ArgumentList(
++      browser_os::GetSnapshotBinary::Results::Create(std::move(buffer))));
++}
++
++// BrowserOSGetSnapshotMarkdownFunction implementation
++ExtensionFunction::ResponseAction BrowserOSGetSnapshotMarkdownFunction::Run() {
++  auto params = browser_os::GetSnapshotMarkdown::Params::Create(args());
++  EXTENSION_FUNCTION_VALIDATE(params);
++
++  // Get the target tab
++  std::string error_message;
++  auto tab_info = GetTabFromOptionalId(params->tab_id, browser_context(),
++                                       include_incognito_information(),
++                                       &error_message);
++  if (!tab_info) {
++    return RespondNow(Error(error_message));
++  }
++
++  content::WebContents* web_contents = tab_info->web_contents;
++  web_contents_ = web_contents;  // For the per-tab content cache
++
++  // Same shared-tree fast path as getSnapshot.
++  ui::AXTreeUpdate cached_update;
++  if (BrowserOSTreeCache::GetOrCreate(web_contents)
++          ->GetCachedTree(&cached_update)) {
++    OnAccessibilityTreeReceived(cached_update);
++    return RespondLater();
++  }
++
++  // Request accessibility tree snapshot
++  web_contents->RequestAXTreeSnapshot(
++      base::BindOnce(
++          &BrowserOSGetSnapshotMarkdownFunction::OnAccessibilityTreeReceived,
++          this),
++      ui::AXMode(ui::AXMode::kWebContents | ui::AXMode::kExtendedProperties),
++      /* max_nodes= */ 0,  // No limit
++      /* timeout= */ base::TimeDelta(),
++      content::WebContents::AXTreeSnapshotPolicy::kAll);
++
++  return RespondLater();
++}
++
++void BrowserOSGetSnapshotMarkdownFunction::OnAccessibilityTreeReceived(
++    ui::AXTreeUpdate& tree_update) {
++  if (!has_callback()) {
++    return;
++  }
++
++  // Extract items (large trees are split over the thread pool), then
++  // render them to markdown in one pass instead of shipping the item
++  // list for the extension to re-serialize.
++  ContentProcessor::ExtractPageContentIncrementalAsync(
++      web_contents_, tree_update,
++      base::BindOnce(&BrowserOSGetSnapshotMarkdownFunction::OnContentExtracted,
++                     this));
++}
++
++void BrowserOSGetSnapshotMarkdownFunction::OnContentExtracted(
++    std::vector<browser_os::ContentItem> items) {
++  std::string markdown = ContentProcessor::ToMarkdown(items);
++
++  Respond(ArgumentList(
++      browser_os::GetSnapshotMarkdown::Results::Create(std::move(markdown))));
++}
++
 +// BrowserOSGetPrefFunction
 +ExtensionFunction::ResponseAction BrowserOSGetPrefFunction::Run() {
 +  std::optional<browser_os::GetPref::Params> params =
@@ -1193,6 +2724,72 @@ index 0000000000000..58abbe5b785ed
 +}
 +
 +// BrowserOSExecuteJavaScriptFunction
++// Per-tab registry of scripts registered through executeJavaScript's
++// registerScript option. The source stays browser-side; the page holds the
++// compiled function under window.__browserosScripts, so repeat invocations
++// reuse V8's compiled code instead of recompiling a multi-kilobyte script
++// on every call. A cross-document navigation drops the page's copy, so
++// installed ids are tracked per document and re-installed lazily from the
++// stored source.
++class ScriptRegistry : public content::WebContentsObserver,
++                       public content::WebContentsUserData<ScriptRegistry> {
++ public:
++  ~ScriptRegistry() override = default;
++
++  ScriptRegistry(const ScriptRegistry&) = delete;
++  ScriptRegistry& operator=(const ScriptRegistry&) = delete;
++
++  static ScriptRegistry* GetOrCreate(content::WebContents* web_contents) {
++    CreateForWebContents(web_contents);
++    return FromWebContents(web_contents);
++  }
++
++  // Stores |source| and returns its handle. The source must evaluate to a
++  // function expression; that is the caller's contract to enforce.
++  int Register(const std::string& source) {
++    const int script_id = next_script_id_++;
++    sources_[script_id] = source;
++    return script_id;
++  }
++
++  const std::string* GetSource(int script_id) const {
++    auto it = sources_.find(script_id);
++    return it == sources_.end() ? nullptr : &it->second;
++  }
++
++  bool IsInstalled(int script_id) const {
++    return installed_.count(script_id) > 0;
++  }
++  void MarkInstalled(int script_id) { installed_.insert(script_id); }
++
++ private:
++  explicit ScriptRegistry(content::WebContents* web_contents)
++      : content::WebContentsObserver(web_contents),
++        content::WebContentsUserData<ScriptRegistry>(*web_contents) {}
++  friend class content::WebContentsUserData<ScriptRegistry>;
++
++  // content::WebContentsObserver:
++  void DidFinishNavigation(
++      content::NavigationHandle* navigation_handle) override {
++    if (!navigation_handle->IsInPrimaryMainFrame() ||
++        !navigation_handle->HasCommitted() ||
++        navigation_handle->IsSameDocument()) {
++      return;
++    }
++    // The new document has no registry object. Sources are kept so the
++    // next invocation re-installs without the extension resending them.
++    installed_.clear();
++  }
++
++  int next_script_id_ = 1;
++  std::map<int, std::string> sources_;
++  std::set<int> installed_;
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(ScriptRegistry);
++
 +ExtensionFunction::ResponseAction BrowserOSExecuteJavaScriptFunction::Run() {
 +  std::optional<browser_os::ExecuteJavaScript::Params> params =
 +      browser_os::ExecuteJavaScript::Params::Create(args());
@@ -1214,11 +2811,98 @@ index 0000000000000..58abbe5b785ed
 +  if (!rfh) {
 +    return RespondNow(Error("No render frame"));
 +  }
-+  
++
++  const auto& options = params->options;
++  // Large results are cheapest as one renderer-side JSON.stringify string;
++  // see ExecuteJavaScriptOptions.stringifyResult.
++  const bool stringify_result =
++      options && options->stringify_result.value_or(false);
++
++  // Registration: compile the function once, park it in the page's
++  // registry object and answer with the handle.
++  if (options && options->register_script.value_or(false)) {
++    ScriptRegistry* registry = ScriptRegistry::GetOrCreate(web_contents);
++    const int script_id = registry->Register(params->code);
++    LOG(INFO) << "[browseros] ExecuteJavaScript: Registering script "
++              << script_id << " in tab " << tab_info->tab_id;
++    std::string install = base::StringPrintf(
++        "(function() {"
++        "  var r = window.__browserosScripts ="
++        "      window.__browserosScripts || {};"
++        "  r[%d] = (%s);"
++        "  return %d;"
++        "})();",
++        script_id, params->code.c_str(), script_id);
++    rfh->ExecuteJavaScriptForTests(
++        base::UTF8ToUTF16(install),
++        base::BindOnce(&BrowserOSExecuteJavaScriptFunction::OnScriptRegistered,
++                       this, script_id),
++        /*honor_js_content_settings=*/false);
++    registry->MarkInstalled(script_id);
++    return RespondLater();
++  }
++
++  // Invocation by handle: run the already-compiled function. Only after a
++  // cross-document navigation is the stored source sent (and compiled)
++  // again, piggybacked on the same invocation.
++  if (options && options->script_id) {
++    const int script_id = *options->script_id;
++    ScriptRegistry* registry = ScriptRegistry::GetOrCreate(web_contents);
++    const std::string* source = registry->GetSource(script_id);
++    if (!source) {
++      return RespondNow(Error(
++          base::StringPrintf("Unknown script id: %d", script_id)));
++    }
++    const std::string args_json =
++        options->args.value_or(std::string("[]"));
++    // When requested, the return value collapses to one string inside the
++    // renderer; undefined maps to null so the stub always yields a value.
++    const char* result_expr =
++        stringify_result ? "v === undefined ? null : JSON.stringify(v)" : "v";
++    std::string invoke;
++    if (registry->IsInstalled(script_id)) {
++      invoke = base::StringPrintf(
++          "(function() {"
++          "  var r = window.__browserosScripts;"
++          "  if (!r || !r[%d]) return null;"
++          "  var v = r[%d].apply(null, (%s));"
++          "  return %s;"
++          "})();",
++          script_id, script_id, args_json.c_str(), result_expr);
++    } else {
++      invoke = base::StringPrintf(
++          "(function() {"
++          "  var r = window.__browserosScripts ="
++          "      window.__browserosScripts || {};"
++          "  r[%d] = (%s);"
++          "  var v = r[%d].apply(null, (%s));"
++          "  return %s;"
++          "})();",
++          script_id, source->c_str(), script_id, args_json.c_str(),
++          result_expr);
++      registry->MarkInstalled(script_id);
++    }
++    rfh->ExecuteJavaScriptForTests(
++        base::UTF8ToUTF16(invoke),
++        base::BindOnce(
++            &BrowserOSExecuteJavaScriptFunction::OnJavaScriptExecuted, this),
++        /*honor_js_content_settings=*/false);
++    return RespondLater();
++  }
++
 +  LOG(INFO) << "[browseros] ExecuteJavaScript: Executing code in tab " << tab_info->tab_id;
 +  
-+  // Convert JavaScript code string to UTF16
-+  std::u16string js_code = base::UTF8ToUTF16(params->code);
++  // Convert JavaScript code string to UTF16. The stringify wrapper treats
++  // |code| as an expression (its documented contract).
++  std::u16string js_code =
++      stringify_result
++          ? base::UTF8ToUTF16(base::StringPrintf(
++                "(function() {"
++                "  var v = (%s);"
++                "  return v === undefined ? null : JSON.stringify(v);"
++                "})();",
++                params->code.c_str()))
++          : base::UTF8ToUTF16(params->code);
 +  
 +  // Execute the JavaScript code using ExecuteJavaScriptForTests
 +  // This will return the result of the execution
@@ -1231,6 +2915,14 @@ index 0000000000000..58abbe5b785ed
 +  return RespondLater();
 +}
 +
++void BrowserOSExecuteJavaScriptFunction::OnScriptRegistered(int script_id,
++                                                            base::Value result) {
++  base::Value::Dict dict;
++  dict.Set("scriptId", script_id);
++  Respond(ArgumentList(browser_os::ExecuteJavaScript::Results::Create(
++      base::Value(std::move(dict)))));
++}
++
 +void BrowserOSExecuteJavaScriptFunction::OnJavaScriptExecuted(base::Value result) {
 +  LOG(INFO) << "[browseros] ExecuteJavaScript: Execution completed";
 +
@@ -1269,20 +2961,26 @@ index 0000000000000..58abbe5b785ed
 +  // Create the click point from the coordinates
 +  gfx::PointF click_point(params->x, params->y);
 +  
-+  LOG(INFO) << "[browseros] ClickCoordinates: Clicking at (" 
++  LOG(INFO) << "[browseros] ClickCoordinates: Clicking at ("
 +            << params->x << ", " << params->y << ")";
-+  
++
 +  // Perform the click with change detection
-+  bool success = ClickCoordinatesWithDetection(web_contents, click_point);
-+  
++  ClickCoordinatesWithDetection(
++      web_contents, click_point,
++      base::BindOnce(&BrowserOSClickCoordinatesFunction::OnClickComplete,
++                     this));
++  return RespondLater();
++}
++
++void BrowserOSClickCoordinatesFunction::OnClickComplete(bool changed) {
 +  // Prepare the response
 +  browser_os::InteractionResponse response;
-+  response.success = success;
-+  
-+  LOG(INFO) << "[browseros] ClickCoordinates: Result = " 
-+            << (success ? "success" : "no change detected");
-+  
-+  return RespondNow(ArgumentList(
++  response.success = changed;
++
++  LOG(INFO) << "[browseros] ClickCoordinates: Result = "
++            << (changed ? "success" : "no change detected");
++
++  Respond(ArgumentList(
 +      browser_os::ClickCoordinates::Results::Create(response)));
 +}
 +
@@ -1310,20 +3008,26 @@ index 0000000000000..58abbe5b785ed
 +  // Create the click point from the coordinates
 +  gfx::PointF click_point(params->x, params->y);
 +  
-+  LOG(INFO) << "[browseros] TypeAtCoordinates: Clicking at (" 
++  LOG(INFO) << "[browseros] TypeAtCoordinates: Clicking at ("
 +            << params->x << ", " << params->y << ") and typing: " << params->text;
-+  
++
 +  // Perform the click and type operation
-+  bool success = TypeAtCoordinatesWithDetection(web_contents, click_point, params->text);
-+  
++  TypeAtCoordinatesWithDetection(
++      web_contents, click_point, params->text,
++      base::BindOnce(&BrowserOSTypeAtCoordinatesFunction::OnTypeComplete,
++                     this));
++  return RespondLater();
++}
++
++void BrowserOSTypeAtCoordinatesFunction::OnTypeComplete(bool changed) {
 +  // Prepare the response
 +  browser_os::InteractionResponse response;
-+  response.success = success;
-+  
-+  LOG(INFO) << "[browseros] TypeAtCoordinates: Result = " 
-+            << (success ? "success" : "failed");
-+  
-+  return RespondNow(ArgumentList(
++  response.success = changed;
++
++  LOG(INFO) << "[browseros] TypeAtCoordinates: Result = "
++            << (changed ? "success" : "failed");
++
++  Respond(ArgumentList(
 +      browser_os::TypeAtCoordinates::Results::Create(response)));
 +}
 +
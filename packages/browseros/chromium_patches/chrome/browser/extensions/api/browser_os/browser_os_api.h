@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api.h b/chrome/browser/extensions/api/browser_os/browser_os_api.h
 new file mode 100644
-index 0000000000000..5f4276cf89432
+index 0000000000000..050a793b9a368
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api.h
-@@ -0,0 +1,344 @@
+@@ -0,0 +1,758 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,14 +12,24 @@ index 0000000000000..5f4276cf89432
 +#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_API_H_
 +
 +#include <cstdint>
++#include <memory>
++#include <optional>
++#include <string>
++#include <unordered_set>
++#include <utility>
++#include <vector>
 +
 +#include "base/memory/raw_ptr.h"
++#include "base/memory/weak_ptr.h"
++#include "base/time/time.h"
 +#include "base/values.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_agent_scheduler.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_content_processor.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h"
 +#include "extensions/browser/extension_function.h"
 +#include "third_party/skia/include/core/SkBitmap.h"
++#include "ui/accessibility/ax_tree_update.h"
 +
 +namespace content {
 +class WebContents;
@@ -48,6 +58,15 @@ index 0000000000000..5f4276cf89432
 +
 + private:
 +  void OnAccessibilityTreeReceived(ui::AXTreeUpdate& tree_update);
++
++  // Whether the tree came from the per-tab cache (skip re-seeding it)
++  bool served_from_cache_ = false;
++
++  // When Run() started, for the per-function latency histogram
++  base::TimeTicks start_time_;
++
++  // Web contents for seeding the tree cache in the snapshot callback
++  raw_ptr<content::WebContents> web_contents_ = nullptr;
 +};
 +
 +class BrowserOSGetInteractiveSnapshotFunction : public ExtensionFunction {
@@ -64,19 +83,163 @@ index 0000000000000..5f4276cf89432
 +  ResponseAction Run() override;
 +
 + private:
++  // Heavy half of Run(), invoked by the agent scheduler when a concurrency
++  // slot is available: the renderer round trip (or cached-tree processing)
++  // and everything after it.
++  void StartScheduledSnapshot(
++      std::unique_ptr<AgentScheduler::ScopedOperation> operation);
++
 +  void OnAccessibilityTreeReceived(ui::AXTreeUpdate& tree_update);
++  void OnViewportChunkProcessed(SnapshotProcessingResult result);
 +  void OnSnapshotProcessed(SnapshotProcessingResult result);
-+  
-+  // Counter for snapshot IDs
-+  static uint32_t next_snapshot_id_;
-+  
++
++  // Answers a cursor call (options.cursor) from the per-tab ranked element
++  // cache; no renderer round trip or processing happens. Errors when the
++  // cursor no longer matches the cached snapshot.
++  ResponseAction ServeCursorPage(const std::string& cursor);
++
++  // Reply from the off-thread element compression (options.compress); falls
++  // back to the structured elements when compression failed.
++  void OnElementsCompressed(
++      SnapshotProcessingResult result,
++      std::pair<std::vector<browser_os::InteractiveNode>, std::string>
++          compressed);
++
++  // Shared tail of every successful response path: ends the request trace
++  // span, records timing, and answers the callback.
++  void RespondWithSnapshot(SnapshotProcessingResult result);
++
 +  // Tab ID for storing mappings
 +  int tab_id_ = -1;
-+  
++
++  // Generation token from the caller, empty when a full snapshot was asked
++  // for. See InteractiveSnapshotOptions.sinceToken.
++  std::string since_token_;
++
++  // Whether to emit attributes as string-table indices
++  bool intern_strings_ = false;
++
++  // Whether to cull nodes outside the visible viewport
++  bool viewport_only_ = false;
++
++  // Whether the tree came from the per-tab cache (skip re-seeding it)
++  bool served_from_cache_ = false;
++
++  // Whether to stream results via onSnapshotChunk events, viewport first
++  bool stream_chunks_ = false;
++
++  // Whether to return elements gzipped+base64 in compressedElements
++  bool compress_ = false;
++
++  // Most-relevant-first cap on the element list; 0 means unpaginated. See
++  // InteractiveSnapshotOptions.maxNodes.
++  int max_nodes_ = 0;
++
++  // Snapshot id for this call; both streaming passes share it
++  uint32_t snapshot_id_ = 0;
++
++  // Tree held across the two streaming passes (viewport, then full)
++  ui::AXTreeUpdate tree_update_;
++
++  // AX node ids already delivered in the viewport chunk, used to keep the
++  // final chunk to just the remainder
++  std::unordered_set<int32_t> streamed_ax_ids_;
++
++  // When Run() started, for the per-function latency histogram
++  base::TimeTicks start_time_;
++
++  // Concurrency slot held for the whole request; released with the
++  // function, which frees the slot for the next queued operation.
++  std::unique_ptr<AgentScheduler::ScopedOperation> scheduler_operation_;
++
 +  // Web contents for processing and drawing
 +  raw_ptr<content::WebContents> web_contents_ = nullptr;
 +};
 +
++// Snapshots several tabs in one call. Every renderer's accessibility tree
++// request is issued before waiting on any of them and each tree is handed to
++// the SnapshotProcessor as it arrives, so the total latency tracks the
++// slowest tab instead of the sum of all tabs.
++class BrowserOSGetSnapshotsFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.getSnapshots", BROWSER_OS_GETSNAPSHOTS)
++
++  BrowserOSGetSnapshotsFunction() = default;
++
++ protected:
++  ~BrowserOSGetSnapshotsFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++
++ private:
++  // Renderer snapshot callback for the tab in slot |index|; re-seeds that
++  // tab's tree cache before processing.
++  void OnAccessibilityTreeReceived(size_t index,
++                                   ui::AXTreeUpdate& tree_update);
++
++  // Hands one tab's tree to the SnapshotProcessor. Shared by the tree-cache
++  // fast path and the renderer callback.
++  void ProcessTree(size_t index, ui::AXTreeUpdate& tree_update);
++
++  void OnSnapshotProcessed(size_t index, SnapshotProcessingResult result);
++
++  // Marks one tab complete and responds once no tabs remain in flight.
++  void FinishTab();
++
++  // One result slot per requested tab, answered in request order.
++  std::vector<browser_os::TabSnapshotResult> results_;
++
++  // Per-slot tab ids and contents; weak because tabs can close mid-call.
++  std::vector<int> tab_ids_;
++  std::vector<base::WeakPtr<content::WebContents>> web_contents_;
++
++  // Tabs still in flight; the function responds when this reaches zero.
++  size_t pending_ = 0;
++};
++
++class BrowserOSWatchChangesFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.watchChanges",
++                             BROWSER_OS_WATCHCHANGES)
++
++  BrowserOSWatchChangesFunction() = default;
++
++ protected:
++  ~BrowserOSWatchChangesFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++class BrowserOSUnwatchChangesFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.unwatchChanges",
++                             BROWSER_OS_UNWATCHCHANGES)
++
++  BrowserOSUnwatchChangesFunction() = default;
++
++ protected:
++  ~BrowserOSUnwatchChangesFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++class BrowserOSDrainChangesFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.drainChanges",
++                             BROWSER_OS_DRAINCHANGES)
++
++  BrowserOSDrainChangesFunction() = default;
++
++ protected:
++  ~BrowserOSDrainChangesFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
 +class BrowserOSClickFunction : public ExtensionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.click", BROWSER_OS_CLICK)
@@ -88,6 +251,10 @@ index 0000000000000..5f4276cf89432
 +
 +  // ExtensionFunction:
 +  ResponseAction Run() override;
++
++ private:
++  // Called when the change-detecting click completes.
++  void OnClickComplete(bool changed);
 +};
 +
 +class BrowserOSInputTextFunction : public ExtensionFunction {
@@ -101,6 +268,10 @@ index 0000000000000..5f4276cf89432
 +
 +  // ExtensionFunction:
 +  ResponseAction Run() override;
++
++ private:
++  // Called when the change-detecting type completes.
++  void OnInputTextComplete(bool changed);
 +};
 +
 +class BrowserOSClearFunction : public ExtensionFunction {
@@ -114,6 +285,44 @@ index 0000000000000..5f4276cf89432
 +
 +  // ExtensionFunction:
 +  ResponseAction Run() override;
++
++ private:
++  // Called when the change-detecting clear completes.
++  void OnClearComplete(bool changed);
++};
++
++class BrowserOSPerformActionsFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.performActions",
++                             BROWSER_OS_PERFORMACTIONS)
++
++  BrowserOSPerformActionsFunction() = default;
++
++ protected:
++  ~BrowserOSPerformActionsFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++
++ private:
++  // Dispatches the action at |next_action_|, or responds when the batch is
++  // done. Each change-detecting action re-enters via OnActionComplete.
++  void RunNextAction();
++
++  // Called when the current action finishes. A failure stops the batch.
++  void OnActionComplete(bool success);
++
++  // Records a failed result with |error| for the current action and stops.
++  void FailCurrentAction(std::string error);
++
++  // Sends the accumulated response.
++  void Finish();
++
++  std::vector<browser_os::BatchAction> actions_;
++  size_t next_action_ = 0;
++  browser_os::PerformActionsResponse response_;
++  base::WeakPtr<content::WebContents> web_contents_;
++  int tab_id_ = -1;
 +};
 +
 +class BrowserOSGetPageLoadStatusFunction : public ExtensionFunction {
@@ -130,6 +339,51 @@ index 0000000000000..5f4276cf89432
 +  ResponseAction Run() override;
 +};
 +
++class BrowserOSGetContentFingerprintFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.getContentFingerprint",
++                             BROWSER_OS_GETCONTENTFINGERPRINT)
++
++  BrowserOSGetContentFingerprintFunction() = default;
++
++ protected:
++  ~BrowserOSGetContentFingerprintFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
++class BrowserOSWaitForStableFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.waitForStable",
++                             BROWSER_OS_WAITFORSTABLE)
++
++  BrowserOSWaitForStableFunction() = default;
++
++ protected:
++  ~BrowserOSWaitForStableFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++
++ private:
++  void OnStable(bool stable);
++};
++
++class BrowserOSSetAgentActiveFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.setAgentActive",
++                             BROWSER_OS_SETAGENTACTIVE)
++
++  BrowserOSSetAgentActiveFunction() = default;
++
++ protected:
++  ~BrowserOSSetAgentActiveFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++};
++
 +class BrowserOSScrollUpFunction : public ExtensionFunction {
 + public:
 +  DECLARE_EXTENSION_FUNCTION("browserOS.scrollUp", BROWSER_OS_SCROLLUP)
@@ -180,6 +434,10 @@ index 0000000000000..5f4276cf89432
 +
 +  // ExtensionFunction:
 +  ResponseAction Run() override;
++
++ private:
++  // Called when the change-detecting key press completes.
++  void OnSendKeysComplete(bool changed);
 +};
 +
 +class BrowserOSCaptureScreenshotFunction : public ExtensionFunction {
@@ -195,16 +453,107 @@ index 0000000000000..5f4276cf89432
 +  ResponseAction Run() override;
 +  
 + private:
-+  void DrawHighlightsAndCapture();
++  // Invoked by the agent scheduler when a concurrency slot is available;
++  // re-validates the tab and starts the surface copy.
++  void StartScheduledCapture(
++      std::unique_ptr<AgentScheduler::ScopedOperation> operation);
++
 +  void CaptureScreenshotNow();
 +  void OnScreenshotCaptured(const SkBitmap& bitmap);
-+  
++  void OnScreenshotEncoded(std::string data_url);
++
 +  // Store web contents and tab id for highlight operations
 +  raw_ptr<content::WebContents> web_contents_ = nullptr;
 +  int tab_id_ = -1;
 +  gfx::Size target_size_;
 +  bool show_highlights_ = false;
 +  bool use_exact_dimensions_ = false;
++
++  // When set, only these snapshot node ids are highlighted; unset means
++  // every in-viewport interactive element
++  std::optional<std::unordered_set<uint32_t>> highlight_node_ids_;
++
++  // Encoding options; JPEG is much cheaper on 4K captures
++  bool use_jpeg_ = false;
++  int quality_ = 90;
++
++  // Optional capture region in CSS pixels (viewport-relative) and output
++  // scale for it; unset means the full visible viewport
++  std::optional<gfx::RectF> clip_rect_;
++  float scale_ = 1.0f;
++
++  // Page region the captured bitmap covers, in CSS pixels; used to place
++  // browser-side highlight overlays on the bitmap
++  gfx::RectF capture_rect_css_;
++
++  // Frame-dedup bookkeeping (see BrowserOSScreenshotCache): the tab's
++  // compositor frame sequence when capture started, and the hash of every
++  // parameter that affects the encoded output. Highlight captures skip the
++  // cache and leave the hash at zero.
++  uint64_t capture_frame_sequence_ = 0;
++  uint64_t params_hash_ = 0;
++
++  // Concurrency slot held for the whole request; released with the
++  // function.
++  std::unique_ptr<AgentScheduler::ScopedOperation> scheduler_operation_;
++
++  // When Run() started, for the per-function latency histogram
++  base::TimeTicks start_time_;
++};
++
++class BrowserOSCaptureWithSnapshotFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.captureWithSnapshot",
++                             BROWSER_OS_CAPTUREWITHSNAPSHOT)
++
++  BrowserOSCaptureWithSnapshotFunction();
++
++ protected:
++  ~BrowserOSCaptureWithSnapshotFunction() override;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++
++ private:
++  // Invoked by the agent scheduler when a concurrency slot is available;
++  // re-validates the tab and kicks off both halves.
++  void StartScheduledCapture(
++      std::unique_ptr<AgentScheduler::ScopedOperation> operation);
++
++  // Screenshot half.
++  void OnScreenshotCaptured(const SkBitmap& bitmap);
++  void OnScreenshotEncoded(std::string data_url);
++
++  // Snapshot half.
++  void OnAccessibilityTreeReceived(ui::AXTreeUpdate& tree_update);
++  void OnSnapshotProcessed(SnapshotProcessingResult result);
++
++  // Responds once both halves have landed (or an error already did).
++  void MaybeRespond();
++
++  raw_ptr<content::WebContents> web_contents_ = nullptr;
++  int tab_id_ = -1;
++
++  // Encoding options; same semantics as captureScreenshot
++  bool use_jpeg_ = false;
++  int quality_ = 90;
++  gfx::Size target_size_;
++
++  // Whether the tree came from the per-tab cache (skip re-seeding it)
++  bool served_from_cache_ = false;
++
++  // Join state: the two halves complete independently and in either order.
++  bool screenshot_done_ = false;
++  bool snapshot_done_ = false;
++  std::string data_url_;
++  browser_os::InteractiveSnapshot snapshot_;
++
++  // Concurrency slot held for the whole request; released with the
++  // function.
++  std::unique_ptr<AgentScheduler::ScopedOperation> scheduler_operation_;
++
++  // When Run() started, for the per-function latency histogram
++  base::TimeTicks start_time_;
 +};
 +
 +class BrowserOSGetSnapshotFunction : public ExtensionFunction {
@@ -221,6 +570,59 @@ index 0000000000000..5f4276cf89432
 +
 + private:
 +  void OnAccessibilityTreeReceived(ui::AXTreeUpdate& tree_update);
++
++  // Called when the (possibly parallel) content extraction completes.
++  void OnContentExtracted(base::Time start_time,
++                          std::vector<browser_os::ContentItem> items);
++
++  // Target tab, kept so extraction can use the per-tab content cache.
++  raw_ptr<content::WebContents> web_contents_ = nullptr;
++};
++
++class BrowserOSGetSnapshotBinaryFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.getSnapshotBinary",
++                             BROWSER_OS_GETSNAPSHOTBINARY)
++
++  BrowserOSGetSnapshotBinaryFunction() = default;
++
++ protected:
++  ~BrowserOSGetSnapshotBinaryFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++
++ private:
++  void OnAccessibilityTreeReceived(ui::AXTreeUpdate& tree_update);
++
++  // Called when the (possibly parallel) content extraction completes.
++  void OnContentExtracted(std::vector<browser_os::ContentItem> items);
++
++  // Target tab, kept so extraction can use the per-tab content cache.
++  raw_ptr<content::WebContents> web_contents_ = nullptr;
++};
++
++class BrowserOSGetSnapshotMarkdownFunction : public ExtensionFunction {
++ public:
++  DECLARE_EXTENSION_FUNCTION("browserOS.getSnapshotMarkdown",
++                             BROWSER_OS_GETSNAPSHOTMARKDOWN)
++
++  BrowserOSGetSnapshotMarkdownFunction() = default;
++
++ protected:
++  ~BrowserOSGetSnapshotMarkdownFunction() override = default;
++
++  // ExtensionFunction:
++  ResponseAction Run() override;
++
++ private:
++  void OnAccessibilityTreeReceived(ui::AXTreeUpdate& tree_update);
++
++  // Called when the (possibly parallel) content extraction completes.
++  void OnContentExtracted(std::vector<browser_os::ContentItem> items);
++
++  // Target tab, kept so extraction can use the per-tab content cache.
++  raw_ptr<content::WebContents> web_contents_ = nullptr;
 +};
 +
 +// Settings API functions
@@ -316,6 +718,10 @@ index 0000000000000..5f4276cf89432
 +  
 + private:
 +  void OnJavaScriptExecuted(base::Value result);
++
++  // Registration path: the script was compiled and parked in the page's
++  // registry; answer with its handle.
++  void OnScriptRegistered(int script_id, base::Value result);
 +};
 +
 +class BrowserOSClickCoordinatesFunction : public ExtensionFunction {
@@ -329,6 +735,10 @@ index 0000000000000..5f4276cf89432
 +
 +  // ExtensionFunction:
 +  ResponseAction Run() override;
++
++ private:
++  // Called when the change-detecting click completes.
++  void OnClickComplete(bool changed);
 +};
 +
 +class BrowserOSTypeAtCoordinatesFunction : public ExtensionFunction {
@@ -342,10 +752,13 @@ index 0000000000000..5f4276cf89432
 +
 +  // ExtensionFunction:
 +  ResponseAction Run() override;
++
++ private:
++  // Called when the change-detecting type completes.
++  void OnTypeComplete(bool changed);
 +};
 +
 +}  // namespace api
 +}  // namespace extensions
 +
 +#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_API_H_
-\ No newline at end of file
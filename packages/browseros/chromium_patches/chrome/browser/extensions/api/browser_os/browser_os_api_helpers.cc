@@ -1,30 +1,54 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api_helpers.cc b/chrome/browser/extensions/api/browser_os/browser_os_api_helpers.cc
 new file mode 100644
-index 0000000000000..f40a2424641e1
+index 0000000000000..b5636c0b839c0
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api_helpers.cc
-@@ -0,0 +1,1073 @@
+@@ -0,0 +1,1796 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_helpers.h"
 +
++#include <optional>
++#include <string_view>
++
++#include "base/base64.h"
++#include "base/callback_list.h"
++#include "base/containers/fixed_flat_map.h"
++#include "base/functional/bind.h"
++#include "base/json/string_escape.h"
++#include "base/location.h"
++#include "base/memory/weak_ptr.h"
++#include "base/strings/strcat.h"
++#include "base/strings/string_split.h"
 +#include "base/strings/string_number_conversions.h"
++#include "base/time/time.h"
 +#include "base/strings/stringprintf.h"
 +#include "base/strings/utf_string_conversions.h"
 +#include "base/task/sequenced_task_runner.h"
++#include "base/trace_event/trace_event.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_change_detector.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_tree_cache.h"
 +#include "components/input/native_web_keyboard_event.h"
++#include "content/public/browser/document_user_data.h"
++#include "content/public/browser/host_zoom_map.h"
 +#include "content/public/browser/render_frame_host.h"
++#include "content/public/browser/web_contents_user_data.h"
 +#include "content/browser/renderer_host/render_widget_host_impl.h"
 +#include "content/public/browser/render_widget_host.h"
 +#include "content/public/browser/render_widget_host_view.h"
 +#include "content/browser/renderer_host/render_widget_host_view_base.h"
 +#include "content/browser/web_contents/web_contents_impl.h"
 +#include "content/public/browser/web_contents.h"
++#include "skia/ext/skia_utils_base.h"
 +#include "third_party/blink/public/common/input/web_input_event.h"
++#include "third_party/skia/include/core/SkBitmap.h"
++#include "third_party/skia/include/core/SkCanvas.h"
++#include "third_party/skia/include/core/SkFont.h"
++#include "third_party/skia/include/core/SkFontMetrics.h"
++#include "third_party/skia/include/core/SkPaint.h"
 +#include "third_party/blink/public/common/input/web_keyboard_event.h"
 +#include "third_party/blink/public/common/input/web_mouse_event.h"
 +#include "third_party/blink/public/common/input/web_mouse_wheel_event.h"
@@ -34,6 +58,9 @@ index 0000000000000..f40a2424641e1
 +#include "ui/events/keycodes/dom/dom_code.h"
 +#include "ui/events/keycodes/dom/dom_key.h"
 +#include "ui/events/keycodes/keyboard_codes.h"
++#include "ui/gfx/codec/jpeg_codec.h"
++#include "ui/gfx/codec/png_codec.h"
++#include "ui/gfx/geometry/point.h"
 +#include "ui/gfx/geometry/point_f.h"
 +#include "ui/gfx/range/range.h"
 +#include "ui/accessibility/ax_action_data.h"
@@ -42,12 +69,76 @@ index 0000000000000..f40a2424641e1
 +namespace extensions {
 +namespace api {
 +
++namespace {
++
++// How long a cached input scale stays usable. Browser zoom changes and
++// navigations invalidate it explicitly, but CSS zoom and pinch page scale
++// have no browser-side change notification, so the TTL bounds how stale a
++// cached value can get.
++constexpr base::TimeDelta kScaleCacheTtl = base::Seconds(1);
++
++// Per-WebContents cache for the CSS->widget input scale. Every pointer
++// action used to recompute it from zoom level, CSS zoom and page scale; in
++// a multi-action sequence those values almost never change between actions.
++class ScaleCache : public content::WebContentsObserver,
++                   public content::WebContentsUserData<ScaleCache> {
++ public:
++  ScaleCache(const ScaleCache&) = delete;
++  ScaleCache& operator=(const ScaleCache&) = delete;
++  ~ScaleCache() override = default;
++
++  static ScaleCache* GetOrCreate(content::WebContents* web_contents) {
++    CreateForWebContents(web_contents);
++    return FromWebContents(web_contents);
++  }
++
++  // Returns true and fills |scale| when a fresh cached value exists.
++  bool Get(float* scale) const {
++    if (!scale_ || base::TimeTicks::Now() - computed_at_ > kScaleCacheTtl) {
++      return false;
++    }
++    *scale = *scale_;
++    return true;
++  }
++
++  void Set(float scale) {
++    scale_ = scale;
++    computed_at_ = base::TimeTicks::Now();
++  }
++
++ private:
++  explicit ScaleCache(content::WebContents* web_contents)
++      : content::WebContentsObserver(web_contents),
++        content::WebContentsUserData<ScaleCache>(*web_contents) {
++    zoom_subscription_ =
++        content::HostZoomMap::GetForWebContents(web_contents)
++            ->AddZoomLevelChangedCallback(base::BindRepeating(
++                &ScaleCache::OnZoomLevelChanged, base::Unretained(this)));
++  }
++  friend class content::WebContentsUserData<ScaleCache>;
++
++  void OnZoomLevelChanged(const content::HostZoomMap::ZoomLevelChange&) {
++    scale_.reset();
++  }
++
++  // content::WebContentsObserver:
++  void PrimaryPageChanged(content::Page& page) override { scale_.reset(); }
++
++  std::optional<float> scale_;
++  base::TimeTicks computed_at_;
++  base::CallbackListSubscription zoom_subscription_;
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(ScaleCache);
++
 +// Compute CSS->widget scale matching DevTools InputHandler::ScaleFactor.
 +// We intentionally exclude device scale factor (DSF). Widget coordinates
 +// used by input are in DIPs; DSF is handled by the compositor. We also set
 +// PositionInScreen = PositionInWidget to avoid unit mixing on HiDPI.
-+float CssToWidgetScale(content::WebContents* web_contents,
-+                       content::RenderWidgetHost* rwh) {
++float ComputeCssToWidgetScale(content::WebContents* web_contents,
++                              content::RenderWidgetHost* rwh) {
 +  float zoom = 1.0f;
 +  if (auto* rwhi = static_cast<content::RenderWidgetHostImpl*>(rwh)) {
 +    if (auto* wci = static_cast<content::WebContentsImpl*>(web_contents)) {
@@ -71,6 +162,20 @@ index 0000000000000..f40a2424641e1
 +  return zoom * css_zoom * page_scale;
 +}
 +
++}  // namespace
++
++float CssToWidgetScale(content::WebContents* web_contents,
++                       content::RenderWidgetHost* rwh) {
++  ScaleCache* cache = ScaleCache::GetOrCreate(web_contents);
++  float scale = 1.0f;
++  if (cache->Get(&scale)) {
++    return scale;
++  }
++  scale = ComputeCssToWidgetScale(web_contents, rwh);
++  cache->Set(scale);
++  return scale;
++}
++
 +// Helper function to get center point of a node's bounds.
 +// Bounds are already stored in CSS pixels from SnapshotProcessor,
 +// so no DSF conversion is needed.
@@ -86,6 +191,7 @@ index 0000000000000..f40a2424641e1
 +// Helper to create and dispatch mouse events for clicking
 +void PointClick(content::WebContents* web_contents, 
 +                  const gfx::PointF& point) {
++  TRACE_EVENT0("browseros", "PointClick");
 +  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
 +  if (!rfh)
 +    return;
@@ -130,135 +236,144 @@ index 0000000000000..f40a2424641e1
 +  rwh->ForwardMouseEvent(mouse_up);
 +}
 +
-+// Helper to perform HTML-based click using JS (uses ID, class, or tag)
-+void HtmlClick(content::WebContents* web_contents,
-+                      const NodeInfo& node_info) {
-+  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
-+  if (!rfh)
-+    return;
-+    
-+  // Build the JavaScript to find and click the element
-+  std::u16string js_code = u"(function() {";
-+  
-+  // Try to find element by ID first
++namespace {
++
++// Marks documents where the persistent find/click/focus helpers below have
++// been injected; torn down automatically on cross-document navigation,
++// which is exactly when the renderer-side functions disappear.
++class HtmlActionHelperInstalled
++    : public content::DocumentUserData<HtmlActionHelperInstalled> {
++ public:
++  ~HtmlActionHelperInstalled() override = default;
++
++ private:
++  friend DocumentUserData;
++  explicit HtmlActionHelperInstalled(content::RenderFrameHost* rfh)
++      : DocumentUserData(rfh) {}
++  DOCUMENT_USER_DATA_KEY_DECL();
++};
++
++DOCUMENT_USER_DATA_KEY_IMPL(HtmlActionHelperInstalled);
++
++// Finder plus click/focus functions injected once per document. The HTML
++// fallback paths fire constantly on pages with poor accessibility support,
++// so later calls invoke these by reference with the lookup keys as
++// arguments instead of recompiling an assembled script per action.
++constexpr char16_t kHtmlActionHelperScript[] =
++    uR"((function() {
++  window.__browserosFind = function(id, selector, tag) {
++    if (id) {
++      var element = document.getElementById(id);
++      if (element) return element;
++    }
++    if (selector) {
++      var elements = document.querySelectorAll(selector);
++      if (elements.length > 0) return elements[0];
++    }
++    if (tag) {
++      var byTag = document.getElementsByTagName(tag);
++      if (byTag.length > 0) return byTag[0];
++    }
++    return null;
++  };
++  window.__browserosClick = function(id, selector, tag) {
++    var element = window.__browserosFind(id, selector, tag);
++    if (!element) return 'no element found';
++    element.click();
++    return 'clicked';
++  };
++  window.__browserosFocus = function(id, selector, tag) {
++    var element = window.__browserosFind(id, selector, tag);
++    if (!element) return 'no element found';
++    element.focus();
++    if (element.select) element.select();
++    return 'focused';
++  };
++})();)";
++
++// Fills the lookup keys the injected finder takes, from |node_info|'s
++// computed attributes: element id, tag.classes selector, bare tag name.
++// Keys that can't be derived are left empty and skipped renderer-side.
++void GetHtmlLookupKeys(const NodeInfo& node_info,
++                       std::string* id,
++                       std::string* selector,
++                       std::string* tag) {
 +  auto id_it = node_info.attributes.find("id");
-+  if (id_it != node_info.attributes.end() && !id_it->second.empty()) {
-+    js_code += u"  var element = document.getElementById('" + 
-+               base::UTF8ToUTF16(id_it->second) + u"');";
-+    js_code += u"  if (element) {";
-+    js_code += u"    element.click();";
-+    js_code += u"    return 'clicked by id';";
-+    js_code += u"  }";
++  if (id_it != node_info.attributes.end()) {
++    *id = id_it->second;
 +  }
-+  
-+  // Try to find by class and tag combination
++
 +  auto class_it = node_info.attributes.find("class");
 +  auto tag_it = node_info.attributes.find("html-tag");
-+  
++  if (tag_it != node_info.attributes.end()) {
++    *tag = tag_it->second;
++  }
 +  if (class_it != node_info.attributes.end() && !class_it->second.empty() &&
-+      tag_it != node_info.attributes.end() && !tag_it->second.empty()) {
-+    // Split class names and create selector
++      !tag->empty()) {
++    // Replace spaces with dots for multiple classes.
 +    std::string class_selector = "." + class_it->second;
-+    // Replace spaces with dots for multiple classes
 +    for (size_t i = 0; i < class_selector.length(); ++i) {
 +      if (class_selector[i] == ' ') {
 +        class_selector[i] = '.';
 +      }
 +    }
-+    
-+    js_code += u"  var elements = document.querySelectorAll('" + 
-+               base::UTF8ToUTF16(tag_it->second + class_selector) + u"');";
-+    js_code += u"  if (elements.length > 0) {";
-+    js_code += u"    elements[0].click();";
-+    js_code += u"    return 'clicked by class and tag';";
-+    js_code += u"  }";
++    *selector = *tag + class_selector;
 +  }
-+  
-+  // Fallback: try just by tag name if available
-+  if (tag_it != node_info.attributes.end() && !tag_it->second.empty()) {
-+    js_code += u"  var elements = document.getElementsByTagName('" + 
-+               base::UTF8ToUTF16(tag_it->second) + u"');";
-+    js_code += u"  if (elements.length > 0) {";
-+    js_code += u"    elements[0].click();";
-+    js_code += u"    return 'clicked by tag';";
-+    js_code += u"  }";
++}
++
++// Installs the helpers on first use in this document, then invokes
++// |function_name| with |node_info|'s lookup keys as arguments.
++void CallHtmlActionHelper(content::RenderFrameHost* rfh,
++                          const char* function_name,
++                          const NodeInfo& node_info) {
++  if (!HtmlActionHelperInstalled::GetForCurrentDocument(rfh)) {
++    rfh->ExecuteJavaScriptForTests(
++        kHtmlActionHelperScript,
++        base::NullCallback(),
++        /*honor_js_content_settings=*/false);
++    HtmlActionHelperInstalled::CreateForCurrentDocument(rfh);
 +  }
-+  
-+  js_code += u"  return 'no element found';";
-+  js_code += u"})();";
-+  
-+  // Execute the JavaScript
++
++  std::string id;
++  std::string selector;
++  std::string tag;
++  GetHtmlLookupKeys(node_info, &id, &selector, &tag);
++
++  // JSON-quote the arguments; the && guard covers a helper injection lost
++  // to a racing navigation (the next call reinstalls it).
++  std::string invocation = base::StrCat(
++      {"window.", function_name, " && window.", function_name, "(",
++       base::GetQuotedJSONString(id), ", ",
++       base::GetQuotedJSONString(selector), ", ",
++       base::GetQuotedJSONString(tag), ");"});
++
 +  rfh->ExecuteJavaScriptForTests(
-+      js_code,
++      base::UTF8ToUTF16(invocation),
 +      base::NullCallback(),
 +      /*honor_js_content_settings=*/false);
 +}
 +
++}  // namespace
++
++// Helper to perform HTML-based click using JS (uses ID, class, or tag)
++void HtmlClick(content::WebContents* web_contents,
++                      const NodeInfo& node_info) {
++  TRACE_EVENT0("browseros", "HtmlClick");
++  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
++  if (!rfh)
++    return;
++
++  CallHtmlActionHelper(rfh, "__browserosClick", node_info);
++}
++
 +// Helper to perform HTML-based focus using JS (uses ID, class, or tag)
 +void HtmlFocus(content::WebContents* web_contents,
 +                      const NodeInfo& node_info) {
 +  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
 +  if (!rfh)
 +    return;
-+    
-+  // Build the JavaScript to find and focus the element
-+  std::u16string js_code = u"(function() {";
-+  
-+  // Try to find element by ID first
-+  auto id_it = node_info.attributes.find("id");
-+  if (id_it != node_info.attributes.end() && !id_it->second.empty()) {
-+    js_code += u"  var element = document.getElementById('" + 
-+               base::UTF8ToUTF16(id_it->second) + u"');";
-+    js_code += u"  if (element) {";
-+    js_code += u"    element.focus();";
-+    js_code += u"    if (element.select) element.select();";  // Select text if possible
-+    js_code += u"    return 'focused by id';";
-+    js_code += u"  }";
-+  }
-+  
-+  // Try to find by class and tag combination
-+  auto class_it = node_info.attributes.find("class");
-+  auto tag_it = node_info.attributes.find("html-tag");
-+  
-+  if (class_it != node_info.attributes.end() && !class_it->second.empty() &&
-+      tag_it != node_info.attributes.end() && !tag_it->second.empty()) {
-+    // Split class names and create selector
-+    std::string class_selector = "." + class_it->second;
-+    // Replace spaces with dots for multiple classes
-+    for (size_t i = 0; i < class_selector.length(); ++i) {
-+      if (class_selector[i] == ' ') {
-+        class_selector[i] = '.';
-+      }
-+    }
-+    
-+    js_code += u"  var elements = document.querySelectorAll('" + 
-+               base::UTF8ToUTF16(tag_it->second + class_selector) + u"');";
-+    js_code += u"  if (elements.length > 0) {";
-+    js_code += u"    elements[0].focus();";
-+    js_code += u"    if (elements[0].select) elements[0].select();";
-+    js_code += u"    return 'focused by class and tag';";
-+    js_code += u"  }";
-+  }
-+  
-+  // Fallback: try just by tag name if available
-+  if (tag_it != node_info.attributes.end() && !tag_it->second.empty()) {
-+    js_code += u"  var elements = document.getElementsByTagName('" + 
-+               base::UTF8ToUTF16(tag_it->second) + u"');";
-+    js_code += u"  if (elements.length > 0) {";
-+    js_code += u"    elements[0].focus();";
-+    js_code += u"    if (elements[0].select) elements[0].select();";
-+    js_code += u"    return 'focused by tag';";
-+    js_code += u"  }";
-+  }
-+  
-+  js_code += u"  return 'no element found';";
-+  js_code += u"})();";
-+  
-+  // Execute the JavaScript
-+  rfh->ExecuteJavaScriptForTests(
-+      js_code,
-+      base::NullCallback(),
-+      /*honor_js_content_settings=*/false);
++
++  CallHtmlActionHelper(rfh, "__browserosFocus", node_info);
 +}
 +
 +// Helper to perform scroll actions using mouse wheel events
@@ -266,9 +381,36 @@ index 0000000000000..f40a2424641e1
 +                   int delta_x,
 +                   int delta_y,
 +                   bool precise) {
++  TRACE_EVENT0("browseros", "Scroll");
 +  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
 +  if (!rfh)
 +    return;
++
++  // Fast path: when snapshot processing has identified the page's main
++  // scrollable container, scroll it with one direct accessibility action.
++  // This skips the wheel-event pair and its hit test at the viewport
++  // midpoint, which can land on an overlay or nested scroller and move the
++  // wrong element. Offsets come from the live cached tree, so the new
++  // position is just current + delta.
++  BrowserOSTreeCache* cache =
++      BrowserOSTreeCache::FromWebContents(web_contents);
++  ui::AXTreeID scroll_tree_id = ui::AXTreeIDUnknown();
++  int32_t scroll_node_id = 0;
++  int scroll_x = 0;
++  int scroll_y = 0;
++  if (cache && cache->GetScrollTarget(&scroll_tree_id, &scroll_node_id,
++                                      &scroll_x, &scroll_y)) {
++    ui::AXActionData action_data;
++    action_data.action = ax::mojom::Action::kSetScrollOffset;
++    action_data.target_tree_id = scroll_tree_id;
++    action_data.target_node_id = scroll_node_id;
++    action_data.target_point =
++        gfx::Point(scroll_x + delta_x, scroll_y + delta_y);
++    VLOG(1) << "[browseros] Scrolling cached container node "
++            << scroll_node_id << " to " << action_data.target_point.ToString();
++    rfh->AccessibilityPerformAction(action_data);
++    return;
++  }
 +    
 +  content::RenderWidgetHost* rwh = rfh->GetRenderWidgetHost();
 +  if (!rwh)
@@ -323,130 +465,168 @@ index 0000000000000..f40a2424641e1
 +  rwh->ForwardWheelEvent(wheel_event);
 +}
 +
-+// Helper to send special key events
-+void KeyPress(content::WebContents* web_contents,
-+                    const std::string& key) {
++namespace {
++
++// Event parameters for one supported key name, including the per-key
++// special cases: Enter also sends a char event (`input` elements expect
++// it to trigger submit) and Tab skips key-up so the focus change sticks.
++struct KeyEventParams {
++  ui::KeyboardCode windows_key_code;
++  ui::DomCode dom_code;
++  ui::DomKey dom_key;
++  bool send_char_event;
++  bool send_key_up;
++};
++
++// Key-name dispatch table. The sorted constexpr flat map is baked into
++// the binary with no static initializer and resolves a name with one
++// binary search, instead of walking an if-else chain of string compares
++// for every key in a sequence.
++constexpr auto kKeyEventParams =
++    base::MakeFixedFlatMap<std::string_view, KeyEventParams>({
++        {"ArrowDown",
++         {ui::VKEY_DOWN, ui::DomCode::ARROW_DOWN, ui::DomKey::ARROW_DOWN,
++          false, true}},
++        {"ArrowLeft",
++         {ui::VKEY_LEFT, ui::DomCode::ARROW_LEFT, ui::DomKey::ARROW_LEFT,
++          false, true}},
++        {"ArrowRight",
++         {ui::VKEY_RIGHT, ui::DomCode::ARROW_RIGHT, ui::DomKey::ARROW_RIGHT,
++          false, true}},
++        {"ArrowUp",
++         {ui::VKEY_UP, ui::DomCode::ARROW_UP, ui::DomKey::ARROW_UP, false,
++          true}},
++        {"Backspace",
++         {ui::VKEY_BACK, ui::DomCode::BACKSPACE, ui::DomKey::BACKSPACE, false,
++          true}},
++        {"Delete",
++         {ui::VKEY_DELETE, ui::DomCode::DEL, ui::DomKey::DEL, false, true}},
++        {"End", {ui::VKEY_END, ui::DomCode::END, ui::DomKey::END, false, true}},
++        {"Enter",
++         {ui::VKEY_RETURN, ui::DomCode::ENTER, ui::DomKey::ENTER, true, true}},
++        {"Escape",
++         {ui::VKEY_ESCAPE, ui::DomCode::ESCAPE, ui::DomKey::ESCAPE, false,
++          true}},
++        {"Home",
++         {ui::VKEY_HOME, ui::DomCode::HOME, ui::DomKey::HOME, false, true}},
++        {"PageDown",
++         {ui::VKEY_NEXT, ui::DomCode::PAGE_DOWN, ui::DomKey::PAGE_DOWN, false,
++          true}},
++        {"PageUp",
++         {ui::VKEY_PRIOR, ui::DomCode::PAGE_UP, ui::DomKey::PAGE_UP, false,
++          true}},
++        {"Tab",
++         {ui::VKEY_TAB, ui::DomCode::TAB, ui::DomKey::TAB, false, false}},
++    });
++
++// Resolves one key name to its compiled event parameters. Returns false for
++// unsupported names.
++bool CompileKey(std::string_view key, CompiledKey* out) {
++  const auto it = kKeyEventParams.find(key);
++  if (it == kKeyEventParams.end()) {
++    return false;  // Unsupported key
++  }
++  const KeyEventParams& params = it->second;
++  out->windows_key_code = params.windows_key_code;
++  out->dom_code = params.dom_code;
++  out->dom_key = params.dom_key;
++  out->send_char_event = params.send_char_event;
++  out->send_key_up = params.send_key_up;
++  return true;
++}
++
++}  // namespace
++
++std::optional<std::vector<CompiledKey>> CompileKeySequence(
++    const std::string& descriptor) {
++  std::vector<CompiledKey> sequence;
++  for (const auto& name :
++       base::SplitStringPiece(descriptor, " \t", base::TRIM_WHITESPACE,
++                              base::SPLIT_WANT_NONEMPTY)) {
++    CompiledKey key;
++    if (!CompileKey(name, &key)) {
++      return std::nullopt;
++    }
++    sequence.push_back(key);
++  }
++  if (sequence.empty()) {
++    return std::nullopt;
++  }
++  return sequence;
++}
++
++void PressCompiledKey(content::WebContents* web_contents,
++                      const CompiledKey& key) {
 +  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
 +  if (!rfh)
 +    return;
-+    
++
 +  content::RenderWidgetHost* rwh = rfh->GetRenderWidgetHost();
 +  if (!rwh)
 +    return;
 +
-+  // Map key names to Windows key codes and DOM codes/keys
-+  ui::KeyboardCode windows_key_code;
-+  ui::DomCode dom_code;
-+  ui::DomKey dom_key;
-+  
-+  // Use if-else chain to avoid static initialization
-+  if (key == "Enter") {
-+    windows_key_code = ui::VKEY_RETURN;
-+    dom_code = ui::DomCode::ENTER;
-+    dom_key = ui::DomKey::ENTER;
-+  } else if (key == "Delete") {
-+    windows_key_code = ui::VKEY_DELETE;
-+    dom_code = ui::DomCode::DEL;
-+    dom_key = ui::DomKey::DEL;
-+  } else if (key == "Backspace") {
-+    windows_key_code = ui::VKEY_BACK;
-+    dom_code = ui::DomCode::BACKSPACE;
-+    dom_key = ui::DomKey::BACKSPACE;
-+  } else if (key == "Tab") {
-+    windows_key_code = ui::VKEY_TAB;
-+    dom_code = ui::DomCode::TAB;
-+    dom_key = ui::DomKey::TAB;
-+  } else if (key == "Escape") {
-+    windows_key_code = ui::VKEY_ESCAPE;
-+    dom_code = ui::DomCode::ESCAPE;
-+    dom_key = ui::DomKey::ESCAPE;
-+  } else if (key == "ArrowUp") {
-+    windows_key_code = ui::VKEY_UP;
-+    dom_code = ui::DomCode::ARROW_UP;
-+    dom_key = ui::DomKey::ARROW_UP;
-+  } else if (key == "ArrowDown") {
-+    windows_key_code = ui::VKEY_DOWN;
-+    dom_code = ui::DomCode::ARROW_DOWN;
-+    dom_key = ui::DomKey::ARROW_DOWN;
-+  } else if (key == "ArrowLeft") {
-+    windows_key_code = ui::VKEY_LEFT;
-+    dom_code = ui::DomCode::ARROW_LEFT;
-+    dom_key = ui::DomKey::ARROW_LEFT;
-+  } else if (key == "ArrowRight") {
-+    windows_key_code = ui::VKEY_RIGHT;
-+    dom_code = ui::DomCode::ARROW_RIGHT;
-+    dom_key = ui::DomKey::ARROW_RIGHT;
-+  } else if (key == "Home") {
-+    windows_key_code = ui::VKEY_HOME;
-+    dom_code = ui::DomCode::HOME;
-+    dom_key = ui::DomKey::HOME;
-+  } else if (key == "End") {
-+    windows_key_code = ui::VKEY_END;
-+    dom_code = ui::DomCode::END;
-+    dom_key = ui::DomKey::END;
-+  } else if (key == "PageUp") {
-+    windows_key_code = ui::VKEY_PRIOR;
-+    dom_code = ui::DomCode::PAGE_UP;
-+    dom_key = ui::DomKey::PAGE_UP;
-+  } else if (key == "PageDown") {
-+    windows_key_code = ui::VKEY_NEXT;
-+    dom_code = ui::DomCode::PAGE_DOWN;
-+    dom_key = ui::DomKey::PAGE_DOWN;
-+  } else {
-+    return;  // Unsupported key
-+  }
-+  
 +  // Create keyboard event
 +  input::NativeWebKeyboardEvent key_down(
 +      blink::WebInputEvent::Type::kKeyDown,
 +      blink::WebInputEvent::kNoModifiers,
 +      ui::EventTimeForNow());
-+  
-+  key_down.windows_key_code = windows_key_code;
-+  key_down.native_key_code = windows_key_code;
-+  key_down.dom_code = static_cast<int>(dom_code);
-+  key_down.dom_key = static_cast<int>(dom_key);
-+  
++
++  key_down.windows_key_code = key.windows_key_code;
++  key_down.native_key_code = key.windows_key_code;
++  key_down.dom_code = static_cast<int>(key.dom_code);
++  key_down.dom_key = static_cast<int>(key.dom_key);
++
 +  // Send key down
 +  rwh->ForwardKeyboardEvent(key_down);
-+  
-+  // For Enter key, also send char event
-+  // This is for `input` elements on web pages expect this to trigger submit
-+  if (key == "Enter") {
++
++  if (key.send_char_event) {
 +    input::NativeWebKeyboardEvent char_event(
 +        blink::WebInputEvent::Type::kChar,
 +        blink::WebInputEvent::kNoModifiers,
 +        ui::EventTimeForNow());
-+    
-+    char_event.windows_key_code = windows_key_code;
-+    char_event.native_key_code = windows_key_code;
-+    char_event.dom_code = static_cast<int>(dom_code);
-+    char_event.dom_key = static_cast<int>(dom_key);
++
++    char_event.windows_key_code = key.windows_key_code;
++    char_event.native_key_code = key.windows_key_code;
++    char_event.dom_code = static_cast<int>(key.dom_code);
++    char_event.dom_key = static_cast<int>(key.dom_key);
 +    char_event.text[0] = '\r';  // Carriage return character
 +    char_event.unmodified_text[0] = '\r';
-+    
++
 +    rwh->ForwardKeyboardEvent(char_event);
 +  }
-+  
-+  // For most keys, also send key up
-+  if (key != "Tab") {  // Tab usually doesn't need key up for focus change
++
++  if (key.send_key_up) {
 +    input::NativeWebKeyboardEvent key_up(
 +        blink::WebInputEvent::Type::kKeyUp,
 +        blink::WebInputEvent::kNoModifiers,
 +        ui::EventTimeForNow());
-+    
-+    key_up.windows_key_code = windows_key_code;
-+    key_up.native_key_code = windows_key_code;
-+    key_up.dom_code = static_cast<int>(dom_code);
-+    key_up.dom_key = static_cast<int>(dom_key);
-+    
++
++    key_up.windows_key_code = key.windows_key_code;
++    key_up.native_key_code = key.windows_key_code;
++    key_up.dom_code = static_cast<int>(key.dom_code);
++    key_up.dom_key = static_cast<int>(key.dom_key);
++
 +    rwh->ForwardKeyboardEvent(key_up);
 +  }
 +}
 +
++// Helper to send special key events
++void KeyPress(content::WebContents* web_contents,
++                    const std::string& key) {
++  TRACE_EVENT0("browseros", "KeyPress");
++  auto sequence = CompileKeySequence(key);
++  if (!sequence) {
++    return;  // Unsupported key
++  }
++  for (const CompiledKey& compiled : *sequence) {
++    PressCompiledKey(web_contents, compiled);
++  }
++}
++
 +// Helper to type text into a focused element using native IME
 +void NativeType(content::WebContents* web_contents,
 +                const std::string& text) {
++  TRACE_EVENT0("browseros", "NativeType");
 +  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
 +  if (!rfh)
 +    return;
@@ -473,72 +653,151 @@ index 0000000000000..f40a2424641e1
 +                      0);  // relative_cursor_pos = 0 means after the text
 +}
 +
-+// Helper to set text value using JavaScript
-+void JavaScriptType(content::WebContents* web_contents,
-+                    const NodeInfo& node_info,
-+                    const std::string& text) {
++// Helper to type text as a burst of synthesized key events
++void KeyEventType(content::WebContents* web_contents,
++                  const std::string& text) {
 +  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
 +  if (!rfh)
 +    return;
-+  
-+  // Build JavaScript to find element and set its value
-+  std::u16string js_code = u"(function() {";
-+  std::u16string escaped_text = base::UTF8ToUTF16(text);
-+  
-+  // Escape quotes in the text
-+  for (size_t i = 0; i < escaped_text.length(); ++i) {
-+    if (escaped_text[i] == u'\'') {
-+      escaped_text.insert(i, u"\\");
-+      i++;
++
++  content::RenderWidgetHost* rwh = rfh->GetRenderWidgetHost();
++  if (!rwh)
++    return;
++
++  // Ensure the widget has focus
++  static_cast<content::RenderWidgetHostImpl*>(rwh)->Focus();
++
++  // Queue keydown/char/keyup for every character without waiting between
++  // keys. ForwardKeyboardEvent doesn't block, so the full string goes out
++  // as one burst and the renderer processes it from its input queue; a
++  // 200-character string costs the same wall time as a single key.
++  std::u16string text16 = base::UTF8ToUTF16(text);
++  for (char16_t ch : text16) {
++    // Best-effort key code: letters and digits map to their VKEY values,
++    // anything else is delivered through the char event's text alone.
++    int windows_key_code = 0;
++    if (ch >= u'a' && ch <= u'z') {
++      windows_key_code = ch - u'a' + 'A';
++    } else if ((ch >= u'A' && ch <= u'Z') || (ch >= u'0' && ch <= u'9')) {
++      windows_key_code = ch;
++    } else if (ch == u' ') {
++      windows_key_code = ui::VKEY_SPACE;
 +    }
++
++    input::NativeWebKeyboardEvent key_down(
++        blink::WebInputEvent::Type::kRawKeyDown,
++        blink::WebInputEvent::kNoModifiers,
++        ui::EventTimeForNow());
++    key_down.windows_key_code = windows_key_code;
++    key_down.native_key_code = windows_key_code;
++    rwh->ForwardKeyboardEvent(key_down);
++
++    input::NativeWebKeyboardEvent char_event(
++        blink::WebInputEvent::Type::kChar,
++        blink::WebInputEvent::kNoModifiers,
++        ui::EventTimeForNow());
++    char_event.windows_key_code = windows_key_code;
++    char_event.native_key_code = windows_key_code;
++    char_event.text[0] = ch;
++    char_event.unmodified_text[0] = ch;
++    rwh->ForwardKeyboardEvent(char_event);
++
++    input::NativeWebKeyboardEvent key_up(
++        blink::WebInputEvent::Type::kKeyUp,
++        blink::WebInputEvent::kNoModifiers,
++        ui::EventTimeForNow());
++    key_up.windows_key_code = windows_key_code;
++    key_up.native_key_code = windows_key_code;
++    rwh->ForwardKeyboardEvent(key_up);
 +  }
-+  
-+  // Try to find element by ID first
-+  auto id_it = node_info.attributes.find("id");
-+  if (id_it != node_info.attributes.end() && !id_it->second.empty()) {
-+    js_code += u"  var element = document.getElementById('" + 
-+               base::UTF8ToUTF16(id_it->second) + u"');";
-+    js_code += u"  if (element) {";
-+    js_code += u"    element.value = '" + escaped_text + u"';";
-+    js_code += u"    element.dispatchEvent(new Event('input', {bubbles: true}));";
-+    js_code += u"    element.dispatchEvent(new Event('change', {bubbles: true}));";
-+    js_code += u"    return 'set by id';";
-+    js_code += u"  }";
-+  }
-+  
-+  // Try to find by class and tag combination
-+  auto class_it = node_info.attributes.find("class");
-+  auto tag_it = node_info.attributes.find("html-tag");
-+  
-+  if (class_it != node_info.attributes.end() && !class_it->second.empty() &&
-+      tag_it != node_info.attributes.end() && !tag_it->second.empty()) {
-+    std::string class_selector = "." + class_it->second;
-+    for (size_t i = 0; i < class_selector.length(); ++i) {
-+      if (class_selector[i] == ' ') {
-+        class_selector[i] = '.';
++}
++
++namespace {
++
++// Marks documents where the persistent typing helper below has been
++// injected; torn down automatically on cross-document navigation, which is
++// exactly when the renderer-side function disappears.
++class TypeHelperInstalled
++    : public content::DocumentUserData<TypeHelperInstalled> {
++ public:
++  ~TypeHelperInstalled() override = default;
++
++ private:
++  friend DocumentUserData;
++  explicit TypeHelperInstalled(content::RenderFrameHost* rfh)
++      : DocumentUserData(rfh) {}
++  DOCUMENT_USER_DATA_KEY_DECL();
++};
++
++DOCUMENT_USER_DATA_KEY_IMPL(TypeHelperInstalled);
++
++// Finder/setter function injected once per document. Later typing calls
++// invoke it by reference with the payload as arguments, so filling dozens
++// of fields on one page compiles this body once instead of recompiling an
++// assembled script per field.
++constexpr char16_t kTypeHelperScript[] =
++    uR"((function() {
++  window.__browserosSetValue = function(id, selector, text) {
++    var element = id ? document.getElementById(id) : null;
++    var how = 'set by id';
++    if (!element && selector) {
++      var elements = document.querySelectorAll(selector);
++      if (elements.length > 0) {
++        element = elements[0];
++        how = 'set by class and tag';
 +      }
 +    }
-+    
-+    js_code += u"  var elements = document.querySelectorAll('" + 
-+               base::UTF8ToUTF16(tag_it->second + class_selector) + u"');";
-+    js_code += u"  if (elements.length > 0) {";
-+    js_code += u"    if (elements[0].value !== undefined) {";
-+    js_code += u"      elements[0].value = '" + escaped_text + u"';";
-+    js_code += u"    } else if (elements[0].isContentEditable) {";
-+    js_code += u"      elements[0].textContent = '" + escaped_text + u"';";
-+    js_code += u"    }";
-+    js_code += u"    elements[0].dispatchEvent(new Event('input', {bubbles: true}));";
-+    js_code += u"    elements[0].dispatchEvent(new Event('change', {bubbles: true}));";
-+    js_code += u"    return 'set by class and tag';";
-+    js_code += u"  }";
++    if (!element) {
++      return 'no element found';
++    }
++    if (element.value !== undefined) {
++      element.value = text;
++    } else if (element.isContentEditable) {
++      element.textContent = text;
++    }
++    element.dispatchEvent(new Event('input', {bubbles: true}));
++    element.dispatchEvent(new Event('change', {bubbles: true}));
++    return how;
++  };
++})();)";
++
++}  // namespace
++
++// Helper to set text value using JavaScript
++void JavaScriptType(content::WebContents* web_contents,
++                    const NodeInfo& node_info,
++                    const std::string& text) {
++  TRACE_EVENT0("browseros", "JavaScriptType");
++  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
++  if (!rfh)
++    return;
++
++  // Install the helper on first use in this document.
++  if (!TypeHelperInstalled::GetForCurrentDocument(rfh)) {
++    rfh->ExecuteJavaScriptForTests(
++        kTypeHelperScript,
++        base::NullCallback(),
++        /*honor_js_content_settings=*/false);
++    TypeHelperInstalled::CreateForCurrentDocument(rfh);
 +  }
-+  
-+  js_code += u"  return 'no element found';";
-+  js_code += u"})();";
-+  
-+  // Execute the JavaScript
++
++  // Same lookup keys as the click/focus helpers; the setter doesn't take
++  // the bare-tag fallback.
++  std::string id;
++  std::string selector;
++  std::string tag;
++  GetHtmlLookupKeys(node_info, &id, &selector, &tag);
++
++  // JSON-quote the arguments; the && guard covers a helper injection lost
++  // to a racing navigation (the next call reinstalls it).
++  std::string invocation = base::StrCat(
++      {"window.__browserosSetValue && window.__browserosSetValue(",
++       base::GetQuotedJSONString(id), ", ",
++       base::GetQuotedJSONString(selector), ", ",
++       base::GetQuotedJSONString(text), ");"});
++
 +  rfh->ExecuteJavaScriptForTests(
-+      js_code,
++      base::UTF8ToUTF16(invocation),
 +      base::NullCallback(),
 +      /*honor_js_content_settings=*/false);
 +}
@@ -546,6 +805,7 @@ index 0000000000000..f40a2424641e1
 +// Helper to perform accessibility action: DoDefault (click)
 +bool AccessibilityDoDefault(content::WebContents* web_contents,
 +                            const NodeInfo& node_info) {
++  TRACE_EVENT0("browseros", "AccessibilityDoDefault");
 +  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
 +  if (!rfh) {
 +    LOG(WARNING) << "[browseros] No RenderFrameHost for AccessibilityDoDefault";
@@ -619,68 +879,135 @@ index 0000000000000..f40a2424641e1
 +  return true;
 +}
 +
++namespace {
++
++// Continuations for the async change-detecting helpers below. Each step
++// holds the WebContents as a weak pointer because detection timeouts and
++// scroll/focus delays can outlive the tab; a dead WebContents completes the
++// chain with false. NodeInfo is bound by value for the same reason.
++
++// Logs the final result of an action chain and forwards it to the caller.
++void ReportActionResult(const char* label,
++                        ActionCompleteCallback callback,
++                        bool changed) {
++  LOG(INFO) << "[browseros] " << label << " result: "
++            << (changed ? "changed" : "no change");
++  std::move(callback).Run(changed);
++}
++
++// Click step 2: if the coordinate click changed nothing, fall back to an
++// HTML (JS-based) click.
++void ClickHtmlFallback(base::WeakPtr<content::WebContents> web_contents,
++                       NodeInfo node_info,
++                       ActionCompleteCallback callback,
++                       bool changed) {
++  if (changed) {
++    ReportActionResult("Click", std::move(callback), true);
++    return;
++  }
++  content::WebContents* contents = web_contents.get();
++  if (!contents) {
++    std::move(callback).Run(false);
++    return;
++  }
++  LOG(INFO) << "[browseros] No change from coordinate click, trying HTML click";
++  BrowserOSChangeDetector::ExecuteWithAdaptiveDetectionAsync(
++      contents,
++      [contents, node_info]() { HtmlClick(contents, node_info); },
++      base::BindOnce(&ReportActionResult, "Click", std::move(callback)),
++      "Click", base::Milliseconds(200), node_info.ax_tree_id,
++      node_info.ax_node_id);
++}
++
++// Click step 1: coordinate click at the node's center point. Runs directly
++// for in-viewport nodes and once the scroll settles for out-of-viewport
++// ones.
++void ClickStartAttempt(base::WeakPtr<content::WebContents> web_contents,
++                       NodeInfo node_info,
++                       ActionCompleteCallback callback) {
++  content::WebContents* contents = web_contents.get();
++  if (!contents) {
++    std::move(callback).Run(false);
++    return;
++  }
++  gfx::PointF click_point = GetNodeCenterPoint(contents, node_info);
++  BrowserOSChangeDetector::ExecuteWithAdaptiveDetectionAsync(
++      contents,
++      [contents, click_point]() { PointClick(contents, click_point); },
++      base::BindOnce(&ClickHtmlFallback, web_contents, node_info,
++                     std::move(callback)),
++      "Click", base::Milliseconds(300), node_info.ax_tree_id,
++      node_info.ax_node_id);
++}
++
++// Click step 0 result: the make-visible scroll settled (its accessibility
++// update landed and went quiet, or the backstop window lapsed on a page
++// that emits no scroll events). Before clicking, the node's bounds are
++// refreshed from the live tree cache so the click targets the post-scroll
++// position; the snapshot-time bounds predate the scroll. Callers used to
++// need a full re-snapshot round trip for this.
++void ClickScrollSettled(base::WeakPtr<content::WebContents> web_contents,
++                        NodeInfo node_info,
++                        ActionCompleteCallback callback,
++                        bool changed) {
++  content::WebContents* contents = web_contents.get();
++  if (contents) {
++    BrowserOSTreeCache* cache = BrowserOSTreeCache::FromWebContents(contents);
++    float device_scale_factor = 1.0f;
++    if (auto* rwhv = contents->GetRenderWidgetHostView()) {
++      device_scale_factor =
++          static_cast<content::RenderWidgetHostViewBase*>(rwhv)
++              ->GetDeviceScaleFactor();
++    }
++    gfx::RectF fresh_bounds;
++    if (cache &&
++        cache->GetNodeBounds(node_info.ax_node_id, device_scale_factor,
++                             &fresh_bounds) &&
++        !fresh_bounds.IsEmpty()) {
++      VLOG(1) << "[browseros] Refreshed post-scroll bounds for node "
++              << node_info.ax_node_id << ": " << fresh_bounds.ToString();
++      node_info.bounds = fresh_bounds;
++    }
++  }
++  ClickStartAttempt(std::move(web_contents), std::move(node_info),
++                    std::move(callback));
++}
++
++}  // namespace
++
 +// Helper to perform a click with change detection and retrying
-+bool ClickWithDetection(content::WebContents* web_contents,
-+                        const NodeInfo& node_info) {
++void ClickWithDetection(content::WebContents* web_contents,
++                        const NodeInfo& node_info,
++                        ActionCompleteCallback callback) {
++  TRACE_EVENT0("browseros", "ClickWithDetection");
 +  // Check if node is out of viewport and needs scrolling
 +  auto viewport_it = node_info.attributes.find("in_viewport");
-+  bool is_out_of_viewport = (viewport_it != node_info.attributes.end() && 
++  bool is_out_of_viewport = (viewport_it != node_info.attributes.end() &&
 +                              viewport_it->second == "false");
-+  
++
 +  if (is_out_of_viewport) {
 +    LOG(INFO) << "[browseros] Node is out of viewport, scrolling to make visible";
-+    AccessibilityScrollToMakeVisible(web_contents, node_info, true /* center */);
-+    // Wait for scroll to complete
-+    base::PlatformThread::Sleep(base::Milliseconds(300));
-+    
-+    // For out-of-viewport nodes, use AccessibilityDoDefault first (most reliable after scroll)
-+    // LOG(INFO) << "[browseros] Node was out of viewport, trying AccessibilityDoDefault click first";
-+    // bool changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+    //     web_contents,
-+    //     [&]() { AccessibilityDoDefault(web_contents, node_info); },
-+    //     base::Milliseconds(300));
-+    
-+    gfx::PointF click_point = GetNodeCenterPoint(web_contents, node_info);
-+    
-+    bool changed = BrowserOSChangeDetector::ExecuteWithDetection(
++    // Arm detection in the same turn the scroll IPC is issued, so the click
++    // follows as soon as the scroll's accessibility update settles instead
++    // of after a fixed 300ms sleep; the timeout preserves the old worst
++    // case. No target node: the scroll mutates the scroll container, not
++    // the clicked node's subtree.
++    BrowserOSChangeDetector::ExecuteWithDetectionAsync(
 +        web_contents,
-+        [&]() { PointClick(web_contents, click_point); },
-+        base::Milliseconds(300));
-+    
-+    if (!changed) {
-+      // Skip coordinate click for out-of-viewport nodes (coordinates unreliable)
-+      // Go straight to HTML click
-+      LOG(INFO) << "[browseros] No change from accessibility click, trying HTML click";
-+      changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+          web_contents,
-+          [&]() { HtmlClick(web_contents, node_info); },
-+          base::Milliseconds(200));
-+    }
-+    
-+    LOG(INFO) << "[browseros] Click result: " << (changed ? "changed" : "no change");
-+    return changed;
++        [web_contents, node_info]() {
++          AccessibilityScrollToMakeVisible(web_contents, node_info,
++                                           true /* center */);
++        },
++        base::BindOnce(&ClickScrollSettled, web_contents->GetWeakPtr(),
++                       node_info, std::move(callback)),
++        "Scroll", base::Milliseconds(300));
++    return;
 +  }
-+  
++
 +  // For in-viewport nodes, try coordinate click first (most natural)
 +  LOG(INFO) << "[browseros] Node is in viewport, trying coordinate click first";
-+  gfx::PointF click_point = GetNodeCenterPoint(web_contents, node_info);
-+  
-+  bool changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+      web_contents,
-+      [&]() { PointClick(web_contents, click_point); },
-+      base::Milliseconds(300));
-+  
-+  // If still no change, try HTML click as final fallback
-+  if (!changed) {
-+      LOG(INFO) << "[browseros] No change from accessibility click, trying HTML click";
-+      changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+          web_contents,
-+          [&]() { HtmlClick(web_contents, node_info); },
-+          base::Milliseconds(200));
-+  }
-+  
-+  LOG(INFO) << "[browseros] Click result: " << (changed ? "changed" : "no change");
-+  return changed;
++  ClickStartAttempt(web_contents->GetWeakPtr(), node_info,
++                    std::move(callback));
 +}
 +
 +// Helper to perform accessibility action: SetValue
@@ -699,75 +1026,248 @@ index 0000000000000..f40a2424641e1
 +  action_data.target_tree_id = node_info.ax_tree_id;
 +  action_data.value = text;
 +  
-+  LOG(INFO) << "[browseros] Performing AccessibilitySetValue on node " 
++  LOG(INFO) << "[browseros] Performing AccessibilitySetValue on node "
 +            << node_info.ax_node_id << " with text: " << text;
-+  
++
 +  rfh->AccessibilityPerformAction(action_data);
 +  return true;
 +}
 +
++// Helper to perform combined accessibility actions: Focus + SetValue
++// Both AXActionData travel the same ordered channel and the renderer
++// applies them in one task batch, so the field is focused when the value
++// lands without the separate call (and settle delay) per action.
++bool AccessibilityFocusAndSetValue(content::WebContents* web_contents,
++                                   const NodeInfo& node_info,
++                                   const std::string& text) {
++  TRACE_EVENT0("browseros", "AccessibilityFocusAndSetValue");
++  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
++  if (!rfh) {
++    LOG(WARNING)
++        << "[browseros] No RenderFrameHost for AccessibilityFocusAndSetValue";
++    return false;
++  }
++
++  ui::AXActionData focus_action;
++  focus_action.action = ax::mojom::Action::kFocus;
++  focus_action.target_node_id = node_info.ax_node_id;
++  focus_action.target_tree_id = node_info.ax_tree_id;
++
++  ui::AXActionData set_value_action;
++  set_value_action.action = ax::mojom::Action::kSetValue;
++  set_value_action.target_node_id = node_info.ax_node_id;
++  set_value_action.target_tree_id = node_info.ax_tree_id;
++  set_value_action.value = text;
++
++  LOG(INFO) << "[browseros] Performing combined Focus+SetValue on node "
++            << node_info.ax_node_id;
++
++  rfh->AccessibilityPerformAction(focus_action);
++  rfh->AccessibilityPerformAction(set_value_action);
++  return true;
++}
++
++namespace {
++
++// Type step 4: if key events changed nothing either, fall back to setting
++// the value with JavaScript.
++void TypeJavaScriptFallback(base::WeakPtr<content::WebContents> web_contents,
++                            NodeInfo node_info,
++                            std::string text,
++                            ActionCompleteCallback callback,
++                            bool changed) {
++  if (changed) {
++    ReportActionResult("Type", std::move(callback), true);
++    return;
++  }
++  content::WebContents* contents = web_contents.get();
++  if (!contents) {
++    std::move(callback).Run(false);
++    return;
++  }
++  LOG(INFO) << "[browseros] No change from native typing, trying JavaScript";
++  BrowserOSChangeDetector::ExecuteWithAdaptiveDetectionAsync(
++      contents,
++      [contents, node_info, text]() {
++        JavaScriptType(contents, node_info, text);
++      },
++      base::BindOnce(&ReportActionResult, "Type", std::move(callback)),
++      "Type", base::Milliseconds(200), node_info.ax_tree_id,
++      node_info.ax_node_id);
++}
++
++// Type step 3: if the IME commit changed nothing, replay the string as a
++// burst of synthesized key events for pages that listen for key events
++// rather than IME input.
++void TypeKeyEventFallback(base::WeakPtr<content::WebContents> web_contents,
++                          NodeInfo node_info,
++                          std::string text,
++                          ActionCompleteCallback callback,
++                          bool changed) {
++  if (changed) {
++    ReportActionResult("Type", std::move(callback), true);
++    return;
++  }
++  content::WebContents* contents = web_contents.get();
++  if (!contents) {
++    std::move(callback).Run(false);
++    return;
++  }
++  LOG(INFO) << "[browseros] No change from IME commit, trying key events";
++  const ui::AXTreeID target_tree_id = node_info.ax_tree_id;
++  const int32_t target_node_id = node_info.ax_node_id;
++  BrowserOSChangeDetector::ExecuteWithAdaptiveDetectionAsync(
++      contents,
++      [contents, text]() { KeyEventType(contents, text); },
++      base::BindOnce(&TypeJavaScriptFallback, web_contents,
++                     std::move(node_info), text, std::move(callback)),
++      "Type", base::Milliseconds(200), target_tree_id, target_node_id);
++}
++
++// Type step 2: native IME typing into the (now focused) element.
++void TypeStartNative(base::WeakPtr<content::WebContents> web_contents,
++                     NodeInfo node_info,
++                     std::string text,
++                     ActionCompleteCallback callback) {
++  content::WebContents* contents = web_contents.get();
++  if (!contents) {
++    std::move(callback).Run(false);
++    return;
++  }
++  LOG(INFO) << "[browseros] Trying native typing";
++  const ui::AXTreeID target_tree_id = node_info.ax_tree_id;
++  const int32_t target_node_id = node_info.ax_node_id;
++  BrowserOSChangeDetector::ExecuteWithAdaptiveDetectionAsync(
++      contents,
++      [contents, text]() { NativeType(contents, text); },
++      base::BindOnce(&TypeKeyEventFallback, web_contents,
++                     std::move(node_info), text, std::move(callback)),
++      "Type", base::Milliseconds(300), target_tree_id, target_node_id);
++}
++
++// Type step 1: focus the element via accessibility, then type after a short
++// delay so focus has settled.
++void TypeFocusThenType(base::WeakPtr<content::WebContents> web_contents,
++                       NodeInfo node_info,
++                       std::string text,
++                       ActionCompleteCallback callback) {
++  content::WebContents* contents = web_contents.get();
++  if (!contents) {
++    std::move(callback).Run(false);
++    return;
++  }
++  LOG(INFO) << "[browseros] Focusing element for typing";
++  AccessibilityFocus(contents, node_info);
++  // Small delay to ensure focus is set
++  base::SequencedTaskRunner::GetCurrentDefault()->PostDelayedTask(
++      FROM_HERE,
++      base::BindOnce(&TypeStartNative, web_contents, std::move(node_info),
++                     std::move(text), std::move(callback)),
++      base::Milliseconds(50));
++}
++
++// Type fallback after step 0: pages that ignore kSetValue (custom widgets,
++// editors that only listen for input events) go through the original
++// focus-then-type chain with all of its fallbacks.
++void TypeFocusFallback(base::WeakPtr<content::WebContents> web_contents,
++                       NodeInfo node_info,
++                       std::string text,
++                       ActionCompleteCallback callback,
++                       bool changed) {
++  if (changed) {
++    ReportActionResult("Type", std::move(callback), true);
++    return;
++  }
++  if (!web_contents) {
++    std::move(callback).Run(false);
++    return;
++  }
++  LOG(INFO) << "[browseros] No change from combined Focus+SetValue, "
++            << "trying focus-then-type";
++  TypeFocusThenType(web_contents, std::move(node_info), std::move(text),
++                    std::move(callback));
++}
++
++// Type step 0: the dominant form-fill pattern is "focus the field, set its
++// value", so try it as one batched Focus+SetValue dispatch first. Success
++// skips the 50ms focus-settle delay and the IME round trip entirely, which
++// adds up when agents fill long forms; change detection catches the pages
++// where it doesn't take.
++void TypeStartCombined(base::WeakPtr<content::WebContents> web_contents,
++                       NodeInfo node_info,
++                       std::string text,
++                       ActionCompleteCallback callback) {
++  content::WebContents* contents = web_contents.get();
++  if (!contents) {
++    std::move(callback).Run(false);
++    return;
++  }
++  const ui::AXTreeID target_tree_id = node_info.ax_tree_id;
++  const int32_t target_node_id = node_info.ax_node_id;
++  BrowserOSChangeDetector::ExecuteWithAdaptiveDetectionAsync(
++      contents,
++      [contents, node_info, text]() {
++        AccessibilityFocusAndSetValue(contents, node_info, text);
++      },
++      base::BindOnce(&TypeFocusFallback, web_contents, std::move(node_info),
++                     text, std::move(callback)),
++      "Type", base::Milliseconds(200), target_tree_id, target_node_id);
++}
++
++// Type scroll result: the make-visible scroll settled (or the backstop
++// window lapsed); the combined Focus+SetValue dispatch proceeds either way.
++void TypeScrollSettled(base::WeakPtr<content::WebContents> web_contents,
++                       NodeInfo node_info,
++                       std::string text,
++                       ActionCompleteCallback callback,
++                       bool changed) {
++  TypeStartCombined(std::move(web_contents), std::move(node_info),
++                    std::move(text), std::move(callback));
++}
++
++}  // namespace
++
 +// Helper to perform typing with change detection
-+bool TypeWithDetection(content::WebContents* web_contents,
-+                      const NodeInfo& node_info,
-+                      const std::string& text) {
++void TypeWithDetection(content::WebContents* web_contents,
++                       const NodeInfo& node_info,
++                       const std::string& text,
++                       ActionCompleteCallback callback) {
++  TRACE_EVENT0("browseros", "TypeWithDetection");
 +  // Check if node is out of viewport and needs scrolling
 +  auto viewport_it = node_info.attributes.find("in_viewport");
-+  bool is_out_of_viewport = (viewport_it != node_info.attributes.end() && 
++  bool is_out_of_viewport = (viewport_it != node_info.attributes.end() &&
 +                              viewport_it->second == "false");
-+  
++
 +  if (is_out_of_viewport) {
 +    LOG(INFO) << "[browseros] Node is out of viewport for typing, scrolling to make visible";
-+    AccessibilityScrollToMakeVisible(web_contents, node_info, true /* center */);
-+    // Wait for scroll to complete
-+    base::PlatformThread::Sleep(base::Milliseconds(300));
-+  }
-+  
-+  // First ensure the element is focused using accessibility
-+  LOG(INFO) << "[browseros] Focusing element for typing";
-+  AccessibilityFocus(web_contents, node_info);
-+  // Small delay to ensure focus is set
-+  base::PlatformThread::Sleep(base::Milliseconds(50));
-+  
-+  // Try native typing first (most natural method)
-+  LOG(INFO) << "[browseros] Trying native typing";
-+  bool changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+      web_contents,
-+      [&]() {
-+        NativeType(web_contents, text);
-+      },
-+      base::Milliseconds(300));
-+  
-+  // If no change detected, try JavaScript typing as second fallback
-+  if (!changed) {
-+    LOG(INFO) << "[browseros] No change from native typing, trying JavaScript";
-+    changed = BrowserOSChangeDetector::ExecuteWithDetection(
++    // As in ClickWithDetection: arm detection alongside the scroll IPC so
++    // typing starts once the scroll settles rather than after a fixed
++    // 300ms sleep; the timeout preserves the old worst case.
++    BrowserOSChangeDetector::ExecuteWithDetectionAsync(
 +        web_contents,
-+        [&]() { JavaScriptType(web_contents, node_info, text); },
-+        base::Milliseconds(200));
++        [web_contents, node_info]() {
++          AccessibilityScrollToMakeVisible(web_contents, node_info,
++                                           true /* center */);
++        },
++        base::BindOnce(&TypeScrollSettled, web_contents->GetWeakPtr(),
++                       node_info, text, std::move(callback)),
++        "Scroll", base::Milliseconds(300));
++    return;
 +  }
-+  
-+  // If still no change, try accessibility SetValue as final fallback
-+  // if (!changed) {
-+  //   LOG(INFO) << "[browseros] No change from JavaScript, trying accessibility SetValue";
-+  //   changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+  //       web_contents,
-+  //       [&]() {
-+  //         AccessibilitySetValue(web_contents, node_info, text);
-+  //       },
-+  //       base::Milliseconds(300));
-+  // }
-+  
-+  LOG(INFO) << "[browseros] Type result: " << (changed ? "changed" : "no change");
-+  return changed;
++
++  TypeStartCombined(web_contents->GetWeakPtr(), node_info, text,
++                    std::move(callback));
 +}
 +
 +// Helper to clear an input field with change detection
-+bool ClearWithDetection(content::WebContents* web_contents,
-+                       const NodeInfo& node_info) {
++void ClearWithDetection(content::WebContents* web_contents,
++                        const NodeInfo& node_info,
++                        ActionCompleteCallback callback) {
++  TRACE_EVENT0("browseros", "ClearWithDetection");
 +  // Use change detection with JavaScript clear
-+  bool changed = BrowserOSChangeDetector::ExecuteWithDetection(
++  BrowserOSChangeDetector::ExecuteWithAdaptiveDetectionAsync(
 +      web_contents,
-+      [&]() {
++      [web_contents, node_info]() {
 +        content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
 +        if (!rfh) return;
 +        
@@ -792,63 +1292,86 @@ index 0000000000000..f40a2424641e1
 +            base::NullCallback(),
 +            /*honor_js_content_settings=*/false);
 +      },
-+      base::Milliseconds(200));
-+  
-+  LOG(INFO) << "[browseros] Clear result: " << (changed ? "changed" : "no change");
-+  return changed;
++      base::BindOnce(&ReportActionResult, "Clear", std::move(callback)),
++      "Clear", base::Milliseconds(200), node_info.ax_tree_id,
++      node_info.ax_node_id);
 +}
 +
 +// Helper to send a key press with change detection
-+bool KeyPressWithDetection(content::WebContents* web_contents,
-+                          const std::string& key) {
-+  // Use change detection with key press
-+  bool changed = BrowserOSChangeDetector::ExecuteWithDetection(
++void KeyPressWithDetection(content::WebContents* web_contents,
++                           const std::string& key,
++                           ActionCompleteCallback callback) {
++  TRACE_EVENT0("browseros", "KeyPressWithDetection");
++  auto sequence = CompileKeySequence(key);
++  if (!sequence) {
++    // Unsupported key; nothing was dispatched, so don't sit out the
++    // detection window.
++    std::move(callback).Run(false);
++    return;
++  }
++  KeySequenceWithDetection(web_contents, std::move(*sequence),
++                           std::move(callback));
++}
++
++// Helper to replay a compiled key sequence with one detection window
++void KeySequenceWithDetection(content::WebContents* web_contents,
++                              std::vector<CompiledKey> sequence,
++                              ActionCompleteCallback callback) {
++  TRACE_EVENT1("browseros", "KeySequenceWithDetection", "keys",
++               sequence.size());
++  // One detection window brackets the whole sequence: tab-tab-tab-enter
++  // style navigation settles as one action instead of paying the
++  // detection setup and quiet period per key.
++  BrowserOSChangeDetector::ExecuteWithAdaptiveDetectionAsync(
 +      web_contents,
-+      [&]() { KeyPress(web_contents, key); },
-+      base::Milliseconds(200));
-+  
-+  LOG(INFO) << "[browseros] KeyPress result for '" << key << "': " 
-+            << (changed ? "changed" : "no change");
-+  return changed;
++      [web_contents, sequence = std::move(sequence)]() {
++        for (const CompiledKey& key : sequence) {
++          PressCompiledKey(web_contents, key);
++        }
++      },
++      base::BindOnce(&ReportActionResult, "KeySequence", std::move(callback)),
++      "KeySequence", base::Milliseconds(200));
 +}
 +
 +// Helper to show highlights for clickable, typeable, and selectable elements that are in viewport
-+void ShowHighlights(
-+    content::WebContents* web_contents,
-+    const std::unordered_map<uint32_t, NodeInfo>& node_mappings,
-+    bool show_labels) {
-+  
++void ShowHighlights(content::WebContents* web_contents,
++                    const std::vector<NodeInfo>& nodes,
++                    bool show_labels) {
 +  content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
 +  if (!rfh) return;
-+  
++
 +  // Filter nodes to only include:
 +  // 1. Elements that are in viewport (using stored in_viewport field)
 +  // 2. Elements that are clickable, typeable, or selectable (using stored node_type)
-+  std::unordered_map<uint32_t, NodeInfo> filtered_nodes;
-+  
-+  for (const auto& [node_id, node_info] : node_mappings) {
++  std::vector<std::pair<uint32_t, const NodeInfo*>> filtered_nodes;
++
++  for (size_t slot = 0; slot < nodes.size(); ++slot) {
++    const NodeInfo& node_info = nodes[slot];
++    if (node_info.ax_node_id == 0) {
++      continue;  // Unfilled registry slot
++    }
 +    // Check if element is in viewport using the stored field
 +    if (!node_info.in_viewport) {
 +      continue;  // Skip elements not in viewport
 +    }
-+    
++
 +    // Check if element is clickable, typeable, or selectable using stored node_type
 +    // Skip "other" interactive type as requested
 +    if (node_info.node_type == browser_os::InteractiveNodeType::kClickable ||
 +        node_info.node_type == browser_os::InteractiveNodeType::kTypeable ||
 +        node_info.node_type == browser_os::InteractiveNodeType::kSelectable) {
-+      filtered_nodes[node_id] = node_info;
++      filtered_nodes.emplace_back(static_cast<uint32_t>(slot + 1), &node_info);
 +    }
 +  }
-+  
++
 +  // If no nodes match our criteria, return early
 +  if (filtered_nodes.empty()) {
 +    LOG(INFO) << "[browseros] No interactive elements in viewport to highlight";
 +    return;
 +  }
-+  
-+  LOG(INFO) << "[browseros] Highlighting " << filtered_nodes.size() 
-+            << " interactive elements in viewport (out of " << node_mappings.size() << " total)";
++
++  LOG(INFO) << "[browseros] Highlighting " << filtered_nodes.size()
++            << " interactive elements in viewport (out of " << nodes.size() << " total)";
 +  
 +  // Use the original drawing implementation but with filtered nodes
 +  
@@ -880,7 +1403,7 @@ index 0000000000000..f40a2424641e1
 +  for (const auto& [node_id, node_info] : filtered_nodes) {
 +    if (!first) js_code += ",";
 +    first = false;
-+    
++
 +    // Bounds are already in CSS pixels from SnapshotProcessor
 +    js_code += base::StringPrintf(
 +        R"(
@@ -893,11 +1416,11 @@ index 0000000000000..f40a2424641e1
 +          role: "%s"
 +        })",
 +        node_id,
-+        node_info.bounds.x(),
-+        node_info.bounds.y(),
-+        node_info.bounds.width(),
-+        node_info.bounds.height(),
-+        node_info.attributes.count("role") ? node_info.attributes.at("role").c_str() : "unknown"
++        node_info->bounds.x(),
++        node_info->bounds.y(),
++        node_info->bounds.width(),
++        node_info->bounds.height(),
++        node_info->attributes.count("role") ? node_info->attributes.at("role").c_str() : "unknown"
 +    );
 +  }
 +  
@@ -992,54 +1515,200 @@ index 0000000000000..f40a2424641e1
 +      false);
 +}
 +
-+// Helper to click at specific coordinates with change detection
-+bool ClickCoordinatesWithDetection(content::WebContents* web_contents,
-+                                   const gfx::PointF& point) {
-+  LOG(INFO) << "[browseros] ClickCoordinatesWithDetection at (" 
++// Draws highlight boxes and labels straight onto a captured bitmap
++void DrawHighlightsOnBitmap(
++    SkBitmap* bitmap,
++    const std::vector<NodeInfo>& nodes,
++    const gfx::RectF& capture_rect_css,
++    bool show_labels,
++    const std::unordered_set<uint32_t>* only_node_ids) {
++  if (!bitmap || bitmap->empty() || capture_rect_css.IsEmpty()) {
++    return;
++  }
++
++  // CopyFromSurface results can be marked immutable; draw on a copy then.
++  if (bitmap->isImmutable()) {
++    SkBitmap mutable_copy;
++    if (!mutable_copy.tryAllocPixels(bitmap->info())) {
++      return;
++    }
++    bitmap->readPixels(mutable_copy.pixmap());
++    *bitmap = mutable_copy;
++  }
++
++  SkCanvas canvas(*bitmap);
++  const float scale_x = bitmap->width() / capture_rect_css.width();
++  const float scale_y = bitmap->height() / capture_rect_css.height();
++
++  // Match the styling ShowHighlights uses: 2px blue border, blue label
++  // chip with the node id above the box.
++  SkPaint border_paint;
++  border_paint.setStyle(SkPaint::kStroke_Style);
++  border_paint.setStrokeWidth(2.0f * scale_x);
++  border_paint.setColor(SkColorSetRGB(0x1E, 0x40, 0xAF));
++  border_paint.setAntiAlias(true);
++
++  SkPaint label_bg_paint;
++  label_bg_paint.setStyle(SkPaint::kFill_Style);
++  label_bg_paint.setColor(SkColorSetRGB(0x25, 0x63, 0xEB));
++  label_bg_paint.setAlphaf(0.9f);
++  label_bg_paint.setAntiAlias(true);
++
++  SkPaint text_paint;
++  text_paint.setColor(SK_ColorWHITE);
++  text_paint.setAntiAlias(true);
++
++  SkFont font;
++  font.setSize(14.0f * scale_y);
++
++  const SkRect bitmap_rect =
++      SkRect::MakeWH(bitmap->width(), bitmap->height());
++
++  for (size_t slot = 0; slot < nodes.size(); ++slot) {
++    const uint32_t node_id = static_cast<uint32_t>(slot + 1);
++    const NodeInfo& node_info = nodes[slot];
++    if (node_info.ax_node_id == 0) {
++      continue;  // Unfilled registry slot.
++    }
++    if (only_node_ids) {
++      // An explicit candidate list overrides the default filtering: the
++      // caller picked the nodes, so draw whatever intersects the capture.
++      if (!only_node_ids->count(node_id)) {
++        continue;
++      }
++    } else {
++      if (!node_info.in_viewport) {
++        continue;
++      }
++      if (node_info.node_type != browser_os::InteractiveNodeType::kClickable &&
++          node_info.node_type != browser_os::InteractiveNodeType::kTypeable &&
++          node_info.node_type != browser_os::InteractiveNodeType::kSelectable) {
++        continue;
++      }
++    }
++    if (node_info.bounds.width() <= 0 || node_info.bounds.height() <= 0) {
++      continue;
++    }
++
++    const SkRect box = SkRect::MakeXYWH(
++        (node_info.bounds.x() - capture_rect_css.x()) * scale_x,
++        (node_info.bounds.y() - capture_rect_css.y()) * scale_y,
++        node_info.bounds.width() * scale_x,
++        node_info.bounds.height() * scale_y);
++    if (!SkRect::Intersects(box, bitmap_rect)) {
++      continue;
++    }
++
++    canvas.drawRect(box, border_paint);
++
++    if (show_labels) {
++      const std::string label = base::NumberToString(node_id);
++      const SkScalar text_width = font.measureText(
++          label.data(), label.size(), SkTextEncoding::kUTF8);
++      const float pad_x = 7.0f * scale_x;
++      const float pad_y = 3.0f * scale_y;
++      const float label_height = font.getSize() + 2.0f * pad_y;
++      SkRect label_rect = SkRect::MakeXYWH(
++          box.left(), box.top() - label_height - 2.0f * scale_y,
++          text_width + 2.0f * pad_x, label_height);
++      // Keep the chip on the bitmap when the box touches the top edge.
++      if (label_rect.top() < 0) {
++        label_rect.offsetTo(label_rect.left(), box.top());
++      }
++      canvas.drawRoundRect(label_rect, 3.0f * scale_x, 3.0f * scale_y,
++                           label_bg_paint);
++      SkFontMetrics metrics;
++      font.getMetrics(&metrics);
++      canvas.drawSimpleText(label.data(), label.size(), SkTextEncoding::kUTF8,
++                            label_rect.left() + pad_x,
++                            label_rect.bottom() - pad_y - metrics.fDescent,
++                            font, text_paint);
++    }
++  }
++}
++
++std::optional<std::vector<uint8_t>> EncodeImageBytes(const SkBitmap& bitmap,
++                                                     bool use_jpeg,
++                                                     int quality) {
++  if (use_jpeg) {
++    return gfx::JPEGCodec::Encode(bitmap, quality);
++  }
++  return gfx::PNGCodec::EncodeBGRASkBitmap(bitmap, false);
++}
++
++std::string EncodeScreenshotDataUrl(SkBitmap bitmap,
++                                    bool use_jpeg,
++                                    int quality) {
++  std::optional<std::vector<uint8_t>> data =
++      EncodeImageBytes(bitmap, use_jpeg, quality);
++  if (!data.has_value()) {
++    return std::string();
++  }
++  return (use_jpeg ? "data:image/jpeg;base64," : "data:image/png;base64,") +
++         base::Base64Encode(data.value());
++}
++
++// N32 premul/opaque inputs (what viz readbacks produce) come back sharing
++// the same pixel ref; only mismatched formats pay a frame copy here.
++SkBitmap PrepareBitmapForClipboard(SkBitmap bitmap) {
++  SkBitmap converted;
++  if (!skia::SkBitmapToN32OpaqueOrPremul(bitmap, &converted)) {
++    return SkBitmap();
++  }
++  return converted;
++}
++
++// Helper to click at specific coordinates with change detection. This is a
++// pure coordinate path: the event is synthesized from CSS coordinates and
++// the cached CssToWidgetScale, with detection armed in the same call; no
++// node resolution and no AX tree reads happen anywhere on it, so
++// vision-driven agents working from screenshots don't pull in the
++// accessibility machinery.
++void ClickCoordinatesWithDetection(content::WebContents* web_contents,
++                                   const gfx::PointF& point,
++                                   ActionCompleteCallback callback) {
++  TRACE_EVENT0("browseros", "ClickCoordinatesWithDetection");
++  LOG(INFO) << "[browseros] ClickCoordinatesWithDetection at ("
 +            << point.x() << ", " << point.y() << ")";
-+  
++
 +  // Perform coordinate click with change detection
-+  bool changed = BrowserOSChangeDetector::ExecuteWithDetection(
++  BrowserOSChangeDetector::ExecuteWithAdaptiveDetectionAsync(
 +      web_contents,
-+      [&]() { 
-+        PointClick(web_contents, point);
-+      },
-+      base::Milliseconds(300));
-+  
-+  LOG(INFO) << "[browseros] Click coordinates result: " 
-+            << (changed ? "changed" : "no change");
-+  return changed;
++      [web_contents, point]() { PointClick(web_contents, point); },
++      base::BindOnce(&ReportActionResult, "Click coordinates",
++                     std::move(callback)),
++      "ClickCoordinates", base::Milliseconds(300));
 +}
 +
-+// Helper to type text after clicking at coordinates to focus element
-+bool TypeAtCoordinatesWithDetection(content::WebContents* web_contents,
-+                                    const gfx::PointF& point,
-+                                    const std::string& text) {
-+  LOG(INFO) << "[browseros] TypeAtCoordinatesWithDetection at (" 
-+            << point.x() << ", " << point.y() << ") with text: " << text;
-+  
-+  // First click at the coordinates to focus the element
-+  PointClick(web_contents, point);
-+  
-+  // Wait a moment for focus to be established
-+  base::PlatformThread::Sleep(base::Milliseconds(100));
-+  
-+  // Now type the text with change detection
-+  bool changed = BrowserOSChangeDetector::ExecuteWithDetection(
-+      web_contents,
-+      [&]() { 
-+        NativeType(web_contents, text);
-+      },
-+      base::Milliseconds(300));
-+  
-+  // If native typing didn't work, try JavaScript injection to detect and type
-+  if (!changed) {
-+    LOG(INFO) << "[browseros] No change from native typing at coordinates, trying JS injection";
-+    
-+    // Execute JavaScript to find the focused element and set its value
-+    content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
-+    if (rfh) {
-+      std::string js_code = base::StringPrintf(R"(
++namespace {
++
++// Type-at-coordinates step 3: if native typing changed nothing, inject
++// JavaScript that sets the value of whatever element the click focused.
++// Mirrors the previous synchronous behavior of assuming success once the
++// injection has had a moment to register.
++void CoordinateTypeJsFallback(
++    base::WeakPtr<content::WebContents> web_contents,
++    std::string text,
++    ActionCompleteCallback callback,
++    bool changed) {
++  if (changed) {
++    ReportActionResult("Type at coordinates", std::move(callback), true);
++    return;
++  }
++  content::WebContents* contents = web_contents.get();
++  if (!contents) {
++    std::move(callback).Run(false);
++    return;
++  }
++  LOG(INFO) << "[browseros] No change from native typing at coordinates, trying JS injection";
++
++  // Execute JavaScript to find the focused element and set its value
++  content::RenderFrameHost* rfh = contents->GetPrimaryMainFrame();
++  if (!rfh) {
++    std::move(callback).Run(false);
++    return;
++  }
++  std::string js_code = base::StringPrintf(R"(
 +        (function() {
 +          var focused = document.activeElement;
 +          if (focused && (focused.tagName === 'INPUT' || 
@@ -1058,21 +1727,75 @@ index 0000000000000..f40a2424641e1
 +          return false;
 +        })();
 +      )", text.c_str(), text.c_str());
-+      
-+      rfh->ExecuteJavaScriptForTests(
-+          base::UTF8ToUTF16(js_code),
-+          base::NullCallback(),
-+          false);
-+      
-+      // Give it a moment to register
-+      base::PlatformThread::Sleep(base::Milliseconds(50));
-+      changed = true; // Assume success if we reached here
-+    }
++
++  rfh->ExecuteJavaScriptForTests(
++      base::UTF8ToUTF16(js_code),
++      base::NullCallback(),
++      false);
++
++  // Give it a moment to register, then assume success
++  base::SequencedTaskRunner::GetCurrentDefault()->PostDelayedTask(
++      FROM_HERE,
++      base::BindOnce(&ReportActionResult, "Type at coordinates",
++                     std::move(callback), true),
++      base::Milliseconds(50));
++}
++
++// Type-at-coordinates step 2: native IME typing once focus has settled.
++void CoordinateTypeStartNative(
++    base::WeakPtr<content::WebContents> web_contents,
++    std::string text,
++    ActionCompleteCallback callback) {
++  content::WebContents* contents = web_contents.get();
++  if (!contents) {
++    std::move(callback).Run(false);
++    return;
 +  }
-+  
-+  LOG(INFO) << "[browseros] Type at coordinates result: " 
-+            << (changed ? "success" : "failed");
-+  return changed;
++  BrowserOSChangeDetector::ExecuteWithAdaptiveDetectionAsync(
++      contents,
++      [contents, text]() { NativeType(contents, text); },
++      base::BindOnce(&CoordinateTypeJsFallback, web_contents, text,
++                     std::move(callback)),
++      "TypeAtCoordinates", base::Milliseconds(300));
++}
++
++// Type-at-coordinates step 1 result: the focusing click settled (the focus
++// change or another reaction was observed, or the short window lapsed on a
++// page that never reacts). Typing proceeds either way, matching the old
++// unconditional behavior after the fixed delay.
++void CoordinateTypeClickSettled(
++    base::WeakPtr<content::WebContents> web_contents,
++    std::string text,
++    ActionCompleteCallback callback,
++    bool changed) {
++  CoordinateTypeStartNative(std::move(web_contents), std::move(text),
++                            std::move(callback));
++}
++
++}  // namespace
++
++// Helper to type text after clicking at coordinates to focus element. Like
++// ClickCoordinatesWithDetection this is a pure coordinate path: both input
++// legs are synthesized from CSS coordinates via the cached CssToWidgetScale
++// and never touch the AX tree.
++void TypeAtCoordinatesWithDetection(content::WebContents* web_contents,
++                                    const gfx::PointF& point,
++                                    const std::string& text,
++                                    ActionCompleteCallback callback) {
++  TRACE_EVENT0("browseros", "TypeAtCoordinatesWithDetection");
++  LOG(INFO) << "[browseros] TypeAtCoordinatesWithDetection at ("
++            << point.x() << ", " << point.y() << ") with text: " << text;
++
++  // Dispatch the focusing click under change detection instead of a blind
++  // fixed wait: the detector is armed before the events go out, typing
++  // starts as soon as the focus change is observed (typically well inside
++  // the old 100ms), and the window still bounds pages that never react.
++  BrowserOSChangeDetector::ExecuteWithDetectionAsync(
++      web_contents,
++      [web_contents, point]() { PointClick(web_contents, point); },
++      base::BindOnce(&CoordinateTypeClickSettled, web_contents->GetWeakPtr(),
++                     text, std::move(callback)),
++      "TypeAtCoordinates", base::Milliseconds(100));
 +}
 +
 +}  // namespace api
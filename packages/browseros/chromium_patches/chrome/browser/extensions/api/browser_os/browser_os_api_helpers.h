@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api_helpers.h b/chrome/browser/extensions/api/browser_os/browser_os_api_helpers.h
 new file mode 100644
-index 0000000000000..2000fa3235290
+index 0000000000000..25450d7b1f9be
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api_helpers.h
-@@ -0,0 +1,137 @@
+@@ -0,0 +1,249 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,11 +11,21 @@ index 0000000000000..2000fa3235290
 +#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_API_HELPERS_H_
 +#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_API_HELPERS_H_
 +
++#include <cstdint>
++#include <optional>
 +#include <string>
 +#include <unordered_map>
++#include <unordered_set>
++#include <vector>
 +
 +#include "base/functional/callback.h"
++#include "ui/events/keycodes/dom/dom_code.h"
++#include "ui/events/keycodes/dom/dom_key.h"
++#include "ui/events/keycodes/keyboard_codes.h"
 +#include "ui/gfx/geometry/point_f.h"
++#include "ui/gfx/geometry/rect_f.h"
++
++class SkBitmap;
 +
 +namespace content {
 +class WebContents;
@@ -27,11 +37,17 @@ index 0000000000000..2000fa3235290
 +
 +struct NodeInfo;
 +
++// Callback invoked when a change-detecting action completes. The argument
++// is true if the action caused a detectable change in the page.
++using ActionCompleteCallback = base::OnceCallback<void(bool)>;
++
 +// Returns the multiplicative factor that converts CSS pixels (frame
 +// coordinates) to widget DIPs for input events. This matches DevTools'
 +// InputHandler::ScaleFactor(): browser zoom × CSS zoom × page scale. The
 +// device scale factor (DSF) is NOT included because compositor handles it and
 +// input expects widget DIPs (we also set screen = widget).
++// The result is cached per WebContents and refreshed on browser zoom
++// changes, navigation, or after a short TTL.
 +float CssToWidgetScale(content::WebContents* web_contents,
 +                       content::RenderWidgetHost* rwh);
 +
@@ -76,13 +92,44 @@ index 0000000000000..2000fa3235290
 +                           const NodeInfo& node_info,
 +                           const std::string& text);
 +
++// Helper to perform combined accessibility actions: Focus + SetValue
++// Dispatches both actions back-to-back through one frame-host lookup so the
++// dominant "focus field, set its value" form-fill pattern costs one renderer
++// hop instead of two separate calls
++// Returns true if the actions were sent successfully
++bool AccessibilityFocusAndSetValue(content::WebContents* web_contents,
++                                   const NodeInfo& node_info,
++                                   const std::string& text);
++
 +// Helper to perform scroll actions using mouse wheel events
 +void Scroll(content::WebContents* web_contents,
 +                   int delta_x,
 +                   int delta_y,
 +                   bool precise = false);
 +
-+// Helper to send special key events
++// One key of a compiled key sequence: the event parameters KeyPress used
++// to re-derive from the descriptor string on every call, resolved once at
++// compile time so sequences can be replayed without re-parsing.
++struct CompiledKey {
++  ui::KeyboardCode windows_key_code;
++  ui::DomCode dom_code;
++  ui::DomKey dom_key;
++  bool send_char_event;  // Enter needs a char event for form submission.
++  bool send_key_up;      // Tab skips key-up so the focus change sticks.
++};
++
++// Compiles a whitespace-separated key descriptor ("Tab Tab Enter") into a
++// replayable sequence. Returns nullopt when the descriptor is empty or any
++// name is unsupported; KeyPress documents the supported names.
++std::optional<std::vector<CompiledKey>> CompileKeySequence(
++    const std::string& descriptor);
++
++// Dispatches one compiled key against the tab's focused widget.
++void PressCompiledKey(content::WebContents* web_contents,
++                      const CompiledKey& key);
++
++// Helper to send special key events. Accepts a single key name or a
++// whitespace-separated sequence, compiled and replayed in one burst.
 +void KeyPress(content::WebContents* web_contents,
 +                    const std::string& key);
 +
@@ -90,52 +137,117 @@ index 0000000000000..2000fa3235290
 +void NativeType(content::WebContents* web_contents,
 +                const std::string& text);
 +
++// Helper to type text into a focused element as synthesized key events.
++// The whole string's keydown/char/keyup events are queued back-to-back in
++// one burst with no per-character waits, so long strings land near-
++// instantly while pages that listen for key events (rather than IME
++// commits) still see realistic per-key input.
++void KeyEventType(content::WebContents* web_contents,
++                  const std::string& text);
++
 +// Helper to set text value using JavaScript
 +void JavaScriptType(content::WebContents* web_contents,
 +                    const NodeInfo& node_info,
 +                    const std::string& text);
 +
-+// Helper to perform a click with change detection and retrying
-+// Returns true if the click caused a change in the page
-+bool ClickWithDetection(content::WebContents* web_contents,
-+                        const NodeInfo& node_info);
-+
-+// Helper to perform typing with change detection
-+// Returns true if the typing caused a change in the page
-+bool TypeWithDetection(content::WebContents* web_contents,
-+                      const NodeInfo& node_info,
-+                      const std::string& text);
-+
-+// Helper to clear an input field with change detection
-+// Returns true if the clear caused a change in the page
-+bool ClearWithDetection(content::WebContents* web_contents,
-+                       const NodeInfo& node_info);
-+
-+// Helper to send a key press with change detection
-+// Returns true if the key press caused a change in the page
-+bool KeyPressWithDetection(content::WebContents* web_contents,
-+                          const std::string& key);
++// Helper to perform a click with change detection and retrying.
++// Runs the callback with true if the click caused a change in the page.
++void ClickWithDetection(content::WebContents* web_contents,
++                        const NodeInfo& node_info,
++                        ActionCompleteCallback callback);
++
++// Helper to perform typing with change detection.
++// Runs the callback with true if the typing caused a change in the page.
++void TypeWithDetection(content::WebContents* web_contents,
++                       const NodeInfo& node_info,
++                       const std::string& text,
++                       ActionCompleteCallback callback);
++
++// Helper to clear an input field with change detection.
++// Runs the callback with true if the clear caused a change in the page.
++void ClearWithDetection(content::WebContents* web_contents,
++                        const NodeInfo& node_info,
++                        ActionCompleteCallback callback);
++
++// Helper to send a key press with change detection.
++// Accepts a single key name or a whitespace-separated sequence; the
++// descriptor is compiled once and invalid descriptors fail fast with
++// false. Runs the callback with true if the keys caused a change.
++void KeyPressWithDetection(content::WebContents* web_contents,
++                           const std::string& key,
++                           ActionCompleteCallback callback);
++
++// Helper to replay an already-compiled key sequence with change detection
++// armed once around the whole sequence, so multi-key navigation pays one
++// detection window instead of one per key.
++void KeySequenceWithDetection(content::WebContents* web_contents,
++                              std::vector<CompiledKey> sequence,
++                              ActionCompleteCallback callback);
 +
 +// Helper to show highlights for clickable, typeable, and selectable elements that are in viewport
-+// Only highlights elements that are actually visible and interactable
++// Only highlights elements that are actually visible and interactable.
++// |nodes| is a registry's node array; ids are the slot index + 1.
 +void ShowHighlights(content::WebContents* web_contents,
-+                                 const std::unordered_map<uint32_t, NodeInfo>& node_mappings,
-+                                 bool show_labels = true);
++                    const std::vector<NodeInfo>& nodes,
++                    bool show_labels = true);
 +
 +// Helper to remove all bounding box highlights from the page
 +void RemoveHighlights(content::WebContents* web_contents);
 +
-+// Helper to click at specific coordinates with change detection
-+// Returns true if the click caused a detectable change in the page
-+bool ClickCoordinatesWithDetection(content::WebContents* web_contents,
-+                                   const gfx::PointF& point);
-+
-+// Helper to type text after clicking at coordinates to focus element
-+// First clicks at the coordinates to focus an element, then types the text
-+// Returns true if the operation succeeded
-+bool TypeAtCoordinatesWithDetection(content::WebContents* web_contents,
++// Draws the same highlight boxes and node-id labels ShowHighlights injects,
++// but directly onto a captured bitmap in the browser process. Used by
++// screenshot capture so highlighted captures need no renderer round trip
++// and never mutate the page. |capture_rect_css| is the page region (CSS
++// pixels, viewport-relative) the bitmap covers; node bounds outside it are
++// skipped. When |only_node_ids| is non-null, exactly those nodes are drawn
++// (no viewport or interactivity filtering — the caller picked them);
++// otherwise every in-viewport interactive element is.
++void DrawHighlightsOnBitmap(
++    SkBitmap* bitmap,
++    const std::vector<NodeInfo>& nodes,
++    const gfx::RectF& capture_rect_css,
++    bool show_labels = true,
++    const std::unordered_set<uint32_t>* only_node_ids = nullptr);
++
++// Off-thread image pipeline shared by the screenshot paths (the browserOS
++// API and the LLM side panel). All three run fine on the thread pool;
++// SkBitmap pixel buffers are refcounted, so passing by value is cheap.
++
++// Encodes |bitmap| as PNG, or JPEG at |quality| when |use_jpeg| is set.
++// Returns nullopt on encode failure.
++std::optional<std::vector<uint8_t>> EncodeImageBytes(const SkBitmap& bitmap,
++                                                     bool use_jpeg,
++                                                     int quality);
++
++// Encodes |bitmap| and wraps it in a data URL. Returns an empty string on
++// encode failure.
++std::string EncodeScreenshotDataUrl(SkBitmap bitmap,
++                                    bool use_jpeg,
++                                    int quality);
++
++// Converts |bitmap| to the N32 layout the clipboard requires, so the
++// pixel copy happens off the UI thread and
++// ui::ScopedClipboardWriter::WriteImage reuses the buffer without another
++// conversion. Returns an empty bitmap on conversion failure.
++SkBitmap PrepareBitmapForClipboard(SkBitmap bitmap);
++
++// Helper to click at specific coordinates with change detection.
++// Runs the callback with true if the click caused a detectable change.
++// Pure coordinate path: events are synthesized from CSS coordinates and
++// the cached CSS-to-widget scale; no node resolution or AX tree reads.
++void ClickCoordinatesWithDetection(content::WebContents* web_contents,
++                                   const gfx::PointF& point,
++                                   ActionCompleteCallback callback);
++
++// Helper to type text after clicking at coordinates to focus element.
++// First clicks at the coordinates to focus an element (under change
++// detection, so typing starts as soon as the focus lands), then types the
++// text. Pure coordinate path, like ClickCoordinatesWithDetection.
++// Runs the callback with true if the operation succeeded.
++void TypeAtCoordinatesWithDetection(content::WebContents* web_contents,
 +                                    const gfx::PointF& point,
-+                                    const std::string& text);
++                                    const std::string& text,
++                                    ActionCompleteCallback callback);
 +
 +}  // namespace api
 +}  // namespace extensions
@@ -1,24 +1,31 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api_utils.cc b/chrome/browser/extensions/api/browser_os/browser_os_api_utils.cc
 new file mode 100644
-index 0000000000000..0c3a060fc70de
+index 0000000000000..357d724fffaa7
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api_utils.cc
-@@ -0,0 +1,167 @@
+@@ -0,0 +1,372 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
 +
++#include <array>
++#include <atomic>
++
 +#include "base/hash/hash.h"
++#include "base/metrics/histogram_functions.h"
 +#include "base/no_destructor.h"
++#include "base/task/thread_pool.h"
 +#include "base/strings/string_number_conversions.h"
 +#include "base/strings/utf_string_conversions.h"
++#include "chrome/browser/browseros/server/browseros_server_manager.h"
 +#include "chrome/browser/extensions/extension_tab_util.h"
 +#include "chrome/browser/extensions/window_controller.h"
 +#include "chrome/browser/ui/browser.h"
 +#include "chrome/browser/ui/browser_finder.h"
 +#include "chrome/browser/ui/tabs/tab_strip_model.h"
++#include "content/public/browser/render_frame_host.h"
 +#include "content/public/browser/web_contents.h"
 +#include "ui/accessibility/ax_role_properties.h"
 +
@@ -33,13 +40,106 @@ index 0000000000000..0c3a060fc70de
 +NodeInfo::NodeInfo(NodeInfo&&) = default;
 +NodeInfo& NodeInfo::operator=(NodeInfo&&) = default;
 +
-+// Global node ID mappings storage
++// NodeRegistry implementation
++NodeRegistry::NodeRegistry() = default;
++NodeRegistry::~NodeRegistry() = default;
++NodeRegistry::NodeRegistry(NodeRegistry&&) = default;
++NodeRegistry& NodeRegistry::operator=(NodeRegistry&&) = default;
++
++const NodeInfo* NodeRegistry::Find(uint32_t node_id) const {
++  if (node_id == 0 || node_id > nodes.size()) {
++    return nullptr;
++  }
++  const NodeInfo& info = nodes[node_id - 1];
++  return info.ax_node_id != 0 ? &info : nullptr;
++}
++
++void NodeRegistry::BeginRebuild() {
++  ++generation;
++  nodes.clear();
++}
++
++// Global per-tab node registries
 +// Use NoDestructor to avoid exit-time destructor
-+std::unordered_map<int, std::unordered_map<uint32_t, NodeInfo>>& 
-+GetNodeIdMappings() {
-+  static base::NoDestructor<std::unordered_map<int, std::unordered_map<uint32_t, NodeInfo>>> 
-+      g_node_id_mappings;
-+  return *g_node_id_mappings;
++std::unordered_map<int, NodeRegistry>& GetNodeRegistries() {
++  static base::NoDestructor<std::unordered_map<int, NodeRegistry>>
++      g_node_registries;
++  return *g_node_registries;
++}
++
++const NodeInfo* ResolveNodeHandle(int tab_id,
++                                  uint32_t node_id,
++                                  content::WebContents* web_contents,
++                                  std::string* error) {
++  auto tab_it = GetNodeRegistries().find(tab_id);
++  if (tab_it == GetNodeRegistries().end() || tab_it->second.nodes.empty()) {
++    *error = "No snapshot data for this tab";
++    return nullptr;
++  }
++
++  const NodeInfo* info = tab_it->second.Find(node_id);
++  if (!info) {
++    *error = "Node ID not found";
++    return nullptr;
++  }
++
++  // A handle minted before a cross-document navigation indexes cleanly
++  // into the rebuilt registry but names a node in a dead tree; acting on
++  // it would hit whatever now occupies that slot. The tree-id compare
++  // turns that misclick into a cheap error the agent answers with a
++  // fresh snapshot.
++  if (web_contents) {
++    content::RenderFrameHost* rfh = web_contents->GetPrimaryMainFrame();
++    if (rfh && info->ax_tree_id != ui::AXTreeIDUnknown() &&
++        rfh->GetAXTreeID() != info->ax_tree_id) {
++      *error = "Stale nodeId: snapshot predates a navigation";
++      return nullptr;
++    }
++  }
++
++  return info;
++}
++
++// SnapshotGeneration implementation
++SnapshotGeneration::SnapshotGeneration() = default;
++SnapshotGeneration::~SnapshotGeneration() = default;
++SnapshotGeneration::SnapshotGeneration(SnapshotGeneration&&) = default;
++SnapshotGeneration& SnapshotGeneration::operator=(SnapshotGeneration&&) =
++    default;
++
++std::unordered_map<int, SnapshotGeneration>& GetSnapshotGenerations() {
++  static base::NoDestructor<std::unordered_map<int, SnapshotGeneration>>
++      g_snapshot_generations;
++  return *g_snapshot_generations;
++}
++
++namespace internal {
++
++namespace {
++// In-flight snapshot worker tasks: posted but not yet started.
++std::atomic<int> g_snapshot_queue_depth{0};
++}  // namespace
++
++void SnapshotTaskPosted() {
++  const int depth =
++      g_snapshot_queue_depth.fetch_add(1, std::memory_order_relaxed) + 1;
++  base::UmaHistogramCounts100("BrowserOS.Snapshot.QueueDepth", depth);
++}
++
++void SnapshotTaskStarted() {
++  g_snapshot_queue_depth.fetch_sub(1, std::memory_order_relaxed);
++}
++
++}  // namespace internal
++
++scoped_refptr<base::TaskRunner> GetSnapshotTaskRunner() {
++  // USER_BLOCKING: a pending snapshot is the agent's critical path - the
++  // extension cannot plan its next action until the snapshot lands, so its
++  // chunks should not queue behind user-visible or best-effort pool work.
++  static base::NoDestructor<scoped_refptr<base::TaskRunner>> g_runner(
++      base::ThreadPool::CreateTaskRunner(
++          {base::TaskPriority::USER_BLOCKING}));
++  return *g_runner;
 +}
 +
 +std::optional<TabInfo> GetTabFromOptionalId(
@@ -47,6 +147,12 @@ index 0000000000000..0c3a060fc70de
 +    content::BrowserContext* browser_context,
 +    bool include_incognito_information,
 +    std::string* error_message) {
++  // Nearly every browserOS API function resolves its tab here, so this
++  // doubles as the "agent features are in use" signal: kick off a server
++  // launch that startup deferred (no-op without
++  // --browseros-defer-server-start).
++  browseros::BrowserOSServerManager::GetInstance()->EnsureStarted();
++
 +  content::WebContents* web_contents = nullptr;
 +  int tab_id = -1;
 +  
@@ -87,48 +193,147 @@ index 0000000000000..0c3a060fc70de
 +  return TabInfo(web_contents, tab_id);
 +}
 +
++namespace {
++
++// Role lists for the compile-time classification table. These mirror the
++// predicates in ui/accessibility/ax_role_properties.h that the snapshot
++// path used to call per node (IsClickable, the text field roles, roles
++// supporting selection, IsHeading/IsLink/IsImage/IsText); they are spelled
++// out here because those predicates are not constexpr.
++using Role = ax::mojom::Role;
++
++constexpr bool IsTypeableRole(Role role) {
++  return role == Role::kTextField || role == Role::kSearchBox ||
++         role == Role::kTextFieldWithComboBox || role == Role::kSpinButton;
++}
++
++constexpr bool IsSelectableRole(Role role) {
++  return role == Role::kComboBoxSelect || role == Role::kComboBoxMenuButton ||
++         role == Role::kComboBoxGrouping || role == Role::kListBox ||
++         role == Role::kListBoxOption || role == Role::kMenuListOption ||
++         role == Role::kMenuItem || role == Role::kMenuItemCheckBox ||
++         role == Role::kMenuItemRadio || role == Role::kTab ||
++         role == Role::kTreeItem;
++}
++
++constexpr bool IsClickableRole(Role role) {
++  return role == Role::kButton || role == Role::kCheckBox ||
++         role == Role::kColorWell || role == Role::kComboBoxMenuButton ||
++         role == Role::kComboBoxSelect || role == Role::kDate ||
++         role == Role::kDateTime || role == Role::kDisclosureTriangle ||
++         role == Role::kDocBackLink || role == Role::kDocBiblioRef ||
++         role == Role::kDocGlossRef || role == Role::kDocNoteRef ||
++         role == Role::kImeCandidate || role == Role::kInputTime ||
++         role == Role::kLink || role == Role::kListBox ||
++         role == Role::kListBoxOption || role == Role::kMenuItem ||
++         role == Role::kMenuItemCheckBox || role == Role::kMenuItemRadio ||
++         role == Role::kMenuListOption ||
++         role == Role::kPdfActionableHighlight || role == Role::kPopUpButton ||
++         role == Role::kRadioButton || role == Role::kSearchBox ||
++         role == Role::kSlider || role == Role::kSpinButton ||
++         role == Role::kSwitch || role == Role::kTab ||
++         role == Role::kTextField || role == Role::kTextFieldWithComboBox ||
++         role == Role::kToggleButton;
++}
++
++constexpr bool IsHeadingRole(Role role) {
++  return role == Role::kHeading || role == Role::kDocSubtitle;
++}
++
++constexpr bool IsLinkRole(Role role) {
++  return role == Role::kLink || role == Role::kDocBackLink ||
++         role == Role::kDocBiblioRef || role == Role::kDocGlossRef ||
++         role == Role::kDocNoteRef;
++}
++
++constexpr bool IsImageRole(Role role) {
++  return role == Role::kImage || role == Role::kCanvas ||
++         role == Role::kDocCover || role == Role::kGraphicsSymbol ||
++         role == Role::kSvgRoot;
++}
++
++constexpr bool IsTextRole(Role role) {
++  return role == Role::kStaticText || role == Role::kLineBreak ||
++         role == Role::kInlineTextBox;
++}
++
++constexpr size_t kRoleCount =
++    static_cast<size_t>(ax::mojom::Role::kMaxValue) + 1;
++
++constexpr std::array<uint8_t, kRoleCount> BuildRoleFlagsTable() {
++  std::array<uint8_t, kRoleCount> table{};
++  for (size_t i = 0; i < kRoleCount; ++i) {
++    const Role role = static_cast<Role>(i);
++    uint8_t flags = kRoleFlagNone;
++    if (IsTypeableRole(role)) {
++      flags |= kRoleFlagTypeable;
++    }
++    if (IsSelectableRole(role)) {
++      flags |= kRoleFlagSelectable;
++    }
++    if (IsClickableRole(role)) {
++      flags |= kRoleFlagClickable;
++    }
++    if (IsHeadingRole(role)) {
++      flags |= kRoleFlagHeading;
++    }
++    if (IsLinkRole(role)) {
++      flags |= kRoleFlagLink;
++    }
++    if (IsImageRole(role)) {
++      flags |= kRoleFlagImage;
++    }
++    if (IsTextRole(role)) {
++      flags |= kRoleFlagText;
++    }
++    if (role == Role::kVideo) {
++      flags |= kRoleFlagVideo;
++    }
++    table[i] = flags;
++  }
++  return table;
++}
++
++constexpr std::array<uint8_t, kRoleCount> kRoleFlagsTable =
++    BuildRoleFlagsTable();
++
++}  // namespace
++
++uint8_t GetRoleFlags(ax::mojom::Role role) {
++  return kRoleFlagsTable[static_cast<size_t>(role)];
++}
++
 +// Helper to determine if a node is interactive (clickable/typeable/selectable)
 +browser_os::InteractiveNodeType GetInteractiveNodeType(
 +    const ui::AXNodeData& node_data) {
-+  
++
 +  // Skip invisible or ignored nodes early
 +  if (node_data.IsInvisibleOrIgnored()) {
 +    return browser_os::InteractiveNodeType::kOther;
 +  }
 +
-+  // Use built-in IsTextField() and related methods for typeable elements
-+  if (node_data.IsTextField() || 
-+      node_data.IsPasswordField() || 
-+      node_data.IsAtomicTextField() ||
-+      node_data.IsNonAtomicTextField() ||
-+      node_data.IsSpinnerTextField()) {
++  const uint8_t flags = GetRoleFlags(node_data.role);
++
++  // Typeable: atomic text field roles, plus anything the page marked
++  // editable (contenteditable regions surface as generic containers with
++  // the editable/richly-editable states).
++  if ((flags & kRoleFlagTypeable) ||
++      node_data.HasState(ax::mojom::State::kEditable) ||
++      node_data.HasState(ax::mojom::State::kRichlyEditable)) {
 +    return browser_os::InteractiveNodeType::kTypeable;
 +  }
 +
-+  // Use built-in IsSelectable() for selectable elements
-+  if (node_data.IsSelectable()) {
++  if (flags & kRoleFlagSelectable) {
 +    return browser_os::InteractiveNodeType::kSelectable;
 +  }
-+  
-+  // Use built-in IsClickable() method
-+  if (node_data.IsClickable()) {
++
++  // Clickable: roles that are inherently clickable, plus anything exposing
++  // a default action.
++  if ((flags & kRoleFlagClickable) ||
++      node_data.HasAction(ax::mojom::Action::kDoDefault)) {
 +    return browser_os::InteractiveNodeType::kClickable;
 +  }
-+  
-+  // Additional check for combobox and list options which might not be caught by IsSelectable
-+  using Role = ax::mojom::Role;
-+  if (node_data.role == Role::kComboBoxSelect ||
-+      node_data.role == Role::kComboBoxMenuButton ||
-+      node_data.role == Role::kComboBoxGrouping ||
-+      node_data.role == Role::kListBox ||
-+      node_data.role == Role::kListBoxOption ||
-+      node_data.role == Role::kMenuListOption ||
-+      node_data.role == Role::kMenuItem ||
-+      node_data.role == Role::kMenuItemCheckBox ||
-+      node_data.role == Role::kMenuItemRadio) {
-+    return browser_os::InteractiveNodeType::kSelectable;
-+  }
-+  
++
 +  return browser_os::InteractiveNodeType::kOther;
 +}
 +
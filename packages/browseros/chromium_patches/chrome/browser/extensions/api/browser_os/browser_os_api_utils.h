@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_api_utils.h b/chrome/browser/extensions/api/browser_os/browser_os_api_utils.h
 new file mode 100644
-index 0000000000000..f4fdcb73186cd
+index 0000000000000..893a027f2520a
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_api_utils.h
-@@ -0,0 +1,80 @@
+@@ -0,0 +1,200 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -14,9 +14,15 @@ index 0000000000000..f4fdcb73186cd
 +#include <optional>
 +#include <string>
 +#include <unordered_map>
++#include <vector>
 +
++#include "base/functional/bind.h"
++#include "base/functional/callback.h"
 +#include "base/memory/raw_ptr.h"
++#include "base/memory/scoped_refptr.h"
++#include "base/task/task_runner.h"
 +#include "base/values.h"
++#include "chrome/browser/browseros/core/browseros_task_annotator.h"
 +#include "chrome/common/extensions/api/browser_os.h"
 +#include "ui/accessibility/ax_node_data.h"
 +#include "ui/accessibility/ax_tree_id.h"
@@ -52,6 +58,7 @@ index 0000000000000..f4fdcb73186cd
 +  NodeInfo(NodeInfo&&);
 +  NodeInfo& operator=(NodeInfo&&);
 +
++  // 0 marks an unfilled registry slot (real AX node ids are nonzero).
 +  int32_t ax_node_id;
 +  ui::AXTreeID ax_tree_id;  // Tree ID for change detection
 +  gfx::RectF bounds;  // Absolute bounds in CSS pixels
@@ -60,9 +67,67 @@ index 0000000000000..f4fdcb73186cd
 +  bool in_viewport;  // Whether the node is currently visible in viewport
 +};
 +
-+// Global node ID mappings storage
-+std::unordered_map<int, std::unordered_map<uint32_t, NodeInfo>>& 
-+GetNodeIdMappings();
++// Per-tab registry of the nodes the last snapshot emitted. Node ids are
++// dense (1..N, assigned positionally by the SnapshotProcessor), so the
++// registry is a plain vector indexed by id - 1: resolving an action
++// target is one bounds check and one array load. |generation| is bumped
++// on every rebuild; a handle from an earlier generation either falls
++// outside the vector or is caught by the tree-id check in
++// ResolveNodeHandle() before an action lands on the wrong node.
++struct NodeRegistry {
++  NodeRegistry();
++  ~NodeRegistry();
++  NodeRegistry(NodeRegistry&&);
++  NodeRegistry& operator=(NodeRegistry&&);
++
++  uint32_t generation = 0;
++  std::vector<NodeInfo> nodes;
++
++  // O(1) handle lookup. Returns nullptr when |node_id| is out of range
++  // or names a slot the processor skipped.
++  const NodeInfo* Find(uint32_t node_id) const;
++
++  // Clears the node list and starts a new generation; called once per
++  // snapshot rebuild before the processor repopulates the slots.
++  void BeginRebuild();
++};
++
++// Global per-tab node registries.
++std::unordered_map<int, NodeRegistry>& GetNodeRegistries();
++
++// Resolves an action's node handle. Returns nullptr and fills |error|
++// with a caller-facing message when there is no snapshot for the tab,
++// the id is unknown, or the handle's tree no longer matches the tab's
++// current accessibility tree (a snapshot taken before a navigation) -
++// the caller should answer with the error instead of acting, and the
++// agent re-snapshots. |web_contents| may be null to skip the tree check.
++const NodeInfo* ResolveNodeHandle(int tab_id,
++                                  uint32_t node_id,
++                                  content::WebContents* web_contents,
++                                  std::string* error);
++
++// Signature of the last interactive snapshot taken for a tab, used by
++// getInteractiveSnapshot's delta mode to answer "what changed since the
++// caller's token" without re-serializing unchanged nodes.
++struct SnapshotGeneration {
++  SnapshotGeneration();
++  ~SnapshotGeneration();
++  SnapshotGeneration(SnapshotGeneration&&);
++  SnapshotGeneration& operator=(SnapshotGeneration&&);
++
++  // Opaque token handed back to the extension.
++  std::string token;
++  // Tree the snapshot was computed from; deltas are only valid against the
++  // same tree.
++  ui::AXTreeID tree_id;
++  // nodeId -> content hash of the serialized node. A node counts as changed
++  // when its hash differs (the hash covers name, type, bounds, attributes
++  // and the backing AX node id, so identity changes also show up).
++  std::unordered_map<uint32_t, size_t> node_hashes;
++};
++
++// Last snapshot generation per tab id.
++std::unordered_map<int, SnapshotGeneration>& GetSnapshotGenerations();
 +
 +// Helper to get WebContents and tab ID from optional tab_id parameter
 +// Returns nullptr if tab is not found, with error message set
@@ -72,6 +137,27 @@ index 0000000000000..f4fdcb73186cd
 +    bool include_incognito_information,
 +    std::string* error_message);
 +
++// Role classification bits looked up from a compile-time table indexed by
++// ax::mojom::Role. Node classification is on the snapshot hot path (it runs
++// once per AX node per snapshot), so it must stay an array load plus a few
++// state-bit tests rather than a chain of predicate calls.
++enum RoleFlags : uint8_t {
++  kRoleFlagNone = 0,
++  // Interaction classes used by GetInteractiveNodeType().
++  kRoleFlagTypeable = 1 << 0,
++  kRoleFlagSelectable = 1 << 1,
++  kRoleFlagClickable = 1 << 2,
++  // Content classes used by ContentProcessor::TraverseDFS().
++  kRoleFlagHeading = 1 << 3,
++  kRoleFlagLink = 1 << 4,
++  kRoleFlagImage = 1 << 5,
++  kRoleFlagText = 1 << 6,
++  kRoleFlagVideo = 1 << 7,
++};
++
++// Returns the RoleFlags for |role| with a single table load.
++uint8_t GetRoleFlags(ax::mojom::Role role);
++
 +// Helper to determine if a node is interactive (clickable/typable)
 +browser_os::InteractiveNodeType GetInteractiveNodeType(
 +    const ui::AXNodeData& node_data);
@@ -79,9 +165,42 @@ index 0000000000000..f4fdcb73186cd
 +// Helper to get the HTML tag name from AX role
 +std::string GetTagFromRole(ax::mojom::Role role);
 +
++namespace internal {
++
++// Queue-depth accounting behind WrapSnapshotTask(); records the
++// BrowserOS.Snapshot.QueueDepth histogram at post time.
++void SnapshotTaskPosted();
++void SnapshotTaskStarted();
++
++}  // namespace internal
++
++// Returns the dedicated USER_BLOCKING task runner that snapshot and content
++// processing workers post to. A dedicated runner keeps agent-critical
++// snapshot chunks from queueing behind the browser's best-effort and
++// user-visible pool work; it is deliberately parallel rather than
++// sequenced, because both processors fan a snapshot out across several
++// workers at once.
++scoped_refptr<base::TaskRunner> GetSnapshotTaskRunner();
++
++// Wraps a worker task headed for GetSnapshotTaskRunner(): posts are counted
++// into a queue-depth gauge (decremented when the task starts) and bracketed
++// by the "Snapshot" browseros task annotation, so both queue depth and
++// queue delay for snapshot work are visible in UMA and tracing.
++template <typename ReturnType>
++base::OnceCallback<ReturnType()> WrapSnapshotTask(
++    base::OnceCallback<ReturnType()> task) {
++  internal::SnapshotTaskPosted();
++  return browseros::AnnotateTask(
++      "Snapshot",
++      base::BindOnce(
++          [](base::OnceCallback<ReturnType()> task) -> ReturnType {
++            internal::SnapshotTaskStarted();
++            return std::move(task).Run();
++          },
++          std::move(task)));
++}
 +
 +}  // namespace api
 +}  // namespace extensions
 +
 +#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_API_UTILS_H_
-\ No newline at end of file
@@ -1,18 +1,31 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_change_detector.cc b/chrome/browser/extensions/api/browser_os/browser_os_change_detector.cc
 new file mode 100644
-index 0000000000000..ea45bebcce461
+index 0000000000000..b4d96b1bf4914
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_change_detector.cc
-@@ -0,0 +1,205 @@
+@@ -0,0 +1,515 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/extensions/api/browser_os/browser_os_change_detector.h"
 +
++#include <algorithm>
++#include <atomic>
++
 +#include "base/functional/bind.h"
 +#include "base/logging.h"
-+#include "base/run_loop.h"
++#include "base/metrics/histogram_functions.h"
++#include "base/no_destructor.h"
++#include "base/strings/strcat.h"
++#include "base/trace_event/memory_allocator_dump.h"
++#include "base/trace_event/memory_dump_manager.h"
++#include "base/trace_event/memory_dump_provider.h"
++#include "base/trace_event/process_memory_dump.h"
++#include "base/trace_event/trace_event.h"
++#include "base/values.h"
++#include "chrome/browser/browseros/core/browseros_step_profiler.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_tree_cache.h"
 +#include "content/public/browser/focused_node_details.h"
 +#include "content/public/browser/navigation_handle.h"
 +#include "content/public/browser/render_frame_host.h"
@@ -22,20 +35,142 @@ index 0000000000000..ea45bebcce461
 +namespace extensions {
 +namespace api {
 +
++namespace {
++
++// Bounds on the sample ring and the derived adaptive timeout. The margin
++// covers jitter above the observed p95; the clamps keep a single bad sample
++// from producing an absurd wait and guarantee slow pages still get a
++// meaningfully longer window than the old fixed 300ms.
++constexpr size_t kMaxResponseSamples = 50;
++constexpr size_t kMinSamplesForAdaptiveTimeout = 5;
++constexpr base::TimeDelta kAdaptiveTimeoutMargin = base::Milliseconds(50);
++constexpr base::TimeDelta kMinAdaptiveTimeout = base::Milliseconds(50);
++constexpr base::TimeDelta kMaxAdaptiveTimeout = base::Milliseconds(1000);
++
++// How long the page must stay quiet after the first relevant change before
++// the result is reported. Coalesces event bursts from busy pages while
++// staying well under the detection timeouts.
++constexpr base::TimeDelta kChangeQuietPeriod = base::Milliseconds(75);
++
++// Count of live detectors for the memory-infra dump below. One persistent
++// detector lives on each WebContents that has performed an action and dies
++// with it, so the count in chrome://memory-internals tracks the tab
++// population; growth beyond open tabs means detectors are being leaked.
++std::atomic<int> g_live_detector_count{0};
++
++// Reports the detector population under "browseros/change_detector".
++// Registered without a task runner; it only reads the atomic above.
++class ChangeDetectorMemoryDumpProvider
++    : public base::trace_event::MemoryDumpProvider {
++ public:
++  static void EnsureRegistered() {
++    static base::NoDestructor<ChangeDetectorMemoryDumpProvider> instance;
++  }
++
++  ChangeDetectorMemoryDumpProvider(const ChangeDetectorMemoryDumpProvider&) =
++      delete;
++  ChangeDetectorMemoryDumpProvider& operator=(
++      const ChangeDetectorMemoryDumpProvider&) = delete;
++
++  // base::trace_event::MemoryDumpProvider:
++  bool OnMemoryDump(const base::trace_event::MemoryDumpArgs& args,
++                    base::trace_event::ProcessMemoryDump* pmd) override {
++    const int count = g_live_detector_count.load(std::memory_order_relaxed);
++    auto* dump = pmd->CreateAllocatorDump("browseros/change_detector");
++    dump->AddScalar(base::trace_event::MemoryAllocatorDump::kNameSize,
++                    base::trace_event::MemoryAllocatorDump::kUnitsBytes,
++                    count * sizeof(BrowserOSChangeDetector));
++    dump->AddScalar(base::trace_event::MemoryAllocatorDump::kNameObjectCount,
++                    base::trace_event::MemoryAllocatorDump::kUnitsObjects,
++                    count);
++    return true;
++  }
++
++ private:
++  friend class base::NoDestructor<ChangeDetectorMemoryDumpProvider>;
++
++  ChangeDetectorMemoryDumpProvider() {
++    base::trace_event::MemoryDumpManager::GetInstance()->RegisterDumpProvider(
++        this, "BrowserOSChangeDetector", nullptr);
++  }
++  ~ChangeDetectorMemoryDumpProvider() = default;
++};
++
++}  // namespace
++
++BrowserOSResponseStats::BrowserOSResponseStats(
++    content::WebContents* web_contents)
++    : content::WebContentsUserData<BrowserOSResponseStats>(*web_contents) {}
++
++BrowserOSResponseStats::~BrowserOSResponseStats() = default;
++
++// static
++BrowserOSResponseStats* BrowserOSResponseStats::GetOrCreate(
++    content::WebContents* web_contents) {
++  CreateForWebContents(web_contents);
++  return FromWebContents(web_contents);
++}
++
++void BrowserOSResponseStats::RecordResponseTime(
++    base::TimeDelta response_time) {
++  if (samples_.size() < kMaxResponseSamples) {
++    samples_.push_back(response_time);
++  } else {
++    samples_[next_sample_] = response_time;
++    next_sample_ = (next_sample_ + 1) % kMaxResponseSamples;
++  }
++}
++
++base::TimeDelta BrowserOSResponseStats::GetAdaptiveTimeout(
++    base::TimeDelta default_timeout) const {
++  if (samples_.size() < kMinSamplesForAdaptiveTimeout) {
++    return default_timeout;
++  }
++  base::TimeDelta timeout = GetPercentile(95) + kAdaptiveTimeoutMargin;
++  return std::clamp(timeout, kMinAdaptiveTimeout, kMaxAdaptiveTimeout);
++}
++
++base::TimeDelta BrowserOSResponseStats::GetMedianResponseTime() const {
++  if (samples_.empty()) {
++    return base::TimeDelta();
++  }
++  return GetPercentile(50);
++}
++
++base::TimeDelta BrowserOSResponseStats::GetPercentile(int percentile) const {
++  std::vector<base::TimeDelta> sorted(samples_);
++  const size_t index = sorted.size() * percentile / 100;
++  const size_t clamped = std::min(index, sorted.size() - 1);
++  std::nth_element(sorted.begin(), sorted.begin() + clamped, sorted.end());
++  return sorted[clamped];
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(BrowserOSResponseStats);
++
 +BrowserOSChangeDetector::BrowserOSChangeDetector(content::WebContents* web_contents)
-+    : content::WebContentsObserver(web_contents) {}
++    : content::WebContentsObserver(web_contents),
++      content::WebContentsUserData<BrowserOSChangeDetector>(*web_contents) {
++  ChangeDetectorMemoryDumpProvider::EnsureRegistered();
++  g_live_detector_count.fetch_add(1, std::memory_order_relaxed);
++}
 +
 +BrowserOSChangeDetector::~BrowserOSChangeDetector() {
++  g_live_detector_count.fetch_sub(1, std::memory_order_relaxed);
 +  timeout_timer_.Stop();
++  quiet_timer_.Stop();
++  // The tab died mid-window; report what was observed so the caller's
++  // chain still completes (its WeakPtr checks handle the dead contents).
++  if (result_callback_) {
++    std::move(result_callback_).Run(quiescence_mode_ ? false
++                                                     : change_detected_);
++  }
 +}
 +
-+// Static method for synchronous detection
-+bool BrowserOSChangeDetector::ExecuteWithDetection(
-+    content::WebContents* web_contents,
-+    std::function<void()> action,
-+    base::TimeDelta timeout) {
-+  auto detector = std::make_unique<BrowserOSChangeDetector>(web_contents);
-+  return detector->ExecuteAndWait(std::move(action), timeout);
++// static
++BrowserOSChangeDetector* BrowserOSChangeDetector::GetOrCreate(
++    content::WebContents* web_contents) {
++  CreateForWebContents(web_contents);
++  return FromWebContents(web_contents);
 +}
 +
 +// Static method for asynchronous detection
@@ -43,10 +178,44 @@ index 0000000000000..ea45bebcce461
 +    content::WebContents* web_contents,
 +    std::function<void()> action,
 +    base::OnceCallback<void(bool)> callback,
++    const char* action_name,
++    base::TimeDelta timeout,
++    const ui::AXTreeID& target_tree_id,
++    int32_t target_node_id) {
++  // Re-arm the tab's persistent detector instead of constructing a fresh
++  // observer per action.
++  GetOrCreate(web_contents)
++      ->ExecuteAndNotify(std::move(action), std::move(callback), action_name,
++                         timeout, target_tree_id, target_node_id);
++}
++
++// Static method for asynchronous detection with an adaptive timeout
++void BrowserOSChangeDetector::ExecuteWithAdaptiveDetectionAsync(
++    content::WebContents* web_contents,
++    std::function<void()> action,
++    base::OnceCallback<void(bool)> callback,
++    const char* action_name,
++    base::TimeDelta default_timeout,
++    const ui::AXTreeID& target_tree_id,
++    int32_t target_node_id) {
++  base::TimeDelta timeout =
++      BrowserOSResponseStats::GetOrCreate(web_contents)
++          ->GetAdaptiveTimeout(default_timeout);
++  VLOG(1) << "[browseros] Adaptive detection timeout: "
++          << timeout.InMilliseconds() << "ms";
++  ExecuteWithDetectionAsync(web_contents, std::move(action),
++                            std::move(callback), action_name, timeout,
++                            target_tree_id, target_node_id);
++}
++
++// Static method backing browserOS.waitForStable
++void BrowserOSChangeDetector::WaitForQuiescenceAsync(
++    content::WebContents* web_contents,
++    base::OnceCallback<void(bool)> callback,
++    base::TimeDelta quiet_period,
 +    base::TimeDelta timeout) {
-+  // Create detector on heap - it will delete itself when done
-+  auto* detector = new BrowserOSChangeDetector(web_contents);
-+  detector->ExecuteAndNotify(std::move(action), std::move(callback), timeout);
++  GetOrCreate(web_contents)
++      ->ArmQuiescence(std::move(callback), quiet_period, timeout);
 +}
 +
 +void BrowserOSChangeDetector::StartMonitoring() {
@@ -55,103 +224,227 @@ index 0000000000000..ea45bebcce461
 +  VLOG(1) << "[browseros] Started monitoring for changes";
 +}
 +
-+bool BrowserOSChangeDetector::ExecuteAndWait(std::function<void()> action,
-+                                             base::TimeDelta timeout) {
-+  StartMonitoring();
-+  
-+  // Execute the action
-+  action();
-+  
-+  // If change already detected (synchronously), return immediately
-+  if (change_detected_) {
-+    VLOG(1) << "[browseros] Change detected immediately";
-+    return true;
-+  }
-+  
-+  // Set up run loop to wait for changes
-+  base::RunLoop run_loop(base::RunLoop::Type::kNestableTasksAllowed);
-+  wait_callback_ = run_loop.QuitClosure();
-+  
-+  // Start timeout timer
-+  timeout_timer_.Start(FROM_HERE, timeout,
-+                      base::BindOnce(&BrowserOSChangeDetector::OnTimeout,
-+                                    weak_factory_.GetWeakPtr()));
-+  
-+  // Wait for change or timeout
-+  run_loop.Run();
-+  
-+  // Clean up
-+  timeout_timer_.Stop();
-+  wait_callback_.Reset();
-+  monitoring_ = false;
-+  
-+  VLOG(1) << "[browseros] Change detection result: " << change_detected_;
-+  return change_detected_;
-+}
-+
 +void BrowserOSChangeDetector::ExecuteAndNotify(
 +    std::function<void()> action,
 +    base::OnceCallback<void(bool)> callback,
-+    base::TimeDelta timeout) {
++    const char* action_name,
++    base::TimeDelta timeout,
++    const ui::AXTreeID& target_tree_id,
++    int32_t target_node_id) {
++  if (monitoring_) {
++    // A new action arrived while a window was still open (overlapping
++    // calls on the same tab). Resolve the old window with what it has
++    // observed so its caller isn't left hanging, then re-arm below.
++    VLOG(1) << "[browseros] Re-arming detector with a window still open";
++    NotifyResult(quiescence_mode_ ? false : change_detected_,
++                 Resolution::kAbandoned);
++  }
 +  StartMonitoring();
++  quiescence_mode_ = false;
++  quiet_period_ = kChangeQuietPeriod;
++  action_name_ = action_name;
 +  result_callback_ = std::move(callback);
-+  
-+  // Execute the action
-+  action();
-+  
-+  // If change already detected, notify immediately
-+  if (change_detected_) {
-+    VLOG(1) << "[browseros] Change detected immediately (async)";
-+    std::move(result_callback_).Run(true);
-+    delete this;  // Self-delete
-+    return;
++  target_tree_id_ = target_tree_id;
++  target_node_id_ = target_node_id;
++  action_start_time_ = base::TimeTicks::Now();
++
++  // Spans action dispatch through the change/quiet/timeout resolution;
++  // ended in NotifyResult.
++  TRACE_EVENT_NESTABLE_ASYNC_BEGIN1("browseros", "ChangeDetection",
++                                    TRACE_ID_LOCAL(this), "timeout_ms",
++                                    timeout.InMilliseconds());
++
++  // Execute the action. A synchronously observed change has already started
++  // the quiet timer; the timeout timer backstops both cases.
++  {
++    TRACE_EVENT0("browseros", "ChangeDetection::Action");
++    action();
 +  }
-+  
-+  // Start timeout timer
++  {
++    auto* profiler = browseros::BrowserOSStepProfiler::GetInstance();
++    if (profiler->enabled()) {
++      profiler->RecordPhase("action_dispatch", action_start_time_,
++                            base::TimeTicks::Now());
++    }
++  }
++
 +  timeout_timer_.Start(
 +      FROM_HERE, timeout,
 +      base::BindOnce(&BrowserOSChangeDetector::OnTimeout,
 +                    weak_factory_.GetWeakPtr()));
 +}
 +
++void BrowserOSChangeDetector::ArmQuiescence(
++    base::OnceCallback<void(bool)> callback,
++    base::TimeDelta quiet_period,
++    base::TimeDelta timeout) {
++  if (monitoring_) {
++    VLOG(1) << "[browseros] Re-arming detector with a window still open";
++    NotifyResult(quiescence_mode_ ? false : change_detected_,
++                 Resolution::kAbandoned);
++  }
++  StartMonitoring();
++  quiescence_mode_ = true;
++  quiet_period_ = quiet_period;
++  action_name_ = "WaitForStable";
++  target_tree_id_ = ui::AXTreeIDUnknown();
++  target_node_id_ = kNoTargetNode;
++  result_callback_ = std::move(callback);
++  action_start_time_ = base::TimeTicks::Now();
++
++  TRACE_EVENT_NESTABLE_ASYNC_BEGIN1("browseros", "ChangeDetection",
++                                    TRACE_ID_LOCAL(this), "quiescence_ms",
++                                    timeout.InMilliseconds());
++
++  // The quiet clock only runs once the tab has finished loading; a page
++  // mid-load is by definition not stable. DidStopLoading starts it then.
++  if (web_contents() && !web_contents()->IsLoading()) {
++    StartQuietClock();
++  }
++
++  timeout_timer_.Start(FROM_HERE, timeout,
++                       base::BindOnce(&BrowserOSChangeDetector::OnTimeout,
++                                      weak_factory_.GetWeakPtr()));
++}
++
++bool BrowserOSChangeDetector::IsRelevantChange(
++    const ui::AXUpdatesAndEvents& details) const {
++  if (target_node_id_ == kNoTargetNode) {
++    return true;
++  }
++
++  // Mutations in another frame's tree can't be the acted-on subtree.
++  if (details.ax_tree_id != target_tree_id_) {
++    return false;
++  }
++
++  // Without a usable cached tree, subtree membership can't be decided;
++  // err on the side of counting the change rather than missing it.
++  BrowserOSTreeCache* cache =
++      web_contents() ? BrowserOSTreeCache::FromWebContents(web_contents())
++                     : nullptr;
++  if (!cache || !cache->valid()) {
++    return true;
++  }
++
++  for (const ui::AXTreeUpdate& update : details.updates) {
++    for (const ui::AXNodeData& node : update.nodes) {
++      if (node.id == target_node_id_ ||
++          cache->IsDescendantOf(node.id, target_node_id_)) {
++        return true;
++      }
++    }
++  }
++  return false;
++}
++
 +void BrowserOSChangeDetector::OnChangeDetected() {
-+  if (!monitoring_ || change_detected_) {
++  if (!monitoring_) {
 +    return;
 +  }
-+  
-+  change_detected_ = true;
-+  monitoring_ = false;
-+  
-+  VLOG(1) << "[browseros] Change detected";
-+  
-+  // Stop the timeout timer
-+  timeout_timer_.Stop();
-+  
-+  // If synchronous wait, quit the run loop
-+  if (wait_callback_) {
-+    std::move(wait_callback_).Run();
++
++  if (!change_detected_) {
++    change_detected_ = true;
++    VLOG(1) << "[browseros] Change detected";
++
++    // Feed the response-time stats that drive the adaptive timeout. A
++    // quiescence wait dispatched no action, so it contributes no sample.
++    if (!quiescence_mode_ && web_contents() &&
++        !action_start_time_.is_null()) {
++      BrowserOSResponseStats::GetOrCreate(web_contents())
++          ->RecordResponseTime(base::TimeTicks::Now() - action_start_time_);
++    }
 +  }
-+  
-+  // If async, notify callback and self-delete
-+  if (result_callback_) {
-+    std::move(result_callback_).Run(true);
-+    delete this;  // Self-delete for async mode
++
++  // In a quiescence wait the quiet clock doesn't run while the tab is
++  // still loading; DidStopLoading starts it once the load settles.
++  if (quiescence_mode_ && web_contents() && web_contents()->IsLoading()) {
++    return;
++  }
++
++  // Coalesce bursts: one result covers the whole cascade the action set
++  // off, and the timeout timer caps how long a noisy page can keep the
++  // window open. Heavy mutation (infinite scroll, big relayouts) delivers
++  // hundreds of AX batches a second, so the per-event cost here is a
++  // timestamp write; the quiet clock extends itself from it instead of
++  // being restarted on every event.
++  last_relevant_event_time_ = base::TimeTicks::Now();
++  if (!quiet_timer_.IsRunning()) {
++    StartQuietClock();
 +  }
 +}
 +
++void BrowserOSChangeDetector::StartQuietClock() {
++  last_relevant_event_time_ = base::TimeTicks::Now();
++  quiet_timer_.Start(FROM_HERE, quiet_period_,
++                     base::BindOnce(&BrowserOSChangeDetector::OnQuietTimer,
++                                    weak_factory_.GetWeakPtr()));
++}
++
++void BrowserOSChangeDetector::OnQuietTimer() {
++  // Events that arrived while the timer ran pushed the quiet deadline
++  // out; sleep for the remainder rather than reporting early.
++  const base::TimeDelta since_last =
++      base::TimeTicks::Now() - last_relevant_event_time_;
++  if (since_last < quiet_period_) {
++    quiet_timer_.Start(FROM_HERE, quiet_period_ - since_last,
++                       base::BindOnce(&BrowserOSChangeDetector::OnQuietTimer,
++                                      weak_factory_.GetWeakPtr()));
++    return;
++  }
++  NotifyResult(true, Resolution::kQuiet);
++}
++
 +void BrowserOSChangeDetector::OnTimeout() {
 +  VLOG(1) << "[browseros] Change detection timeout";
++  // At the deadline an action window reports whatever it saw; a quiescence
++  // wait that got this far never went quiet, so the page isn't stable.
++  NotifyResult(quiescence_mode_ ? false : change_detected_,
++               Resolution::kTimeout);
++}
++
++void BrowserOSChangeDetector::NotifyResult(bool changed,
++                                           Resolution resolution) {
 +  monitoring_ = false;
-+  
-+  // If synchronous wait, quit the run loop
-+  if (wait_callback_) {
-+    std::move(wait_callback_).Run();
++  timeout_timer_.Stop();
++  quiet_timer_.Stop();
++
++  // Histograms keyed per action type so Click timeouts are separable from
++  // Type or WaitForStable ones. TimedOut is recorded on every resolved
++  // window (the rate needs both outcomes); WaitTime only on windows that
++  // went quiet, where the duration reflects how long the page actually
++  // took rather than the configured deadline. Fleet percentiles of these
++  // are the data the fixed timeout values get tuned against.
++  if (resolution != Resolution::kAbandoned) {
++    base::UmaHistogramBoolean(
++        base::StrCat({"BrowserOS.ChangeDetection.", action_name_,
++                      ".TimedOut"}),
++        resolution == Resolution::kTimeout);
++    if (resolution == Resolution::kQuiet && !action_start_time_.is_null()) {
++      base::UmaHistogramTimes(
++          base::StrCat({"BrowserOS.ChangeDetection.", action_name_,
++                        ".WaitTime"}),
++          base::TimeTicks::Now() - action_start_time_);
++    }
 +  }
-+  
-+  // If async, notify callback with false and self-delete
++
++  TRACE_EVENT_NESTABLE_ASYNC_END1("browseros", "ChangeDetection",
++                                  TRACE_ID_LOCAL(this), "changed", changed);
++
++  // The wait slice spans action dispatch through change/quiet/timeout
++  // resolution in the exported step timeline.
++  auto* profiler = browseros::BrowserOSStepProfiler::GetInstance();
++  if (profiler->enabled() && !action_start_time_.is_null()) {
++    base::Value::Dict args;
++    args.Set("changed", changed);
++    profiler->RecordPhase("change_wait", action_start_time_,
++                          base::TimeTicks::Now(), std::move(args));
++  }
++
++  // Notify the callback; the detector stays attached to the tab for the
++  // next arm.
 +  if (result_callback_) {
-+    std::move(result_callback_).Run(false);
-+    delete this;  // Self-delete for async mode
++    std::move(result_callback_).Run(changed);
 +  }
 +}
 +
@@ -160,12 +453,20 @@ index 0000000000000..ea45bebcce461
 +void BrowserOSChangeDetector::AccessibilityEventReceived(
 +    const ui::AXUpdatesAndEvents& details) {
 +  if (!monitoring_) return;
-+  
-+  // Any accessibility event indicates a change
-+  if (!details.updates.empty() || !details.events.empty()) {
-+    VLOG(2) << "[browseros] Accessibility event detected";
-+    OnChangeDetected();
++
++  if (details.updates.empty() && details.events.empty()) {
++    return;
 +  }
++
++  // Ignore mutations outside the acted-on subtree (rotating ads, ticking
++  // clocks) when a target node was supplied.
++  if (!IsRelevantChange(details)) {
++    VLOG(2) << "[browseros] Ignoring accessibility event outside target subtree";
++    return;
++  }
++
++  VLOG(2) << "[browseros] Accessibility event detected";
++  OnChangeDetected();
 +}
 +
 +void BrowserOSChangeDetector::DidFinishNavigation(
@@ -176,6 +477,13 @@ index 0000000000000..ea45bebcce461
 +  OnChangeDetected();
 +}
 +
++void BrowserOSChangeDetector::DidStopLoading() {
++  if (!monitoring_ || !quiescence_mode_) return;
++
++  VLOG(2) << "[browseros] Load finished; starting quiescence quiet clock";
++  StartQuietClock();
++}
++
 +void BrowserOSChangeDetector::DOMContentLoaded(
 +    content::RenderFrameHost* render_frame_host) {
 +  if (!monitoring_) return;
@@ -207,6 +515,7 @@ index 0000000000000..ea45bebcce461
 +  OnChangeDetected();
 +}
 +
++WEB_CONTENTS_USER_DATA_KEY_IMPL(BrowserOSChangeDetector);
++
 +}  // namespace api
 +}  // namespace extensions
-\ No newline at end of file
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_change_detector.h b/chrome/browser/extensions/api/browser_os/browser_os_change_detector.h
 new file mode 100644
-index 0000000000000..a45117498c829
+index 0000000000000..5021bb50296d2
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_change_detector.h
-@@ -0,0 +1,108 @@
+@@ -0,0 +1,266 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,12 +12,15 @@ index 0000000000000..a45117498c829
 +#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_CHANGE_DETECTOR_H_
 +
 +#include <functional>
++#include <vector>
 +
 +#include "base/functional/callback.h"
 +#include "base/memory/weak_ptr.h"
 +#include "base/time/time.h"
 +#include "base/timer/timer.h"
 +#include "content/public/browser/web_contents_observer.h"
++#include "content/public/browser/web_contents_user_data.h"
++#include "ui/accessibility/ax_tree_id.h"
 +
 +namespace content {
 +class WebContents;
@@ -30,49 +33,158 @@ index 0000000000000..a45117498c829
 +namespace extensions {
 +namespace api {
 +
++// Per-WebContents statistics on how quickly a page reacts to input. The
++// change detector records the time from action dispatch to the first
++// observed change; the adaptive timeout derives a wait window from those
++// samples so fast pages don't sit out the full fixed timeout and slow
++// pages don't time out spuriously.
++class BrowserOSResponseStats
++    : public content::WebContentsUserData<BrowserOSResponseStats> {
++ public:
++  BrowserOSResponseStats(const BrowserOSResponseStats&) = delete;
++  BrowserOSResponseStats& operator=(const BrowserOSResponseStats&) = delete;
++  ~BrowserOSResponseStats() override;
++
++  // Returns the stats for |web_contents|, creating them if needed.
++  static BrowserOSResponseStats* GetOrCreate(
++      content::WebContents* web_contents);
++
++  // Records the time from action dispatch to the first detected change.
++  void RecordResponseTime(base::TimeDelta response_time);
++
++  // Returns the 95th percentile of recorded response times plus a margin,
++  // clamped to sane bounds. Falls back to |default_timeout| until enough
++  // samples have been recorded.
++  base::TimeDelta GetAdaptiveTimeout(base::TimeDelta default_timeout) const;
++
++  // Median of recorded response times; zero until samples exist. Useful
++  // for logging and diagnostics.
++  base::TimeDelta GetMedianResponseTime() const;
++
++ private:
++  explicit BrowserOSResponseStats(content::WebContents* web_contents);
++  friend class content::WebContentsUserData<BrowserOSResponseStats>;
++
++  // Returns the |percentile| (0-100) of the recorded samples.
++  base::TimeDelta GetPercentile(int percentile) const;
++
++  // Recent samples in a bounded ring; |next_sample_| is the slot the next
++  // sample overwrites once the ring is full.
++  std::vector<base::TimeDelta> samples_;
++  size_t next_sample_ = 0;
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
 +// Change detector that monitors if any change occurred in the web content
 +// after an action is performed. This is used to verify that actions like
 +// click, type, clear, etc. actually had an effect on the page.
-+class BrowserOSChangeDetector : public content::WebContentsObserver {
++//
++// One persistent detector lives on each WebContents and is re-armed per
++// action, so the WebContentsObserver registration is set up once per tab
++// instead of being torn down and re-created at every action — at tens of
++// actions per session across many tabs that churn adds up. Persistence is
++// also what lets per-tab state like BrowserOSResponseStats accumulate
++// alongside it.
++class BrowserOSChangeDetector
++    : public content::WebContentsObserver,
++      public content::WebContentsUserData<BrowserOSChangeDetector> {
 + public:
-+  // Execute an action and detect if it causes any change in the page
-+  // Returns true if any change was detected within the timeout period
-+  static bool ExecuteWithDetection(
++  // Sentinel meaning "don't scope detection to a node subtree".
++  static constexpr int32_t kNoTargetNode = 0;
++
++  ~BrowserOSChangeDetector() override;
++
++  BrowserOSChangeDetector(const BrowserOSChangeDetector&) = delete;
++  BrowserOSChangeDetector& operator=(const BrowserOSChangeDetector&) = delete;
++
++  // Execute an action and detect if it causes any change in the page.
++  // The callback is invoked with true if any change was detected within the
++  // timeout period. Detection never blocks the UI thread. Arming while a
++  // window is still open resolves that window first with whatever it has
++  // observed, so an overlapping caller is never left hanging.
++  //
++  // When |target_node_id| identifies the acted-on node, accessibility
++  // mutations outside that node's subtree (rotating ads, ticking clocks)
++  // are ignored, so only the action's own effect counts as a change.
++  // Event bursts are coalesced: the callback fires once the page has been
++  // quiet briefly after the first relevant change, or at the timeout.
++  //
++  // |action_name| keys the wait-time and timeout-rate histograms this
++  // window records (e.g. "Click", "Type"); it must point at a string
++  // literal since the detector holds it across the async window.
++  static void ExecuteWithDetectionAsync(
 +      content::WebContents* web_contents,
 +      std::function<void()> action,
-+      base::TimeDelta timeout = base::Milliseconds(300));
++      base::OnceCallback<void(bool)> callback,
++      const char* action_name,
++      base::TimeDelta timeout = base::Milliseconds(300),
++      const ui::AXTreeID& target_tree_id = ui::AXTreeIDUnknown(),
++      int32_t target_node_id = kNoTargetNode);
 +
-+  // Alternative async version that doesn't block
-+  static void ExecuteWithDetectionAsync(
++  // Like ExecuteWithDetectionAsync, but derives the timeout from the page's
++  // observed responsiveness (see BrowserOSResponseStats). |default_timeout|
++  // is used until enough samples have been recorded for this WebContents.
++  static void ExecuteWithAdaptiveDetectionAsync(
 +      content::WebContents* web_contents,
 +      std::function<void()> action,
 +      base::OnceCallback<void(bool)> callback,
-+      base::TimeDelta timeout = base::Milliseconds(300));
++      const char* action_name,
++      base::TimeDelta default_timeout = base::Milliseconds(300),
++      const ui::AXTreeID& target_tree_id = ui::AXTreeIDUnknown(),
++      int32_t target_node_id = kNoTargetNode);
 +
-+  // Constructor and destructor are public for use by factory methods
-+  explicit BrowserOSChangeDetector(content::WebContents* web_contents);
-+  ~BrowserOSChangeDetector() override;
++  // The inverse of a detection window: resolves |callback| with true once
++  // the tab has finished loading and its accessibility stream has stayed
++  // quiet for |quiet_period|, or with false when |timeout| passes with the
++  // page still churning. Backs browserOS.waitForStable; reuses the same
++  // persistent observer and timers the action windows use.
++  static void WaitForQuiescenceAsync(content::WebContents* web_contents,
++                                     base::OnceCallback<void(bool)> callback,
++                                     base::TimeDelta quiet_period,
++                                     base::TimeDelta timeout);
 +
 + private:
-+  BrowserOSChangeDetector(const BrowserOSChangeDetector&) = delete;
-+  BrowserOSChangeDetector& operator=(const BrowserOSChangeDetector&) = delete;
++  explicit BrowserOSChangeDetector(content::WebContents* web_contents);
++  friend class content::WebContentsUserData<BrowserOSChangeDetector>;
++
++  // Returns the detector for |web_contents|, creating it on first use.
++  static BrowserOSChangeDetector* GetOrCreate(
++      content::WebContents* web_contents);
 +
 +  // Start monitoring for changes
 +  void StartMonitoring();
 +
-+  // Execute the action and wait for changes
-+  bool ExecuteAndWait(std::function<void()> action, base::TimeDelta timeout);
++  // How an open window was resolved; drives what the wait-time and
++  // timeout-rate histograms record. An abandoned window (re-arm or tab
++  // teardown mid-window) records nothing - its duration reflects the
++  // interruption, not the page.
++  enum class Resolution { kQuiet, kTimeout, kAbandoned };
 +
 +  // Execute the action and notify via callback
 +  void ExecuteAndNotify(std::function<void()> action,
 +                        base::OnceCallback<void(bool)> callback,
-+                        base::TimeDelta timeout);
++                        const char* action_name,
++                        base::TimeDelta timeout,
++                        const ui::AXTreeID& target_tree_id,
++                        int32_t target_node_id);
++
++  // Arms a quiescence wait (see WaitForQuiescenceAsync).
++  void ArmQuiescence(base::OnceCallback<void(bool)> callback,
++                     base::TimeDelta quiet_period,
++                     base::TimeDelta timeout);
++
++  // Returns true when the accessibility event batch touches the target
++  // subtree (or no target is set). Falls back to "relevant" when subtree
++  // membership can't be determined from the cached tree.
++  bool IsRelevantChange(const ui::AXUpdatesAndEvents& details) const;
 +
 +  // WebContentsObserver overrides - we monitor any of these as "changes"
 +  void AccessibilityEventReceived(
 +      const ui::AXUpdatesAndEvents& details) override;
 +  void DidFinishNavigation(
 +      content::NavigationHandle* navigation_handle) override;
++  void DidStopLoading() override;
 +  void DOMContentLoaded(
 +      content::RenderFrameHost* render_frame_host) override;
 +  void OnFocusChangedInPage(
@@ -87,29 +199,74 @@ index 0000000000000..a45117498c829
 +      bool started_from_context_menu,
 +      bool renderer_initiated) override;
 +
-+  // Called when any change is detected
++  // Called when a relevant change is detected. Bumps the last-event
++  // timestamp the quiet clock extends itself from.
 +  void OnChangeDetected();
 +
++  // Starts the quiet clock from "now". The timer is not restarted per
++  // event; OnQuietTimer() re-checks the last-event timestamp when it
++  // fires and sleeps for the remainder if events kept arriving, so a
++  // mutation storm costs one timestamp write per event.
++  void StartQuietClock();
++  void OnQuietTimer();
++
 +  // Called when timeout expires
 +  void OnTimeout();
 +
++  // Stops monitoring, records the window's histograms (unless abandoned)
++  // and runs the result callback; the detector stays attached to the tab,
++  // ready for the next arm.
++  void NotifyResult(bool changed, Resolution resolution);
++
 +  // Simple state tracking
 +  bool monitoring_ = false;
 +  bool change_detected_ = false;
++
++  // True when the open window is a quiescence wait rather than an action
++  // window: quiet means stable (report true), the deadline passing means
++  // still churning (report false), and no response-time sample is fed to
++  // the adaptive-timeout stats.
++  bool quiescence_mode_ = false;
++
++  // Quiet period for the open window; action windows use the fixed
++  // kChangeQuietPeriod, quiescence waits take it from the caller.
++  base::TimeDelta quiet_period_;
++
++  // When the monitored action was dispatched; used to feed
++  // BrowserOSResponseStats when a change is detected.
++  base::TimeTicks action_start_time_;
++
++  // Histogram key for the open window; always a string literal supplied
++  // by the arming caller ("Click", "WaitForStable", ...).
++  const char* action_name_ = "Action";
++
++  // Subtree scope for relevance filtering; kNoTargetNode means any
++  // accessibility mutation counts.
++  ui::AXTreeID target_tree_id_ = ui::AXTreeIDUnknown();
++  int32_t target_node_id_ = kNoTargetNode;
 +  
-+  // Callbacks
-+  base::OnceClosure wait_callback_;
++  // Callback notified with the detection result
 +  base::OnceCallback<void(bool)> result_callback_;
 +  
 +  // Timer for timeout
 +  base::OneShotTimer timeout_timer_;
-+  
++
++  // Fires once per quiet period and extends itself while events keep
++  // arriving (see OnQuietTimer); settling means the result can be
++  // reported without waiting out the full timeout.
++  base::OneShotTimer quiet_timer_;
++
++  // When the last relevant event was observed; the quiet clock reports
++  // quiet once this is more than quiet_period_ old.
++  base::TimeTicks last_relevant_event_time_;
++
 +  // Weak pointer factory
 +  base::WeakPtrFactory<BrowserOSChangeDetector> weak_factory_{this};
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
 +};
 +
 +}  // namespace api
 +}  // namespace extensions
 +
 +#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_CHANGE_DETECTOR_H_
-\ No newline at end of file
@@ -0,0 +1,166 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_change_recorder.cc b/chrome/browser/extensions/api/browser_os/browser_os_change_recorder.cc
+new file mode 100644
+index 0000000000000..741b1b617b043
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_change_recorder.cc
+@@ -0,0 +1,160 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_change_recorder.h"
++
++#include <utility>
++
++#include "base/logging.h"
++#include "chrome/browser/extensions/extension_tab_util.h"
++#include "chrome/common/extensions/api/browser_os.h"
++#include "content/public/browser/browser_accessibility_state.h"
++#include "content/public/browser/scoped_accessibility_mode.h"
++#include "content/public/browser/web_contents.h"
++#include "extensions/browser/event_router.h"
++#include "extensions/browser/extension_event_histogram_value.h"
++#include "ui/accessibility/ax_updates_and_events.h"
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Ring capacity. At a few hundred events per second on a busy page this
++// buys several seconds of backlog between drains; beyond that the oldest
++// records are overwritten and surfaced via the dropped count.
++constexpr size_t kMaxChangeRecords = 4096;
++
++}  // namespace
++
++BrowserOSChangeRecorder::BrowserOSChangeRecorder(
++    content::WebContents* web_contents)
++    : content::WebContentsObserver(web_contents),
++      content::WebContentsUserData<BrowserOSChangeRecorder>(*web_contents) {}
++
++BrowserOSChangeRecorder::~BrowserOSChangeRecorder() = default;
++
++// static
++BrowserOSChangeRecorder* BrowserOSChangeRecorder::GetOrCreate(
++    content::WebContents* web_contents) {
++  CreateForWebContents(web_contents);
++  return FromWebContents(web_contents);
++}
++
++void BrowserOSChangeRecorder::StartRecording() {
++  recording_ = true;
++
++  // Keep web accessibility serialization on so the renderer streams the
++  // events the ring buffer is fed from, even when nothing else (snapshot
++  // calls, assistive tech) has enabled it.
++  if (!scoped_mode_) {
++    scoped_mode_ =
++        content::BrowserAccessibilityState::GetInstance()
++            ->CreateScopedModeForWebContents(
++                web_contents(),
++                ui::AXMode(ui::AXMode::kWebContents |
++                           ui::AXMode::kExtendedProperties));
++  }
++
++  VLOG(1) << "[browseros] Change recording started";
++}
++
++void BrowserOSChangeRecorder::StopRecording() {
++  recording_ = false;
++  scoped_mode_.reset();
++  VLOG(1) << "[browseros] Change recording stopped";
++}
++
++std::vector<BrowserOSChangeRecorder::ChangeRecord>
++BrowserOSChangeRecorder::Drain(uint64_t* dropped_count) {
++  *dropped_count = dropped_;
++  dropped_ = 0;
++
++  std::vector<ChangeRecord> records;
++  records.reserve(size_);
++  for (size_t i = 0; i < size_; ++i) {
++    records.push_back(ring_[(head_ + i) % ring_.size()]);
++  }
++  head_ = 0;
++  size_ = 0;
++
++  // The buffer is empty again; the next append may notify.
++  notify_armed_ = true;
++  return records;
++}
++
++void BrowserOSChangeRecorder::AccessibilityEventReceived(
++    const ui::AXUpdatesAndEvents& details) {
++  if (!recording_) {
++    return;
++  }
++
++  const base::Time now = base::Time::Now();
++
++  // One record per explicit event. Tree updates that arrive without any
++  // event (plain mutations) get a single kNone record for the first
++  // changed node, so a thousand-node relayout costs one slot, not a
++  // thousand.
++  for (const ui::AXEvent& event : details.events) {
++    ChangeRecord record;
++    record.tree_id = details.ax_tree_id;
++    record.node_id = event.id;
++    record.event = event.event_type;
++    record.timestamp = now;
++    Append(record);
++  }
++
++  if (details.events.empty()) {
++    for (const ui::AXTreeUpdate& update : details.updates) {
++      if (update.nodes.empty()) {
++        continue;
++      }
++      ChangeRecord record;
++      record.tree_id = details.ax_tree_id;
++      record.node_id = update.nodes[0].id;
++      record.event = ax::mojom::Event::kNone;
++      record.timestamp = now;
++      Append(record);
++    }
++  }
++}
++
++void BrowserOSChangeRecorder::Append(const ChangeRecord& record) {
++  if (ring_.empty()) {
++    ring_.resize(kMaxChangeRecords);
++  }
++
++  if (size_ < ring_.size()) {
++    ring_[(head_ + size_) % ring_.size()] = record;
++    ++size_;
++  } else {
++    // Full: overwrite the oldest record.
++    ring_[head_] = record;
++    head_ = (head_ + 1) % ring_.size();
++    ++dropped_;
++  }
++
++  if (!notify_armed_) {
++    return;
++  }
++  notify_armed_ = false;
++
++  EventRouter* event_router =
++      EventRouter::Get(web_contents()->GetBrowserContext());
++  if (!event_router) {
++    return;
++  }
++  const int tab_id = ExtensionTabUtil::GetTabId(web_contents());
++  // No histogram value assigned for browserOS events yet.
++  auto event = std::make_unique<Event>(
++      events::UNKNOWN, browser_os::OnChangesAvailable::kEventName,
++      browser_os::OnChangesAvailable::Create(tab_id),
++      web_contents()->GetBrowserContext());
++  event_router->BroadcastEvent(std::move(event));
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(BrowserOSChangeRecorder);
++
++}  // namespace api
++}  // namespace extensions
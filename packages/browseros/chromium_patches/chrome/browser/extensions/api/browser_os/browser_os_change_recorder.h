@@ -0,0 +1,113 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_change_recorder.h b/chrome/browser/extensions/api/browser_os/browser_os_change_recorder.h
+new file mode 100644
+index 0000000000000..9ffc182be0b56
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_change_recorder.h
+@@ -0,0 +1,107 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_CHANGE_RECORDER_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_CHANGE_RECORDER_H_
++
++#include <cstdint>
++#include <memory>
++#include <vector>
++
++#include "base/time/time.h"
++#include "content/public/browser/web_contents_observer.h"
++#include "content/public/browser/web_contents_user_data.h"
++#include "ui/accessibility/ax_enums.mojom.h"
++#include "ui/accessibility/ax_tree_id.h"
++
++namespace content {
++class ScopedAccessibilityMode;
++class WebContents;
++}  // namespace content
++
++namespace ui {
++struct AXUpdatesAndEvents;
++}  // namespace ui
++
++namespace extensions {
++namespace api {
++
++// Per-tab ring buffer of compact change records for live-mutation tracking.
++//
++// Dispatching one extension event per accessibility event does not scale:
++// busy pages emit hundreds of AX events per second and each dispatch pays
++// its own serialization, IPC and V8 entry. While watching is enabled, the
++// recorder instead appends fixed-size records (tree id, node id, event
++// type, timestamp) to a bounded ring on the UI thread; the extension
++// drains the whole backlog in one drainChanges call. A single
++// onChangesAvailable notification fires when the buffer goes non-empty and
++// is re-armed by the next drain, so the per-event firehose collapses to
++// one event per drain cycle. When the ring wraps before a drain, the
++// oldest records are overwritten and reported via the dropped count.
++class BrowserOSChangeRecorder
++    : public content::WebContentsObserver,
++      public content::WebContentsUserData<BrowserOSChangeRecorder> {
++ public:
++  struct ChangeRecord {
++    ui::AXTreeID tree_id;
++    int32_t node_id = 0;
++    // kNone marks a plain tree mutation that arrived without an event.
++    ax::mojom::Event event = ax::mojom::Event::kNone;
++    base::Time timestamp;
++  };
++
++  BrowserOSChangeRecorder(const BrowserOSChangeRecorder&) = delete;
++  BrowserOSChangeRecorder& operator=(const BrowserOSChangeRecorder&) = delete;
++  ~BrowserOSChangeRecorder() override;
++
++  // Returns the recorder for |web_contents|, creating it on first use.
++  static BrowserOSChangeRecorder* GetOrCreate(
++      content::WebContents* web_contents);
++
++  // Starts/stops appending records. Starting keeps web accessibility
++  // serialization enabled for the tab so events flow while watched.
++  void StartRecording();
++  void StopRecording();
++
++  bool recording() const { return recording_; }
++
++  // Moves out all buffered records, oldest first. |dropped_count| receives
++  // the number of records overwritten since the last drain. Re-arms the
++  // onChangesAvailable notification.
++  std::vector<ChangeRecord> Drain(uint64_t* dropped_count);
++
++ private:
++  explicit BrowserOSChangeRecorder(content::WebContents* web_contents);
++  friend class content::WebContentsUserData<BrowserOSChangeRecorder>;
++
++  // content::WebContentsObserver:
++  void AccessibilityEventReceived(
++      const ui::AXUpdatesAndEvents& details) override;
++
++  // Appends one record, overwriting the oldest when the ring is full, and
++  // fires the armed notification on the empty -> non-empty transition.
++  void Append(const ChangeRecord& record);
++
++  // Bounded ring; |head_| is the oldest record once |size_| hits capacity.
++  std::vector<ChangeRecord> ring_;
++  size_t head_ = 0;
++  size_t size_ = 0;
++  uint64_t dropped_ = 0;
++
++  bool recording_ = false;
++
++  // True when the next append may dispatch onChangesAvailable; cleared by
++  // that dispatch and set again by Drain.
++  bool notify_armed_ = true;
++
++  // Keeps web accessibility serialization on while recording.
++  std::unique_ptr<content::ScopedAccessibilityMode> scoped_mode_;
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_CHANGE_RECORDER_H_
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_content_processor.cc b/chrome/browser/extensions/api/browser_os/browser_os_content_processor.cc
 new file mode 100644
-index 0000000000000..4166f1a38737c
+index 0000000000000..3ae39515e1dd9
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_content_processor.cc
-@@ -0,0 +1,247 @@
+@@ -0,0 +1,883 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,13 +11,27 @@ index 0000000000000..4166f1a38737c
 +#include "chrome/browser/extensions/api/browser_os/browser_os_content_processor.h"
 +
 +#include <algorithm>
++#include <optional>
++#include <utility>
 +
++#include "base/functional/bind.h"
 +#include "base/logging.h"
++#include "base/memory/ref_counted.h"
++#include "base/memory/weak_ptr.h"
 +#include "base/strings/string_util.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_text_util.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_tree_cache.h"
++#include "content/public/browser/navigation_handle.h"
++#include "content/public/browser/web_contents.h"
++#include "content/public/browser/web_contents_observer.h"
++#include "content/public/browser/web_contents_user_data.h"
 +#include "ui/accessibility/ax_enum_util.h"
 +#include "ui/accessibility/ax_enums.mojom.h"
 +#include "ui/accessibility/ax_node_data.h"
 +#include "ui/accessibility/ax_role_properties.h"
++#include "ui/accessibility/ax_tree_id.h"
++#include "ui/accessibility/ax_updates_and_events.h"
 +#include "ui/gfx/geometry/rect.h"
 +#include "ui/gfx/geometry/rect_conversions.h"
 +
@@ -26,29 +40,244 @@ index 0000000000000..4166f1a38737c
 +
 +namespace {
 +
-+// Clean whitespace from text
-+std::string CleanText(const std::string& text) {
-+  std::string cleaned = std::string(base::TrimWhitespaceASCII(text, base::TRIM_ALL));
-+
-+  // Replace multiple spaces with single space
-+  std::string result;
-+  bool prev_space = false;
-+  for (char c : cleaned) {
-+    if (std::isspace(c)) {
-+      if (!prev_space) {
-+        result += ' ';
-+        prev_space = true;
-+      }
++// Clean whitespace from text. Runs on every extracted name, so the
++// vectorized shared implementation matters on text-heavy pages. Takes a
++// view so callers can pass the node's attribute storage without an
++// intermediate copy; the collapsed result is the only allocation.
++std::string CleanText(std::string_view text) {
++  return CollapseWhitespaceASCII(text);
++}
++
++// Below this many nodes the extraction finishes in well under a task's
++// scheduling overhead, so the parallel path is not worth it.
++constexpr size_t kMinNodesForParallelExtract = 512;
++
++}  // namespace
++
++// Per-tab cache of the last content extraction, split at the same
++// top-level sections ExtractPageContentAsync parallelizes over. Between
++// calls the tab's accessibility event stream marks changed sections dirty
++// (classified against the live tree the BrowserOSTreeCache maintains);
++// the next extraction then re-traverses only those sections and reuses
++// the cached items for the rest. Like the tree cache, this is
++// deliberately conservative: a change that cannot be pinned to a section,
++// a different section split, or a cross-document navigation dirties
++// everything and the caller takes the full path.
++class ContentExtractionCache
++    : public content::WebContentsObserver,
++      public content::WebContentsUserData<ContentExtractionCache> {
++ public:
++  ~ContentExtractionCache() override = default;
++
++  ContentExtractionCache(const ContentExtractionCache&) = delete;
++  ContentExtractionCache& operator=(const ContentExtractionCache&) = delete;
++
++  static ContentExtractionCache* GetOrCreate(
++      content::WebContents* web_contents) {
++    CreateForWebContents(web_contents);
++    return FromWebContents(web_contents);
++  }
++
++  // Called with a fresh renderer snapshot in hand. Returns true and fills
++  // |dirty| (one flag per section) when the stored extraction matches
++  // |tree_id| and |section_roots| and can be patched. The dirty bits reset
++  // now in either case: changes streaming in after this point re-mark
++  // their sections for the next call.
++  bool BeginExtraction(const ui::AXTreeID& tree_id,
++                       int32_t content_root_id,
++                       const std::vector<int32_t>& section_roots,
++                       std::vector<bool>* dirty) {
++    const bool patchable = valid_ && !all_dirty_ && tree_id == tree_id_ &&
++                           section_roots == section_roots_;
++    if (patchable) {
++      *dirty = dirty_;
 +    } else {
-+      result += c;
-+      prev_space = false;
++      // Stored items are unusable until the next Store().
++      valid_ = false;
 +    }
++    tree_id_ = tree_id;
++    content_root_id_ = content_root_id;
++    section_roots_ = section_roots;
++    dirty_.assign(section_roots_.size(), false);
++    all_dirty_ = false;
++    return patchable;
 +  }
 +
-+  return result;
-+}
++  // Saves the freshly extracted per-section items. Dirty bits accumulated
++  // since BeginExtraction are kept: they describe changes this extraction
++  // may have raced with.
++  void Store(const ui::AXTreeID& tree_id,
++             const std::vector<int32_t>& section_roots,
++             const std::vector<std::vector<browser_os::ContentItem>>&
++                 section_items) {
++    if (tree_id != tree_id_ || section_roots != section_roots_) {
++      // A newer extraction began after this one; don't clobber its
++      // bookkeeping with stale results.
++      return;
++    }
++    section_items_.clear();
++    section_items_.reserve(section_items.size());
++    for (const auto& items : section_items) {
++      std::vector<browser_os::ContentItem> copy;
++      copy.reserve(items.size());
++      for (const auto& item : items) {
++        copy.push_back(item.Clone());
++      }
++      section_items_.push_back(std::move(copy));
++    }
++    valid_ = true;
++  }
 +
-+}  // namespace
++  std::vector<browser_os::ContentItem> CloneSection(size_t index) const {
++    std::vector<browser_os::ContentItem> copy;
++    copy.reserve(section_items_[index].size());
++    for (const auto& item : section_items_[index]) {
++      copy.push_back(item.Clone());
++    }
++    return copy;
++  }
++
++ private:
++  explicit ContentExtractionCache(content::WebContents* web_contents)
++      : content::WebContentsObserver(web_contents),
++        content::WebContentsUserData<ContentExtractionCache>(*web_contents) {}
++  friend class content::WebContentsUserData<ContentExtractionCache>;
++
++  // content::WebContentsObserver:
++  void AccessibilityEventReceived(
++      const ui::AXUpdatesAndEvents& details) override {
++    if (section_roots_.empty() || all_dirty_) {
++      return;
++    }
++    // Updates from other frames' trees use a different node-id space, but
++    // their content is still part of the combined snapshot; anything could
++    // have changed.
++    if (details.ax_tree_id != tree_id_) {
++      all_dirty_ = true;
++      return;
++    }
++    auto* tree_cache = BrowserOSTreeCache::FromWebContents(web_contents());
++    if (!tree_cache || !tree_cache->valid()) {
++      all_dirty_ = true;
++      return;
++    }
++    for (const ui::AXTreeUpdate& update : details.updates) {
++      for (const ui::AXNodeData& node : update.nodes) {
++        if (MarkSectionFor(node.id, *tree_cache)) {
++          continue;
++        }
++        // Not in any section. A known node outside the content subtree
++        // can't affect the extracted items (chrome churn - sidebars,
++        // toasts - would otherwise invalidate everything on every poll).
++        // IsDescendantOf(id, id) is true exactly when the live tree knows
++        // the node; unknown nodes and the content root itself stay
++        // conservative.
++        if (content_root_id_ != 0 && node.id != content_root_id_ &&
++            tree_cache->IsDescendantOf(node.id, node.id) &&
++            !tree_cache->IsDescendantOf(node.id, content_root_id_)) {
++          continue;
++        }
++        all_dirty_ = true;
++        return;
++      }
++    }
++  }
++
++  void DidFinishNavigation(
++      content::NavigationHandle* navigation_handle) override {
++    if (!navigation_handle->IsInPrimaryMainFrame() ||
++        !navigation_handle->HasCommitted() ||
++        navigation_handle->IsSameDocument()) {
++      return;
++    }
++    valid_ = false;
++    content_root_id_ = 0;
++    section_roots_.clear();
++    section_items_.clear();
++    dirty_.clear();
++    all_dirty_ = false;
++  }
++
++  // Marks the section containing |node_id| dirty. Returns false when the
++  // node belongs to no known section.
++  bool MarkSectionFor(int32_t node_id, const BrowserOSTreeCache& tree_cache) {
++    for (size_t i = 0; i < section_roots_.size(); ++i) {
++      if (tree_cache.IsDescendantOf(node_id, section_roots_[i])) {
++        dirty_[i] = true;
++        return true;
++      }
++    }
++    return false;
++  }
++
++  ui::AXTreeID tree_id_;
++  // Content landmark the sections were split under; 0 before the first
++  // extraction. Changes outside its subtree don't dirty anything.
++  int32_t content_root_id_ = 0;
++  std::vector<int32_t> section_roots_;
++  std::vector<std::vector<browser_os::ContentItem>> section_items_;
++  std::vector<bool> dirty_;
++  bool all_dirty_ = false;
++  bool valid_ = false;
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(ContentExtractionCache);
++
++// Shared state for one ExtractPageContentAsync call. The node map and
++// section roots are read-only once the workers are posted; each worker
++// holds a ref so the map outlives every section traversal.
++struct ContentProcessor::SectionExtractContext
++    : public base::RefCountedThreadSafe<SectionExtractContext> {
++  SectionExtractContext() = default;
++
++  std::unordered_map<int32_t, ContentNode> node_map;
++  std::vector<int32_t> section_roots;
++
++  // One slot per section, filled on the reply sequence so concatenation
++  // preserves document order regardless of completion order.
++  std::vector<std::vector<browser_os::ContentItem>> section_items;
++  size_t completed = 0;
++  base::OnceCallback<void(std::vector<browser_os::ContentItem>)> callback;
++
++  // Set by the incremental path so FinishSectionExtract stores the results
++  // in the tab's ContentExtractionCache for the next call to patch.
++  bool update_cache = false;
++  base::WeakPtr<content::WebContents> web_contents;
++  ui::AXTreeID tree_id;
++
++ private:
++  friend class base::RefCountedThreadSafe<SectionExtractContext>;
++  ~SectionExtractContext() = default;
++};
++
++// static
++ContentProcessor::ContentNode ContentProcessor::MakeContentNode(
++    const ui::AXNodeData& node) {
++  ContentNode entry;
++  entry.data = node;
++  entry.role_flags = GetRoleFlags(node.role);
++  // One scan over the attribute vector here replaces a scan per getter
++  // call in the traversal.
++  const auto& attrs = entry.data.string_attributes;
++  for (size_t i = 0; i < attrs.size(); ++i) {
++    switch (attrs[i].first) {
++      case ax::mojom::StringAttribute::kName:
++        entry.name_index = static_cast<int32_t>(i);
++        break;
++      case ax::mojom::StringAttribute::kValue:
++        entry.value_index = static_cast<int32_t>(i);
++        break;
++      case ax::mojom::StringAttribute::kUrl:
++        entry.url_index = static_cast<int32_t>(i);
++        break;
++      default:
++        break;
++    }
++  }
++  return entry;
++}
 +
 +// static
 +std::vector<browser_os::ContentItem> ContentProcessor::ExtractPageContent(
@@ -63,14 +292,23 @@ index 0000000000000..4166f1a38737c
 +
 +  LOG(INFO) << "browseros: ExtractPageContent - processing " << tree_update.nodes.size() << " nodes";
 +
-+  // Build node map for O(1) lookup
-+  std::unordered_map<int32_t, ui::AXNodeData> node_map;
++  // Build node map for O(1) lookup, precomputing the hot attribute
++  // positions while each node's payload is in cache anyway.
++  std::unordered_map<int32_t, ContentNode> node_map;
++  node_map.reserve(tree_update.nodes.size());
 +  for (const auto& node : tree_update.nodes) {
-+    node_map[node.id] = node;
++    node_map[node.id] = MakeContentNode(node);
 +  }
 +
-+  // Start DFS from root
-+  TraverseDFS(tree_update.root_id, node_map, items);
++  // Extraction is scoped to the content landmark when the page has one,
++  // so the chrome landmarks around it are never visited.
++  const int32_t extract_root = FindContentRootId(tree_update);
++
++  // Size the output once up front; the pre-count pass touches no strings,
++  // so it costs a fraction of the traversal it saves reallocations in.
++  items.reserve(CountItems(extract_root, node_map));
++
++  TraverseDFS(extract_root, node_map, items);
 +
 +  LOG(INFO) << "browseros: ExtractPageContent - extracted " << items.size() << " items";
 +
@@ -78,9 +316,226 @@ index 0000000000000..4166f1a38737c
 +}
 +
 +// static
++int32_t ContentProcessor::FindContentRootId(
++    const ui::AXTreeUpdate& tree_update) {
++  // Nodes arrive in document order, so the first hit is the outermost
++  // landmark of its kind.
++  int32_t article_id = 0;
++  for (const auto& node : tree_update.nodes) {
++    if (node.role == ax::mojom::Role::kMain) {
++      return node.id;
++    }
++    if (article_id == 0 && node.role == ax::mojom::Role::kArticle) {
++      article_id = node.id;
++    }
++  }
++  return article_id != 0 ? article_id : tree_update.root_id;
++}
++
++// static
++scoped_refptr<ContentProcessor::SectionExtractContext>
++ContentProcessor::MakeSectionContext(const ui::AXTreeUpdate& tree_update,
++                                     int32_t content_root_id) {
++  auto context = base::MakeRefCounted<SectionExtractContext>();
++  context->node_map.reserve(tree_update.nodes.size());
++  for (const auto& node : tree_update.nodes) {
++    context->node_map[node.id] = MakeContentNode(node);
++  }
++
++  // Split at the content root's direct children - its top-level sections.
++  // The sequential traversal would recurse straight through the container
++  // into these children anyway, so per-section results concatenated in
++  // child order match it exactly. A content root that is itself a
++  // semantic boundary (or has nothing to split) goes through the
++  // sequential path instead.
++  auto root_it = context->node_map.find(content_root_id);
++  if (root_it == context->node_map.end() ||
++      root_it->second.role_flags != 0 ||
++      root_it->second.data.child_ids.size() < 2) {
++    return nullptr;
++  }
++
++  context->section_roots = root_it->second.data.child_ids;
++  context->section_items.resize(context->section_roots.size());
++  return context;
++}
++
++// static
++void ContentProcessor::ExtractPageContentAsync(
++    const ui::AXTreeUpdate& tree_update,
++    base::OnceCallback<void(std::vector<browser_os::ContentItem>)> callback) {
++  // Small trees aren't worth the task overhead; handle them inline.
++  if (tree_update.nodes.size() < kMinNodesForParallelExtract) {
++    std::move(callback).Run(ExtractPageContent(tree_update));
++    return;
++  }
++
++  auto context = MakeSectionContext(tree_update, FindContentRootId(tree_update));
++  if (!context) {
++    std::move(callback).Run(ExtractPageContent(tree_update));
++    return;
++  }
++  context->callback = std::move(callback);
++
++  LOG(INFO) << "browseros: ExtractPageContentAsync - "
++            << context->section_roots.size() << " sections, "
++            << tree_update.nodes.size() << " nodes";
++
++  for (size_t i = 0; i < context->section_roots.size(); ++i) {
++    GetSnapshotTaskRunner()->PostTaskAndReplyWithResult(
++        FROM_HERE,
++        WrapSnapshotTask(
++            base::BindOnce(&ContentProcessor::ExtractSection, context, i)),
++        base::BindOnce(&ContentProcessor::OnSectionExtracted, context, i));
++  }
++}
++
++// static
++void ContentProcessor::ExtractPageContentIncrementalAsync(
++    content::WebContents* web_contents,
++    const ui::AXTreeUpdate& tree_update,
++    base::OnceCallback<void(std::vector<browser_os::ContentItem>)> callback) {
++  // Small trees re-extract inline; patching buys nothing there.
++  if (!web_contents ||
++      tree_update.nodes.size() < kMinNodesForParallelExtract) {
++    ExtractPageContentAsync(tree_update, std::move(callback));
++    return;
++  }
++
++  // The content landmark is stable within a document, so resolve it once
++  // per navigation through the tree cache instead of rescanning every
++  // snapshot for it.
++  auto* tree_cache = BrowserOSTreeCache::GetOrCreate(web_contents);
++  int32_t content_root_id = 0;
++  if (!tree_cache->GetContentRoot(&content_root_id)) {
++    content_root_id = FindContentRootId(tree_update);
++    tree_cache->SetContentRoot(content_root_id);
++  }
++
++  auto context = MakeSectionContext(tree_update, content_root_id);
++  if (!context) {
++    std::move(callback).Run(ExtractPageContent(tree_update));
++    return;
++  }
++
++  // Section dirtiness is classified against the live tree, so (re-)seed it
++  // from this snapshot when it went cold. Seeding also pins the scoped
++  // accessibility mode that keeps change events flowing until the next
++  // call.
++  if (!tree_cache->valid()) {
++    tree_cache->SeedFromSnapshot(tree_update,
++                                 /*includes_inline_text_boxes=*/false);
++  }
++
++  context->callback = std::move(callback);
++  context->update_cache = true;
++  context->web_contents = web_contents->GetWeakPtr();
++  context->tree_id = tree_update.has_tree_data ? tree_update.tree_data.tree_id
++                                               : ui::AXTreeID();
++
++  auto* cache = ContentExtractionCache::GetOrCreate(web_contents);
++  std::vector<bool> dirty;
++  if (!cache->BeginExtraction(context->tree_id, content_root_id,
++                              context->section_roots, &dirty)) {
++    LOG(INFO) << "browseros: ExtractPageContentIncrementalAsync - full, "
++              << context->section_roots.size() << " sections, "
++              << tree_update.nodes.size() << " nodes";
++    for (size_t i = 0; i < context->section_roots.size(); ++i) {
++      GetSnapshotTaskRunner()->PostTaskAndReplyWithResult(
++          FROM_HERE,
++          WrapSnapshotTask(
++              base::BindOnce(&ContentProcessor::ExtractSection, context, i)),
++          base::BindOnce(&ContentProcessor::OnSectionExtracted, context, i));
++    }
++    return;
++  }
++
++  // Reuse the cached items for clean sections; re-extract only the dirty
++  // ones.
++  size_t reused = 0;
++  for (size_t i = 0; i < dirty.size(); ++i) {
++    if (!dirty[i]) {
++      context->section_items[i] = cache->CloneSection(i);
++      ++reused;
++    }
++  }
++  context->completed = reused;
++
++  LOG(INFO) << "browseros: ExtractPageContentIncrementalAsync - patching "
++            << (dirty.size() - reused) << " of " << dirty.size()
++            << " sections";
++
++  if (reused == dirty.size()) {
++    FinishSectionExtract(std::move(context));
++    return;
++  }
++  for (size_t i = 0; i < dirty.size(); ++i) {
++    if (dirty[i]) {
++      GetSnapshotTaskRunner()->PostTaskAndReplyWithResult(
++          FROM_HERE,
++          WrapSnapshotTask(
++              base::BindOnce(&ContentProcessor::ExtractSection, context, i)),
++          base::BindOnce(&ContentProcessor::OnSectionExtracted, context, i));
++    }
++  }
++}
++
++// static
++std::vector<browser_os::ContentItem> ContentProcessor::ExtractSection(
++    scoped_refptr<SectionExtractContext> context,
++    size_t index) {
++  std::vector<browser_os::ContentItem> items;
++  items.reserve(CountItems(context->section_roots[index], context->node_map));
++  TraverseDFS(context->section_roots[index], context->node_map, items);
++  return items;
++}
++
++// static
++void ContentProcessor::OnSectionExtracted(
++    scoped_refptr<SectionExtractContext> context,
++    size_t index,
++    std::vector<browser_os::ContentItem> items) {
++  context->section_items[index] = std::move(items);
++  if (++context->completed < context->section_items.size()) {
++    return;
++  }
++  FinishSectionExtract(std::move(context));
++}
++
++// static
++void ContentProcessor::FinishSectionExtract(
++    scoped_refptr<SectionExtractContext> context) {
++  // Save the per-section results so the tab's next extraction can patch
++  // instead of re-traversing everything.
++  if (context->update_cache && context->web_contents) {
++    ContentExtractionCache::GetOrCreate(context->web_contents.get())
++        ->Store(context->tree_id, context->section_roots,
++                context->section_items);
++  }
++
++  // Every section is in; concatenate in document order.
++  size_t total = 0;
++  for (const auto& section : context->section_items) {
++    total += section.size();
++  }
++  std::vector<browser_os::ContentItem> all_items;
++  all_items.reserve(total);
++  for (auto& section : context->section_items) {
++    for (auto& item : section) {
++      all_items.push_back(std::move(item));
++    }
++  }
++
++  LOG(INFO) << "browseros: ExtractPageContentAsync - extracted "
++            << all_items.size() << " items";
++
++  std::move(context->callback).Run(std::move(all_items));
++}
++
++// static
 +void ContentProcessor::TraverseDFS(
 +    int32_t node_id,
-+    const std::unordered_map<int32_t, ui::AXNodeData>& node_map,
++    const std::unordered_map<int32_t, ContentNode>& node_map,
 +    std::vector<browser_os::ContentItem>& items) {
 +
 +  auto it = node_map.find(node_id);
@@ -88,11 +543,11 @@ index 0000000000000..4166f1a38737c
 +    return;
 +  }
 +
-+  const ui::AXNodeData& node = it->second;
++  const ContentNode& node = it->second;
 +
 +  // Skip extracting from ignored nodes, but still recurse to children
-+  if (node.IsIgnored()) {
-+    for (int32_t child_id : node.child_ids) {
++  if (node.data.IsIgnored()) {
++    for (int32_t child_id : node.data.child_ids) {
 +      TraverseDFS(child_id, node_map, items);
 +    }
 +    return;
@@ -100,28 +555,30 @@ index 0000000000000..4166f1a38737c
 +
 +  // Extract content at semantic boundaries
 +  // Don't recurse into these - their children are just formatting
++  // Classification was precomputed when the node map was built.
++  const uint8_t flags = node.role_flags;
 +
-+  if (ui::IsHeading(node.role)) {
++  if (flags & kRoleFlagHeading) {
 +    items.push_back(ExtractHeading(node));
 +    return;
 +  }
 +
-+  if (ui::IsLink(node.role)) {
++  if (flags & kRoleFlagLink) {
 +    items.push_back(ExtractLink(node));
 +    return;
 +  }
 +
-+  if (ui::IsImage(node.role)) {
++  if (flags & kRoleFlagImage) {
 +    items.push_back(ExtractImage(node));
 +    return;
 +  }
 +
-+  if (node.role == ax::mojom::Role::kVideo) {
++  if (flags & kRoleFlagVideo) {
 +    items.push_back(ExtractVideo(node));
 +    return;
 +  }
 +
-+  if (ui::IsText(node.role)) {
++  if (flags & kRoleFlagText) {
 +    // Extract text content
 +    auto item = ExtractText(node);
 +    if (item.text.has_value() && !item.text->empty()) {
@@ -131,25 +588,199 @@ index 0000000000000..4166f1a38737c
 +  }
 +
 +  // For container nodes (divs, sections, etc.), recurse to children
-+  for (int32_t child_id : node.child_ids) {
++  for (int32_t child_id : node.data.child_ids) {
 +    TraverseDFS(child_id, node_map, items);
 +  }
 +}
 +
 +// static
++size_t ContentProcessor::CountItems(
++    int32_t node_id,
++    const std::unordered_map<int32_t, ContentNode>& node_map) {
++  auto it = node_map.find(node_id);
++  if (it == node_map.end()) {
++    return 0;
++  }
++
++  const ContentNode& node = it->second;
++
++  // Mirrors TraverseDFS's boundary logic without any of the string work.
++  // Text nodes whose name collapses to whitespace are counted anyway, so
++  // the result can overshoot slightly; reserve() tolerates that.
++  if (!node.data.IsIgnored()) {
++    const uint8_t flags = node.role_flags;
++    if (flags & (kRoleFlagHeading | kRoleFlagLink | kRoleFlagImage |
++                 kRoleFlagVideo)) {
++      return 1;
++    }
++    if (flags & kRoleFlagText) {
++      return GetAccessibleName(node).empty() ? 0 : 1;
++    }
++  }
++
++  size_t count = 0;
++  for (int32_t child_id : node.data.child_ids) {
++    count += CountItems(child_id, node_map);
++  }
++  return count;
++}
++
++// static
++std::vector<uint8_t> ContentProcessor::SerializeToBinary(
++    const std::vector<browser_os::ContentItem>& items) {
++  constexpr uint32_t kMagic = 0x43534F42;  // 'BOSC'
++  constexpr uint32_t kVersion = 1;
++  constexpr uint32_t kAbsent = 0xFFFFFFFF;
++  constexpr size_t kHeaderSize = 16;
++  constexpr size_t kRecordSize = 16;
++
++  std::vector<uint8_t> buffer;
++  buffer.reserve(kHeaderSize + items.size() * kRecordSize);
++
++  auto append_u32 = [&buffer](uint32_t value) {
++    buffer.push_back(value & 0xFF);
++    buffer.push_back((value >> 8) & 0xFF);
++    buffer.push_back((value >> 16) & 0xFF);
++    buffer.push_back((value >> 24) & 0xFF);
++  };
++
++  // String table is built alongside the records; offsets are relative to
++  // the table start so the header can be written up front.
++  std::vector<uint8_t> string_table;
++  std::unordered_map<std::string, uint32_t> string_offsets;
++  auto intern = [&](const std::optional<std::string>& str) -> uint32_t {
++    if (!str) {
++      return kAbsent;
++    }
++    auto it = string_offsets.find(*str);
++    if (it != string_offsets.end()) {
++      return it->second;
++    }
++    const uint32_t offset = static_cast<uint32_t>(string_table.size());
++    const uint32_t length = static_cast<uint32_t>(str->size());
++    string_table.push_back(length & 0xFF);
++    string_table.push_back((length >> 8) & 0xFF);
++    string_table.push_back((length >> 16) & 0xFF);
++    string_table.push_back((length >> 24) & 0xFF);
++    string_table.insert(string_table.end(), str->begin(), str->end());
++    string_offsets.emplace(*str, offset);
++    return offset;
++  };
++
++  append_u32(kMagic);
++  append_u32(kVersion);
++  append_u32(static_cast<uint32_t>(items.size()));
++  append_u32(static_cast<uint32_t>(kHeaderSize + items.size() * kRecordSize));
++
++  for (const auto& item : items) {
++    buffer.push_back(static_cast<uint8_t>(item.type));
++    buffer.push_back(static_cast<uint8_t>(item.level.value_or(0)));
++    buffer.push_back(0);
++    buffer.push_back(0);
++    append_u32(intern(item.text));
++    append_u32(intern(item.url));
++    append_u32(intern(item.alt));
++  }
++
++  buffer.insert(buffer.end(), string_table.begin(), string_table.end());
++  return buffer;
++}
++
++// static
++std::string ContentProcessor::ToMarkdown(
++    const std::vector<browser_os::ContentItem>& items) {
++  // One reserve up front: text plus a handful of markup characters per
++  // item covers the common case without reallocating mid-append.
++  size_t estimated = 0;
++  for (const auto& item : items) {
++    estimated += (item.text ? item.text->size() : 0) +
++                 (item.url ? item.url->size() : 0) +
++                 (item.alt ? item.alt->size() : 0) + 12;
++  }
++
++  std::string out;
++  out.reserve(estimated);
++
++  for (const auto& item : items) {
++    switch (item.type) {
++      case browser_os::ContentItemType::kHeading: {
++        const int level = std::clamp(item.level.value_or(2), 1, 6);
++        out.append(static_cast<size_t>(level), '#');
++        out += ' ';
++        if (item.text) {
++          out += *item.text;
++        }
++        out += "\n\n";
++        break;
++      }
++      case browser_os::ContentItemType::kText:
++        if (item.text) {
++          out += *item.text;
++          out += "\n\n";
++        }
++        break;
++      case browser_os::ContentItemType::kLink:
++        out += '[';
++        if (item.text) {
++          out += *item.text;
++        }
++        out += "](";
++        if (item.url) {
++          out += *item.url;
++        }
++        out += ")\n\n";
++        break;
++      case browser_os::ContentItemType::kImage:
++        out += "![";
++        if (item.alt) {
++          out += *item.alt;
++        }
++        out += "](";
++        if (item.url) {
++          out += *item.url;
++        }
++        out += ")\n\n";
++        break;
++      case browser_os::ContentItemType::kVideo:
++        out += "[Video: ";
++        if (item.alt) {
++          out += *item.alt;
++        }
++        out += "](";
++        if (item.url) {
++          out += *item.url;
++        }
++        out += ")\n\n";
++        break;
++      default:
++        break;
++    }
++  }
++
++  // Drop the trailing paragraph break.
++  while (!out.empty() && out.back() == '\n') {
++    out.pop_back();
++  }
++  return out;
++}
++
++// static
 +browser_os::ContentItem ContentProcessor::ExtractHeading(
-+    const ui::AXNodeData& node) {
++    const ContentNode& node) {
 +  browser_os::ContentItem item;
 +  item.type = browser_os::ContentItemType::kHeading;
 +
-+  std::string name = GetAccessibleName(node);
++  const std::string& name = GetAccessibleName(node);
 +  if (!name.empty()) {
 +    item.text = CleanText(name);
 +  }
 +
-+  // Get heading level from hierarchical level attribute
-+  if (node.HasIntAttribute(ax::mojom::IntAttribute::kHierarchicalLevel)) {
-+    int level = node.GetIntAttribute(ax::mojom::IntAttribute::kHierarchicalLevel);
++  // Get heading level from hierarchical level attribute. Int attributes
++  // stay on the scanning getter: there is one lookup per emitted heading,
++  // not per visited node.
++  if (node.data.HasIntAttribute(ax::mojom::IntAttribute::kHierarchicalLevel)) {
++    int level =
++        node.data.GetIntAttribute(ax::mojom::IntAttribute::kHierarchicalLevel);
 +    item.level = std::clamp(level, 1, 6);
 +  } else {
 +    // Default to level 2 if not specified
@@ -161,11 +792,11 @@ index 0000000000000..4166f1a38737c
 +
 +// static
 +browser_os::ContentItem ContentProcessor::ExtractText(
-+    const ui::AXNodeData& node) {
++    const ContentNode& node) {
 +  browser_os::ContentItem item;
 +  item.type = browser_os::ContentItemType::kText;
 +
-+  std::string name = GetAccessibleName(node);
++  const std::string& name = GetAccessibleName(node);
 +  if (!name.empty()) {
 +    item.text = CleanText(name);
 +  }
@@ -175,18 +806,18 @@ index 0000000000000..4166f1a38737c
 +
 +// static
 +browser_os::ContentItem ContentProcessor::ExtractLink(
-+    const ui::AXNodeData& node) {
++    const ContentNode& node) {
 +  browser_os::ContentItem item;
 +  item.type = browser_os::ContentItemType::kLink;
 +
-+  std::string name = GetAccessibleName(node);
++  const std::string& name = GetAccessibleName(node);
 +  if (!name.empty()) {
 +    item.text = CleanText(name);
 +  }
 +
-+  // Get URL from url attribute
-+  if (node.HasStringAttribute(ax::mojom::StringAttribute::kUrl)) {
-+    item.url = node.GetStringAttribute(ax::mojom::StringAttribute::kUrl);
++  // Get URL from the cached attribute position
++  if (node.url_index >= 0) {
++    item.url = node.data.string_attributes[node.url_index].second;
 +  }
 +
 +  return item;
@@ -194,21 +825,24 @@ index 0000000000000..4166f1a38737c
 +
 +// static
 +browser_os::ContentItem ContentProcessor::ExtractImage(
-+    const ui::AXNodeData& node) {
++    const ContentNode& node) {
 +  browser_os::ContentItem item;
 +  item.type = browser_os::ContentItemType::kImage;
 +
 +  // Get alt text from name
-+  std::string name = GetAccessibleName(node);
++  const std::string& name = GetAccessibleName(node);
 +  if (!name.empty()) {
 +    item.alt = CleanText(name);
 +  }
 +
-+  // Get image URL
-+  if (node.HasStringAttribute(ax::mojom::StringAttribute::kUrl)) {
-+    item.url = node.GetStringAttribute(ax::mojom::StringAttribute::kUrl);
-+  } else if (node.HasStringAttribute(ax::mojom::StringAttribute::kImageDataUrl)) {
-+    item.url = node.GetStringAttribute(ax::mojom::StringAttribute::kImageDataUrl);
++  // Get image URL; the data-URL fallback is rare enough to leave on the
++  // scanning getter.
++  if (node.url_index >= 0) {
++    item.url = node.data.string_attributes[node.url_index].second;
++  } else if (node.data.HasStringAttribute(
++                 ax::mojom::StringAttribute::kImageDataUrl)) {
++    item.url =
++        node.data.GetStringAttribute(ax::mojom::StringAttribute::kImageDataUrl);
 +  }
 +
 +  return item;
@@ -216,37 +850,39 @@ index 0000000000000..4166f1a38737c
 +
 +// static
 +browser_os::ContentItem ContentProcessor::ExtractVideo(
-+    const ui::AXNodeData& node) {
++    const ContentNode& node) {
 +  browser_os::ContentItem item;
 +  item.type = browser_os::ContentItemType::kVideo;
 +
 +  // Get video title from name
-+  std::string name = GetAccessibleName(node);
++  const std::string& name = GetAccessibleName(node);
 +  if (!name.empty()) {
 +    item.alt = CleanText(name);
 +  }
 +
-+  // Get video URL
-+  if (node.HasStringAttribute(ax::mojom::StringAttribute::kUrl)) {
-+    item.url = node.GetStringAttribute(ax::mojom::StringAttribute::kUrl);
++  // Get video URL from the cached attribute position
++  if (node.url_index >= 0) {
++    item.url = node.data.string_attributes[node.url_index].second;
 +  }
 +
 +  return item;
 +}
 +
 +// static
-+std::string ContentProcessor::GetAccessibleName(const ui::AXNodeData& node) {
-+  // Try name attribute first
-+  if (node.HasStringAttribute(ax::mojom::StringAttribute::kName)) {
-+    return node.GetStringAttribute(ax::mojom::StringAttribute::kName);
++const std::string& ContentProcessor::GetAccessibleName(
++    const ContentNode& node) {
++  // Try name attribute first, then fall back to value; both positions were
++  // cached at map-build time, so this is two compares instead of two scans
++  // of the attribute vector. The reference points into the node's own
++  // storage; callers copy at most once, when they clean the text into the
++  // item.
++  if (node.name_index >= 0) {
++    return node.data.string_attributes[node.name_index].second;
 +  }
-+
-+  // Fall back to value attribute
-+  if (node.HasStringAttribute(ax::mojom::StringAttribute::kValue)) {
-+    return node.GetStringAttribute(ax::mojom::StringAttribute::kValue);
++  if (node.value_index >= 0) {
++    return node.data.string_attributes[node.value_index].second;
 +  }
-+
-+  return "";
++  return base::EmptyString();
 +}
 +
 +}  // namespace api
@@ -0,0 +1,69 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_screenshot_cache.cc b/chrome/browser/extensions/api/browser_os/browser_os_screenshot_cache.cc
+new file mode 100644
+index 0000000000000..792a5ce1a32e3
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_screenshot_cache.cc
+@@ -0,0 +1,63 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_screenshot_cache.h"
++
++#include "content/public/browser/render_frame_host.h"
++#include "content/public/browser/web_contents.h"
++
++namespace extensions {
++namespace api {
++
++BrowserOSScreenshotCache::BrowserOSScreenshotCache(
++    content::WebContents* web_contents)
++    : content::WebContentsObserver(web_contents),
++      content::WebContentsUserData<BrowserOSScreenshotCache>(*web_contents) {}
++
++BrowserOSScreenshotCache::~BrowserOSScreenshotCache() = default;
++
++// static
++BrowserOSScreenshotCache* BrowserOSScreenshotCache::GetOrCreate(
++    content::WebContents* web_contents) {
++  CreateForWebContents(web_contents);
++  return FromWebContents(web_contents);
++}
++
++const std::string* BrowserOSScreenshotCache::Lookup(
++    uint64_t params_hash) const {
++  if (cached_frame_sequence_ == 0 ||
++      cached_frame_sequence_ != frame_sequence_ ||
++      cached_params_hash_ != params_hash) {
++    return nullptr;
++  }
++  return &cached_data_url_;
++}
++
++void BrowserOSScreenshotCache::Store(uint64_t params_hash,
++                                     uint64_t frame_sequence,
++                                     const std::string& data_url) {
++  cached_params_hash_ = params_hash;
++  cached_frame_sequence_ = frame_sequence;
++  cached_data_url_ = data_url;
++}
++
++void BrowserOSScreenshotCache::DidCommitAndDrawCompositorFrame(
++    content::RenderFrameHost* render_frame_host) {
++  // Any frame draw - main frame or OOPIF - can change the pixels a capture
++  // would see, so all of them advance the sequence. Over-counting only
++  // costs a redundant capture; under-counting would serve stale bytes.
++  ++frame_sequence_;
++}
++
++void BrowserOSScreenshotCache::PrimaryPageChanged(content::Page& page) {
++  // New document; drop the cached capture outright.
++  ++frame_sequence_;
++  cached_frame_sequence_ = 0;
++  cached_data_url_.clear();
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(BrowserOSScreenshotCache);
++
++}  // namespace api
++}  // namespace extensions
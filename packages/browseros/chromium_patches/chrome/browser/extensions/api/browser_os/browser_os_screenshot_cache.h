@@ -0,0 +1,83 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_screenshot_cache.h b/chrome/browser/extensions/api/browser_os/browser_os_screenshot_cache.h
+new file mode 100644
+index 0000000000000..e86359da70839
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_screenshot_cache.h
+@@ -0,0 +1,77 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SCREENSHOT_CACHE_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SCREENSHOT_CACHE_H_
++
++#include <cstdint>
++#include <string>
++
++#include "content/public/browser/web_contents_observer.h"
++#include "content/public/browser/web_contents_user_data.h"
++
++namespace content {
++class WebContents;
++}  // namespace content
++
++namespace extensions {
++namespace api {
++
++// Per-tab memo of the last encoded screenshot and the compositor frame
++// sequence it was captured at. Agent loops screenshot every step; on a
++// static page the compositor draws nothing between steps, so the
++// copy-from-surface and re-encode of an identical frame can be skipped and
++// the previous encoding returned as-is.
++class BrowserOSScreenshotCache
++    : public content::WebContentsObserver,
++      public content::WebContentsUserData<BrowserOSScreenshotCache> {
++ public:
++  ~BrowserOSScreenshotCache() override;
++
++  BrowserOSScreenshotCache(const BrowserOSScreenshotCache&) = delete;
++  BrowserOSScreenshotCache& operator=(const BrowserOSScreenshotCache&) =
++      delete;
++
++  // Returns the cache for |web_contents|, creating it on first use.
++  static BrowserOSScreenshotCache* GetOrCreate(
++      content::WebContents* web_contents);
++
++  // Count of compositor frames drawn by this tab since the cache was
++  // created. Captures record the value they started from; an unchanged
++  // count means the surface still shows the same frame.
++  uint64_t frame_sequence() const { return frame_sequence_; }
++
++  // Returns the cached data URL when the compositor hasn't drawn since it
++  // was stored and the capture parameters match; nullptr otherwise.
++  const std::string* Lookup(uint64_t params_hash) const;
++
++  // Remembers |data_url| as the encoding of frame |frame_sequence| under
++  // |params_hash|. Only the latest capture is kept.
++  void Store(uint64_t params_hash,
++             uint64_t frame_sequence,
++             const std::string& data_url);
++
++ private:
++  explicit BrowserOSScreenshotCache(content::WebContents* web_contents);
++  friend class content::WebContentsUserData<BrowserOSScreenshotCache>;
++
++  // content::WebContentsObserver:
++  void DidCommitAndDrawCompositorFrame(
++      content::RenderFrameHost* render_frame_host) override;
++  void PrimaryPageChanged(content::Page& page) override;
++
++  uint64_t frame_sequence_ = 1;
++
++  // Last stored capture; a zero sequence means nothing is cached.
++  uint64_t cached_frame_sequence_ = 0;
++  uint64_t cached_params_hash_ = 0;
++  std::string cached_data_url_;
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SCREENSHOT_CACHE_H_
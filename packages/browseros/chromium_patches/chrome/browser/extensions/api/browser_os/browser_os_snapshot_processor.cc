@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.cc b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.cc
 new file mode 100644
-index 0000000000000..885942336dcd6
+index 0000000000000..ce8b54bb430a4
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.cc
-@@ -0,0 +1,648 @@
+@@ -0,0 +1,1300 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -13,22 +13,41 @@ index 0000000000000..885942336dcd6
 +#include <algorithm>
 +#include <atomic>
 +#include <cctype>
++#include <cstdint>
++#include <cstdlib>
 +#include <functional>
 +#include <future>
 +#include <memory>
 +#include <queue>
++#include <set>
 +#include <sstream>
 +#include <unordered_set>
 +#include <utility>
 +
++#include "base/bits.h"
 +#include "base/functional/bind.h"
 +#include "base/logging.h"
 +#include "base/memory/raw_ptr.h"
 +#include "base/memory/ref_counted.h"
++#include "base/no_destructor.h"
 +#include "base/strings/string_util.h"
-+#include "base/task/thread_pool.h"
++#include "base/synchronization/lock.h"
++#include "base/system/sys_info.h"
 +#include "base/time/time.h"
++#include "base/trace_event/memory_allocator_dump.h"
++#include "base/trace_event/memory_dump_manager.h"
++#include "base/trace_event/memory_dump_provider.h"
++#include "base/trace_event/process_memory_dump.h"
++#include "base/trace_event/trace_event.h"
++#include "build/build_config.h"
 +#include "chrome/browser/extensions/api/browser_os/browser_os_api_utils.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_tree_cache.h"
++
++#if defined(ARCH_CPU_X86_FAMILY)
++#include <emmintrin.h>
++#elif defined(ARCH_CPU_ARM_FAMILY) && defined(__ARM_NEON)
++#include <arm_neon.h>
++#endif
 +#include "content/public/browser/browser_thread.h"
 +#include "content/public/browser/render_widget_host_view.h"
 +#include "content/browser/renderer_host/render_widget_host_view_base.h"
@@ -44,11 +63,78 @@ index 0000000000000..885942336dcd6
 +#include "ui/gfx/geometry/rect.h"
 +#include "ui/gfx/geometry/rect_conversions.h"
 +#include "ui/gfx/geometry/rect_f.h"
++#include "ui/gfx/geometry/size_f.h"
 +#include "ui/gfx/geometry/transform.h"
 +
 +namespace extensions {
 +namespace api {
 +
++namespace {
++
++// Itemizes snapshot-processing memory in chrome://memory-internals. Arenas
++// register themselves on construction, so every live snapshot's bookkeeping
++// (one arena per ProcessingContext) is summed into a single
++// "browseros/snapshot_processor" entry; a count that never returns to zero
++// between agent steps points at context retention.
++class SnapshotMemoryDumpProvider
++    : public base::trace_event::MemoryDumpProvider {
++ public:
++  static SnapshotMemoryDumpProvider* GetInstance() {
++    static base::NoDestructor<SnapshotMemoryDumpProvider> instance;
++    return instance.get();
++  }
++
++  SnapshotMemoryDumpProvider(const SnapshotMemoryDumpProvider&) = delete;
++  SnapshotMemoryDumpProvider& operator=(const SnapshotMemoryDumpProvider&) =
++      delete;
++
++  void AddArena(const SnapshotArena* arena) {
++    base::AutoLock lock(lock_);
++    arenas_.insert(arena);
++  }
++
++  void RemoveArena(const SnapshotArena* arena) {
++    base::AutoLock lock(lock_);
++    arenas_.erase(arena);
++  }
++
++  // base::trace_event::MemoryDumpProvider:
++  bool OnMemoryDump(const base::trace_event::MemoryDumpArgs& args,
++                    base::trace_event::ProcessMemoryDump* pmd) override {
++    base::AutoLock lock(lock_);
++    size_t reserved_bytes = 0;
++    for (const SnapshotArena* arena : arenas_) {
++      reserved_bytes += arena->bytes_reserved();
++    }
++    auto* dump = pmd->CreateAllocatorDump("browseros/snapshot_processor");
++    dump->AddScalar(base::trace_event::MemoryAllocatorDump::kNameSize,
++                    base::trace_event::MemoryAllocatorDump::kUnitsBytes,
++                    reserved_bytes);
++    dump->AddScalar(base::trace_event::MemoryAllocatorDump::kNameObjectCount,
++                    base::trace_event::MemoryAllocatorDump::kUnitsObjects,
++                    arenas_.size());
++    return true;
++  }
++
++ private:
++  friend class base::NoDestructor<SnapshotMemoryDumpProvider>;
++
++  SnapshotMemoryDumpProvider() {
++    // Contexts are released by whichever thread drops the last reference,
++    // so the provider registers without a task runner and guards the
++    // registry with a lock instead of a sequence.
++    base::trace_event::MemoryDumpManager::GetInstance()->RegisterDumpProvider(
++        this, "BrowserOSSnapshot", nullptr);
++  }
++  ~SnapshotMemoryDumpProvider() = default;
++
++  base::Lock lock_;
++  std::set<raw_ptr<const SnapshotArena, SetExperimental>> arenas_
++      GUARDED_BY(lock_);
++};
++
++}  // namespace
++
 +// Static method to compute bounds for a node using AXTree and convert to CSS pixels
 +// This implements the same logic as BrowserAccessibility::GetBoundsRect
 +gfx::RectF SnapshotProcessor::GetNodeBounds(
@@ -88,6 +174,232 @@ index 0000000000000..885942336dcd6
 +}
 +
 +
++// SnapshotArena implementation
++struct SnapshotArena::Chunk {
++  Chunk* next;
++  size_t payload_size;  // Recorded so Reset() can rewind into this chunk.
++  // Payload follows the header in the same allocation.
++};
++
++SnapshotArena::SnapshotArena(size_t chunk_size) : chunk_size_(chunk_size) {
++  SnapshotMemoryDumpProvider::GetInstance()->AddArena(this);
++}
++
++SnapshotArena::~SnapshotArena() {
++  // Deregister before freeing so a concurrent dump never walks dead chunks.
++  SnapshotMemoryDumpProvider::GetInstance()->RemoveArena(this);
++  Chunk* chunk = head_;
++  while (chunk) {
++    Chunk* next = chunk->next;
++    free(chunk);
++    chunk = next;
++  }
++}
++
++void* SnapshotArena::Allocate(size_t size, size_t alignment) {
++  // Align the bump cursor; fall through to a new chunk if it doesn't fit.
++  uintptr_t aligned =
++      (reinterpret_cast<uintptr_t>(cursor_) + alignment - 1) & ~(alignment - 1);
++  if (cursor_ && aligned + size <= reinterpret_cast<uintptr_t>(limit_)) {
++    cursor_ = reinterpret_cast<char*>(aligned + size);
++    return reinterpret_cast<void*>(aligned);
++  }
++
++  // Oversized requests get a dedicated chunk so they don't waste the
++  // remainder of a fresh standard chunk.
++  size_t payload = std::max(size + alignment, chunk_size_);
++  size_t total = sizeof(Chunk) + payload;
++  Chunk* chunk = static_cast<Chunk*>(malloc(total));
++  CHECK(chunk);
++  chunk->next = head_;
++  chunk->payload_size = payload;
++  head_ = chunk;
++  bytes_reserved_.fetch_add(total, std::memory_order_relaxed);
++
++  char* base = reinterpret_cast<char*>(chunk) + sizeof(Chunk);
++  aligned =
++      (reinterpret_cast<uintptr_t>(base) + alignment - 1) & ~(alignment - 1);
++  cursor_ = reinterpret_cast<char*>(aligned + size);
++  limit_ = base + payload;
++  return reinterpret_cast<void*>(aligned);
++}
++
++void SnapshotArena::Reset() {
++  if (!head_) {
++    return;
++  }
++  // Keep the newest chunk — in steady state it is the one sized for this
++  // page's node count — and return the rest to the system.
++  Chunk* keep = head_;
++  Chunk* chunk = keep->next;
++  while (chunk) {
++    Chunk* next = chunk->next;
++    bytes_reserved_.fetch_sub(sizeof(Chunk) + chunk->payload_size,
++                              std::memory_order_relaxed);
++    free(chunk);
++    chunk = next;
++  }
++  keep->next = nullptr;
++  cursor_ = reinterpret_cast<char*>(keep) + sizeof(Chunk);
++  limit_ = cursor_ + keep->payload_size;
++}
++
++
++// FlatAXTree implementation
++FlatAXTree::FlatAXTree(SnapshotArena* arena)
++    : nodes_(SnapshotArenaAllocator<ui::AXNodeData>(arena)),
++      links_(SnapshotArenaAllocator<Links>(arena)),
++      bounds_(SnapshotArenaAllocator<NodeBounds>(arena)),
++      id_to_index_(
++          SnapshotArenaAllocator<std::pair<const int32_t, int32_t>>(arena)) {}
++
++FlatAXTree::~FlatAXTree() = default;
++
++void FlatAXTree::Reset() {
++  // Move-assigning from empty containers with the same allocator drops the
++  // old buffers (a no-op deallocation for the arena) rather than keeping
++  // capacity; arena-backed storage cannot survive the arena rewind that
++  // follows.
++  nodes_ = decltype(nodes_)(nodes_.get_allocator());
++  links_ = decltype(links_)(links_.get_allocator());
++  bounds_ = decltype(bounds_)(bounds_.get_allocator());
++  id_to_index_ = decltype(id_to_index_)(id_to_index_.get_allocator());
++}
++
++void FlatAXTree::Build(const ui::AXTreeUpdate& tree_update) {
++  const size_t count = tree_update.nodes.size();
++  nodes_.reserve(count);
++  links_.resize(count);
++  id_to_index_.reserve(count);
++
++  // Pass 1: copy node data into the contiguous vector and index it by id.
++  for (const auto& node : tree_update.nodes) {
++    id_to_index_.emplace(node.id, static_cast<int32_t>(nodes_.size()));
++    nodes_.push_back(node);
++  }
++
++  WireLinks();
++}
++
++void FlatAXTree::Build(ui::AXTreeUpdate&& tree_update) {
++  const size_t count = tree_update.nodes.size();
++  nodes_.reserve(count);
++  links_.resize(count);
++  id_to_index_.reserve(count);
++
++  // Pass 1: adopt the update's nodes. Moving transfers each node's heap
++  // payload (name and attribute storage) instead of duplicating it.
++  for (auto& node : tree_update.nodes) {
++    id_to_index_.emplace(node.id, static_cast<int32_t>(nodes_.size()));
++    nodes_.push_back(std::move(node));
++  }
++  tree_update.nodes.clear();
++
++  WireLinks();
++}
++
++void FlatAXTree::WireLinks() {
++  // Pass 2: wire up first-child/next-sibling links. Children are chained in
++  // the order they appear in child_ids so sibling iteration matches the
++  // original tree order.
++  for (size_t i = 0; i < nodes_.size(); ++i) {
++    int32_t prev_child = kInvalidIndex;
++    for (int32_t child_id : nodes_[i].child_ids) {
++      int32_t child_index = IndexOf(child_id);
++      if (child_index == kInvalidIndex) {
++        continue;  // Child not present in this update.
++      }
++      links_[child_index].parent = static_cast<int32_t>(i);
++      if (prev_child == kInvalidIndex) {
++        links_[i].first_child = child_index;
++      } else {
++        links_[prev_child].next_sibling = child_index;
++      }
++      prev_child = child_index;
++    }
++  }
++}
++
++int32_t FlatAXTree::IndexOf(int32_t ax_node_id) const {
++  auto it = id_to_index_.find(ax_node_id);
++  return it == id_to_index_.end() ? kInvalidIndex : it->second;
++}
++
++const ui::AXNodeData* FlatAXTree::Find(int32_t ax_node_id) const {
++  int32_t index = IndexOf(ax_node_id);
++  return index == kInvalidIndex ? nullptr : &nodes_[index];
++}
++
++void FlatAXTree::ComputeAbsoluteBounds(float device_scale_factor) {
++  bounds_.resize(nodes_.size());
++
++  // Iterative DFS from every root, so a node's offset container (always an
++  // ancestor) has its absolute rect computed before the node itself. All
++  // arithmetic stays in physical pixels until the final scale pass.
++  std::vector<int32_t> stack;
++  for (size_t i = 0; i < nodes_.size(); ++i) {
++    if (links_[i].parent == kInvalidIndex) {
++      stack.push_back(static_cast<int32_t>(i));
++    }
++  }
++
++  while (!stack.empty()) {
++    int32_t index = stack.back();
++    stack.pop_back();
++    const ui::AXNodeData& node = nodes_[index];
++
++    gfx::RectF rect = node.relative_bounds.bounds;
++    if (node.relative_bounds.transform &&
++        !node.relative_bounds.transform->IsIdentity()) {
++      rect = node.relative_bounds.transform->MapRect(rect);
++    }
++
++    bool offscreen = false;
++    int32_t container_index =
++        IndexOf(node.relative_bounds.offset_container_id);
++    if (container_index != kInvalidIndex && container_index != index) {
++      const NodeBounds& container = bounds_[container_index];
++      const ui::AXNodeData& container_node = nodes_[container_index];
++
++      // Undo the container's scrolling, then translate into its space.
++      rect.Offset(
++          -container_node.GetIntAttribute(ax::mojom::IntAttribute::kScrollX),
++          -container_node.GetIntAttribute(ax::mojom::IntAttribute::kScrollY));
++      rect.Offset(container.rect.OffsetFromOrigin());
++
++      // Clip against containers that clip their children; a clipped-away
++      // rect marks the node (and effectively its subtree) offscreen.
++      if (container_node.GetBoolAttribute(
++              ax::mojom::BoolAttribute::kClipsChildren)) {
++        gfx::RectF clipped = rect;
++        clipped.Intersect(container.rect);
++        if (clipped.IsEmpty()) {
++          offscreen = true;
++        }
++        rect = clipped;
++      }
++      offscreen = offscreen || container.offscreen;
++    }
++
++    bounds_[index].rect = rect;
++    bounds_[index].offscreen = offscreen;
++
++    for (int32_t child = links_[index].first_child; child != kInvalidIndex;
++         child = links_[child].next_sibling) {
++      stack.push_back(child);
++    }
++  }
++
++  // Convert physical pixels to CSS pixels once for the whole tree.
++  if (device_scale_factor > 0.0f && device_scale_factor != 1.0f) {
++    const float inv_scale = 1.0f / device_scale_factor;
++    for (NodeBounds& entry : bounds_) {
++      entry.rect.Scale(inv_scale);
++    }
++  }
++}
++
++
 +// ProcessedNode implementation
 +SnapshotProcessor::ProcessedNode::ProcessedNode()
 +    : node_data(nullptr), node_id(0) {}
@@ -103,20 +415,133 @@ index 0000000000000..885942336dcd6
 +
 +namespace {
 +
-+// Helper to sanitize strings to ensure valid UTF-8 by keeping only printable ASCII
++// Returns the offset of the first byte that needs inspection - a control
++// byte other than tab/newline, DEL, or any non-ASCII byte - or |size| if
++// every byte is printable ASCII. This is the hot inner loop of
++// SanitizeStringForOutput; on x86 and ARM it scans 16 bytes at a time so
++// the common all-printable case never branches per character.
++size_t FindFirstNonPrintable(const char* data, size_t size) {
++  size_t i = 0;
++#if defined(ARCH_CPU_X86_FAMILY)
++  // SSE2 is part of the Chromium x86 baseline. A byte is acceptable when
++  // 32 <= c <= 126 (signed compares also reject >= 128, which wraps
++  // negative) or when it is \t or \n.
++  for (; i + 16 <= size; i += 16) {
++    __m128i chunk =
++        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
++    __m128i gt31 = _mm_cmpgt_epi8(chunk, _mm_set1_epi8(31));
++    __m128i lt127 = _mm_cmplt_epi8(chunk, _mm_set1_epi8(127));
++    __m128i tab = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\t'));
++    __m128i newline = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n'));
++    __m128i ok = _mm_or_si128(_mm_and_si128(gt31, lt127),
++                              _mm_or_si128(tab, newline));
++    int bad_mask = _mm_movemask_epi8(ok) ^ 0xffff;
++    if (bad_mask) {
++      return i + base::bits::CountTrailingZeroBits(
++                     static_cast<uint32_t>(bad_mask));
++    }
++  }
++#elif defined(ARCH_CPU_ARM_FAMILY) && defined(__ARM_NEON)
++  for (; i + 16 <= size; i += 16) {
++    uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(data + i));
++    uint8x16_t in_range = vandq_u8(vcgeq_u8(chunk, vdupq_n_u8(32)),
++                                   vcleq_u8(chunk, vdupq_n_u8(126)));
++    uint8x16_t tab = vceqq_u8(chunk, vdupq_n_u8('\t'));
++    uint8x16_t newline = vceqq_u8(chunk, vdupq_n_u8('\n'));
++    uint8x16_t bad = vmvnq_u8(vorrq_u8(in_range, vorrq_u8(tab, newline)));
++    if (vmaxvq_u8(bad)) {
++      // Rare: fall through to the scalar loop to pinpoint the byte.
++      break;
++    }
++  }
++#endif
++  for (; i < size; ++i) {
++    char c = data[i];
++    if (!((c >= 32 && c <= 126) || c == '\t' || c == '\n')) {
++      return i;
++    }
++  }
++  return size;
++}
++
++// Returns the length (2-4) of the complete, well-formed UTF-8 sequence
++// starting at |p|, or 0 when the bytes do not form one (stray
++// continuation byte, overlong encoding, UTF-16 surrogate, beyond
++// U+10FFFF, or truncated at the end of the string).
++size_t ValidUtf8SequenceLength(const uint8_t* p, size_t remaining) {
++  const uint8_t lead = p[0];
++  if (lead < 0xC2) {
++    return 0;  // Continuation byte or overlong two-byte lead.
++  }
++  if (lead < 0xE0) {
++    if (remaining < 2 || (p[1] & 0xC0) != 0x80) {
++      return 0;
++    }
++    return 2;
++  }
++  if (lead < 0xF0) {
++    if (remaining < 3 || (p[1] & 0xC0) != 0x80 || (p[2] & 0xC0) != 0x80) {
++      return 0;
++    }
++    if (lead == 0xE0 && p[1] < 0xA0) {
++      return 0;  // Overlong.
++    }
++    if (lead == 0xED && p[1] >= 0xA0) {
++      return 0;  // UTF-16 surrogate half.
++    }
++    return 3;
++  }
++  if (lead < 0xF5) {
++    if (remaining < 4 || (p[1] & 0xC0) != 0x80 || (p[2] & 0xC0) != 0x80 ||
++        (p[3] & 0xC0) != 0x80) {
++      return 0;
++    }
++    if (lead == 0xF0 && p[1] < 0x90) {
++      return 0;  // Overlong.
++    }
++    if (lead == 0xF4 && p[1] >= 0x90) {
++      return 0;  // Beyond U+10FFFF.
++    }
++    return 4;
++  }
++  return 0;
++}
++
++// Sanitizes a string for snapshot output: printable ASCII and valid
++// multi-byte UTF-8 pass through untouched; control bytes (other than
++// tab/newline) and bytes that are not part of a well-formed UTF-8
++// sequence are repaired to spaces. Non-English names and values survive
++// intact, so callers no longer need a JS extraction round trip to
++// recover text this function used to blank out.
 +std::string SanitizeStringForOutput(const std::string& input) {
-+  std::string output;
-+  output.reserve(input.size());
-+  
-+  for (char c : input) {
-+    // Only include printable ASCII and whitespace
-+    if ((c >= 32 && c <= 126) || c == '\t' || c == '\n') {
-+      output.push_back(c);
++  // Fast path: fully printable ASCII input (the overwhelmingly common
++  // case for AX names/values) is returned with a single copy and no
++  // per-byte branching.
++  size_t special = FindFirstNonPrintable(input.data(), input.size());
++  if (special == input.size()) {
++    return input;
++  }
++
++  // Slow path: copy once, then hop between special bytes with the
++  // vectorized scan. Each stop is either a valid UTF-8 sequence (skipped
++  // whole) or a byte to repair; the ASCII stretches in between never get
++  // a per-byte check.
++  std::string output = input;
++  size_t i = special;
++  while (i < output.size()) {
++    const uint8_t lead = static_cast<uint8_t>(output[i]);
++    const size_t seq_len =
++        lead >= 0x80 ? ValidUtf8SequenceLength(
++                           reinterpret_cast<const uint8_t*>(output.data()) + i,
++                           output.size() - i)
++                     : 0;
++    if (seq_len > 0) {
++      i += seq_len;
 +    } else {
-+      output.push_back(' ');  // Replace non-printable with space
++      output[i++] = ' ';  // Control byte or invalid UTF-8.
 +    }
++    i += FindFirstNonPrintable(output.data() + i, output.size() - i);
 +  }
-+  
 +  return output;
 +}
 +
@@ -139,12 +564,39 @@ index 0000000000000..885942336dcd6
 +}  // namespace
 +
 +// Internal structure for managing async processing
-+struct SnapshotProcessor::ProcessingContext 
++struct SnapshotProcessor::ProcessingContext
 +    : public base::RefCountedThreadSafe<ProcessingContext> {
++  ProcessingContext()
++      : arena(std::make_unique<SnapshotArena>()), flat_tree(arena.get()) {}
++
 +  browser_os::InteractiveSnapshot snapshot;
-+  std::unordered_map<int32_t, ui::AXNodeData> node_map;
-+  std::unordered_map<int32_t, int32_t> parent_map;  // child_id -> parent_id  
-+  std::unordered_map<int32_t, std::vector<int32_t>> children_map;  // parent_id -> child_ids
++  // Arena backing the flat tree below; declared first so it outlives it.
++  // Releasing the context frees the whole snapshot's bookkeeping in O(1)
++  // chunk frees instead of one free per node.
++  std::unique_ptr<SnapshotArena> arena;
++  FlatAXTree flat_tree;
++  // Indices into |flat_tree| of the filtered nodes, shared by all workers;
++  // read-only once processing starts. Indices rather than AXNodeData copies:
++  // the flat tree already owns one contiguous copy of every node.
++  std::vector<int32_t> nodes_to_process;
++  // Cursor workers use to claim the next chunk of |nodes_to_process|.
++  std::atomic<size_t> next_node_index{0};
++  // String interning (enabled via InteractiveSnapshotOptions.internStrings).
++  // Repeated attribute values are stored once in |string_table| and emitted
++  // as indices. Only touched on the UI thread while merging batch results.
++  bool intern_strings = false;
++  std::unordered_map<std::string, int> string_table_index;
++  std::vector<std::string> string_table;
++
++  // Returns the table index for |value|, adding it on first sight.
++  int InternString(const std::string& value) {
++    auto [it, inserted] =
++        string_table_index.emplace(value, static_cast<int>(string_table.size()));
++    if (inserted) {
++      string_table.push_back(value);
++    }
++    return it->second;
++  }
 +  std::unique_ptr<ui::AXTree> ax_tree;  // AXTree for computing accurate bounds
 +  int tab_id;
 +  ui::AXTreeID tree_id;  // Tree ID for change detection
@@ -155,39 +607,86 @@ index 0000000000000..885942336dcd6
 +  size_t processed_batches;
 +  size_t total_batches;
 +  base::OnceCallback<void(SnapshotProcessingResult)> callback;
-+  
++
++  // Clears per-request state so the context can serve the tab's next
++  // snapshot. The plain-heap containers (|nodes_to_process|, the string
++  // table) keep their capacity; the arena-backed flat tree cannot, so its
++  // buffers are dropped and the arena rewound to its largest chunk, which
++  // serves the next Build() without fresh system allocations. Only call
++  // once every worker has released its ref.
++  void ResetForReuse() {
++    snapshot = browser_os::InteractiveSnapshot();
++    flat_tree.Reset();
++    arena->Reset();
++    nodes_to_process.clear();
++    next_node_index.store(0, std::memory_order_relaxed);
++    intern_strings = false;
++    string_table_index.clear();
++    string_table.clear();
++    ax_tree.reset();
++    tree_id = ui::AXTreeID();
++    device_scale_factor = 1.0f;
++    viewport_size = gfx::Size();
++    total_nodes = 0;
++    processed_batches = 0;
++    total_batches = 0;
++  }
++
 + private:
 +  friend class base::RefCountedThreadSafe<ProcessingContext>;
 +  ~ProcessingContext() = default;
 +};
 +
++// static
++std::unordered_map<int, scoped_refptr<SnapshotProcessor::ProcessingContext>>&
++SnapshotProcessor::GetContextPool() {
++  static base::NoDestructor<
++      std::unordered_map<int, scoped_refptr<ProcessingContext>>>
++      pool;
++  return *pool;
++}
++
++// static
++void SnapshotProcessor::MaybePoolContext(
++    scoped_refptr<ProcessingContext> context) {
++  // Cap what an idle tab may retain; a pathological page should not pin a
++  // huge arena after its snapshot finished.
++  constexpr size_t kMaxPooledArenaBytes = 16 * 1024 * 1024;
++  if (!context->HasOneRef() ||
++      context->arena->bytes_reserved() > kMaxPooledArenaBytes) {
++    return;
++  }
++  const int tab_id = context->tab_id;
++  context->ResetForReuse();
++  GetContextPool()[tab_id] = std::move(context);
++}
++
 +// Helper to collect text from a node's subtree
 +std::string CollectTextFromNode(
 +    int32_t node_id,
-+    const std::unordered_map<int32_t, ui::AXNodeData>& node_map,
++    const FlatAXTree& flat_tree,
 +    int max_chars = 200) {
-+  
-+  auto node_it = node_map.find(node_id);
-+  if (node_it == node_map.end()) {
++
++  int32_t start_index = flat_tree.IndexOf(node_id);
++  if (start_index == FlatAXTree::kInvalidIndex) {
 +    return "";
 +  }
-+  
++
 +  std::vector<std::string> text_parts;
-+  
-+  // BFS to collect text from this node and its children
++
++  // BFS to collect text from this node and its children. The queue holds
++  // flat-tree indices; child iteration follows the first-child/next-sibling
++  // links so no hash lookups are needed.
 +  std::queue<int32_t> queue;
-+  queue.push(node_id);
++  queue.push(start_index);
 +  int chars_collected = 0;
-+  
++
 +  while (!queue.empty() && chars_collected < max_chars) {
-+    int32_t current_id = queue.front();
++    int32_t current_index = queue.front();
 +    queue.pop();
-+    
-+    auto current_it = node_map.find(current_id);
-+    if (current_it == node_map.end()) continue;
-+    
-+    const ui::AXNodeData& current = current_it->second;
-+    
++
++    const ui::AXNodeData& current = flat_tree.NodeAt(current_index);
++
 +    // Collect text from this node
 +    if (current.HasStringAttribute(ax::mojom::StringAttribute::kName)) {
 +      std::string text = current.GetStringAttribute(ax::mojom::StringAttribute::kName);
@@ -200,10 +699,12 @@ index 0000000000000..885942336dcd6
 +        }
 +      }
 +    }
-+    
++
 +    // Add children to queue
-+    for (int32_t child_id : current.child_ids) {
-+      queue.push(child_id);
++    for (int32_t child = flat_tree.LinksAt(current_index).first_child;
++         child != FlatAXTree::kInvalidIndex;
++         child = flat_tree.LinksAt(child).next_sibling) {
++      queue.push(child);
 +    }
 +  }
 +  
@@ -217,24 +718,22 @@ index 0000000000000..885942336dcd6
 +// Helper to build path using offset_container_id and return depth
 +std::pair<std::string, int> BuildPathAndDepth(
 +    int32_t node_id,
-+    const std::unordered_map<int32_t, ui::AXNodeData>& node_map) {
-+  
++    const FlatAXTree& flat_tree) {
++
 +  std::vector<std::string> path_parts;
 +  int32_t current_id = node_id;
 +  int depth = 0;
 +  const int max_depth = 10;
-+  
++
 +  while (current_id >= 0 && depth < max_depth) {
-+    auto node_it = node_map.find(current_id);
-+    if (node_it == node_map.end()) break;
-+    
-+    const ui::AXNodeData& node = node_it->second;
-+    
++    const ui::AXNodeData* node = flat_tree.Find(current_id);
++    if (!node) break;
++
 +    // Just append the role
-+    path_parts.push_back(ui::ToString(node.role));
-+    
++    path_parts.push_back(ui::ToString(node->role));
++
 +    // Move to offset container
-+    current_id = node.relative_bounds.offset_container_id;
++    current_id = node->relative_bounds.offset_container_id;
 +    depth++;
 +  }
 +  
@@ -323,19 +822,18 @@ index 0000000000000..885942336dcd6
 +  }
 +}
 +
-+// Process a batch of nodes
-+std::vector<SnapshotProcessor::ProcessedNode> SnapshotProcessor::ProcessNodeBatch(
-+    const std::vector<ui::AXNodeData>& nodes_to_process,
-+    const std::unordered_map<int32_t, ui::AXNodeData>& node_map,
++// Process a contiguous range of nodes
++void SnapshotProcessor::ProcessNodeRange(
++    const std::vector<int32_t>& node_indices,
++    size_t begin,
++    size_t end,
++    const FlatAXTree& flat_tree,
 +    ui::AXTree* ax_tree,
-+    uint32_t start_node_id,
-+    float device_scale_factor) {
-+  std::vector<ProcessedNode> results;
-+  results.reserve(nodes_to_process.size());
-+  
-+  uint32_t current_node_id = start_node_id;
-+  
-+  for (const auto& node_data : nodes_to_process) {
++    float device_scale_factor,
++    std::vector<ProcessedNode>* results) {
++  for (size_t index = begin; index < end; ++index) {
++    const int32_t flat_index = node_indices[index];
++    const ui::AXNodeData& node_data = flat_tree.NodeAt(flat_index);
 +    // Skip invisible, ignored, or non-interactive elements
 +    if (ShouldSkipNode(node_data)) {
 +      continue;
@@ -351,7 +849,9 @@ index 0000000000000..885942336dcd6
 +    
 +    ProcessedNode data;
 +    data.node_data = &node_data;
-+    data.node_id = current_node_id++;
++    // Node IDs start at 1 and follow the node's position in the shared
++    // array, independent of which worker claimed this range.
++    data.node_id = static_cast<uint32_t>(index + 1);
 +    data.node_type = node_type;
 +    
 +    // Get accessible name
@@ -360,9 +860,15 @@ index 0000000000000..885942336dcd6
 +      data.name = SanitizeStringForOutput(name);
 +    }
 +
-+    // Compute bounds using AXTree
++    // Use the precomputed top-down bounds when available; they avoid the
++    // O(depth) ancestor re-walk RelativeToTreeBounds does per node. The flat
++    // index is already at hand, so no id lookup is needed.
 +    bool is_offscreen = false;
-+    if (ax_tree) {
++    if (flat_tree.has_bounds()) {
++      const FlatAXTree::NodeBounds& precomputed = flat_tree.BoundsAt(flat_index);
++      data.absolute_bounds = precomputed.rect;
++      is_offscreen = precomputed.offscreen;
++    } else if (ax_tree) {
 +      ui::AXNode* ax_node = ax_tree->GetFromId(node_data.id);
 +      if (ax_node) {
 +        // GetNodeBounds now returns CSS pixels directly
@@ -396,14 +902,14 @@ index 0000000000000..885942336dcd6
 +    // Add context from parent node
 +    int32_t parent_id = node_data.relative_bounds.offset_container_id;
 +    if (parent_id >= 0) {
-+      std::string context = CollectTextFromNode(parent_id, node_map, 200);
++      std::string context = CollectTextFromNode(parent_id, flat_tree, 200);
 +      if (!context.empty()) {
 +        data.attributes["context"] = context;
 +      }
 +    }
 +    
 +    // Add path and depth using offset_container_id chain
-+    auto [path, depth] = BuildPathAndDepth(node_data.id, node_map);
++    auto [path, depth] = BuildPathAndDepth(node_data.id, flat_tree);
 +    if (!path.empty()) {
 +      data.attributes["path"] = path;
 +    }
@@ -414,9 +920,32 @@ index 0000000000000..885942336dcd6
 +    // offscreen=true means the node is NOT in viewport (completely hidden)
 +    data.attributes["in_viewport"] = is_offscreen ? "false" : "true";
 +    
-+    results.push_back(std::move(data));
++    results->push_back(std::move(data));
++  }
++}
++
++// Worker body: claim small chunks off the shared cursor until the node
++// array is exhausted. Chunks are small enough that a few expensive nodes
++// (deep context subtrees) cannot leave other cores idle.
++std::vector<SnapshotProcessor::ProcessedNode> SnapshotProcessor::StealNodeChunks(
++    scoped_refptr<ProcessingContext> context) {
++  TRACE_EVENT0("browseros", "SnapshotProcessor::StealNodeChunks");
++  constexpr size_t kStealChunkSize = 32;
++
++  std::vector<ProcessedNode> results;
++  const std::vector<int32_t>& node_indices = context->nodes_to_process;
++
++  while (true) {
++    size_t begin = context->next_node_index.fetch_add(kStealChunkSize,
++                                                      std::memory_order_relaxed);
++    if (begin >= node_indices.size()) {
++      break;
++    }
++    size_t end = std::min(begin + kStealChunkSize, node_indices.size());
++    ProcessNodeRange(node_indices, begin, end, context->flat_tree,
++                     context->ax_tree.get(), context->device_scale_factor,
++                     &results);
 +  }
-+  
 +  return results;
 +}
 +
@@ -424,7 +953,10 @@ index 0000000000000..885942336dcd6
 +void SnapshotProcessor::OnBatchProcessed(
 +    scoped_refptr<ProcessingContext> context,
 +    std::vector<ProcessedNode> batch_results) {
-+  // Process batch results
++  // Process batch results. Ids are positional, so each node's registry
++  // slot is its id; batches land out of order, and the grow-on-demand
++  // resize keeps whichever arrives first from indexing past the end.
++  NodeRegistry& registry = GetNodeRegistries()[context->tab_id];
 +  for (const auto& node_data : batch_results) {
 +    // Store mapping from our nodeId to AX node ID, bounds, and attributes
 +    NodeInfo info;
@@ -436,7 +968,10 @@ index 0000000000000..885942336dcd6
 +    // Extract in_viewport from attributes (stored as "true"/"false" string)
 +    auto viewport_it = node_data.attributes.find("in_viewport");
 +    info.in_viewport = (viewport_it != node_data.attributes.end() && viewport_it->second == "true");
-+    GetNodeIdMappings()[context->tab_id][node_data.node_id] = info;
++    if (node_data.node_id > registry.nodes.size()) {
++      registry.nodes.resize(node_data.node_id);
++    }
++    registry.nodes[node_data.node_id - 1] = std::move(info);
 +    
 +    // Log the mapping for debugging
 +    VLOG(2) << "Node ID Mapping: Interactive nodeId=" << node_data.node_id 
@@ -461,9 +996,16 @@ index 0000000000000..885942336dcd6
 +    if (!node_data.attributes.empty()) {
 +      browser_os::InteractiveNode::Attributes attributes;
 +      
-+      // Iterate over all attributes and add them to the dictionary
++      // Iterate over all attributes and add them to the dictionary. With
++      // interning enabled, values become indices into the string table so
++      // repeated roles/paths/classes are serialized once.
 +      for (const auto& [key, value] : node_data.attributes) {
-+        attributes.additional_properties.Set(key, value);
++        if (context->intern_strings) {
++          attributes.additional_properties.Set(key,
++                                               context->InternString(value));
++        } else {
++          attributes.additional_properties.Set(key, value);
++        }
 +      }
 +      
 +      interactive_node.attributes = std::move(attributes);
@@ -476,6 +1018,8 @@ index 0000000000000..885942336dcd6
 +  
 +  // Check if all batches are complete
 +  if (context->processed_batches == context->total_batches) {
++    TRACE_EVENT1("browseros", "SnapshotProcessor::Finalize", "elements",
++                 context->snapshot.elements.size());
 +    // Sort elements by node_id to maintain consistent ordering
 +    std::sort(context->snapshot.elements.begin(), 
 +              context->snapshot.elements.end(),
@@ -487,6 +1031,14 @@ index 0000000000000..885942336dcd6
 +    // Leave hierarchical_structure empty for now as requested
 +    context->snapshot.hierarchical_structure = "";
 +
++    // Attach the deduplicated string table when interning was requested
++    if (context->intern_strings) {
++      VLOG(1) << "[browseros] Interned " << context->string_table.size()
++              << " unique strings for " << context->snapshot.elements.size()
++              << " elements";
++      context->snapshot.string_table = std::move(context->string_table);
++    }
++
 +    base::TimeDelta processing_time = base::TimeTicks::Now() - context->start_time;
 +    LOG(INFO) << "[PERF] Interactive snapshot processed in " 
 +              << processing_time.InMilliseconds() << " ms"
@@ -499,9 +1051,14 @@ index 0000000000000..885942336dcd6
 +    result.snapshot = std::move(context->snapshot);
 +    result.nodes_processed = context->total_nodes;
 +    result.processing_time_ms = processing_time.InMilliseconds();
-+    
-+    // Run callback (context will be deleted when last ref is released)
-+    std::move(context->callback).Run(std::move(result));
++
++    // Pool the context before running the callback: the streamed-snapshot
++    // path kicks off the full-tree pass synchronously from its callback, and
++    // this ordering lets that pass pick the context straight back up.
++    base::OnceCallback<void(SnapshotProcessingResult)> done =
++        std::move(context->callback);
++    MaybePoolContext(std::move(context));
++    std::move(done).Run(std::move(result));
 +  }
 +}
 +
@@ -532,32 +1089,65 @@ index 0000000000000..885942336dcd6
 +}
 +
 +void SnapshotProcessor::ProcessAccessibilityTree(
-+    const ui::AXTreeUpdate& tree_update,
++    ui::AXTreeUpdate tree_update,
 +    int tab_id,
 +    uint32_t snapshot_id,
 +    content::WebContents* web_contents,
-+    base::OnceCallback<void(SnapshotProcessingResult)> callback) {
++    base::OnceCallback<void(SnapshotProcessingResult)> callback,
++    bool intern_strings,
++    bool viewport_only) {
++  TRACE_EVENT2("browseros", "SnapshotProcessor::ProcessAccessibilityTree",
++               "nodes", tree_update.nodes.size(), "viewport_only",
++               viewport_only);
 +  base::TimeTicks start_time = base::TimeTicks::Now();
-+  
++
 +  // Extract viewport info from WebContents on UI thread
 +  auto [viewport_size, device_scale_factor] = ExtractViewportInfo(web_contents);
-+  
-+  // Build node ID map, parent map and children map for efficient lookup
-+  std::unordered_map<int32_t, ui::AXNodeData> node_map;
-+  std::unordered_map<int32_t, int32_t> parent_map;
-+  std::unordered_map<int32_t, std::vector<int32_t>> children_map;
-+  
-+  for (const auto& node : tree_update.nodes) {
-+    node_map[node.id] = node;
-+    // Build parent and children relationships
-+    for (int32_t child_id : node.child_ids) {
-+      parent_map[child_id] = node.id;
-+      children_map[node.id].push_back(child_id);
++
++  // Prepare processing context using RefCounted. Created up front so the
++  // node/parent/children maps can be built directly into its arena instead
++  // of heap-allocating per node and moving afterwards. A context pooled by a
++  // previous snapshot of this tab is reused when available: its containers
++  // come back with capacity (and the arena with a chunk) sized by the last
++  // request, so steady-state agent polling rebuilds the maps without going
++  // to the system allocator.
++  scoped_refptr<ProcessingContext> context;
++  auto& pool = GetContextPool();
++  auto pooled = pool.find(tab_id);
++  if (pooled != pool.end()) {
++    context = std::move(pooled->second);
++    pool.erase(pooled);
++  } else {
++    context = base::MakeRefCounted<ProcessingContext>();
++  }
++
++  // Start a new registry generation for this tab; the batch results below
++  // repopulate the slots.
++  GetNodeRegistries()[tab_id].BeginRebuild();
++
++  // While the full node list is at hand, remember the page's main
++  // scrollable container so Scroll can target it with one direct
++  // accessibility action instead of synthesizing wheel events. The nodes
++  // arrive in document order, so the first container with scroll range is
++  // the root scroller.
++  if (web_contents) {
++    for (const ui::AXNodeData& node : tree_update.nodes) {
++      if (!node.GetBoolAttribute(ax::mojom::BoolAttribute::kScrollable)) {
++        continue;
++      }
++      const bool can_scroll_x =
++          node.GetIntAttribute(ax::mojom::IntAttribute::kScrollXMax) >
++          node.GetIntAttribute(ax::mojom::IntAttribute::kScrollXMin);
++      const bool can_scroll_y =
++          node.GetIntAttribute(ax::mojom::IntAttribute::kScrollYMax) >
++          node.GetIntAttribute(ax::mojom::IntAttribute::kScrollYMin);
++      if (can_scroll_x || can_scroll_y) {
++        BrowserOSTreeCache::GetOrCreate(web_contents)
++            ->SetScrollTarget(node.id);
++        break;
++      }
 +    }
 +  }
-+  
-+  // Clear previous mappings for this tab
-+  GetNodeIdMappings()[tab_id].clear();
 +
 +  // Create an AXTree from the tree update for accurate bounds computation
 +  std::unique_ptr<ui::AXTree> ax_tree = std::make_unique<ui::AXTree>(tree_update);
@@ -574,14 +1164,9 @@ index 0000000000000..885942336dcd6
 +  LOG(INFO) << "[browseros] Created AXTree with " << tree_update.nodes.size() 
 +            << " nodes for bounds computation";
 +  
-+  // Prepare processing context using RefCounted
-+  auto context = base::MakeRefCounted<ProcessingContext>();
 +  context->snapshot.snapshot_id = snapshot_id;
 +  context->snapshot.timestamp = base::Time::Now().InMillisecondsFSinceUnixEpoch();
 +  context->tab_id = tab_id;
-+  context->node_map = std::move(node_map);
-+  context->parent_map = std::move(parent_map); 
-+  context->children_map = std::move(children_map);
 +  context->ax_tree = std::move(ax_tree);  // Store AXTree for bounds computation
 +  context->device_scale_factor = device_scale_factor;  // For CSS pixel conversion
 +  context->viewport_size = viewport_size;  // For visibility checks
@@ -596,21 +1181,85 @@ index 0000000000000..885942336dcd6
 +  // TODO: Implement proper viewport detection if needed
 +  context->callback = std::move(callback);
 +  context->processed_batches = 0;
-+  
++  context->intern_strings = intern_strings;
++
++  // Build the flat tree last so it can adopt the update's nodes outright:
++  // everything above that reads |tree_update| (AXTree construction, the
++  // scroll-target scan, the tree id) has already run, and moving transfers
++  // each node's heap payload instead of deep-copying it.
++  {
++    TRACE_EVENT0("browseros", "SnapshotProcessor::BuildFlatTree");
++    context->flat_tree.Build(std::move(tree_update));
++    context->flat_tree.ComputeAbsoluteBounds(device_scale_factor);
++  }
++
 +  // Collect all nodes to process and filter
-+  std::vector<ui::AXNodeData> nodes_to_process;
-+  for (const auto& node : tree_update.nodes) {
-+    // Skip invisible, ignored, or non-interactive nodes
-+    if (ShouldSkipNode(node)) {
-+      continue;
++  if (viewport_only && context->flat_tree.has_bounds() &&
++      !viewport_size.IsEmpty()) {
++    TRACE_EVENT0("browseros", "SnapshotProcessor::ViewportCull");
++    // Viewport culling pre-pass: DFS over the flat tree that drops nodes
++    // whose clipped bounds fall outside the visible viewport, and skips
++    // entire subtrees when an out-of-view container clips its children
++    // (nothing below it can become visible).
++    const gfx::RectF viewport_rect(
++        gfx::SizeF(viewport_size.width(), viewport_size.height()));
++    std::vector<int32_t> stack;
++    for (size_t i = 0; i < context->flat_tree.size(); ++i) {
++      if (context->flat_tree.LinksAt(static_cast<int32_t>(i)).parent ==
++          FlatAXTree::kInvalidIndex) {
++        stack.push_back(static_cast<int32_t>(i));
++      }
++    }
++    size_t visited = 0;
++    while (!stack.empty()) {
++      int32_t index = stack.back();
++      stack.pop_back();
++      ++visited;
++
++      const ui::AXNodeData& node = context->flat_tree.NodeAt(index);
++      const FlatAXTree::NodeBounds& node_bounds =
++          context->flat_tree.BoundsAt(index);
++      const bool outside = node_bounds.offscreen ||
++                           !node_bounds.rect.Intersects(viewport_rect);
++
++      if (!outside && !ShouldSkipNode(node)) {
++        context->nodes_to_process.push_back(index);
++      }
++
++      // Prune the whole subtree only when clipping guarantees descendants
++      // cannot escape the out-of-view container.
++      if (outside &&
++          node.GetBoolAttribute(ax::mojom::BoolAttribute::kClipsChildren)) {
++        continue;
++      }
++      for (int32_t child = context->flat_tree.LinksAt(index).first_child;
++           child != FlatAXTree::kInvalidIndex;
++           child = context->flat_tree.LinksAt(child).next_sibling) {
++        stack.push_back(child);
++      }
++    }
++    VLOG(1) << "[browseros] Viewport culling visited " << visited << " of "
++            << context->flat_tree.size() << " nodes, kept "
++            << context->nodes_to_process.size();
++  } else {
++    for (size_t i = 0; i < context->flat_tree.size(); ++i) {
++      const int32_t index = static_cast<int32_t>(i);
++      // Skip invisible, ignored, or non-interactive nodes
++      if (ShouldSkipNode(context->flat_tree.NodeAt(index))) {
++        continue;
++      }
++      context->nodes_to_process.push_back(index);
 +    }
-+    nodes_to_process.push_back(node);
 +  }
-+  
-+  context->total_nodes = nodes_to_process.size();
-+  
++
++  context->total_nodes = context->nodes_to_process.size();
++
++  // Ids are 1..N over the filtered list, so the registry can be sized
++  // exactly up front; the batch merge then only assigns slots.
++  GetNodeRegistries()[tab_id].nodes.resize(context->nodes_to_process.size());
++
 +  // Handle empty case
-+  if (nodes_to_process.empty()) {
++  if (context->nodes_to_process.empty()) {
 +    base::TimeDelta processing_time = base::TimeTicks::Now() - start_time;
 +    context->snapshot.processing_time_ms = processing_time.InMilliseconds();
 +    
@@ -618,32 +1267,35 @@ index 0000000000000..885942336dcd6
 +    result.snapshot = std::move(context->snapshot);
 +    result.nodes_processed = 0;
 +    result.processing_time_ms = processing_time.InMilliseconds();
-+    std::move(context->callback).Run(std::move(result));
++    base::OnceCallback<void(SnapshotProcessingResult)> done =
++        std::move(context->callback);
++    MaybePoolContext(std::move(context));
++    std::move(done).Run(std::move(result));
 +    return;
 +  }
 +  
-+  // Process nodes in batches using ThreadPool
-+  const size_t batch_size = 100;  // Process 100 nodes per batch
-+  size_t num_batches = (nodes_to_process.size() + batch_size - 1) / batch_size;
-+  context->total_batches = num_batches;
-+  
-+  for (size_t i = 0; i < nodes_to_process.size(); i += batch_size) {
-+    size_t end = std::min(i + batch_size, nodes_to_process.size());
-+    std::vector<ui::AXNodeData> batch(
-+        std::make_move_iterator(nodes_to_process.begin() + i),
-+        std::make_move_iterator(nodes_to_process.begin() + end));
-+    uint32_t start_node_id = i + 1;  // Node IDs start at 1
-+    
-+    // Post task to ThreadPool and handle result on UI thread
-+    base::ThreadPool::PostTaskAndReplyWithResult(
++  // Process nodes in parallel on the dedicated snapshot runner. Rather
++  // than pre-partitioning into fixed batches (which lets one expensive
++  // range serialize the whole snapshot), spawn one worker per core and let
++  // workers claim small chunks off a shared atomic cursor until the array
++  // is drained.
++  const size_t max_workers = std::max(1, base::SysInfo::NumberOfProcessors());
++  constexpr size_t kMinNodesPerWorker = 64;
++  const size_t num_workers = std::max<size_t>(
++      1, std::min(max_workers,
++                  context->nodes_to_process.size() / kMinNodesPerWorker + 1));
++  context->total_batches = num_workers;
++
++  VLOG(1) << "[browseros] Snapshot processing with " << num_workers
++          << " workers over " << context->nodes_to_process.size() << " nodes";
++
++  for (size_t i = 0; i < num_workers; ++i) {
++    // Each worker holds a ref on |context|, which keeps the node array and
++    // arena-backed flat tree alive until every worker has completed.
++    GetSnapshotTaskRunner()->PostTaskAndReplyWithResult(
 +        FROM_HERE,
-+        {base::TaskPriority::USER_VISIBLE},
-+        base::BindOnce(&SnapshotProcessor::ProcessNodeBatch, 
-+                       std::move(batch), 
-+                       context->node_map,
-+                       context->ax_tree.get(),  // Pass AXTree pointer for bounds computation
-+                       start_node_id,
-+                       context->device_scale_factor),  // Pass DSF for CSS pixel conversion
++        WrapSnapshotTask(
++            base::BindOnce(&SnapshotProcessor::StealNodeChunks, context)),
 +        base::BindOnce(&SnapshotProcessor::OnBatchProcessed,
 +                       context));
 +  }
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h
 new file mode 100644
-index 0000000000000..5c85cd73b26f3
+index 0000000000000..ee578a0ab0596
 --- /dev/null
 +++ b/chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h
-@@ -0,0 +1,111 @@
+@@ -0,0 +1,305 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,6 +11,7 @@ index 0000000000000..5c85cd73b26f3
 +#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SNAPSHOT_PROCESSOR_H_
 +#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SNAPSHOT_PROCESSOR_H_
 +
++#include <atomic>
 +#include <cstdint>
 +#include <string>
 +#include <unordered_map>
@@ -18,6 +19,7 @@ index 0000000000000..5c85cd73b26f3
 +
 +#include "base/functional/callback.h"
 +#include "base/memory/raw_ptr.h"
++#include "base/memory/scoped_refptr.h"
 +#include "chrome/common/extensions/api/browser_os.h"
 +#include "ui/gfx/geometry/rect_f.h"
 +
@@ -37,6 +39,166 @@ index 0000000000000..5c85cd73b26f3
 +namespace extensions {
 +namespace api {
 +
++// Bump allocator backing a single snapshot's node bookkeeping. Allocations
++// are served from large contiguous chunks and never freed individually; the
++// whole arena is released in one shot when it is destroyed alongside the
++// ProcessingContext. This avoids one malloc/free pair per AX node for the
++// node/parent/children maps, which dominates the profile on pages with tens
++// of thousands of nodes. Not thread-safe: allocate only on the sequence that
++// owns the arena (the maps are built and destroyed on the UI thread).
++class SnapshotArena {
++ public:
++  explicit SnapshotArena(size_t chunk_size = kDefaultChunkSize);
++  ~SnapshotArena();
++
++  SnapshotArena(const SnapshotArena&) = delete;
++  SnapshotArena& operator=(const SnapshotArena&) = delete;
++
++  // Returns |size| bytes aligned to |alignment|. Never returns null;
++  // allocations larger than the chunk size get a dedicated chunk.
++  void* Allocate(size_t size, size_t alignment);
++
++  // Rewinds the arena for reuse: frees every chunk except the newest (the
++  // largest one in steady state) and resets the bump cursor to its start, so
++  // the next snapshot's allocations are served without going back to the
++  // system allocator. The caller must have released every container backed
++  // by this arena first.
++  void Reset();
++
++  // Total bytes reserved from the system allocator, for logging and the
++  // memory-infra dump. Atomic (relaxed) because the dump provider samples it
++  // from the dump sequence while the owning thread may be allocating.
++  size_t bytes_reserved() const {
++    return bytes_reserved_.load(std::memory_order_relaxed);
++  }
++
++ private:
++  static constexpr size_t kDefaultChunkSize = 1 << 20;  // 1 MiB
++
++  struct Chunk;
++
++  size_t chunk_size_;
++  std::atomic<size_t> bytes_reserved_{0};
++  Chunk* head_ = nullptr;  // Singly-linked list of chunks, newest first.
++  char* cursor_ = nullptr;
++  char* limit_ = nullptr;
++};
++
++// Minimal STL allocator adapter over SnapshotArena. deallocate() is a no-op;
++// memory is reclaimed when the arena dies.
++template <typename T>
++class SnapshotArenaAllocator {
++ public:
++  using value_type = T;
++
++  explicit SnapshotArenaAllocator(SnapshotArena* arena) : arena_(arena) {}
++  template <typename U>
++  SnapshotArenaAllocator(const SnapshotArenaAllocator<U>& other)
++      : arena_(other.arena()) {}
++
++  T* allocate(size_t n) {
++    return static_cast<T*>(arena_->Allocate(n * sizeof(T), alignof(T)));
++  }
++  void deallocate(T*, size_t) {}  // Bulk-freed by the arena.
++
++  SnapshotArena* arena() const { return arena_; }
++
++  friend bool operator==(const SnapshotArenaAllocator& a,
++                         const SnapshotArenaAllocator& b) {
++    return a.arena_ == b.arena_;
++  }
++  friend bool operator!=(const SnapshotArenaAllocator& a,
++                         const SnapshotArenaAllocator& b) {
++    return !(a == b);
++  }
++
++ private:
++  template <typename U>
++  friend class SnapshotArenaAllocator;
++
++  raw_ptr<SnapshotArena> arena_;
++};
++
++// Flat, arena-backed representation of an AXTreeUpdate. Node data lives in
++// one contiguous vector in update order and the tree structure is encoded as
++// first-child/next-sibling indices into that vector, so DFS/BFS walks touch
++// memory linearly instead of chasing three separate hash maps across the
++// heap. A single id->index map remains for lookups by AX node id (ids are
++// sparse); everything else is index arithmetic.
++class FlatAXTree {
++ public:
++  static constexpr int32_t kInvalidIndex = -1;
++
++  // Structural links for the node at the same index in the node vector.
++  struct Links {
++    int32_t parent = kInvalidIndex;
++    int32_t first_child = kInvalidIndex;
++    int32_t next_sibling = kInvalidIndex;
++  };
++
++  explicit FlatAXTree(SnapshotArena* arena);
++  ~FlatAXTree();
++
++  FlatAXTree(const FlatAXTree&) = delete;
++  FlatAXTree& operator=(const FlatAXTree&) = delete;
++
++  // Copies the update's nodes into the flat layout and wires up the
++  // first-child/next-sibling links. Two linear passes over the nodes.
++  void Build(const ui::AXTreeUpdate& tree_update);
++
++  // As above, but takes ownership of the update and moves each node's heap
++  // payload (strings, attribute vectors) instead of deep-copying it. This is
++  // the path the snapshot pipeline uses; on 50k-node trees the per-node
++  // copies it avoids amount to tens of MB per call.
++  void Build(ui::AXTreeUpdate&& tree_update);
++
++  size_t size() const { return nodes_.size(); }
++  const ui::AXNodeData& NodeAt(int32_t index) const { return nodes_[index]; }
++  const Links& LinksAt(int32_t index) const { return links_[index]; }
++
++  // Returns kInvalidIndex / null if |ax_node_id| is not in the tree.
++  int32_t IndexOf(int32_t ax_node_id) const;
++  const ui::AXNodeData* Find(int32_t ax_node_id) const;
++
++  // Absolute bounds in CSS pixels for the node at the same index, filled in
++  // by ComputeAbsoluteBounds().
++  struct NodeBounds {
++    gfx::RectF rect;
++    bool offscreen = false;
++  };
++
++  // Computes every node's absolute rect in one top-down pass: each rect is
++  // derived from its offset container's already-computed rect (offset
++  // containers are always ancestors, so DFS order suffices) instead of
++  // re-walking the ancestor chain per node. Applies container scroll
++  // offsets, transforms and clipping, and divides by |device_scale_factor|
++  // once at the end.
++  void ComputeAbsoluteBounds(float device_scale_factor);
++
++  bool has_bounds() const { return !bounds_.empty(); }
++  const NodeBounds& BoundsAt(int32_t index) const { return bounds_[index]; }
++
++  // Drops all buffers (deallocation is a no-op for the arena allocator) so
++  // the backing arena can be rewound; a reused tree re-reserves from the
++  // rewound arena on the next Build().
++  void Reset();
++
++ private:
++  // Pass 2 of Build(): wires up the first-child/next-sibling links from the
++  // already-populated node vector.
++  void WireLinks();
++
++  std::vector<ui::AXNodeData, SnapshotArenaAllocator<ui::AXNodeData>> nodes_;
++  std::vector<Links, SnapshotArenaAllocator<Links>> links_;
++  std::vector<NodeBounds, SnapshotArenaAllocator<NodeBounds>> bounds_;
++  std::unordered_map<int32_t,
++                     int32_t,
++                     std::hash<int32_t>,
++                     std::equal_to<int32_t>,
++                     SnapshotArenaAllocator<std::pair<const int32_t, int32_t>>>
++      id_to_index_;
++};
++
 +// Result of snapshot processing
 +struct SnapshotProcessingResult {
 +  browser_os::InteractiveSnapshot snapshot;
@@ -72,27 +234,59 @@ index 0000000000000..5c85cd73b26f3
 +  // This function processes the accessibility tree into an interactive snapshot
 +  // using parallel processing on the thread pool. Extracts viewport info from
 +  // web_contents on UI thread before processing.
++  // Takes the update by value: callers that are done with it should
++  // std::move() it in, which lets the flat tree adopt the nodes' heap
++  // payloads instead of deep-copying every AXNodeData.
++  // When |intern_strings| is set, repeated attribute values are deduplicated
++  // into InteractiveSnapshot.stringTable and emitted as indices.
++  // When |viewport_only| is set, nodes outside the visible viewport are
++  // culled before per-node processing, pruning whole subtrees when a
++  // clipping container is already out of view.
 +  static void ProcessAccessibilityTree(
-+      const ui::AXTreeUpdate& tree_update,
++      ui::AXTreeUpdate tree_update,
 +      int tab_id,
 +      uint32_t snapshot_id,
 +      content::WebContents* web_contents,
-+      base::OnceCallback<void(SnapshotProcessingResult)> callback);
-+
-+  // Process a batch of nodes (exposed for testing)
-+  // The ax_tree is used to compute accurate bounds for each node
-+  // device_scale_factor is used to convert physical pixels to CSS pixels
-+  static std::vector<ProcessedNode> ProcessNodeBatch(
-+      const std::vector<ui::AXNodeData>& nodes_to_process,
-+      const std::unordered_map<int32_t, ui::AXNodeData>& node_map,
-+      ui::AXTree* ax_tree,
-+      uint32_t start_node_id,
-+      float device_scale_factor = 1.0f);
++      base::OnceCallback<void(SnapshotProcessingResult)> callback,
++      bool intern_strings = false,
++      bool viewport_only = false);
++
++  // Process the entries in [begin, end) of |node_indices| — indices into
++  // |flat_tree|, which owns the node data — appending to |results| (exposed
++  // for testing). Node ids are derived from the global index so the output
++  // is deterministic regardless of which worker processes the range.
++  // The ax_tree is used to compute accurate bounds for each node;
++  // device_scale_factor converts physical pixels to CSS pixels.
++  static void ProcessNodeRange(const std::vector<int32_t>& node_indices,
++                               size_t begin,
++                               size_t end,
++                               const FlatAXTree& flat_tree,
++                               ui::AXTree* ax_tree,
++                               float device_scale_factor,
++                               std::vector<ProcessedNode>* results);
 +
 + private:
 +  // Internal processing context
 +  struct ProcessingContext;
-+  
++
++  // Idle contexts kept for reuse between snapshot requests, keyed by tab id
++  // like the node-id mappings. UI thread only.
++  static std::unordered_map<int, scoped_refptr<ProcessingContext>>&
++  GetContextPool();
++
++  // Returns a finished context to the pool after clearing its per-request
++  // state (plain-heap containers keep their capacity, the arena keeps its
++  // largest chunk). Skipped when another ref is still live or the arena has
++  // grown past the pooling cap; the context is then simply destroyed.
++  static void MaybePoolContext(scoped_refptr<ProcessingContext> context);
++
++  // Worker body for parallel snapshot processing. Workers repeatedly claim
++  // small chunks of the shared node array via an atomic cursor until it is
++  // exhausted, so one expensive subtree cannot serialize the snapshot while
++  // other cores idle.
++  static std::vector<ProcessedNode> StealNodeChunks(
++      scoped_refptr<ProcessingContext> context);
++
 +  // Compute absolute bounds for a node using AXTree and convert to CSS pixels
 +  // This implements the same logic as BrowserAccessibility::GetBoundsRect
 +  // Returns bounds in CSS pixels by applying device_scale_factor
@@ -115,4 +309,3 @@ index 0000000000000..5c85cd73b26f3
 +}  // namespace extensions
 +
 +#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_SNAPSHOT_PROCESSOR_H_
-\ No newline at end of file
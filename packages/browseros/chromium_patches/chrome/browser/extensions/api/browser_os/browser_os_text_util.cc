@@ -0,0 +1,157 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_text_util.cc b/chrome/browser/extensions/api/browser_os/browser_os_text_util.cc
+new file mode 100644
+index 0000000000000..ce0ef66977c1a
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_text_util.cc
+@@ -0,0 +1,151 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_text_util.h"
++
++#include <cstdint>
++
++#include "base/strings/string_util.h"
++#include "build/build_config.h"
++
++#if defined(ARCH_CPU_X86_FAMILY)
++#include <emmintrin.h>
++#elif defined(ARCH_CPU_ARM_FAMILY) && defined(__ARM_NEON)
++#include <arm_neon.h>
++#endif
++
++namespace extensions {
++namespace api {
++
++namespace {
++
++// Returns the number of leading characters in [data, data + len) that are
++// certainly not whitespace candidates (> 0x20), rounded down to whole
++// vector blocks. Everything in that prefix can be copied wholesale; the
++// caller handles the rest scalar. Works for UTF-8 bytes because the
++// comparison is unsigned, so continuation bytes >= 0x80 never match.
++size_t NonWhitespacePrefix(const char* data, size_t len) {
++  size_t i = 0;
++#if defined(ARCH_CPU_X86_FAMILY)
++  const __m128i limit = _mm_set1_epi8(0x20);
++  for (; i + 16 <= len; i += 16) {
++    __m128i chunk =
++        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
++    // bytes <= 0x20 saturate to zero; any zero lane is a candidate.
++    __m128i candidates =
++        _mm_cmpeq_epi8(_mm_subs_epu8(chunk, limit), _mm_setzero_si128());
++    if (_mm_movemask_epi8(candidates) != 0) {
++      break;
++    }
++  }
++#elif defined(ARCH_CPU_ARM_FAMILY) && defined(__ARM_NEON)
++  const uint8x16_t limit = vdupq_n_u8(0x20);
++  for (; i + 16 <= len; i += 16) {
++    uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(data + i));
++    uint8x16_t candidates = vcleq_u8(chunk, limit);
++    if (vmaxvq_u8(candidates) != 0) {
++      break;
++    }
++  }
++#endif
++  return i;
++}
++
++// u16 variant of NonWhitespacePrefix; eight characters per block.
++size_t NonWhitespacePrefix16(const char16_t* data, size_t len) {
++  size_t i = 0;
++#if defined(ARCH_CPU_X86_FAMILY)
++  const __m128i limit = _mm_set1_epi16(0x20);
++  for (; i + 8 <= len; i += 8) {
++    __m128i chunk =
++        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
++    __m128i candidates =
++        _mm_cmpeq_epi16(_mm_subs_epu16(chunk, limit), _mm_setzero_si128());
++    if (_mm_movemask_epi8(candidates) != 0) {
++      break;
++    }
++  }
++#elif defined(ARCH_CPU_ARM_FAMILY) && defined(__ARM_NEON)
++  const uint16x8_t limit = vdupq_n_u16(0x20);
++  for (; i + 8 <= len; i += 8) {
++    uint16x8_t chunk = vld1q_u16(reinterpret_cast<const uint16_t*>(data + i));
++    uint16x8_t candidates = vcleq_u16(chunk, limit);
++    if (vmaxvq_u16(candidates) != 0) {
++      break;
++    }
++  }
++#endif
++  return i;
++}
++
++}  // namespace
++
++std::string CollapseWhitespaceASCII(std::string_view text) {
++  std::string out;
++  out.reserve(text.size());
++
++  bool pending_space = false;
++  size_t i = 0;
++  while (i < text.size()) {
++    // Bulk-copy the run up to the next whitespace candidate.
++    size_t clean = NonWhitespacePrefix(text.data() + i, text.size() - i);
++    if (clean > 0) {
++      if (pending_space && !out.empty()) {
++        out += ' ';
++      }
++      pending_space = false;
++      out.append(text, i, clean);
++      i += clean;
++      continue;
++    }
++
++    const char c = text[i++];
++    if (base::IsAsciiWhitespace(c)) {
++      // Run of whitespace becomes one space, and only between words:
++      // leading/trailing runs are dropped because the space is emitted
++      // lazily when the next word arrives.
++      pending_space = true;
++    } else {
++      if (pending_space && !out.empty()) {
++        out += ' ';
++      }
++      pending_space = false;
++      out += c;
++    }
++  }
++  return out;
++}
++
++std::u16string CollapseStructuredWhitespace(std::u16string_view text) {
++  std::u16string out;
++  out.reserve(text.size());
++
++  size_t i = 0;
++  while (i < text.size()) {
++    size_t clean = NonWhitespacePrefix16(text.data() + i, text.size() - i);
++    if (clean > 0) {
++      out.append(text, i, clean);
++      i += clean;
++      continue;
++    }
++
++    const char16_t c = text[i++];
++    if (c == u' ' && !out.empty() && out.back() == u' ') {
++      continue;
++    }
++    if (c == u'\n' && out.size() >= 2 && out[out.size() - 1] == u'\n' &&
++        out[out.size() - 2] == u'\n') {
++      continue;
++    }
++    out.push_back(c);
++  }
++
++  while (!out.empty() && (out.back() == u' ' || out.back() == u'\n')) {
++    out.pop_back();
++  }
++  return out;
++}
++
++}  // namespace api
++}  // namespace extensions
@@ -0,0 +1,41 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_text_util.h b/chrome/browser/extensions/api/browser_os/browser_os_text_util.h
+new file mode 100644
+index 0000000000000..4314861597ad7
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_text_util.h
+@@ -0,0 +1,35 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TEXT_UTIL_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TEXT_UTIL_H_
++
++#include <string>
++#include <string_view>
++
++namespace extensions {
++namespace api {
++
++// Whitespace cleanup shared by the text-extraction pipelines
++// (ContentProcessor::CleanText and the side panel's page extractor). Both
++// run on every extraction, so the scans are vectorized: blocks with no
++// byte/char <= 0x20 - the overwhelmingly common case in article text -
++// are copied wholesale, and only blocks containing whitespace candidates
++// take the scalar path.
++
++// Collapses every whitespace run to a single space and trims both ends.
++// Matches TrimWhitespaceASCII + collapse over UTF-8 data; bytes >= 0x80
++// (multi-byte sequences) are copied untouched.
++std::string CollapseWhitespaceASCII(std::string_view text);
++
++// Structured variant for markdown-ish output: runs of spaces collapse to
++// one space, runs of newlines to at most two (so paragraph breaks
++// survive), other characters - including the tabs used for list
++// indentation - pass through, and trailing spaces/newlines are trimmed.
++std::u16string CollapseStructuredWhitespace(std::u16string_view text);
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TEXT_UTIL_H_
@@ -0,0 +1,275 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_tree_cache.cc b/chrome/browser/extensions/api/browser_os/browser_os_tree_cache.cc
+new file mode 100644
+index 0000000000000..b97a6b97eb644
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_tree_cache.cc
+@@ -0,0 +1,269 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/extensions/api/browser_os/browser_os_tree_cache.h"
++
++#include <utility>
++#include <vector>
++
++#include "base/hash/hash.h"
++#include "base/logging.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h"
++#include "content/public/browser/browser_accessibility_state.h"
++#include "content/public/browser/navigation_handle.h"
++#include "content/public/browser/scoped_accessibility_mode.h"
++#include "content/public/browser/web_contents.h"
++#include "ui/accessibility/ax_clipping_behavior.h"
++#include "ui/accessibility/ax_coordinate_system.h"
++#include "ui/accessibility/ax_node.h"
++#include "ui/accessibility/ax_tree_update.h"
++#include "ui/accessibility/ax_updates_and_events.h"
++#include "ui/gfx/geometry/rect_f.h"
++
++namespace extensions {
++namespace api {
++
++BrowserOSTreeCache::BrowserOSTreeCache(content::WebContents* web_contents)
++    : content::WebContentsObserver(web_contents),
++      content::WebContentsUserData<BrowserOSTreeCache>(*web_contents) {}
++
++BrowserOSTreeCache::~BrowserOSTreeCache() = default;
++
++// static
++BrowserOSTreeCache* BrowserOSTreeCache::GetOrCreate(
++    content::WebContents* web_contents) {
++  CreateForWebContents(web_contents);
++  return FromWebContents(web_contents);
++}
++
++void BrowserOSTreeCache::SeedFromSnapshot(const ui::AXTreeUpdate& tree_update,
++                                          bool includes_inline_text_boxes) {
++  if (tree_) {
++    tree_->RemoveObserver(this);
++  }
++  tree_ = std::make_unique<ui::AXTree>();
++  // Observe before unserializing: the per-node creation callbacks build the
++  // content fingerprint while the seed applies, and keep it current as
++  // later incremental updates land.
++  content_fingerprint_ = 0;
++  tree_->AddObserver(this);
++  if (!tree_->Unserialize(tree_update) || !tree_->root()) {
++    Invalidate("seed failed: " + tree_->error());
++    return;
++  }
++
++  tree_id_ = tree_update.has_tree_data ? tree_update.tree_data.tree_id
++                                       : ui::AXTreeID();
++  valid_ = true;
++  has_inline_text_boxes_ = includes_inline_text_boxes;
++
++  // Keep web accessibility serialization on for this tab so the renderer
++  // streams incremental updates that keep the cached tree current. Without
++  // this the one-off snapshot mode would leave the cache permanently stale.
++  if (!scoped_mode_) {
++    scoped_mode_ =
++        content::BrowserAccessibilityState::GetInstance()
++            ->CreateScopedModeForWebContents(
++                web_contents(),
++                ui::AXMode(ui::AXMode::kWebContents |
++                           ui::AXMode::kExtendedProperties |
++                           ui::AXMode::kInlineTextBoxes));
++  }
++
++  VLOG(1) << "[browseros] Tree cache seeded: " << tree_->size() << " nodes";
++}
++
++bool BrowserOSTreeCache::GetCachedTree(ui::AXTreeUpdate* out,
++                                       bool require_inline_text_boxes) const {
++  if (!valid_ || !tree_ || !tree_->root()) {
++    return false;
++  }
++
++  // A cache seeded from a lean snapshot cannot serve callers that need the
++  // full-fidelity tree; they fall back to the renderer and re-seed.
++  if (require_inline_text_boxes && !has_inline_text_boxes_) {
++    return false;
++  }
++
++  out->has_tree_data = true;
++  out->tree_data = tree_->data();
++  out->root_id = tree_->root()->id();
++  out->nodes.clear();
++  out->nodes.reserve(tree_->size());
++
++  // Emit nodes in pre-order (parents before children) so the result is a
++  // valid full-tree update for consumers that rebuild the hierarchy.
++  std::vector<const ui::AXNode*> stack;
++  stack.push_back(tree_->root());
++  while (!stack.empty()) {
++    const ui::AXNode* node = stack.back();
++    stack.pop_back();
++    out->nodes.push_back(node->data());
++    const auto& children = node->GetAllChildren();
++    for (auto it = children.rbegin(); it != children.rend(); ++it) {
++      stack.push_back(*it);
++    }
++  }
++  return true;
++}
++
++bool BrowserOSTreeCache::IsDescendantOf(int32_t node_id,
++                                        int32_t ancestor_id) const {
++  if (!valid_ || !tree_) {
++    return false;
++  }
++  for (const ui::AXNode* node = tree_->GetFromId(node_id); node;
++       node = node->parent()) {
++    if (node->id() == ancestor_id) {
++      return true;
++    }
++  }
++  return false;
++}
++
++void BrowserOSTreeCache::SetScrollTarget(int32_t ax_node_id) {
++  scroll_target_id_ = ax_node_id;
++}
++
++bool BrowserOSTreeCache::GetScrollTarget(ui::AXTreeID* tree_id,
++                                         int32_t* ax_node_id,
++                                         int* scroll_x,
++                                         int* scroll_y) const {
++  if (!valid_ || !tree_ || scroll_target_id_ == 0) {
++    return false;
++  }
++  const ui::AXNode* node = tree_->GetFromId(scroll_target_id_);
++  if (!node) {
++    return false;
++  }
++  *tree_id = tree_id_;
++  *ax_node_id = scroll_target_id_;
++  // Offsets come from the live tree, which incremental updates keep
++  // current, so relative scrolls can be computed browser-side.
++  *scroll_x = node->data().GetIntAttribute(ax::mojom::IntAttribute::kScrollX);
++  *scroll_y = node->data().GetIntAttribute(ax::mojom::IntAttribute::kScrollY);
++  return true;
++}
++
++void BrowserOSTreeCache::SetContentRoot(int32_t ax_node_id) {
++  content_root_id_ = ax_node_id;
++}
++
++bool BrowserOSTreeCache::GetContentRoot(int32_t* ax_node_id) const {
++  if (!valid_ || !tree_ || content_root_id_ == 0 ||
++      !tree_->GetFromId(content_root_id_)) {
++    return false;
++  }
++  *ax_node_id = content_root_id_;
++  return true;
++}
++
++bool BrowserOSTreeCache::GetNodeBounds(int32_t ax_node_id,
++                                       float device_scale_factor,
++                                       gfx::RectF* out_bounds) const {
++  if (!valid_ || !tree_) {
++    return false;
++  }
++  const ui::AXNode* node = tree_->GetFromId(ax_node_id);
++  if (!node) {
++    return false;
++  }
++  *out_bounds = SnapshotProcessor::GetNodeBounds(
++      tree_.get(), node, ui::AXCoordinateSystem::kFrame,
++      ui::AXClippingBehavior::kClipped, device_scale_factor);
++  return true;
++}
++
++bool BrowserOSTreeCache::GetContentFingerprint(uint64_t* fingerprint) const {
++  if (!valid_ || !tree_) {
++    return false;
++  }
++  *fingerprint = content_fingerprint_;
++  return true;
++}
++
++// static
++uint64_t BrowserOSTreeCache::NodeTextHash(const ui::AXNodeData& data) {
++  const std::string& name =
++      data.GetStringAttribute(ax::mojom::StringAttribute::kName);
++  const std::string& value =
++      data.GetStringAttribute(ax::mojom::StringAttribute::kValue);
++  if (name.empty() && value.empty()) {
++    return 0;
++  }
++  // Fold the node id in so two nodes carrying identical text don't cancel
++  // each other out of the XOR combine.
++  const uint64_t text_hash =
++      base::HashInts(base::FastHash(name), base::FastHash(value));
++  return base::HashInts(text_hash, static_cast<uint32_t>(data.id));
++}
++
++void BrowserOSTreeCache::OnNodeCreated(ui::AXTree* tree, ui::AXNode* node) {
++  content_fingerprint_ ^= NodeTextHash(node->data());
++}
++
++void BrowserOSTreeCache::OnNodeWillBeDeleted(ui::AXTree* tree,
++                                             ui::AXNode* node) {
++  content_fingerprint_ ^= NodeTextHash(node->data());
++}
++
++void BrowserOSTreeCache::OnNodeDataChanged(
++    ui::AXTree* tree,
++    const ui::AXNodeData& old_node_data,
++    const ui::AXNodeData& new_node_data) {
++  content_fingerprint_ ^=
++      NodeTextHash(old_node_data) ^ NodeTextHash(new_node_data);
++}
++
++void BrowserOSTreeCache::AccessibilityEventReceived(
++    const ui::AXUpdatesAndEvents& details) {
++  if (!valid_) {
++    return;
++  }
++
++  // Updates from other frames' trees can't be applied to this tree.
++  if (details.ax_tree_id != tree_id_) {
++    return;
++  }
++
++  for (const ui::AXTreeUpdate& update : details.updates) {
++    if (!tree_->Unserialize(update)) {
++      // The event stream can reference nodes the seed snapshot didn't
++      // include; bail out and let the next snapshot call re-seed.
++      Invalidate("update failed to apply: " + tree_->error());
++      return;
++    }
++  }
++}
++
++void BrowserOSTreeCache::DidFinishNavigation(
++    content::NavigationHandle* navigation_handle) {
++  if (!navigation_handle->IsInPrimaryMainFrame() ||
++      !navigation_handle->HasCommitted() ||
++      navigation_handle->IsSameDocument()) {
++    return;
++  }
++  Invalidate("cross-document navigation");
++}
++
++void BrowserOSTreeCache::Invalidate(const std::string& reason) {
++  VLOG(1) << "[browseros] Tree cache invalidated: " << reason;
++  valid_ = false;
++  if (tree_) {
++    tree_->RemoveObserver(this);
++  }
++  tree_.reset();
++  tree_id_ = ui::AXTreeID();
++  // Node ids are per-document; a recorded content root or scroll target
++  // must not survive into the next seed, where the same id can name an
++  // unrelated node.
++  content_root_id_ = 0;
++  scroll_target_id_ = 0;
++  content_fingerprint_ = 0;
++}
++
++WEB_CONTENTS_USER_DATA_KEY_IMPL(BrowserOSTreeCache);
++
++}  // namespace api
++}  // namespace extensions
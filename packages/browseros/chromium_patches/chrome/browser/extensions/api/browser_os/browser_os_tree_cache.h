@@ -0,0 +1,183 @@
+diff --git a/chrome/browser/extensions/api/browser_os/browser_os_tree_cache.h b/chrome/browser/extensions/api/browser_os/browser_os_tree_cache.h
+new file mode 100644
+index 0000000000000..76a8a2174bc93
+--- /dev/null
++++ b/chrome/browser/extensions/api/browser_os/browser_os_tree_cache.h
+@@ -0,0 +1,177 @@
++// Copyright 2024 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TREE_CACHE_H_
++#define CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TREE_CACHE_H_
++
++#include <memory>
++#include <string>
++
++#include "content/public/browser/web_contents_observer.h"
++#include "content/public/browser/web_contents_user_data.h"
++#include "ui/accessibility/ax_tree.h"
++#include "ui/accessibility/ax_tree_id.h"
++#include "ui/accessibility/ax_tree_observer.h"
++
++namespace content {
++class ScopedAccessibilityMode;
++class WebContents;
++}  // namespace content
++
++namespace gfx {
++class RectF;
++}  // namespace gfx
++
++namespace ui {
++struct AXTreeUpdate;
++struct AXUpdatesAndEvents;
++}  // namespace ui
++
++namespace extensions {
++namespace api {
++
++// Long-lived accessibility tree cache for a tab. The first snapshot call
++// still round-trips to the renderer; its result seeds a local ui::AXTree
++// which is then kept current by applying the incremental AXTreeUpdates the
++// renderer already streams for accessibility events. Subsequent snapshot
++// calls serialize from this local tree, skipping the full-tree renderer IPC
++// that dominates getInteractiveSnapshot/getAccessibilityTree latency.
++//
++// The cache is deliberately conservative: any update that fails to apply
++// (different serialization shape, unknown nodes) or any cross-document
++// navigation invalidates it, and the next snapshot call falls back to the
++// renderer and re-seeds.
++class BrowserOSTreeCache
++    : public content::WebContentsObserver,
++      public content::WebContentsUserData<BrowserOSTreeCache>,
++      public ui::AXTreeObserver {
++ public:
++  ~BrowserOSTreeCache() override;
++
++  BrowserOSTreeCache(const BrowserOSTreeCache&) = delete;
++  BrowserOSTreeCache& operator=(const BrowserOSTreeCache&) = delete;
++
++  // Returns the cache for |web_contents|, creating it on first use.
++  static BrowserOSTreeCache* GetOrCreate(content::WebContents* web_contents);
++
++  // Seeds (or re-seeds) the cache from a renderer snapshot.
++  // |includes_inline_text_boxes| records the fidelity of that snapshot: the
++  // interactive-snapshot paths request the tree without inline text boxes
++  // (the renderer then never serializes them), while getAccessibilityTree
++  // requests the full tree.
++  void SeedFromSnapshot(const ui::AXTreeUpdate& tree_update,
++                        bool includes_inline_text_boxes);
++
++  // Serializes the locally maintained tree into |out|. Returns false when
++  // the cache is cold or was invalidated, or when the caller requires
++  // inline text boxes but the cache was seeded from a lean snapshot;
++  // callers should then fall back to WebContents::RequestAXTreeSnapshot and
++  // re-seed with the result.
++  bool GetCachedTree(ui::AXTreeUpdate* out,
++                     bool require_inline_text_boxes = false) const;
++
++  // Returns true when |node_id| is |ancestor_id| or one of its descendants
++  // in the cached tree. Returns false when the cache is cold or invalid;
++  // callers that need "unknown" semantics should check valid() first.
++  bool IsDescendantOf(int32_t node_id, int32_t ancestor_id) const;
++
++  // Remembers the tab's main scrollable container, detected while the
++  // SnapshotProcessor has the full node list at hand.
++  void SetScrollTarget(int32_t ax_node_id);
++
++  // Returns the cached scrollable container together with its current
++  // scroll offsets from the live tree, so Scroll can issue one direct
++  // accessibility action instead of synthesizing wheel events. Returns
++  // false when the cache is cold or invalid or no container was detected.
++  bool GetScrollTarget(ui::AXTreeID* tree_id,
++                       int32_t* ax_node_id,
++                       int* scroll_x,
++                       int* scroll_y) const;
++
++  // Remembers the document's main content landmark, found by the
++  // ContentProcessor the first time it scans a snapshot for one, so later
++  // extractions in the same document skip the scan.
++  void SetContentRoot(int32_t ax_node_id);
++
++  // Returns true and fills |ax_node_id| when a content root is recorded
++  // and still exists in the live tree. Returns false when the cache is
++  // cold or invalid; the caller should then re-detect and re-record.
++  bool GetContentRoot(int32_t* ax_node_id) const;
++
++  // Recomputes |ax_node_id|'s clipped bounds from the live tree, in CSS
++  // pixels with |device_scale_factor| applied — the same computation the
++  // SnapshotProcessor does at snapshot time, but against the current tree
++  // state. Lets post-scroll actions refresh a node's coordinates without a
++  // full re-snapshot. Returns false when the cache is cold or invalid or
++  // the node is gone; callers should keep their snapshot-time bounds then.
++  bool GetNodeBounds(int32_t ax_node_id,
++                     float device_scale_factor,
++                     gfx::RectF* out_bounds) const;
++
++  // Returns true and fills |fingerprint| with the tab's text-content
++  // fingerprint: per-node hashes of accessible name and value, XOR-combined
++  // across the live tree and updated incrementally as accessibility events
++  // apply. Two equal fingerprints mean the page text is (almost certainly)
++  // unchanged, so agents can poll an 8-byte compare instead of a snapshot.
++  // Returns false when the cache is cold or invalid.
++  bool GetContentFingerprint(uint64_t* fingerprint) const;
++
++  bool valid() const { return valid_; }
++
++ private:
++  explicit BrowserOSTreeCache(content::WebContents* web_contents);
++  friend class content::WebContentsUserData<BrowserOSTreeCache>;
++
++  // content::WebContentsObserver:
++  void AccessibilityEventReceived(
++      const ui::AXUpdatesAndEvents& details) override;
++  void DidFinishNavigation(
++      content::NavigationHandle* navigation_handle) override;
++
++  // ui::AXTreeObserver — maintains |content_fingerprint_| incrementally.
++  // XOR combining is commutative and self-inverse, so removing a node's
++  // old hash and adding its new one keeps the fingerprint exact without
++  // rewalking the tree.
++  void OnNodeCreated(ui::AXTree* tree, ui::AXNode* node) override;
++  void OnNodeWillBeDeleted(ui::AXTree* tree, ui::AXNode* node) override;
++  void OnNodeDataChanged(ui::AXTree* tree,
++                         const ui::AXNodeData& old_node_data,
++                         const ui::AXNodeData& new_node_data) override;
++
++  // Hash of the text content a node contributes to the fingerprint; zero
++  // for nodes with neither an accessible name nor a value.
++  static uint64_t NodeTextHash(const ui::AXNodeData& data);
++
++  void Invalidate(const std::string& reason);
++
++  std::unique_ptr<ui::AXTree> tree_;
++  ui::AXTreeID tree_id_;
++  bool valid_ = false;
++
++  // Whether the seeding snapshot carried inline text boxes; a lean-seeded
++  // cache only serves callers that don't require them.
++  bool has_inline_text_boxes_ = false;
++
++  // Main scrollable container's AX node id; 0 when none has been detected.
++  int32_t scroll_target_id_ = 0;
++
++  // Main content landmark's AX node id; 0 when none has been recorded.
++  // Cleared on invalidation since node ids are per-document.
++  int32_t content_root_id_ = 0;
++
++  // XOR of NodeTextHash over every node in the live tree; see
++  // GetContentFingerprint.
++  uint64_t content_fingerprint_ = 0;
++
++  // Keeps web accessibility serialization enabled for this tab so update
++  // events continue to flow between snapshot calls.
++  std::unique_ptr<content::ScopedAccessibilityMode> scoped_mode_;
++
++  WEB_CONTENTS_USER_DATA_KEY_DECL();
++};
++
++}  // namespace api
++}  // namespace extensions
++
++#endif  // CHROME_BROWSER_EXTENSIONS_API_BROWSER_OS_BROWSER_OS_TREE_CACHE_H_
@@ -10,15 +10,18 @@ index fd38c92b7493b..08d05ceb30782 100644
  #include "chrome/browser/enterprise/util/managed_browser_utils.h"
  #include "chrome/browser/extensions/cws_info_service.h"
  #include "chrome/browser/extensions/extension_management_constants.h"
-@@ -664,6 +665,14 @@ ExtensionIdSet ExtensionManagement::GetForcePinnedList() const {
+@@ -664,6 +665,17 @@ ExtensionIdSet ExtensionManagement::GetForcePinnedList() const {
        force_pinned_list.insert(entry.first);
      }
    }
 +
-+  // Always force-pin BrowserOS extensions that are marked pinned.
-+  for (const auto& extension_id : browseros::GetBrowserOSExtensionIds()) {
-+    if (browseros::IsBrowserOSPinnedExtension(extension_id)) {
-+      force_pinned_list.insert(extension_id);
++  // Always force-pin BrowserOS extensions that are marked pinned. The
++  // pin decision is compile-time data, so walk the table directly
++  // instead of materializing the id list and re-resolving each entry;
++  // this runs on every force-pinned query.
++  for (const auto& info : browseros::kBrowserOSExtensions) {
++    if (info.is_pinned) {
++      force_pinned_list.insert(info.id);
 +    }
 +  }
 +
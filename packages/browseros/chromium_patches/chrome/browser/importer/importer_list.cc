@@ -26,71 +26,21 @@ index 62546b572bab8..072d2d89ee990 100644
  
  #if BUILDFLAG(IS_MAC)
  #include "base/apple/foundation_util.h"
-@@ -29,6 +35,196 @@
+@@ -29,6 +35,143 @@
  
  namespace {
  
 +// Forward declaration for platform-specific Chrome user data folder getter
 +base::FilePath GetChromeUserDataFolder();
 +
-+// Chrome importer helper functions (cross-platform)
-+bool HasExtensionsToImport(const base::FilePath& preferences_path) {
-+  LOG(INFO) << "browseros: Checking for extensions in: " << preferences_path.AsUTF8Unsafe();
-+
-+  std::string preferences_content;
-+  if (!base::ReadFileToString(preferences_path, &preferences_content)) {
-+    LOG(INFO) << "browseros: Failed to read preferences file: " << preferences_path.AsUTF8Unsafe();
-+    return false;
-+  }
-+
-+  std::optional<base::Value::Dict> preferences =
-+      base::JSONReader::ReadDict(preferences_content, base::JSON_PARSE_CHROMIUM_EXTENSIONS);
-+  if (!preferences) {
-+    LOG(INFO) << "browseros: Failed to parse preferences file as JSON: " << preferences_path.AsUTF8Unsafe();
-+    return false;
-+  }
-+
-+  // Extensions are stored in extensions.settings in Chrome preferences
-+  const base::Value::Dict* extensions_dict =
-+      preferences->FindDictByDottedPath("extensions.settings");
-+  if (!extensions_dict) {
-+    LOG(INFO) << "browseros: No extensions.settings found in preferences file";
-+    return false;
-+  }
-+
-+  LOG(INFO) << "browseros: Found extensions.settings with " << extensions_dict->size() << " entries";
-+
-+  // Check for at least one valid extension
-+  int examined_extensions = 0;
-+  for (const auto [key, value] : *extensions_dict) {
-+    examined_extensions++;
-+    if (!value.is_dict()) {
-+      continue;
-+    }
-+
-+    const base::Value::Dict& dict = value.GetDict();
-+
-+    // Only count if:
-+    // 1. It's from the Chrome Web Store
-+    // 2. It's not installed by default
-+    // 3. It's enabled (we're being lenient here, importing disabled ones too for now)
-+
-+    if (dict.FindBool("was_installed_by_default").value_or(true)) {
-+      LOG(INFO) << "browseros: Extension " << key << " was installed by default, skipping";
-+      continue;  // Skip default extensions
-+    }
-+
-+    if (!dict.FindBool("from_webstore").value_or(false)) {
-+      LOG(INFO) << "browseros: Extension " << key << " is not from the web store, skipping";
-+      continue;  // Skip non-webstore extensions
-+    }
-+    return true;
-+  }
-+
-+  LOG(INFO) << "browseros: Examined " << examined_extensions << " extensions, none qualified for import";
-+  return false;
-+}
-+
++// Stat-only capability probe for a Chrome profile. Detection runs on every
++// candidate profile just to render the import dialog's checkboxes, so it
++// must stay cheap: the presence of the well-known files is enough to offer
++// an item, and nothing here opens a SQLite database or parses the
++// (potentially multi-megabyte) Preferences JSON. The real importer
++// re-reads those when the user commits and quietly imports nothing when a
++// category turns out to be empty, so an optimistic bit costs one no-op
++// import rather than a wrong checkbox.
 +bool ChromeImporterCanImport(const base::FilePath& profile_path, uint16_t* services) {
 +  DCHECK(services);
 +  *services = user_data_importer::NONE;
@@ -113,16 +63,13 @@ index 62546b572bab8..072d2d89ee990 100644
 +  if (base::PathExists(passwords_path))
 +    *services |= user_data_importer::PASSWORDS;
 +
-+  if (base::PathExists(preferences_path)) {
++  if (base::PathExists(preferences_path) ||
++      base::PathExists(secure_preferences_path)) {
 +    *services |= user_data_importer::AUTOFILL_FORM_DATA;
 +    *services |= user_data_importer::SEARCH_ENGINES;
-+
-+    // Check for extensions in preferences
-+    if (HasExtensionsToImport(preferences_path) ||
-+        (base::PathExists(secure_preferences_path) &&
-+         HasExtensionsToImport(secure_preferences_path))) {
-+      *services |= user_data_importer::EXTENSIONS;
-+    }
++    // Whether any extension actually qualifies for import is only knowable
++    // by parsing the preferences; that check lives in the import itself.
++    *services |= user_data_importer::EXTENSIONS;
 +  }
 +
 +  return *services != user_data_importer::NONE;
@@ -223,7 +170,7 @@ index 62546b572bab8..072d2d89ee990 100644
  #if BUILDFLAG(IS_WIN)
  void DetectIEProfiles(
      std::vector<user_data_importer::SourceProfile>* profiles) {
-@@ -71,6 +267,21 @@ void DetectBuiltinWindowsProfiles(
+@@ -71,6 +214,21 @@ void DetectBuiltinWindowsProfiles(
  
  #endif  // BUILDFLAG(IS_WIN)
  
@@ -245,7 +192,7 @@ index 62546b572bab8..072d2d89ee990 100644
  #if BUILDFLAG(IS_MAC)
  void DetectSafariProfiles(
      std::vector<user_data_importer::SourceProfile>* profiles) {
-@@ -88,8 +299,30 @@ void DetectSafariProfiles(
+@@ -88,8 +246,30 @@ void DetectSafariProfiles(
    safari.services_supported = items;
    profiles->push_back(safari);
  }
@@ -276,7 +223,7 @@ index 62546b572bab8..072d2d89ee990 100644
  // |locale|: The application locale used for lookups in Firefox's
  // locale-specific search engines feature (see firefox_importer.cc for
  // details).
-@@ -170,8 +403,10 @@ std::vector<user_data_importer::SourceProfile> DetectSourceProfilesWorker(
+@@ -170,8 +350,10 @@ std::vector<user_data_importer::SourceProfile> DetectSourceProfilesWorker(
  #if BUILDFLAG(IS_WIN)
    if (shell_integration::IsFirefoxDefaultBrowser()) {
      DetectFirefoxProfiles(locale, &profiles);
@@ -287,7 +234,7 @@ index 62546b572bab8..072d2d89ee990 100644
      DetectBuiltinWindowsProfiles(&profiles);
      DetectFirefoxProfiles(locale, &profiles);
    }
-@@ -179,11 +414,15 @@ std::vector<user_data_importer::SourceProfile> DetectSourceProfilesWorker(
+@@ -179,11 +361,15 @@ std::vector<user_data_importer::SourceProfile> DetectSourceProfilesWorker(
    if (shell_integration::IsFirefoxDefaultBrowser()) {
      DetectFirefoxProfiles(locale, &profiles);
      DetectSafariProfiles(&profiles);
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/mac/sparkle_glue.mm b/chrome/browser/mac/sparkle_glue.mm
 new file mode 100644
-index 0000000000000..25a2dd2d5a578
+index 0000000000000..16025804de734
 --- /dev/null
 +++ b/chrome/browser/mac/sparkle_glue.mm
-@@ -0,0 +1,662 @@
+@@ -0,0 +1,691 @@
 +// Copyright 2024 BrowserOS Authors. All rights reserved.
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -21,6 +21,7 @@ index 0000000000000..25a2dd2d5a578
 +#include "base/version.h"
 +#include "chrome/browser/browser_process.h"
 +#include "chrome/browser/browseros/core/browseros_switches.h"
++#include "chrome/browser/browseros/core/browseros_update_scheduler.h"
 +#include "chrome/browser/upgrade_detector/build_state.h"
 +
 +#import <Sparkle/Sparkle.h>
@@ -233,6 +234,7 @@ index 0000000000000..25a2dd2d5a578
 +
 +- (void)showDownloadDidReceiveDataOfLength:(uint64_t)length {
 +  self.receivedBytes += length;
++  browseros::ChargeDownloadBudget(static_cast<int64_t>(length));
 +
 +  SparkleProgress* progress =
 +      [[SparkleProgress alloc] initWithReceived:self.receivedBytes
@@ -532,6 +534,33 @@ index 0000000000000..25a2dd2d5a578
 +
 +#pragma mark - SPUUpdaterDelegate
 +
++- (BOOL)updater:(SPUUpdater*)updater
++    mayPerformUpdateCheck:(SPUUpdateCheck)updateCheck
++                    error:(NSError* __autoreleasing*)error {
++  // Scheduled checks share one scheduler with the BrowserOS server
++  // updater: defer on battery/metered, yield if the other updater
++  // checked within the spacing window, and hold off while the shared
++  // daily download budget is exhausted. Sparkle retries on its own
++  // interval, so a deferred tick just slides to the next one.
++  // User-initiated checks always go through.
++  if (updateCheck == SPUUpdateCheckUpdatesInBackground &&
++      (browseros::ShouldDeferBackgroundUpdateWork() ||
++       !browseros::HasDownloadBudget() ||
++       !browseros::TryBeginUpdateCheck("sparkle"))) {
++    VLOG(1) << "Sparkle: Background check deferred by shared scheduler";
++    if (error) {
++      *error = [NSError errorWithDomain:@"com.browseros.UpdateScheduler"
++                                   code:0
++                               userInfo:@{
++                                 NSLocalizedDescriptionKey :
++                                     @"Deferred by shared update scheduler"
++                               }];
++    }
++    return NO;
++  }
++  return YES;
++}
++
 +- (nullable NSString*)feedURLStringForUpdater:(SPUUpdater*)updater {
 +  auto* cmd = base::CommandLine::ForCurrentProcess();
 +  if (cmd && cmd->HasSwitch(browseros::kSparkleUrl)) {
@@ -25,7 +25,7 @@ index deb531f8832e3..91cf6b70413ff 100644
  #include "extensions/common/extension_urls.h"
  #include "printing/buildflags/buildflags.h"
  #include "ui/actions/actions.h"
-@@ -988,6 +996,71 @@ bool BrowserCommandController::ExecuteCommandWithDisposition(
+@@ -988,6 +996,68 @@ bool BrowserCommandController::ExecuteCommandWithDisposition(
        browser_->GetFeatures().side_panel_ui()->Show(
            SidePanelEntryId::kBookmarks, SidePanelOpenTrigger::kAppMenu);
        break;
@@ -37,18 +37,15 @@ index deb531f8832e3..91cf6b70413ff 100644
 +      }
 +      break;
 +    case IDC_CYCLE_THIRD_PARTY_LLM_PROVIDER:
-+      if (base::FeatureList::IsEnabled(features::kThirdPartyLlmPanel)) {
-+        if (ThirdPartyLlmPanelCoordinator* coordinator =
-+                browser_->browser_window_features()
-+                    ->third_party_llm_panel_coordinator()) {
-+          coordinator->CycleProvider();
-+        }
++      // Creates the coordinator on first use; returns null when disabled.
++      if (ThirdPartyLlmPanelCoordinator* coordinator =
++              ThirdPartyLlmPanelCoordinator::GetOrCreateForBrowser(browser_)) {
++        coordinator->CycleProvider();
 +      }
 +      break;
 +    case IDC_OPEN_CLASH_OF_GPTS:
-+      if (base::FeatureList::IsEnabled(features::kClashOfGpts)) {
-+        ClashOfGptsCoordinator* coordinator =
-+            browser_->browser_window_features()->clash_of_gpts_coordinator();
++      if (ClashOfGptsCoordinator* coordinator =
++              ClashOfGptsCoordinator::GetOrCreateForBrowser(browser_)) {
 +        // If not showing properly, close and recreate
 +        if (!coordinator->IsShowing()) {
 +          coordinator->Close();
@@ -97,7 +94,7 @@ index deb531f8832e3..91cf6b70413ff 100644
      case IDC_SHOW_APP_MENU:
        base::RecordAction(base::UserMetricsAction("Accel_Show_App_Menu"));
        ShowAppMenu(browser_);
-@@ -1648,6 +1721,13 @@ void BrowserCommandController::InitCommandState() {
+@@ -1648,6 +1718,13 @@ void BrowserCommandController::InitCommandState() {
    }
  
    command_updater_.UpdateCommandEnabled(IDC_SHOW_BOOKMARK_SIDE_PANEL, true);
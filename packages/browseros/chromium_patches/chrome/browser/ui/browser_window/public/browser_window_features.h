@@ -18,22 +18,35 @@ index 19048c9478592..cc3c846cac900 100644
  class ToastController;
  class ToastService;
  class TranslateBubbleController;
-@@ -253,6 +255,14 @@ class BrowserWindowFeatures {
+@@ -253,6 +255,27 @@ class BrowserWindowFeatures {
      return comments_side_panel_coordinator_.get();
    }
  
++  // The BrowserOS coordinators are created lazily by the
++  // GetOrCreateForBrowser() statics on the coordinators, so window creation
++  // only pays for empty slots; the getters return null until first use.
 +  ThirdPartyLlmPanelCoordinator* third_party_llm_panel_coordinator() {
 +    return third_party_llm_panel_coordinator_.get();
 +  }
 +
++  void set_third_party_llm_panel_coordinator(
++      std::unique_ptr<ThirdPartyLlmPanelCoordinator> coordinator) {
++    third_party_llm_panel_coordinator_ = std::move(coordinator);
++  }
++
 +  ClashOfGptsCoordinator* clash_of_gpts_coordinator() {
 +    return clash_of_gpts_coordinator_.get();
 +  }
++
++  void set_clash_of_gpts_coordinator(
++      std::unique_ptr<ClashOfGptsCoordinator> coordinator) {
++    clash_of_gpts_coordinator_ = std::move(coordinator);
++  }
 +
  #if BUILDFLAG(ENABLE_GLIC)
    glic::GlicLegacySidePanelCoordinator* glic_side_panel_coordinator() {
      return glic_side_panel_coordinator_.get();
-@@ -546,6 +556,11 @@ class BrowserWindowFeatures {
+@@ -546,6 +569,11 @@ class BrowserWindowFeatures {
    std::unique_ptr<CommentsSidePanelCoordinator>
        comments_side_panel_coordinator_;
  
@@ -22,16 +22,18 @@ index e0ac63141989c..067446bb2a571 100644
    auto* management =
        extensions::ExtensionManagementFactory::GetForBrowserContext(profile_);
    return base::Contains(management->GetForcePinnedList(), action_id);
-@@ -565,6 +571,14 @@ ToolbarActionsModel::GetFilteredPinnedActionIds() const {
+@@ -565,6 +571,16 @@ ToolbarActionsModel::GetFilteredPinnedActionIds() const {
    std::ranges::copy_if(
        management->GetForcePinnedList(), std::back_inserter(pinned),
        [&pinned](const std::string& id) { return !base::Contains(pinned, id); });
 +      
-+  // Add BrowserOS extensions to the force-pinned list (only those marked as pinned)
-+  for (const std::string& ext_id : browseros::GetBrowserOSExtensionIds()) {
-+    if (browseros::IsBrowserOSPinnedExtension(ext_id) &&
-+        !base::Contains(pinned, ext_id)) {
-+      pinned.push_back(ext_id);
++  // Add BrowserOS extensions to the force-pinned list (only those marked
++  // as pinned). Walk the constexpr table directly; this runs per toolbar
++  // update and the id-list helper allocates.
++  for (const auto& info : browseros::kBrowserOSExtensions) {
++    if (info.is_pinned &&
++        !base::Contains(pinned, info.id)) {
++      pinned.push_back(info.id);
 +    }
 +  }
  
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/ui/views/side_panel/browseros_simple_page_extractor.cc b/chrome/browser/ui/views/side_panel/browseros_simple_page_extractor.cc
 new file mode 100644
-index 0000000000000..4a801a5d847ea
+index 0000000000000..42f310171fa07
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/browseros_simple_page_extractor.cc
-@@ -0,0 +1,231 @@
+@@ -0,0 +1,274 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,10 +12,13 @@ index 0000000000000..4a801a5d847ea
 +
 +#include <algorithm>
 +#include <string>
++#include <string_view>
 +#include <unordered_map>
++#include <vector>
 +
 +#include "base/strings/string_util.h"
 +#include "base/strings/utf_string_conversions.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_text_util.h"
 +#include "ui/accessibility/ax_enums.mojom.h"
 +#include "ui/accessibility/ax_node_data.h"
 +#include "ui/accessibility/ax_role_properties.h"
@@ -25,14 +28,69 @@ index 0000000000000..4a801a5d847ea
 +
 +// Forward declarations
 +std::u16string GetNodeText(const ui::AXNodeData* node);
-+void CleanupWhitespace(std::u16string& text);
++
++// Chunked accumulator for the extracted text. A single growing
++// std::u16string reallocates-and-copies everything written so far each
++// time it outgrows its buffer, which stalls the UI thread on
++// multi-megabyte pages. Appends here only ever touch the current chunk:
++// once a chunk fills up it is sealed and a fresh one begins, so no
++// already-written text is moved again until the final single-pass
++// materialization.
++class RopeBuilder {
++ public:
++  RopeBuilder() {
++    chunks_.emplace_back();
++    chunks_.back().reserve(kChunkSize);
++  }
++
++  void Append(std::u16string_view text) {
++    if (text.empty()) {
++      return;
++    }
++    if (chunks_.back().size() + text.size() > chunks_.back().capacity()) {
++      chunks_.emplace_back();
++      chunks_.back().reserve(std::max(kChunkSize, text.size()));
++    }
++    chunks_.back().append(text);
++    last_char_ = text.back();
++  }
++
++  bool empty() const { return chunks_.size() == 1 && chunks_[0].empty(); }
++
++  // Last appended character; only meaningful when !empty().
++  char16_t last_char() const { return last_char_; }
++
++  // Concatenates the chunks into one string and collapses whitespace in
++  // a single vectorized pass (see CollapseStructuredWhitespace). Cleanup
++  // has to happen here rather than per chunk because whitespace runs can
++  // straddle chunk boundaries.
++  std::u16string Materialize() const {
++    size_t total = 0;
++    for (const auto& chunk : chunks_) {
++      total += chunk.size();
++    }
++
++    std::u16string raw;
++    raw.reserve(total);
++    for (const auto& chunk : chunks_) {
++      raw.append(chunk);
++    }
++    return extensions::api::CollapseStructuredWhitespace(raw);
++  }
++
++ private:
++  static constexpr size_t kChunkSize = 64 * 1024;
++
++  std::vector<std::u16string> chunks_;
++  char16_t last_char_ = u'\0';
++};
 +
 +// Recursively extracts text from a node using DFS with semantic boundaries.
 +// Stops recursion at headings, links, and images to prevent duplication.
 +void ExtractNode(
 +    int32_t node_id,
 +    const std::unordered_map<int32_t, const ui::AXNodeData*>& node_map,
-+    std::u16string& output,
++    RopeBuilder& output,
 +    int depth = 0) {
 +
 +  auto it = node_map.find(node_id);
@@ -54,8 +112,8 @@ index 0000000000000..4a801a5d847ea
 +  if (node->role == ax::mojom::Role::kNavigation ||
 +      node->role == ax::mojom::Role::kBanner) {
 +    // Add spacing before
-+    if (!output.empty() && output.back() != u'\n') {
-+      output += u"\n\n";
++    if (!output.empty() && output.last_char() != u'\n') {
++      output.Append(u"\n\n");
 +    }
 +
 +    // Recurse to extract nav links
@@ -64,7 +122,7 @@ index 0000000000000..4a801a5d847ea
 +    }
 +
 +    // Add spacing after to separate from content
-+    output += u"\n\n";
++    output.Append(u"\n\n");
 +    return;
 +  }
 +
@@ -79,11 +137,14 @@ index 0000000000000..4a801a5d847ea
 +    std::u16string text = GetNodeText(node);
 +    if (!text.empty()) {
 +      // Add newline if not at start
-+      if (!output.empty() && output.back() != u'\n') {
-+        output += u"\n\n";
++      if (!output.empty() && output.last_char() != u'\n') {
++        output.Append(u"\n\n");
 +      }
 +      // Add markdown heading
-+      output += std::u16string(level, u'#') + u" " + text + u"\n\n";
++      output.Append(std::u16string(level, u'#'));
++      output.Append(u" ");
++      output.Append(text);
++      output.Append(u"\n\n");
 +    }
 +    return;  // Don't recurse into heading children
 +  }
@@ -92,7 +153,8 @@ index 0000000000000..4a801a5d847ea
 +  if (ui::IsLink(node->role)) {
 +    std::u16string text = GetNodeText(node);
 +    if (!text.empty()) {
-+      output += text + u" ";
++      output.Append(text);
++      output.Append(u" ");
 +    }
 +    return;  // Don't recurse into link children
 +  }
@@ -101,7 +163,9 @@ index 0000000000000..4a801a5d847ea
 +  if (ui::IsImage(node->role)) {
 +    std::u16string alt_text = GetNodeText(node);
 +    if (!alt_text.empty()) {
-+      output += u"[Image: " + alt_text + u"] ";
++      output.Append(u"[Image: ");
++      output.Append(alt_text);
++      output.Append(u"] ");
 +    }
 +    return;  // Don't recurse into image children
 +  }
@@ -111,10 +175,11 @@ index 0000000000000..4a801a5d847ea
 +    std::u16string text = GetNodeText(node);
 +    if (!text.empty()) {
 +      // Add space if needed
-+      if (!output.empty() && output.back() != u' ' && output.back() != u'\n') {
-+        output += u" ";
++      if (!output.empty() && output.last_char() != u' ' &&
++          output.last_char() != u'\n') {
++        output.Append(u" ");
 +      }
-+      output += text;
++      output.Append(text);
 +    }
 +    return;  // Terminal node, no children
 +  }
@@ -130,13 +195,13 @@ index 0000000000000..4a801a5d847ea
 +  // LIST ITEMS - Start new line with indentation
 +  if (node->role == ax::mojom::Role::kListItem) {
 +    // Start new line
-+    if (!output.empty() && output.back() != u'\n') {
-+      output += u"\n";
++    if (!output.empty() && output.last_char() != u'\n') {
++      output.Append(u"\n");
 +    }
 +
 +    // Add indentation for nested items (only if depth > 0)
 +    if (depth > 0) {
-+      output += std::u16string(depth, u'\t');
++      output.Append(std::u16string(depth, u'\t'));
 +    }
 +
 +    // Extract children inline (same depth - they're siblings on same line)
@@ -149,8 +214,8 @@ index 0000000000000..4a801a5d847ea
 +
 +  // PARAGRAPHS - Add spacing
 +  if (node->role == ax::mojom::Role::kParagraph) {
-+    if (!output.empty() && output.back() != u'\n') {
-+      output += u"\n\n";
++    if (!output.empty() && output.last_char() != u'\n') {
++      output.Append(u"\n\n");
 +    }
 +  }
 +
@@ -163,8 +228,8 @@ index 0000000000000..4a801a5d847ea
 +  if (node->role == ax::mojom::Role::kParagraph ||
 +      node->role == ax::mojom::Role::kSection ||
 +      node->role == ax::mojom::Role::kArticle) {
-+    if (!output.empty() && output.back() != u'\n') {
-+      output += u"\n\n";
++    if (!output.empty() && output.last_char() != u'\n') {
++      output.Append(u"\n\n");
 +    }
 +  }
 +}
@@ -189,26 +254,6 @@ index 0000000000000..4a801a5d847ea
 +  return base::UTF8ToUTF16(text);
 +}
 +
-+// Clean up excessive whitespace in the final output
-+void CleanupWhitespace(std::u16string& text) {
-+  // Replace multiple spaces with single space
-+  size_t pos = 0;
-+  while ((pos = text.find(u"  ", pos)) != std::u16string::npos) {
-+    text.replace(pos, 2, u" ");
-+  }
-+
-+  // Replace multiple newlines (more than 2) with double newline
-+  pos = 0;
-+  while ((pos = text.find(u"\n\n\n", pos)) != std::u16string::npos) {
-+    text.replace(pos, 3, u"\n\n");
-+  }
-+
-+  // Trim trailing whitespace
-+  while (!text.empty() && (text.back() == u' ' || text.back() == u'\n')) {
-+    text.pop_back();
-+  }
-+}
-+
 +}  // namespace
 +
 +namespace side_panel {
@@ -225,14 +270,11 @@ index 0000000000000..4a801a5d847ea
 +    node_map[node.id] = &node;
 +  }
 +
-+  std::u16string output;
++  RopeBuilder output;
 +  ExtractNode(update.root_id, node_map, output, -1);  // Start at depth -1
 +
-+  // Clean up extra whitespace
-+  CleanupWhitespace(output);
-+
-+  return output;
++  // Whitespace cleanup happens in the same pass as concatenation.
++  return output.Materialize();
 +}
 +
 +}  // namespace side_panel
-\ No newline at end of file
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.cc b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.cc
 new file mode 100644
-index 0000000000000..9e1c6dc9fe8a1
+index 0000000000000..23769bf668887
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.cc
-@@ -0,0 +1,568 @@
+@@ -0,0 +1,864 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,7 +11,11 @@ index 0000000000000..9e1c6dc9fe8a1
 +#include "chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.h"
 +
 +#include "base/check.h"
++#include "base/command_line.h"
++#include "base/feature_list.h"
 +#include "base/functional/bind.h"
++#include "base/json/string_escape.h"
++#include "base/json/values_util.h"
 +#include "base/logging.h"
 +#include "base/strings/string_number_conversions.h"
 +#include "base/strings/stringprintf.h"
@@ -24,15 +28,21 @@ index 0000000000000..9e1c6dc9fe8a1
 +#include "chrome/browser/ui/browser_list.h"
 +#include "chrome/browser/ui/browser_tabstrip.h"
 +#include "chrome/browser/ui/browser_window.h"
++#include "chrome/browser/ui/browser_window/public/browser_window_features.h"
 +#include "chrome/browser/ui/tabs/tab_strip_model.h"
++#include "chrome/browser/ui/ui_features.h"
 +#include "chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_view.h"
 +#include "chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_window.h"
 +#include "components/input/native_web_keyboard_event.h"
 +#include "components/pref_registry/pref_registry_syncable.h"
 +#include "components/prefs/pref_service.h"
 +#include "components/prefs/scoped_user_pref_update.h"
++#include "chrome/browser/browseros/core/browseros_switches.h"
++#include "content/public/browser/navigation_controller.h"
 +#include "content/public/browser/render_frame_host.h"
++#include "content/public/browser/site_instance.h"
 +#include "content/public/browser/web_contents.h"
++#include "url/origin.h"
 +#include "ui/base/clipboard/clipboard.h"
 +#include "ui/base/clipboard/scoped_clipboard_writer.h"
 +#include "ui/accessibility/ax_tree_update.h"
@@ -46,6 +56,11 @@ index 0000000000000..9e1c6dc9fe8a1
 +const char kClashOfGptsPaneProvidersPref[] = "browseros.clash_of_gpts.pane_providers";  // Per-pane selections
 +const char kClashOfGptsLastUrlsPref[] = "browseros.clash_of_gpts.last_urls";
 +const char kClashOfGptsPaneCountPref[] = "browseros.clash_of_gpts.pane_count";
++const char kClashOfGptsHistoryPref[] = "browseros.clash_of_gpts.history";
++
++// Cap on the comparison history ring. Entries are a prompt plus a URL per
++// pane (well under a KB), so the whole ring stays cheap to keep in prefs.
++constexpr size_t kMaxHistoryEntries = 50;
 +
 +// Shared provider list preference (from third_party_llm)
 +const char kThirdPartyLlmProvidersPref[] = "browseros.third_party_llm.providers";
@@ -76,6 +91,20 @@ index 0000000000000..9e1c6dc9fe8a1
 +  SaveState();
 +}
 +
++// static
++ClashOfGptsCoordinator* ClashOfGptsCoordinator::GetOrCreateForBrowser(
++    Browser* browser) {
++  if (!base::FeatureList::IsEnabled(features::kClashOfGpts)) {
++    return nullptr;
++  }
++  BrowserWindowFeatures* window_features = browser->browser_window_features();
++  if (!window_features->clash_of_gpts_coordinator()) {
++    window_features->set_clash_of_gpts_coordinator(
++        std::make_unique<ClashOfGptsCoordinator>(browser));
++  }
++  return window_features->clash_of_gpts_coordinator();
++}
++
 +void ClashOfGptsCoordinator::Show() {
 +  CreateWindowIfNeeded();
 +  if (widget_) {
@@ -85,7 +114,51 @@ index 0000000000000..9e1c6dc9fe8a1
 +  }
 +}
 +
++void ClashOfGptsCoordinator::Warmup() {
++  // Once the window exists the panes are already materialized (or being
++  // staggered in by the view); warming up then would fight it.
++  if (window_) {
++    return;
++  }
++
++  // Same provider refresh CreateWindowIfNeeded() does, so the warmed
++  // panes load the URLs the window will actually show.
++  size_t previous_size = providers_.size();
++  LoadProvidersFromPrefs();
++  if (providers_.size() != previous_size) {
++    for (int i = 0; i < kMaxPanes; ++i) {
++      if (pane_provider_indices_[i] >= providers_.size()) {
++        pane_provider_indices_[i] = 0;
++      }
++    }
++  }
++
++  for (int i = 0; i < current_pane_count_; ++i) {
++    if (HasWebContentsForPane(i)) {
++      continue;
++    }
++    content::WebContents* web_contents = GetOrCreateWebContentsForPane(i);
++    if (!web_contents) {
++      continue;
++    }
++    GURL url = GetInitialUrlForPane(i);
++    if (url.is_valid()) {
++      web_contents->GetController().LoadURL(url, content::Referrer(),
++                                            ui::PAGE_TRANSITION_AUTO_TOPLEVEL,
++                                            std::string());
++    }
++    // Hidden until the window attaches them, so the warmup loads run at
++    // background priority. MaterializePane() skips the reload for a
++    // kept-alive WebContents already on the right provider, so Show()
++    // after a warmup is a cheap reattach.
++    web_contents->WasHidden();
++  }
++
++  LOG(INFO) << "browseros: Clash of GPTs panes warmed up";
++}
++
 +void ClashOfGptsCoordinator::Close() {
++  OnWindowClosing();
 +  if (widget_) {
 +    // Following Chromium style guide: destroy widget by resetting unique_ptr
 +    widget_.reset();
@@ -94,6 +167,48 @@ index 0000000000000..9e1c6dc9fe8a1
 +  view_ = nullptr;
 +}
 +
++void ClashOfGptsCoordinator::OnWindowClosing() {
++  // Record each pane's current URL so both an in-session reopen and a
++  // restart land back on the same conversation.
++  if (view_) {
++    for (int i = 0; i < current_pane_count_; ++i) {
++      if (content::WebContents* web_contents = view_->GetWebContentsForPane(i)) {
++        GURL current_url = web_contents->GetURL();
++        if (current_url.is_valid()) {
++          last_urls_[{i, pane_provider_indices_[i]}] = current_url;
++        }
++      }
++    }
++    UpdateLatestHistoryEntryUrls();
++  }
++
++  // The WebContents stay alive across close; mark them hidden so their
++  // renderers deprioritize (and can be frozen) while the window is gone.
++  for (int i = 0; i < kMaxPanes; ++i) {
++    if (owned_web_contents_[i]) {
++      owned_web_contents_[i]->WasHidden();
++    }
++  }
++
++  SaveState();
++}
++
++GURL ClashOfGptsCoordinator::GetInitialUrlForPane(int pane_index) const {
++  if (pane_index < 0 || pane_index >= current_pane_count_) {
++    return GURL();
++  }
++
++  const size_t provider_index = pane_provider_indices_[pane_index];
++  auto it = last_urls_.find({pane_index, provider_index});
++  if (it != last_urls_.end() && it->second.is_valid()) {
++    return it->second;
++  }
++  if (provider_index < providers_.size()) {
++    return providers_[provider_index].url;
++  }
++  return GURL();
++}
++
 +bool ClashOfGptsCoordinator::IsShowing() const {
 +  return widget_ && widget_->IsVisible();
 +}
@@ -157,6 +272,154 @@ index 0000000000000..9e1c6dc9fe8a1
 +  }
 +}
 +
++void ClashOfGptsCoordinator::BroadcastPromptToAll(const std::u16string& prompt) {
++  if (prompt.empty() || !view_) {
++    return;
++  }
++
++  // A previous broadcast may still be in flight; dropping its bookkeeping
++  // just means its aggregate feedback is skipped.
++  broadcast_pending_ = 0;
++  broadcast_total_ = 0;
++  broadcast_succeeded_ = 0;
++
++  // Finds the provider's prompt box (the focused editable if there is one,
++  // otherwise the first textarea/contenteditable on the page), inserts the
++  // prompt, and reports whether an input was found.
++  const std::string quoted =
++      base::GetQuotedJSONString(base::UTF16ToUTF8(prompt));
++  const std::u16string js = base::UTF8ToUTF16(base::StringPrintf(
++      "(function() {"
++      "  var editable = function(e) {"
++      "    return e && (e.tagName === 'TEXTAREA' || e.isContentEditable ||"
++      "                 (e.tagName === 'INPUT' && e.type === 'text'));"
++      "  };"
++      "  var el = document.activeElement;"
++      "  if (!editable(el)) {"
++      "    el = document.querySelector("
++      "        'textarea, [contenteditable=\"true\"], input[type=\"text\"]');"
++      "  }"
++      "  if (!el) { return 'no-input'; }"
++      "  el.focus();"
++      "  if (el.isContentEditable) {"
++      "    document.execCommand('selectAll', false, null);"
++      "    document.execCommand('insertText', false, %s);"
++      "  } else {"
++      "    el.value = %s;"
++      "    el.dispatchEvent(new Event('input', {bubbles: true}));"
++      "  }"
++      "  return 'ok';"
++      "})();",
++      quoted.c_str(), quoted.c_str()));
++
++  // Issue every pane's injection back to back in this turn rather than
++  // waiting on each completion, so the renderers run them concurrently.
++  for (int i = 0; i < current_pane_count_; ++i) {
++    content::WebContents* web_contents = view_->GetWebContentsForPane(i);
++    content::RenderFrameHost* rfh =
++        web_contents ? web_contents->GetPrimaryMainFrame() : nullptr;
++    if (!rfh) {
++      continue;
++    }
++    ++broadcast_pending_;
++    rfh->ExecuteJavaScriptForTests(
++        js,
++        base::BindOnce(&ClashOfGptsCoordinator::OnPromptInjected,
++                       weak_factory_.GetWeakPtr(), i),
++        /*honor_js_content_settings=*/false);
++  }
++
++  broadcast_total_ = broadcast_pending_;
++  if (broadcast_total_ > 0) {
++    browseros_metrics::BrowserOSMetrics::Log(
++        "llmhub.prompt.broadcast", {{"panes", base::Value(broadcast_total_)}});
++    RecordBroadcastHistory(prompt);
++  }
++}
++
++void ClashOfGptsCoordinator::RecordBroadcastHistory(
++    const std::u16string& prompt) {
++  PrefService* prefs = browser_->profile()->GetPrefs();
++  if (!prefs) {
++    return;
++  }
++
++  base::Value::Dict entry;
++  entry.Set("time", base::TimeToValue(base::Time::Now()));
++  entry.Set("prompt", base::UTF16ToUTF8(prompt));
++
++  base::Value::List panes;
++  for (int i = 0; i < current_pane_count_; ++i) {
++    base::Value::Dict pane;
++    const size_t provider_index = pane_provider_indices_[i];
++    if (provider_index < providers_.size()) {
++      pane.Set("provider", base::UTF16ToUTF8(providers_[provider_index].name));
++    }
++    if (view_) {
++      if (content::WebContents* contents = view_->GetWebContentsForPane(i)) {
++        const GURL& url = contents->GetLastCommittedURL();
++        if (url.is_valid()) {
++          pane.Set("url", url.spec());
++        }
++      }
++    }
++    panes.Append(std::move(pane));
++  }
++  entry.Set("panes", std::move(panes));
++
++  ScopedListPrefUpdate update(prefs, kClashOfGptsHistoryPref);
++  update->Append(base::Value(std::move(entry)));
++  // Ring semantics: the newest entries win.
++  while (update->size() > kMaxHistoryEntries) {
++    update->erase(update->begin());
++  }
++}
++
++void ClashOfGptsCoordinator::UpdateLatestHistoryEntryUrls() {
++  PrefService* prefs = browser_->profile()->GetPrefs();
++  if (!prefs || !view_) {
++    return;
++  }
++
++  ScopedListPrefUpdate update(prefs, kClashOfGptsHistoryPref);
++  if (update->empty()) {
++    return;
++  }
++  base::Value::Dict* entry = update->back().GetIfDict();
++  base::Value::List* panes = entry ? entry->FindList("panes") : nullptr;
++  if (!panes) {
++    return;
++  }
++
++  for (int i = 0;
++       i < current_pane_count_ && i < static_cast<int>(panes->size()); ++i) {
++    base::Value::Dict* pane = (*panes)[i].GetIfDict();
++    if (!pane) {
++      continue;
++    }
++    if (content::WebContents* contents = view_->GetWebContentsForPane(i)) {
++      const GURL& url = contents->GetLastCommittedURL();
++      if (url.is_valid()) {
++        pane->Set("url", url.spec());
++      }
++    }
++  }
++}
++
++void ClashOfGptsCoordinator::OnPromptInjected(int pane_index,
++                                              base::Value result) {
++  if (result.is_string() && result.GetString() == "ok") {
++    ++broadcast_succeeded_;
++  } else {
++    LOG(WARNING) << "[browseros] Prompt broadcast found no input in pane "
++                 << pane_index;
++  }
++
++  if (--broadcast_pending_ == 0 && view_) {
++    view_->ShowBroadcastFeedback(broadcast_succeeded_, broadcast_total_);
++  }
++}
++
 +std::vector<LlmProviderInfo> ClashOfGptsCoordinator::GetDefaultProviders() const {
 +  std::vector<LlmProviderInfo> defaults;
 +  defaults.push_back({u"ChatGPT", GURL("https://chatgpt.com")});
@@ -481,6 +744,7 @@ index 0000000000000..9e1c6dc9fe8a1
 +  registry->RegisterListPref(kClashOfGptsPaneProvidersPref);
 +  registry->RegisterDictionaryPref(kClashOfGptsLastUrlsPref);
 +  registry->RegisterIntegerPref(kClashOfGptsPaneCountPref, kDefaultPaneCount);
++  registry->RegisterListPref(kClashOfGptsHistoryPref);
 +}
 +
 +
@@ -505,6 +769,32 @@ index 0000000000000..9e1c6dc9fe8a1
 +
 +  if (!owned_web_contents_[pane_index]) {
 +    content::WebContents::CreateParams params(GetBrowser().profile());
++
++    // Opted-in machines let same-origin panes share one renderer: creating
++    // the new contents in a SiteInstance related to an existing pane's
++    // keeps both in one browsing instance, where same-site frames reuse
++    // the process. Three panes of the same provider then cost one renderer
++    // instead of three, at the price of per-pane process isolation.
++    if (base::CommandLine::ForCurrentProcess()->HasSwitch(
++            browseros::kSharePaneProcesses)) {
++      const GURL target_url = GetInitialUrlForPane(pane_index);
++      if (target_url.is_valid()) {
++        for (int i = 0; i < kMaxPanes; ++i) {
++          if (i == pane_index || !owned_web_contents_[i]) {
++            continue;
++          }
++          const GURL other_url = owned_web_contents_[i]->GetURL();
++          if (other_url.is_valid() && url::Origin::Create(other_url) ==
++                                          url::Origin::Create(target_url)) {
++            params.site_instance = owned_web_contents_[i]
++                                       ->GetSiteInstance()
++                                       ->GetRelatedSiteInstance(target_url);
++            break;
++          }
++        }
++      }
++    }
++
 +    owned_web_contents_[pane_index] = content::WebContents::Create(params);
 +
 +    // Set this as the delegate to handle keyboard events
@@ -518,6 +808,11 @@ index 0000000000000..9e1c6dc9fe8a1
 +  return owned_web_contents_[pane_index].get();
 +}
 +
++bool ClashOfGptsCoordinator::HasWebContentsForPane(int pane_index) const {
++  return pane_index >= 0 && pane_index < kMaxPanes &&
++         owned_web_contents_[pane_index] != nullptr;
++}
++
 +void ClashOfGptsCoordinator::CleanupWebContents() {
 +  // Save any URLs before cleanup
 +  if (view_) {
@@ -529,6 +824,7 @@ index 0000000000000..9e1c6dc9fe8a1
 +        }
 +      }
 +    }
++    UpdateLatestHistoryEntryUrls();
 +  }
 +
 +  // Clear all WebContents first
@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.h b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.h
 new file mode 100644
-index 0000000000000..80c7895b1e08b
+index 0000000000000..22e44bac45055
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.h
-@@ -0,0 +1,214 @@
+@@ -0,0 +1,267 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -19,6 +19,7 @@ index 0000000000000..80c7895b1e08b
 +
 +#include "base/memory/raw_ptr.h"
 +#include "base/memory/weak_ptr.h"
++#include "base/values.h"
 +#include "base/scoped_multi_source_observation.h"
 +#include "base/scoped_observation.h"
 +#include "chrome/browser/ui/browser_list_observer.h"
@@ -73,12 +74,35 @@ index 0000000000000..80c7895b1e08b
 +  explicit ClashOfGptsCoordinator(Browser* browser);
 +  ~ClashOfGptsCoordinator() override;
 +
++  // Returns |browser|'s coordinator, constructing it on first use and
++  // installing it in the window's BrowserWindowFeatures. Construction is
++  // deferred out of window creation because most windows never open the
++  // Clash of GPTs window. Returns nullptr when the feature is disabled.
++  static ClashOfGptsCoordinator* GetOrCreateForBrowser(Browser* browser);
++
 +  // Shows the Clash of GPTs window
 +  void Show();
 +
++  // Optional pre-Show() warmup (e.g. from toolbar-button hover): spawns
++  // the pane WebContents hidden and starts their provider loads so the
++  // later Show() is a reattach instead of a cold bootstrap. No-op once
++  // the window exists; safe to call repeatedly.
++  void Warmup();
++
 +  // Closes the window
 +  void Close();
 +
++  // Called when the window is closing (by us or by the user). Snapshots
++  // per-pane session state and parks the kept-alive renderers hidden so
++  // the next Show() reattaches them instantly with scroll, form text and
++  // conversation intact.
++  void OnWindowClosing();
++
++  // Returns the URL a pane should show when it is (re)created: the pane's
++  // last recorded URL for its provider if there is one, else the
++  // provider's base URL.
++  GURL GetInitialUrlForPane(int pane_index) const;
++
 +  // Returns true if the window is showing
 +  bool IsShowing() const;
 +
@@ -88,6 +112,11 @@ index 0000000000000..80c7895b1e08b
 +  // Copies content from active tab to all panes
 +  void CopyContentToAll();
 +
++  // Injects |prompt| into every pane's input field in the same turn so all
++  // providers start generating at the same instant, then reports per-pane
++  // completion back to the view once every injection has resolved.
++  void BroadcastPromptToAll(const std::u16string& prompt);
++
 +  // Gets the current provider index for a pane
 +  size_t GetProviderIndexForPane(int pane_index) const;
 +
@@ -112,6 +141,10 @@ index 0000000000000..80c7895b1e08b
 +  // Gets or creates WebContents for a specific pane
 +  content::WebContents* GetOrCreateWebContentsForPane(int pane_index);
 +
++  // Returns true if the pane's WebContents already exists (i.e. creating
++  // it again is a cheap reattach, not a renderer spawn).
++  bool HasWebContentsForPane(int pane_index) const;
++
 +  // content::WebContentsDelegate:
 +  bool HandleKeyboardEvent(content::WebContents* source,
 +                           const input::NativeWebKeyboardEvent& event) override;
@@ -155,6 +188,21 @@ index 0000000000000..80c7895b1e08b
 +  // Clean up WebContents early to avoid shutdown crashes
 +  void CleanupWebContents();
 +
++  // Completion callback for one pane's prompt injection; shows aggregate
++  // feedback once the last pane reports.
++  void OnPromptInjected(int pane_index, base::Value result);
++
++  // Appends a broadcast to the per-profile comparison history ring
++  // (prompt, timestamp, per-pane provider and URL), dropping the oldest
++  // entries past the cap.
++  void RecordBroadcastHistory(const std::u16string& prompt);
++
++  // Refreshes the newest history entry's pane URLs with the current
++  // conversation URLs. Providers move to a conversation-specific URL once
++  // a response streams in, so this runs when the window goes away and
++  // makes the recorded entry reopenable without re-running generation.
++  void UpdateLatestHistoryEntryUrls();
++
 +  // WebContents observer for a specific pane
 +  class PaneWebContentsObserver : public content::WebContentsObserver {
 +   public:
@@ -210,6 +258,11 @@ index 0000000000000..80c7895b1e08b
 +
 +  raw_ptr<Browser> browser_ = nullptr;
 +
++  // In-flight prompt broadcast bookkeeping
++  int broadcast_pending_ = 0;
++  int broadcast_total_ = 0;
++  int broadcast_succeeded_ = 0;
++
 +  // Handler for unhandled keyboard events
 +  views::UnhandledKeyboardEventHandler unhandled_keyboard_event_handler_;
 +
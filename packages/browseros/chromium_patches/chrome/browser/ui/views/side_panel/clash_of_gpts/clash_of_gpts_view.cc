@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_view.cc b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_view.cc
 new file mode 100644
-index 0000000000000..24eefea8b8860
+index 0000000000000..ef6b53c2867ae
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_view.cc
-@@ -0,0 +1,474 @@
+@@ -0,0 +1,713 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -19,6 +19,7 @@ index 0000000000000..24eefea8b8860
 +#include "base/strings/string_number_conversions.h"
 +#include "base/strings/stringprintf.h"
 +#include "base/strings/utf_string_conversions.h"
++#include "base/task/sequenced_task_runner.h"
 +#include "base/timer/timer.h"
 +#include "chrome/browser/profiles/profile.h"
 +#include "chrome/browser/ui/browser.h"
@@ -39,15 +40,36 @@ index 0000000000000..24eefea8b8860
 +#include "ui/views/controls/button/image_button.h"
 +#include "ui/views/controls/button/radio_button.h"
 +#include "ui/views/controls/combobox/combobox.h"
++#include "ui/events/event.h"
++#include "ui/events/keycodes/keyboard_codes.h"
 +#include "ui/views/controls/label.h"
 +#include "ui/views/controls/separator.h"
++#include "ui/views/controls/textfield/textfield.h"
 +#include "ui/views/controls/webview/webview.h"
++#include "ui/views/focus/focus_manager.h"
 +#include "ui/views/layout/box_layout.h"
 +#include "ui/views/layout/flex_layout.h"
 +#include "ui/views/vector_icons.h"
++#include "ui/views/widget/widget.h"
 +
 +namespace {
 +
++// Spacing between the deferred loads of successive panes, so renderer
++// startup for a three-way comparison is staggered instead of stacked on
++// window open.
++constexpr base::TimeDelta kDeferredPaneLoadDelay = base::Milliseconds(300);
++
++// Cadence of the background-pane rendering duty cycle: once per interval
++// a non-hovered, non-focused pane is let through for one frame and then
++// re-occluded, capping it at roughly 5fps. Three panes streaming
++// responses at full rate otherwise peg integrated GPUs.
++constexpr base::TimeDelta kBackgroundPaneFrameInterval =
++    base::Milliseconds(200);
++
++// How long a background pane stays unthrottled within each cycle -
++// enough for the renderer to produce and submit one frame.
++constexpr base::TimeDelta kBackgroundPaneFramePulse = base::Milliseconds(50);
++
 +// ComboboxModel for LLM provider selection
 +class LlmProviderComboboxModel : public ui::ComboboxModel {
 + public:
@@ -76,10 +98,17 @@ index 0000000000000..24eefea8b8860
 +
 +ClashOfGptsView::ClashOfGptsView(ClashOfGptsCoordinator* coordinator)
 +    : coordinator_(coordinator),
-+      feedback_timer_(std::make_unique<base::OneShotTimer>()) {
++      feedback_timer_(std::make_unique<base::OneShotTimer>()),
++      background_throttle_timer_(std::make_unique<base::RepeatingTimer>()) {
 +  // Initialize panes vector based on current pane count
 +  panes_.resize(coordinator_->GetPaneCount());
 +
++  // Drives the background-pane rendering duty cycle; each tick no-ops
++  // when the window is hidden or only one pane is up.
++  background_throttle_timer_->Start(
++      FROM_HERE, kBackgroundPaneFrameInterval, this,
++      &ClashOfGptsView::UpdateBackgroundPaneThrottling);
++
 +  // Set up the main container with horizontal layout
 +  auto* main_layout = SetLayoutManager(std::make_unique<views::FlexLayout>());
 +  main_layout->SetOrientation(views::LayoutOrientation::kVertical)
@@ -154,6 +183,33 @@ index 0000000000000..24eefea8b8860
 +  // Add separator
 +  AddChildView(std::make_unique<views::Separator>());
 +
++  // Add prompt broadcast row: one field whose text is injected into every
++  // pane at the same time so all providers start generating together.
++  auto* prompt_row = AddChildView(std::make_unique<views::View>());
++  prompt_row->SetLayoutManager(std::make_unique<views::BoxLayout>(
++      views::BoxLayout::Orientation::kHorizontal,
++      gfx::Insets::TLBR(6, 12, 6, 12),
++      8));
++
++  prompt_field_ = prompt_row->AddChildView(std::make_unique<views::Textfield>());
++  prompt_field_->set_controller(this);
++  prompt_field_->SetPlaceholderText(u"Send a prompt to all panes");
++  prompt_field_->SetAccessibleName(u"Prompt for all panes");
++  static_cast<views::BoxLayout*>(prompt_row->GetLayoutManager())
++      ->SetFlexForView(prompt_field_, 1);
++
++  auto* send_button = prompt_row->AddChildView(
++      std::make_unique<views::ImageButton>(base::BindRepeating(
++          &ClashOfGptsView::OnSendPrompt, base::Unretained(this))));
++  send_button->SetImageModel(
++      views::Button::STATE_NORMAL,
++      ui::ImageModel::FromVectorIcon(vector_icons::kSendIcon, ui::kColorIcon, 20));
++  send_button->SetAccessibleName(u"Send prompt to all panes");
++  send_button->SetTooltipText(u"Send prompt to all panes");
++  send_button->SetPreferredSize(gfx::Size(32, 32));
++  send_button->SetImageHorizontalAlignment(views::ImageButton::ALIGN_CENTER);
++  send_button->SetImageVerticalAlignment(views::ImageButton::ALIGN_MIDDLE);
++
 +  // Create container for the panes
 +  panes_container_ = AddChildView(std::make_unique<views::View>());
 +  panes_container_->SetProperty(
@@ -194,6 +250,9 @@ index 0000000000000..24eefea8b8860
 +  if (feedback_timer_ && feedback_timer_->IsRunning()) {
 +    feedback_timer_->Stop();
 +  }
++  if (background_throttle_timer_ && background_throttle_timer_->IsRunning()) {
++    background_throttle_timer_->Stop();
++  }
 +  // No need to clean up WebContents - coordinator owns them and will
 +  // clean them up via BrowserListObserver/ProfileObserver
 +}
@@ -212,6 +271,17 @@ index 0000000000000..24eefea8b8860
 +}
 +
 +void ClashOfGptsView::NavigatePaneToUrl(int pane_index, const GURL& url) {
++  if (pane_index < 0 || pane_index >= static_cast<int>(panes_.size())) {
++    return;
++  }
++
++  // A pane that hasn't materialized yet just updates its deferred-load
++  // handle; the navigation happens when its WebContents is created.
++  if (!panes_[pane_index].materialized) {
++    panes_[pane_index].pending_url = url;
++    return;
++  }
++
 +  if (content::WebContents* web_contents = GetWebContentsForPane(pane_index)) {
 +    web_contents->GetController().LoadURL(
 +        url, content::Referrer(), ui::PAGE_TRANSITION_AUTO_TOPLEVEL, std::string());
@@ -352,31 +422,146 @@ index 0000000000000..24eefea8b8860
 +      views::FlexSpecification(views::MinimumFlexSizeRule::kScaleToZero,
 +                               views::MaximumFlexSizeRule::kUnbounded));
 +
++  // Record the URL this pane should show (the pane's last session URL if
++  // one was recorded); the WebContents itself is created in
++  // MaterializePane() so opening the window doesn't spawn every pane's
++  // renderer up front.
++  panes_[pane_index].pending_url = coordinator_->GetInitialUrlForPane(pane_index);
++
++  if (pane_index == 0 || coordinator_->HasWebContentsForPane(pane_index)) {
++    // The first pane is what the user looks at first, and panes whose
++    // renderer already exists (window reopen, pane count change) cost
++    // nothing to reattach — materialize those immediately.
++    MaterializePane(pane_index, panes_generation_);
++  } else {
++    // Stagger the remaining renderers so they start behind the first
++    // pane's load instead of all competing with window open.
++    base::SequencedTaskRunner::GetCurrentDefault()->PostDelayedTask(
++        FROM_HERE,
++        base::BindOnce(&ClashOfGptsView::MaterializePane,
++                       weak_factory_.GetWeakPtr(), pane_index,
++                       panes_generation_),
++        kDeferredPaneLoadDelay * pane_index);
++  }
++
++  // Enable focus and accelerators
++  panes_[pane_index].web_view->SetFocusBehavior(views::View::FocusBehavior::ALWAYS);
++  panes_[pane_index].web_view->set_allow_accelerators(true);
++
++  return pane_container;
++}
++
++void ClashOfGptsView::MaterializePane(int pane_index, int generation) {
++  // The panes may have been rebuilt since this task was posted.
++  if (generation != panes_generation_ || pane_index < 0 ||
++      pane_index >= static_cast<int>(panes_.size())) {
++    return;
++  }
++
++  PaneControls& pane = panes_[pane_index];
++  if (pane.materialized || !pane.web_view) {
++    return;
++  }
++
 +  // Get WebContents from coordinator (it owns them)
-+  content::WebContents* web_contents = coordinator_->GetOrCreateWebContentsForPane(pane_index);
-+  if (web_contents) {
-+    // Navigate to initial provider URL
-+    size_t provider_index = coordinator_->GetProviderIndexForPane(pane_index);
-+    const auto& providers = coordinator_->GetProviders();
-+    if (provider_index < providers.size()) {
-+      GURL provider_url = providers[provider_index].url;
++  content::WebContents* web_contents =
++      coordinator_->GetOrCreateWebContentsForPane(pane_index);
++  if (!web_contents) {
++    return;
++  }
++
++  if (pane.pending_url.is_valid()) {
++    // If the kept-alive WebContents is already on the same provider, skip
++    // the reload so reattaching preserves scroll position, form text and
++    // any in-progress conversation from the previous session.
++    const GURL& current_url = web_contents->GetLastCommittedURL();
++    if (!current_url.is_valid() ||
++        current_url.host() != pane.pending_url.host()) {
 +      web_contents->GetController().LoadURL(
-+          provider_url,
++          pane.pending_url,
 +          content::Referrer(),
 +          ui::PAGE_TRANSITION_AUTO_TOPLEVEL,
 +          std::string());
 +    }
++    pane.pending_url = GURL();
++  }
++
++  // Set the WebContents in the WebView (WebView does NOT take ownership)
++  web_contents->WasShown();
++  pane.web_view->SetWebContents(web_contents);
++  pane.web_view->SetVisible(true);
++  pane.materialized = true;
++}
 +
-+    // Set the WebContents in the WebView (WebView does NOT take ownership)
-+    panes_[pane_index].web_view->SetWebContents(web_contents);
-+    panes_[pane_index].web_view->SetVisible(true);
++void ClashOfGptsView::UpdateBackgroundPaneThrottling() {
++  // The coordinator owns visibility while the window is hidden; stay out
++  // of its way.
++  if (!GetWidget() || !GetWidget()->IsVisible()) {
++    return;
 +  }
 +
-+  // Enable focus and accelerators
-+  panes_[pane_index].web_view->SetFocusBehavior(views::View::FocusBehavior::ALWAYS);
-+  panes_[pane_index].web_view->set_allow_accelerators(true);
++  int materialized = 0;
++  for (const PaneControls& pane : panes_) {
++    if (pane.materialized) {
++      ++materialized;
++    }
++  }
 +
-+  return pane_container;
++  views::View* focused =
++      GetFocusManager() ? GetFocusManager()->GetFocusedView() : nullptr;
++
++  for (size_t i = 0; i < panes_.size(); ++i) {
++    PaneControls& pane = panes_[i];
++    if (!pane.materialized || !pane.web_view ||
++        !pane.web_view->web_contents()) {
++      continue;
++    }
++    content::WebContents* contents = pane.web_view->web_contents();
++    // A lone pane, the hovered pane and the focused pane render at full
++    // rate; everything else gets the duty cycle.
++    const bool active = materialized < 2 || pane.web_view->IsMouseHovered() ||
++                        (focused && pane.web_view->Contains(focused));
++    if (active) {
++      if (pane.throttled) {
++        pane.throttled = false;
++        contents->WasShown();
++      }
++      continue;
++    }
++    // Let one frame through, then re-occlude until the next cycle. An
++    // occluded renderer skips rAF and compositing entirely, which is the
++    // work that pegs integrated GPUs with several panes streaming.
++    pane.throttled = true;
++    contents->WasShown();
++    base::SequencedTaskRunner::GetCurrentDefault()->PostDelayedTask(
++        FROM_HERE,
++        base::BindOnce(&ClashOfGptsView::OccludePaneIfStillBackground,
++                       weak_factory_.GetWeakPtr(), static_cast<int>(i),
++                       panes_generation_),
++        kBackgroundPaneFramePulse);
++  }
++}
++
++void ClashOfGptsView::OccludePaneIfStillBackground(int pane_index,
++                                                   int generation) {
++  if (generation != panes_generation_ || pane_index < 0 ||
++      pane_index >= static_cast<int>(panes_.size())) {
++    return;
++  }
++  PaneControls& pane = panes_[pane_index];
++  if (!pane.throttled || !pane.web_view || !pane.web_view->web_contents()) {
++    return;
++  }
++  // The pane may have become active within the pulse; restore it rather
++  // than occluding under the user.
++  views::View* focused =
++      GetFocusManager() ? GetFocusManager()->GetFocusedView() : nullptr;
++  if (pane.web_view->IsMouseHovered() ||
++      (focused && pane.web_view->Contains(focused))) {
++    pane.throttled = false;
++    return;
++  }
++  pane.web_view->web_contents()->WasOccluded();
 +}
 +
 +void ClashOfGptsView::OnProviderChanged(int pane_index) {
@@ -414,6 +599,57 @@ index 0000000000000..24eefea8b8860
 +  coordinator_->CopyContentToAll();
 +}
 +
++void ClashOfGptsView::OnSendPrompt() {
++  if (!prompt_field_) {
++    return;
++  }
++
++  std::u16string prompt(prompt_field_->GetText());
++  if (prompt.empty()) {
++    return;
++  }
++
++  coordinator_->BroadcastPromptToAll(prompt);
++  prompt_field_->SetText(std::u16string());
++}
++
++bool ClashOfGptsView::HandleKeyEvent(views::Textfield* sender,
++                                     const ui::KeyEvent& key_event) {
++  if (sender == prompt_field_ &&
++      key_event.type() == ui::EventType::kKeyPressed &&
++      key_event.key_code() == ui::VKEY_RETURN) {
++    OnSendPrompt();
++    return true;
++  }
++  return false;
++}
++
++void ClashOfGptsView::ShowBroadcastFeedback(int succeeded_panes,
++                                            int total_panes) {
++  if (!copy_feedback_label_) {
++    return;
++  }
++
++  if (succeeded_panes == total_panes) {
++    copy_feedback_label_->SetText(u"Prompt sent to all panes");
++  } else {
++    copy_feedback_label_->SetText(
++        u"Prompt sent to " + base::NumberToString16(succeeded_panes) +
++        u" of " + base::NumberToString16(total_panes) + u" panes");
++  }
++  copy_feedback_label_->SetVisible(true);
++
++  // Cancel any existing timer
++  if (feedback_timer_->IsRunning()) {
++    feedback_timer_->Stop();
++  }
++
++  // Start timer to hide message after 2.5 seconds
++  feedback_timer_->Start(FROM_HERE, base::Seconds(2.5),
++      base::BindOnce(&ClashOfGptsView::HideFeedbackLabel,
++                     weak_factory_.GetWeakPtr()));
++}
++
 +void ClashOfGptsView::HideFeedbackLabel() {
 +  if (copy_feedback_label_ && copy_feedback_label_->GetWidget()) {
 +    copy_feedback_label_->SetVisible(false);
@@ -439,6 +675,9 @@ index 0000000000000..24eefea8b8860
 +}
 +
 +void ClashOfGptsView::RecreatePanesContainer() {
++  // Invalidate any pending MaterializePane tasks for the old panes.
++  ++panes_generation_;
++
 +  // Clear existing panes
 +  panes_container_->RemoveAllChildViews();
 +  panes_.clear();
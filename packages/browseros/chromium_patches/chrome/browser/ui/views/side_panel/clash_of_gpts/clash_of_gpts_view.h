@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_view.h b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_view.h
 new file mode 100644
-index 0000000000000..e9bc398177fe3
+index 0000000000000..fb93a143988c1
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_view.h
-@@ -0,0 +1,112 @@
+@@ -0,0 +1,162 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -18,12 +18,15 @@ index 0000000000000..e9bc398177fe3
 +#include "base/memory/raw_ptr.h"
 +#include "base/memory/weak_ptr.h"
 +#include "ui/base/metadata/metadata_header_macros.h"
++#include "ui/views/controls/textfield/textfield_controller.h"
 +#include "ui/views/view.h"
++#include "url/gurl.h"
 +
 +class ClashOfGptsCoordinator;
 +
 +namespace base {
 +class OneShotTimer;
++class RepeatingTimer;
 +}  // namespace base
 +
 +namespace content {
@@ -34,12 +37,14 @@ index 0000000000000..e9bc398177fe3
 +class Combobox;
 +class Label;
 +class RadioButton;
++class Textfield;
 +class WebView;
 +}  // namespace views
 +
 +// ClashOfGptsView is the main view containing multiple split WebViews for comparing
 +// LLM responses side-by-side. Supports 2 or 3 panes dynamically.
-+class ClashOfGptsView : public views::View {
++class ClashOfGptsView : public views::View,
++                        public views::TextfieldController {
 + public:
 +  METADATA_HEADER(ClashOfGptsView, views::View)
 +  
@@ -55,9 +60,16 @@ index 0000000000000..e9bc398177fe3
 +  // Shows copy feedback message
 +  void ShowCopyFeedback();
 +
++  // Shows the result of a prompt broadcast once every pane has reported.
++  void ShowBroadcastFeedback(int succeeded_panes, int total_panes);
++
 +  // views::View:
 +  void OnThemeChanged() override;
 +
++  // views::TextfieldController:
++  bool HandleKeyEvent(views::Textfield* sender,
++                      const ui::KeyEvent& key_event) override;
++
 +  // Updates the view to show the specified number of panes
 +  void UpdatePaneCount(int new_count);
 +
@@ -68,11 +80,24 @@ index 0000000000000..e9bc398177fe3
 +    raw_ptr<views::Combobox> provider_selector = nullptr;
 +    raw_ptr<views::WebView> web_view = nullptr;
 +    raw_ptr<views::Label> pane_label = nullptr;
++    // Deferred-load handle: the URL this pane should show once its
++    // WebContents is materialized. Cleared on materialization.
++    GURL pending_url;
++    bool materialized = false;
++    // Whether this pane is currently in the background rendering duty
++    // cycle; see UpdateBackgroundPaneThrottling().
++    bool throttled = false;
 +  };
 +
-+  // Creates the UI for a single pane
++  // Creates the UI for a single pane. The pane's WebContents is NOT
++  // created here; see MaterializePane().
 +  std::unique_ptr<views::View> CreatePaneView(int pane_index);
 +
++  // Creates (or reattaches) the pane's WebContents and starts its deferred
++  // load. |generation| guards against panes being rebuilt between the task
++  // being posted and running.
++  void MaterializePane(int pane_index, int generation);
++
 +  // Handles provider selection change for a pane
 +  void OnProviderChanged(int pane_index);
 +
@@ -82,6 +107,9 @@ index 0000000000000..e9bc398177fe3
 +  // Copies content from the active tab
 +  void OnCopyContent();
 +
++  // Sends the prompt field's text to every pane at once
++  void OnSendPrompt();
++
 +  // Hides the feedback label after a delay
 +  void HideFeedbackLabel();
 +
@@ -91,6 +119,17 @@ index 0000000000000..e9bc398177fe3
 +  // Recreates the panes container with the new count
 +  void RecreatePanesContainer();
 +
++  // Timer tick: duty-cycles rendering of panes the user isn't hovering or
++  // focusing - each tick lets one frame through and then re-occludes them
++  // until the next, capping background panes at a few fps while responses
++  // stream. The active pane always renders at full rate, restored within
++  // one tick.
++  void UpdateBackgroundPaneThrottling();
++
++  // Second half of the duty cycle: re-occludes |pane_index| unless it
++  // became active during the pulse or the panes were rebuilt.
++  void OccludePaneIfStillBackground(int pane_index, int generation);
++
 +  // The coordinator that owns this view
 +  raw_ptr<ClashOfGptsCoordinator> coordinator_;
 +
@@ -100,6 +139,10 @@ index 0000000000000..e9bc398177fe3
 +  // Container for the panes
 +  raw_ptr<views::View> panes_container_ = nullptr;
 +
++  // Bumped whenever the panes are rebuilt; stale MaterializePane tasks
++  // compare against it and bail out.
++  int panes_generation_ = 0;
++
 +  // Radio buttons for selecting pane count
 +  raw_ptr<views::RadioButton> one_pane_radio_ = nullptr;
 +  raw_ptr<views::RadioButton> two_panes_radio_ = nullptr;
@@ -108,12 +151,18 @@ index 0000000000000..e9bc398177fe3
 +  // Global copy feedback label
 +  raw_ptr<views::Label> copy_feedback_label_ = nullptr;
 +
++  // Prompt field that broadcasts to all panes
++  raw_ptr<views::Textfield> prompt_field_ = nullptr;
++
 +  // Timer for auto-hiding feedback
 +  std::unique_ptr<base::OneShotTimer> feedback_timer_;
 +
++  // Drives UpdateBackgroundPaneThrottling(); runs for the view's lifetime
++  // and no-ops while the window is hidden.
++  std::unique_ptr<base::RepeatingTimer> background_throttle_timer_;
++
 +  // Weak pointer factory for callbacks
 +  base::WeakPtrFactory<ClashOfGptsView> weak_factory_{this};
 +};
 +
 +#endif  // CHROME_BROWSER_UI_VIEWS_SIDE_PANEL_CLASH_OF_GPTS_CLASH_OF_GPTS_VIEW_H_
-\ No newline at end of file
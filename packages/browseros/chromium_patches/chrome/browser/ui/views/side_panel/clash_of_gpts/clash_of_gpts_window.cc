@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_window.cc b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_window.cc
 new file mode 100644
-index 0000000000000..7a44fab1879ef
+index 0000000000000..e6958cf0a7b55
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_window.cc
-@@ -0,0 +1,83 @@
+@@ -0,0 +1,91 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -80,6 +80,14 @@ index 0000000000000..7a44fab1879ef
 +  return GetWindowIcon();
 +}
 +
++void ClashOfGptsWindow::WindowClosing() {
++  // Snapshot per-pane session state before the views go away so the next
++  // open restores instantly.
++  if (coordinator_) {
++    coordinator_->OnWindowClosing();
++  }
++}
++
 +views::Widget* ClashOfGptsWindow::GetWidget() {
 +  return widget_;
 +}
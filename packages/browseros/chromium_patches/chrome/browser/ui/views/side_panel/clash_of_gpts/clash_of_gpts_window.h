@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_window.h b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_window.h
 new file mode 100644
-index 0000000000000..74a3cd0bbb720
+index 0000000000000..3edecb11c8c10
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_window.h
-@@ -0,0 +1,65 @@
+@@ -0,0 +1,66 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -57,6 +57,7 @@ index 0000000000000..74a3cd0bbb720
 +  views::View* GetContentsView() override;
 +  ui::ImageModel GetWindowIcon() override;
 +  ui::ImageModel GetWindowAppIcon() override;
++  void WindowClosing() override;
 +
 + private:
 +
@@ -69,4 +70,3 @@ index 0000000000000..74a3cd0bbb720
 +};
 +
 +#endif  // CHROME_BROWSER_UI_VIEWS_SIDE_PANEL_CLASH_OF_GPTS_CLASH_OF_GPTS_WINDOW_H_
-\ No newline at end of file
@@ -15,11 +15,11 @@ index b1fb784415a46..ff491e8ace77e 100644
    }
  #endif
 +
-+  // Add third-party LLM panel.
++  // Add third-party LLM panel. Only the entry is registered here; the
++  // coordinator is created when the panel is first shown.
 +  if (base::FeatureList::IsEnabled(features::kThirdPartyLlmPanel)) {
-+    browser->browser_window_features()
-+        ->third_party_llm_panel_coordinator()
-+        ->CreateAndRegisterEntry(window_registry);
++    ThirdPartyLlmPanelCoordinator::CreateAndRegisterEntry(browser,
++                                                          window_registry);
 +  }
 +
 +  // Clash of GPTs doesn't need side panel registration as it opens in its own window
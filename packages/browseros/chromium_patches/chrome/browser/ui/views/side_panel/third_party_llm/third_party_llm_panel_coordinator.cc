@@ -1,37 +1,49 @@
 diff --git a/chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.cc b/chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.cc
 new file mode 100644
-index 0000000000000..f87c563fdd645
+index 0000000000000..d4f322de72b99
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.cc
-@@ -0,0 +1,1163 @@
+@@ -0,0 +1,1670 @@
 +// Copyright 2024 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
 +
 +#include "chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.h"
 +
++#include <algorithm>
 +#include <memory>
++#include <optional>
 +#include <vector>
 +
 +#include "base/check.h"
 +#include "base/check_deref.h"
++#include "base/feature_list.h"
 +#include "build/build_config.h"
 +#include "base/functional/callback.h"
 +#include "ui/views/controls/menu/menu_runner.h"
 +#include "ui/base/mojom/menu_source_type.mojom.h"
 +#include "chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_view.h"
 +#include "base/strings/utf_string_conversions.h"
++#include "chrome/browser/predictors/loading_predictor.h"
++#include "chrome/browser/predictors/loading_predictor_factory.h"
 +#include "chrome/browser/profiles/profile.h"
 +#include "chrome/browser/ui/browser.h"
++#include "net/base/network_anonymization_key.h"
++#include "net/base/schemeful_site.h"
 +#include "chrome/browser/ui/browser_list.h"
 +#include "chrome/browser/ui/browser_window.h"
 +#include "chrome/browser/ui/browser_window/public/browser_window_features.h"
++#include "chrome/browser/ui/ui_features.h"
 +#include "chrome/browser/ui/views/chrome_layout_provider.h"
 +#include "chrome/browser/ui/views/side_panel/side_panel_entry.h"
 +#include "chrome/browser/ui/views/side_panel/side_panel_entry_id.h"
 +#include "chrome/browser/ui/views/side_panel/side_panel_registry.h"
 +#include "chrome/browser/ui/views/side_panel/side_panel_ui.h"
 +#include "chrome/grit/generated_resources.h"
++#include "content/public/browser/browser_task_traits.h"
++#include "content/public/browser/browser_thread.h"
++#include "content/public/browser/navigation_controller.h"
++#include "content/public/browser/navigation_entry.h"
 +#include "content/public/browser/web_contents.h"
 +#include "ui/base/l10n/l10n_util.h"
 +#include "ui/base/models/combobox_model.h"
@@ -65,17 +77,21 @@ index 0000000000000..f87c563fdd645
 +#include "chrome/browser/ui/browser_tabstrip.h"
 +#include "base/timer/timer.h"
 +#include "base/task/sequenced_task_runner.h"
++#include "base/task/thread_pool.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_api_helpers.h"
++#include "chrome/browser/extensions/api/browser_os/browser_os_snapshot_processor.h"
 +#include "components/input/native_web_keyboard_event.h"
 +#include "content/public/browser/render_widget_host_view.h"
 +#include "third_party/skia/include/core/SkBitmap.h"
 +#include "ui/gfx/codec/png_codec.h"
-+#include "ui/gfx/image/image.h"
 +#include "chrome/browser/file_select_helper.h"
 +#include "chrome/browser/media/webrtc/media_capture_devices_dispatcher.h"
 +#include "content/public/browser/file_select_listener.h"
 +#include "third_party/blink/public/common/mediastream/media_stream_request.h"
 +#include "content/public/browser/render_frame_host.h"
++#include "chrome/browser/browser_process.h"
 +#include "chrome/browser/browseros/metrics/browseros_metrics.h"
++#include "components/performance_manager/public/user_tuning/prefs.h"
 +#include "chrome/browser/ui/views/side_panel/clash_of_gpts/clash_of_gpts_coordinator.h"
 +
 +namespace {
@@ -84,6 +100,226 @@ index 0000000000000..f87c563fdd645
 +const char kThirdPartyLlmProvidersPref[] = "browseros.third_party_llm.providers";
 +const char kThirdPartyLlmSelectedProviderPref[] = "browseros.third_party_llm.selected_provider";
 +
++// How long a cached extraction stays valid. The navigation entry id in
++// the cache key already covers navigations; the age limit keeps very
++// dynamic pages (feeds, dashboards) from serving stale text forever.
++constexpr base::TimeDelta kExtractionCacheMaxAge = base::Seconds(30);
++
++// Maximum number of hidden provider WebContents kept warm for instant
++// switching. Heavy LLM web apps hold a renderer each, so keep this small.
++constexpr size_t kMaxWarmContents = 3;
++
++// How long after the panel view is created before recently used providers
++// are pre-loaded in the background, so the prewarm does not compete with
++// the visible provider's own page load.
++constexpr base::TimeDelta kPrewarmDelay = base::Seconds(5);
++
++// How long an LLM panel WebContents may sit idle before it is discarded,
++// or nullopt when the user has turned Memory Saver off. Reuses the same
++// local-state prefs that drive tab discarding so the panel honors the
++// user's existing memory/speed trade-off.
++std::optional<base::TimeDelta> GetIdleDiscardDelay() {
++  PrefService* local_state = g_browser_process->local_state();
++  if (!local_state) {
++    return std::nullopt;
++  }
++  using performance_manager::user_tuning::prefs::MemorySaverModeState;
++  const int state = local_state->GetInteger(
++      performance_manager::user_tuning::prefs::kMemorySaverModeState);
++  if (state == static_cast<int>(MemorySaverModeState::kDisabled)) {
++    return std::nullopt;
++  }
++  const int minutes =
++      local_state->GetInteger(performance_manager::user_tuning::prefs::
++                                  kMemorySaverModeTimeBeforeDiscardInMinutes);
++  return base::Minutes(std::max(minutes, 1));
++}
++
++// Roles whose own text is page chrome (controls, menu entries) rather
++// than content; their subtrees are still walked for nested content.
++bool IsSkippedRole(ax::mojom::Role role) {
++  return role == ax::mojom::Role::kButton ||
++         role == ax::mojom::Role::kForm ||
++         role == ax::mojom::Role::kMenuItem;
++}
++
++// Landmark containers that hold only page chrome (site header, sidebar,
++// footer, toolbars). Unlike the skipped roles above, nothing under these
++// is conversation content, so the walk drops the whole subtree without
++// visiting it.
++bool IsPrunedSubtreeRole(ax::mojom::Role role) {
++  return role == ax::mojom::Role::kNavigation ||
++         role == ax::mojom::Role::kBanner ||
++         role == ax::mojom::Role::kComplementary ||
++         role == ax::mojom::Role::kContentInfo ||
++         role == ax::mojom::Role::kSearch ||
++         role == ax::mojom::Role::kMenu ||
++         role == ax::mojom::Role::kMenuBar ||
++         role == ax::mojom::Role::kToolbar;
++}
++
++// Picks the node the extraction walk should start from. Provider pages
++// mark the conversation area as a landmark (main on the big chat UIs,
++// sometimes log or article); when one exists, walking just that subtree
++// skips the surrounding chrome entirely, which on a long conversation is
++// most of the node count. Falls back to |root_index| for pages without a
++// content landmark.
++int32_t FindContentRoot(const extensions::api::FlatAXTree& tree,
++                        int32_t root_index) {
++  constexpr int32_t kInvalidIndex = extensions::api::FlatAXTree::kInvalidIndex;
++  int32_t log_index = kInvalidIndex;
++  int32_t article_index = kInvalidIndex;
++  for (int32_t i = 0; i < static_cast<int32_t>(tree.size()); ++i) {
++    switch (tree.NodeAt(i).role) {
++      case ax::mojom::Role::kMain:
++        // Outermost main wins; nodes are stored in document order.
++        return i;
++      case ax::mojom::Role::kLog:
++        if (log_index == kInvalidIndex) {
++          log_index = i;
++        }
++        break;
++      case ax::mojom::Role::kArticle:
++        if (article_index == kInvalidIndex) {
++          article_index = i;
++        }
++        break;
++      default:
++        break;
++    }
++  }
++  if (log_index != kInvalidIndex) {
++    return log_index;
++  }
++  if (article_index != kInvalidIndex) {
++    return article_index;
++  }
++  return root_index;
++}
++
++// Builds the clipboard text from an AX tree snapshot. Runs on the thread
++// pool: the snapshot is a self-contained value, so the walk touches nothing
++// UI-owned. Uses the flat first-child/next-sibling layout from the
++// browser_os snapshot processor, so the traversal is linear index chasing
++// with an explicit stack instead of per-node map lookups and recursion.
++// The walk is scoped to the conversation landmark (FindContentRoot) and
++// drops chrome-only landmark subtrees, so on a long conversation it only
++// touches the transcript nodes rather than the whole page tree.
++std::u16string ExtractTextFromTreeUpdate(ui::AXTreeUpdate update) {
++  extensions::api::SnapshotArena arena;
++  extensions::api::FlatAXTree tree(&arena);
++  tree.Build(update);
++
++  constexpr int32_t kInvalidIndex = extensions::api::FlatAXTree::kInvalidIndex;
++  const int32_t root_index = tree.IndexOf(update.root_id);
++  if (root_index == kInvalidIndex) {
++    LOG(ERROR) << "Root node not found in tree update";
++    return std::u16string();
++  }
++
++  std::u16string output;
++  // Long conversations produce hundreds of KB of text; reserving against
++  // the node count keeps the append loop from repeatedly reallocating.
++  output.reserve(tree.size() * 4);
++
++  // A frame is either a node's main visit or the post-children visit that
++  // closes a block-level element with a paragraph break.
++  struct Frame {
++    int32_t index;
++    bool post_visit;
++  };
++  std::vector<Frame> stack;
++  stack.push_back({FindContentRoot(tree, root_index), false});
++
++  while (!stack.empty()) {
++    const Frame frame = stack.back();
++    stack.pop_back();
++
++    if (frame.post_visit) {
++      // Paragraph break after block-level elements if they had content.
++      if (!output.empty() && output.back() != '\n') {
++        output += u"\n\n";
++      }
++      continue;
++    }
++
++    const ui::AXNodeData& node = tree.NodeAt(frame.index);
++    if (IsPrunedSubtreeRole(node.role)) {
++      continue;
++    }
++    const bool skipped = IsSkippedRole(node.role);
++    bool needs_paragraph_break = false;
++
++    if (!skipped) {
++      // Extract text if this is a text-containing element.
++      if (node.role == ax::mojom::Role::kStaticText ||
++          node.role == ax::mojom::Role::kInlineTextBox) {
++        std::u16string text;
++        if (node.HasStringAttribute(ax::mojom::StringAttribute::kName)) {
++          text = node.GetString16Attribute(ax::mojom::StringAttribute::kName);
++        }
++        if (text.empty() &&
++            node.HasStringAttribute(ax::mojom::StringAttribute::kValue)) {
++          text = node.GetString16Attribute(ax::mojom::StringAttribute::kValue);
++        }
++        if (!text.empty()) {
++          // Add appropriate spacing.
++          if (!output.empty() && output.back() != ' ' &&
++              output.back() != '\n') {
++            output += u" ";
++          }
++          output += text;
++        }
++      }
++
++      // Handle line breaks.
++      if (node.role == ax::mojom::Role::kLineBreak) {
++        output += u"\n";
++      }
++
++      // Add paragraph breaks around block-level elements.
++      needs_paragraph_break = (node.role == ax::mojom::Role::kParagraph ||
++                               node.role == ax::mojom::Role::kHeading ||
++                               node.role == ax::mojom::Role::kListItem ||
++                               node.role == ax::mojom::Role::kBlockquote ||
++                               node.role == ax::mojom::Role::kArticle ||
++                               node.role == ax::mojom::Role::kSection);
++      if (needs_paragraph_break && !output.empty() && output.back() != '\n') {
++        output += u"\n\n";
++      }
++    }
++
++    if (needs_paragraph_break) {
++      stack.push_back({frame.index, true});
++    }
++
++    // Push children reversed so the first child is processed first (and
++    // before any post-visit frame pushed above).
++    std::vector<int32_t> children;
++    for (int32_t child = tree.LinksAt(frame.index).first_child;
++         child != kInvalidIndex; child = tree.LinksAt(child).next_sibling) {
++      children.push_back(child);
++    }
++    for (auto it = children.rbegin(); it != children.rend(); ++it) {
++      stack.push_back({*it, false});
++    }
++  }
++
++  // Clean up text - collapse runs of multiple spaces. Single in-place
++  // pass; the old find/replace loop reshuffled the tail of the string for
++  // every run, which was quadratic on conversation-sized output.
++  size_t write = 0;
++  for (size_t read = 0; read < output.size(); ++read) {
++    if (output[read] == u' ' && write > 0 && output[write - 1] == u' ') {
++      continue;
++    }
++    output[write++] = output[read];
++  }
++  output.resize(write);
++
++  return output;
++}
++
 +// ComboboxModel for LLM provider selection
 +class LlmProviderComboboxModel : public ui::ComboboxModel {
 + public:
@@ -119,6 +355,12 @@ index 0000000000000..f87c563fdd645
 +  browser_list_observation_.Observe(BrowserList::GetInstance());
 +  profile_observation_.Observe(&profile_.get());
 +
++  // Drop warm provider contents when memory gets tight.
++  memory_pressure_listener_ = std::make_unique<base::MemoryPressureListener>(
++      FROM_HERE,
++      base::BindRepeating(&ThirdPartyLlmPanelCoordinator::OnMemoryPressure,
++                          base::Unretained(this)));
++
 +  // Load providers from preferences
 +  LoadProvidersFromPrefs();
 +}
@@ -128,15 +370,37 @@ index 0000000000000..f87c563fdd645
 +  // The ScopedObservation objects will automatically unregister
 +}
 +
++// static
++ThirdPartyLlmPanelCoordinator*
++ThirdPartyLlmPanelCoordinator::GetOrCreateForBrowser(Browser* browser) {
++  if (!base::FeatureList::IsEnabled(features::kThirdPartyLlmPanel)) {
++    return nullptr;
++  }
++  BrowserWindowFeatures* window_features = browser->browser_window_features();
++  if (!window_features->third_party_llm_panel_coordinator()) {
++    window_features->set_third_party_llm_panel_coordinator(
++        std::make_unique<ThirdPartyLlmPanelCoordinator>(
++            browser->profile(), browser->tab_strip_model()));
++  }
++  return window_features->third_party_llm_panel_coordinator();
++}
++
++// static
 +void ThirdPartyLlmPanelCoordinator::CreateAndRegisterEntry(
++    Browser* browser,
 +    SidePanelRegistry* global_registry) {
++  // The entry only captures |browser| (which outlives the window registry);
++  // the coordinator is created when the panel is first shown.
 +  auto entry = std::make_unique<SidePanelEntry>(
 +      SidePanelEntry::Key(SidePanelEntry::Id::kThirdPartyLlm),
 +      base::BindRepeating(
-+          &ThirdPartyLlmPanelCoordinator::CreateThirdPartyLlmWebView,
-+          base::Unretained(this)),
++          [](Browser* browser, SidePanelEntryScope& scope) {
++            return GetOrCreateForBrowser(browser)->CreateThirdPartyLlmWebView(
++                scope);
++          },
++          browser),
 +      base::RepeatingCallback<int()>());
-+  
++
 +  global_registry->Register(std::move(entry));
 +}
 +
@@ -166,6 +430,17 @@ index 0000000000000..f87c563fdd645
 +    }
 +  }
 +
++  // Warm connections for the providers the user is most likely to hit:
++  // the current one on a cold open (its deferred navigation then starts
++  // with DNS/TCP/TLS already done) and the next in cycle order. A
++  // provider switch otherwise pays the full handshake before first byte.
++  if (!owned_web_contents_) {
++    PreconnectProvider(current_provider_index_);
++  }
++  if (providers_.size() > 1) {
++    PreconnectProvider((current_provider_index_ + 1) % providers_.size());
++  }
++
 +  // Cancel any pending timer callbacks before resetting UI pointers
 +  if (feedback_timer_ && feedback_timer_->IsRunning()) {
 +    feedback_timer_->Stop();
@@ -314,45 +589,26 @@ index 0000000000000..f87c563fdd645
 +  // Observe UI elements so we can reset pointers when they are destroyed.
 +  view_observation_.AddObservation(web_view_);
 +  
-+  // Create WebContents if we don't have one yet
-+  if (!owned_web_contents_) {
-+    content::WebContents::CreateParams params(GetProfile());
-+    owned_web_contents_ = content::WebContents::Create(params);
-+
-+    // Set this as the delegate to handle keyboard events
-+    owned_web_contents_->SetDelegate(this);
-+  }
-+
-+  // Navigate to initial provider (use last URL if available)
-+  GURL provider_url;
-+  if (current_provider_index_ < providers_.size()) {
-+    auto it = last_urls_.find(current_provider_index_);
-+    if (it != last_urls_.end() && it->second.is_valid()) {
-+      provider_url = it->second;
-+    } else {
-+      provider_url = providers_[current_provider_index_].url;
-+    }
-+  }
-+
-+  if (provider_url.is_valid()) {
-+    owned_web_contents_->GetController().LoadURL(
-+        provider_url,
-+        content::Referrer(),
-+        ui::PAGE_TRANSITION_AUTO_TOPLEVEL,
-+        std::string());
++  // Warm contents from a previous open attach immediately - reopening is
++  // a cheap reattach. A cold open defers the WebContents creation and
++  // provider navigation to an idle task so the panel shell paints and
++  // animates first; the synchronous renderer spawn here is what made the
++  // open stutter on integrated GPUs. The empty WebView serves as the
++  // placeholder until the contents attach.
++  if (owned_web_contents_) {
++    AttachWebContentsToPanel();
++  } else {
++    content::GetUIThreadTaskRunner({base::TaskPriority::BEST_EFFORT})
++        ->PostTask(
++            FROM_HERE,
++            base::BindOnce(
++                &ThirdPartyLlmPanelCoordinator::AttachWebContentsToPanel,
++                weak_factory_.GetWeakPtr()));
 +  }
 +
-+  // Set the WebContents in the WebView (WebView does NOT take ownership)
-+  // We pass the raw pointer but retain ownership via owned_web_contents_
-+  web_view_->SetWebContents(owned_web_contents_.get());
-+  web_view_->SetVisible(true);
-+  
 +  // Tell our custom container about the WebView for proper cleanup
 +  container->SetWebView(web_view_);
 +
-+  // Observe the WebContents
-+  Observe(owned_web_contents_.get());
-+
 +  // Enable focus for the WebView to handle keyboard events properly
 +  web_view_->SetFocusBehavior(views::View::FocusBehavior::ALWAYS);
 +
@@ -386,10 +642,63 @@ index 0000000000000..f87c563fdd645
 +      shortcuts_label->font_list().DeriveWithSizeDelta(-1));
 +  
 +  browseros_metrics::BrowserOSMetrics::Log("llmchat.created");
-+  
++
++  // Pre-load recently used providers once the visible provider's own load
++  // has had a chance to get going.
++  base::SequencedTaskRunner::GetCurrentDefault()->PostDelayedTask(
++      FROM_HERE,
++      base::BindOnce(&ThirdPartyLlmPanelCoordinator::PrewarmRecentProviders,
++                     weak_factory_.GetWeakPtr()),
++      kPrewarmDelay);
++
 +  return container;
 +}
 +
++void ThirdPartyLlmPanelCoordinator::AttachWebContentsToPanel() {
++  // The panel may have closed again before the idle task ran.
++  if (!web_view_) {
++    return;
++  }
++
++  // Create WebContents if we don't have one yet
++  if (!owned_web_contents_) {
++    content::WebContents::CreateParams params(GetProfile());
++    owned_web_contents_ = content::WebContents::Create(params);
++
++    // Set this as the delegate to handle keyboard events
++    owned_web_contents_->SetDelegate(this);
++  }
++
++  // Navigate to initial provider (use last URL if available)
++  GURL provider_url;
++  if (current_provider_index_ < providers_.size()) {
++    auto it = last_urls_.find(current_provider_index_);
++    if (it != last_urls_.end() && it->second.is_valid()) {
++      provider_url = it->second;
++    } else {
++      provider_url = providers_[current_provider_index_].url;
++    }
++  }
++
++  if (provider_url.is_valid()) {
++    owned_web_contents_->GetController().LoadURL(
++        provider_url,
++        content::Referrer(),
++        ui::PAGE_TRANSITION_AUTO_TOPLEVEL,
++        std::string());
++  }
++
++  // Set the WebContents in the WebView (WebView does NOT take ownership)
++  // We pass the raw pointer but retain ownership via owned_web_contents_
++  web_view_->SetWebContents(owned_web_contents_.get());
++  web_view_->SetVisible(true);
++  owned_web_contents_->WasShown();
++  panel_hidden_time_ = base::TimeTicks();
++
++  // Observe the WebContents
++  Observe(owned_web_contents_.get());
++}
++
 +void ThirdPartyLlmPanelCoordinator::OnProviderChanged() {
 +  if (!provider_selector_)
 +    return;
@@ -421,6 +730,10 @@ index 0000000000000..f87c563fdd645
 +
 +  const base::Value::List& providers_list = prefs->GetList(kThirdPartyLlmProvidersPref);
 +
++  // The reload may remap provider indices; the warm pool is keyed by
++  // index, so drop it rather than risk swapping in the wrong provider.
++  warm_contents_.clear();
++
 +  providers_.clear();
 +
 +  if (!providers_list.empty()) {
@@ -460,6 +773,15 @@ index 0000000000000..f87c563fdd645
 +    SaveProvidersToPrefs();
 +  }
 +
++  // Rebuild the trusted-host set; this is the only place the provider list
++  // changes, so the media permission hooks can trust it between reloads.
++  std::vector<std::string> provider_hosts;
++  provider_hosts.reserve(providers_.size());
++  for (const auto& provider : providers_) {
++    provider_hosts.push_back(provider.url.host());
++  }
++  provider_hosts_ = base::flat_set<std::string>(std::move(provider_hosts));
++
 +  // Load selected provider index
 +  int selected_index = prefs->GetInteger(kThirdPartyLlmSelectedProviderPref);
 +  if (selected_index < 0 || static_cast<size_t>(selected_index) >= providers_.size()) {
@@ -491,6 +813,11 @@ index 0000000000000..f87c563fdd645
 +  prefs->SetList(kThirdPartyLlmProvidersPref, std::move(providers_list));
 +}
 +
++bool ThirdPartyLlmPanelCoordinator::IsTrustedLlmHost(
++    const GURL& origin_url) const {
++  return provider_hosts_.contains(origin_url.host());
++}
++
 +void ThirdPartyLlmPanelCoordinator::DoProviderChange(size_t new_provider_index) {
 +  // Prevent re-entrancy and overlapping updates.
 +  if (provider_change_in_progress_ || new_provider_index == current_provider_index_)
@@ -505,10 +832,11 @@ index 0000000000000..f87c563fdd645
 +
 +  browseros_metrics::BrowserOSMetrics::Log("llmchat.provider.changed");
 +
++  const size_t old_index = current_provider_index_;
 +  if (owned_web_contents_) {
 +    GURL current_url = owned_web_contents_->GetURL();
 +    if (current_url.is_valid()) {
-+      last_urls_[current_provider_index_] = current_url;
++      last_urls_[old_index] = current_url;
 +    }
 +  }
 +
@@ -519,21 +847,201 @@ index 0000000000000..f87c563fdd645
 +    prefs->SetInteger(kThirdPartyLlmSelectedProviderPref, static_cast<int>(current_provider_index_));
 +  }
 +
-+  // Determine URL to load.
-+  GURL provider_url;
-+  auto it = last_urls_.find(current_provider_index_);
-+  provider_url = (it != last_urls_.end() && it->second.is_valid())
-+                     ? it->second
-+                     : providers_[current_provider_index_].url;
-+
 +  if (owned_web_contents_) {
++    // Park the outgoing contents (hidden, still loaded) so switching back
++    // to this provider is instant instead of a full page load.
++    if (web_view_) {
++      web_view_->SetWebContents(nullptr);
++    }
++    Observe(nullptr);
++    owned_web_contents_->WasHidden();
++    WarmEntry& parked = warm_contents_[old_index];
++    parked.contents = std::move(owned_web_contents_);
++    parked.last_used = base::TimeTicks::Now();
++
++    while (warm_contents_.size() > kMaxWarmContents) {
++      auto lru = warm_contents_.begin();
++      for (auto candidate = warm_contents_.begin();
++           candidate != warm_contents_.end(); ++candidate) {
++        if (candidate->second.last_used < lru->second.last_used) {
++          lru = candidate;
++        }
++      }
++      warm_contents_.erase(lru);
++    }
++
++    ScheduleIdleDiscardSweep();
++  }
++
++  // Swap in a warm contents if we have one; otherwise create and load.
++  auto warm_it = warm_contents_.find(current_provider_index_);
++  if (warm_it != warm_contents_.end()) {
++    owned_web_contents_ = std::move(warm_it->second.contents);
++    warm_contents_.erase(warm_it);
++  } else {
++    content::WebContents::CreateParams params(GetProfile());
++    owned_web_contents_ = content::WebContents::Create(params);
++
++    GURL provider_url;
++    auto it = last_urls_.find(current_provider_index_);
++    provider_url = (it != last_urls_.end() && it->second.is_valid())
++                       ? it->second
++                       : providers_[current_provider_index_].url;
 +    owned_web_contents_->GetController().LoadURL(
-+        provider_url, content::Referrer(), ui::PAGE_TRANSITION_AUTO_TOPLEVEL, std::string());
++        provider_url, content::Referrer(), ui::PAGE_TRANSITION_AUTO_TOPLEVEL,
++        std::string());
 +  }
 +
++  owned_web_contents_->SetDelegate(this);
++  if (web_view_) {
++    web_view_->SetWebContents(owned_web_contents_.get());
++  }
++  owned_web_contents_->WasShown();
++  Observe(owned_web_contents_.get());
++
 +  provider_change_in_progress_ = false;
 +}
 +
++void ThirdPartyLlmPanelCoordinator::PrewarmRecentProviders() {
++  // Panel may have been torn down since the task was posted.
++  if (!owned_web_contents_) {
++    return;
++  }
++
++  // last_urls_ holds the providers the user actually visited; pre-load
++  // those hidden so switching to them skips the page load entirely.
++  for (const auto& [index, url] : last_urls_) {
++    if (index == current_provider_index_ || index >= providers_.size()) {
++      continue;
++    }
++    if (warm_contents_.size() >= kMaxWarmContents) {
++      break;
++    }
++    if (warm_contents_.find(index) != warm_contents_.end()) {
++      continue;
++    }
++
++    content::WebContents::CreateParams params(GetProfile());
++    std::unique_ptr<content::WebContents> contents =
++        content::WebContents::Create(params);
++    contents->SetDelegate(this);
++    contents->GetController().LoadURL(
++        url.is_valid() ? url : providers_[index].url, content::Referrer(),
++        ui::PAGE_TRANSITION_AUTO_TOPLEVEL, std::string());
++    contents->WasHidden();
++
++    WarmEntry& entry = warm_contents_[index];
++    entry.contents = std::move(contents);
++    entry.last_used = base::TimeTicks::Now();
++  }
++
++  if (!warm_contents_.empty()) {
++    ScheduleIdleDiscardSweep();
++  }
++}
++
++void ThirdPartyLlmPanelCoordinator::PreconnectProvider(size_t provider_index) {
++  if (provider_index >= providers_.size()) {
++    return;
++  }
++  // A warm WebContents already holds live connections to the provider.
++  if (warm_contents_.find(provider_index) != warm_contents_.end()) {
++    return;
++  }
++  auto* loading_predictor =
++      predictors::LoadingPredictorFactory::GetForProfile(GetProfile());
++  if (!loading_predictor) {
++    return;
++  }
++  // Preconnect to where a switch would actually navigate: the provider's
++  // last URL when one was saved, its landing page otherwise.
++  auto url_it = last_urls_.find(provider_index);
++  const GURL& url = url_it != last_urls_.end() && url_it->second.is_valid()
++                        ? url_it->second
++                        : providers_[provider_index].url;
++  if (!url.is_valid()) {
++    return;
++  }
++  loading_predictor->PreconnectURLIfAllowed(
++      url, /*allow_credentials=*/true,
++      net::NetworkAnonymizationKey::CreateSameSite(net::SchemefulSite(url)));
++}
++
++void ThirdPartyLlmPanelCoordinator::OnMemoryPressure(
++    base::MemoryPressureListener::MemoryPressureLevel level) {
++  if (level == base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE ||
++      warm_contents_.empty()) {
++    return;
++  }
++  LOG(INFO) << "[browseros] Dropping " << warm_contents_.size()
++            << " warm LLM provider contents under memory pressure";
++  warm_contents_.clear();
++}
++
++void ThirdPartyLlmPanelCoordinator::ScheduleIdleDiscardSweep() {
++  if (discard_timer_.IsRunning()) {
++    return;
++  }
++  std::optional<base::TimeDelta> delay = GetIdleDiscardDelay();
++  if (!delay) {
++    // Memory Saver is off; nothing to do. Re-checked the next time a
++    // contents goes idle, so a pref flip takes effect without a restart.
++    return;
++  }
++  discard_timer_.Start(FROM_HERE, *delay, this,
++                       &ThirdPartyLlmPanelCoordinator::DiscardIdleContents);
++}
++
++void ThirdPartyLlmPanelCoordinator::DiscardIdleContents() {
++  std::optional<base::TimeDelta> delay = GetIdleDiscardDelay();
++  if (!delay) {
++    return;
++  }
++
++  const base::TimeTicks now = base::TimeTicks::Now();
++  size_t discarded = 0;
++
++  // Warm pool entries that have been parked past the timeout. Their last
++  // URL is kept so the next switch to that provider reloads where the
++  // user left off instead of the provider landing page.
++  for (auto it = warm_contents_.begin(); it != warm_contents_.end();) {
++    if (now - it->second.last_used >= *delay) {
++      GURL url = it->second.contents->GetURL();
++      if (url.is_valid()) {
++        last_urls_[it->first] = url;
++      }
++      it = warm_contents_.erase(it);
++      ++discarded;
++    } else {
++      ++it;
++    }
++  }
++
++  // The panel's own contents, once the side panel has been closed long
++  // enough. CreateThirdPartyLlmWebView() recreates it from last_urls_ the
++  // next time the panel opens.
++  if (!web_view_ && owned_web_contents_ && !panel_hidden_time_.is_null() &&
++      now - panel_hidden_time_ >= *delay) {
++    GURL url = owned_web_contents_->GetURL();
++    if (url.is_valid()) {
++      last_urls_[current_provider_index_] = url;
++    }
++    Observe(nullptr);
++    owned_web_contents_.reset();
++    ++discarded;
++  }
++
++  if (discarded > 0) {
++    LOG(INFO) << "[browseros] Discarded " << discarded
++              << " idle LLM panel contents (memory saver)";
++  }
++
++  // Keep sweeping while anything is still idle.
++  if (!warm_contents_.empty() || (!web_view_ && owned_web_contents_)) {
++    ScheduleIdleDiscardSweep();
++  }
++}
++
 +void ThirdPartyLlmPanelCoordinator::OnRefreshContent() {
 +  if (!owned_web_contents_ || current_provider_index_ >= providers_.size()) {
 +    return;
@@ -591,11 +1099,34 @@ index 0000000000000..f87c563fdd645
 +  // Store the title and URL for later use
 +  page_title_ = active_contents->GetTitle();
 +  page_url_ = active_contents->GetVisibleURL();
-+  
-+  // Request accessibility tree snapshot
++
++  // Serve repeated copies of an unchanged page from the cache. The AX
++  // tree serialization below is the expensive part of this path, and
++  // users hammering the copy button on a static article would otherwise
++  // pay for it on every click.
++  content::NavigationEntry* entry =
++      active_contents->GetController().GetLastCommittedEntry();
++  const int nav_id = entry ? entry->GetUniqueID() : 0;
++  if (nav_id != 0 && extraction_cache_contents_.get() == active_contents &&
++      extraction_cache_nav_id_ == nav_id &&
++      !extraction_cache_text_.empty() &&
++      base::TimeTicks::Now() - extraction_cache_time_ <
++          kExtractionCacheMaxAge) {
++    CopyExtractedText(extraction_cache_text_);
++    return;
++  }
++  extraction_cache_contents_ = active_contents->GetWeakPtr();
++  extraction_cache_nav_id_ = nav_id;
++  extraction_cache_text_.clear();
++
++  // Request accessibility tree snapshot. The key is bound into the reply
++  // so a response that arrives after the user copied a different tab (or
++  // the tab navigated) can be recognized and dropped instead of being
++  // cached - and copied - under the newer key.
 +  active_contents->RequestAXTreeSnapshot(
 +      base::BindOnce(&ThirdPartyLlmPanelCoordinator::OnAccessibilityTreeReceived,
-+                     weak_factory_.GetWeakPtr()),
++                     weak_factory_.GetWeakPtr(), active_contents->GetWeakPtr(),
++                     nav_id),
 +      ui::AXMode::kWebContents,  // Request web contents mode
 +      0,  // max_nodes (0 = no limit)
 +      base::Seconds(5),  // timeout
@@ -622,6 +1153,9 @@ index 0000000000000..f87c563fdd645
 +
 +  // For now, just capture the visible viewport
 +  // Full page screenshot would require DevTools protocol or RenderFrameHostImpl access
++  // The callback's bitmap shares the viz readback buffer through its
++  // refcounted pixel ref; hand it straight through rather than wrapping
++  // it in a gfx::Image just to unwrap it again.
 +  view->CopyFromSurface(
 +      gfx::Rect(),  // Empty rect = full visible surface
 +      gfx::Size(),  // Empty size = original size
@@ -630,18 +1164,14 @@ index 0000000000000..f87c563fdd645
 +        if (!coordinator) {
 +          return;
 +        }
-+        gfx::Image image;
-+        if (!bitmap.drawsNothing()) {
-+          image = gfx::Image::CreateFrom1xBitmap(bitmap);
-+        }
-+        coordinator->OnScreenshotCaptured(image);
++        coordinator->OnScreenshotCaptured(bitmap);
 +      }, weak_factory_.GetWeakPtr()));
 +}
 +
 +
 +void ThirdPartyLlmPanelCoordinator::OnScreenshotCaptured(
-+    const gfx::Image& image) {
-+  if (image.IsEmpty()) {
++    const SkBitmap& bitmap) {
++  if (bitmap.drawsNothing()) {
 +    if (copy_feedback_label_) {
 +      copy_feedback_label_->SetText(u"Failed to capture screenshot");
 +      copy_feedback_label_->SetVisible(true);
@@ -657,10 +1187,44 @@ index 0000000000000..f87c563fdd645
 +    return;
 +  }
 +
-+  // Copy image to clipboard
++  // Run the clipboard conversion on the thread pool; the clipboard itself
++  // is UI-thread-only, so the write happens in the reply. Binding the
++  // bitmap shares its pixel ref - the frame stays in the viz readback
++  // buffer - and PrepareBitmapForClipboard passes N32 captures (the
++  // common case) through without touching the pixels, so only a
++  // non-N32 capture pays a frame copy before the clipboard's own write.
++  // Shares the off-thread image pipeline with the browserOS
++  // captureScreenshot API.
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE, {base::TaskPriority::USER_BLOCKING},
++      base::BindOnce(&extensions::api::PrepareBitmapForClipboard, bitmap),
++      base::BindOnce(
++          &ThirdPartyLlmPanelCoordinator::OnScreenshotReadyForClipboard,
++          weak_factory_.GetWeakPtr()));
++}
++
++void ThirdPartyLlmPanelCoordinator::OnScreenshotReadyForClipboard(
++    SkBitmap bitmap) {
++  if (bitmap.drawsNothing()) {
++    if (copy_feedback_label_) {
++      copy_feedback_label_->SetText(u"Failed to capture screenshot");
++      copy_feedback_label_->SetVisible(true);
++
++      // Start timer to hide message
++      if (feedback_timer_->IsRunning()) {
++        feedback_timer_->Stop();
++      }
++      feedback_timer_->Start(FROM_HERE, base::Seconds(2.5),
++          base::BindOnce(&ThirdPartyLlmPanelCoordinator::HideFeedbackLabel,
++                         weak_factory_.GetWeakPtr()));
++    }
++    return;
++  }
++
++  // Copy image to clipboard. WriteImage reuses the converted pixels.
 +  ui::ScopedClipboardWriter clipboard_writer(ui::ClipboardBuffer::kCopyPaste);
-+  clipboard_writer.WriteImage(image.AsBitmap());
-+  
++  clipboard_writer.WriteImage(bitmap);
++
 +  browseros_metrics::BrowserOSMetrics::Log("llmchat.screenshot.captured");
 +
 +  // Show success feedback
@@ -679,61 +1243,75 @@ index 0000000000000..f87c563fdd645
 +}
 +
 +void ThirdPartyLlmPanelCoordinator::OnAccessibilityTreeReceived(
++    base::WeakPtr<content::WebContents> contents,
++    int nav_id,
 +    ui::AXTreeUpdate& update) {
-+  // Build a map of node IDs to node data for easy lookup
-+  std::map<ui::AXNodeID, const ui::AXNodeData*> node_map;
-+  for (const auto& node_data : update.nodes) {
-+    node_map[node_data.id] = &node_data;
++  // The update is a value-type snapshot, so hand it to the thread pool and
++  // build the text there: walking a long conversation's tree on the UI
++  // thread visibly stalls the browser.
++  base::ThreadPool::PostTaskAndReplyWithResult(
++      FROM_HERE, {base::TaskPriority::USER_BLOCKING},
++      base::BindOnce(&ExtractTextFromTreeUpdate, std::move(update)),
++      base::BindOnce(&ThirdPartyLlmPanelCoordinator::OnTextExtracted,
++                     weak_factory_.GetWeakPtr(), std::move(contents), nav_id));
++}
++
++void ThirdPartyLlmPanelCoordinator::OnTextExtracted(
++    base::WeakPtr<content::WebContents> contents,
++    int nav_id,
++    std::u16string extracted_text) {
++  // Drop the result when it no longer answers the outstanding request:
++  // the user may have copied another tab while this extraction was in
++  // flight, and thread-pool replies can arrive out of order. Caching or
++  // copying it would file this tab's text under the newer tab's key (and
++  // page_title_/page_url_).
++  if (contents.get() != extraction_cache_contents_.get() ||
++      nav_id != extraction_cache_nav_id_) {
++    return;
 +  }
-+  
-+  // Find the root node
-+  ui::AXNodeID root_id = update.root_id;
-+  if (node_map.find(root_id) == node_map.end()) {
-+    LOG(ERROR) << "Root node not found in tree update";
++
++  if (extracted_text.empty()) {
 +    return;
 +  }
-+  
-+  // Extract text from the accessibility tree recursively
-+  std::u16string extracted_text;
-+  ExtractTextFromNodeData(node_map[root_id], node_map, &extracted_text);
-+  
-+  // Clean up text - remove excessive whitespace
-+  if (!extracted_text.empty()) {
-+    // Simple cleanup of multiple spaces
-+    size_t pos = 0;
-+    while ((pos = extracted_text.find(u"  ", pos)) != std::u16string::npos) {
-+      extracted_text.replace(pos, 2, u" ");
-+    }
-+    
-+    // Format the final output
-+    std::u16string formatted_output = u"----------- WEB PAGE -----------\n\n";
-+    formatted_output += u"TITLE: " + page_title_ + u"\n\n";
-+    formatted_output += u"URL: " + base::UTF8ToUTF16(page_url_.spec()) + u"\n\n";
-+    formatted_output += u"CONTENT:\n\n" + extracted_text;
-+    formatted_output += u" ------------------------------------\n\n";
-+    formatted_output += u"USER PROMPT:\n\n";
-+    
-+    // Copy to clipboard
-+    ui::ScopedClipboardWriter clipboard_writer(ui::ClipboardBuffer::kCopyPaste);
-+    clipboard_writer.WriteText(formatted_output);
-+    
-+    browseros_metrics::BrowserOSMetrics::Log("llmchat.content.copied");
-+    
-+    // Show feedback message
-+    if (copy_feedback_label_) {
-+      copy_feedback_label_->SetText(u"Content copied to clipboard");
-+      copy_feedback_label_->SetVisible(true);
 +
-+      // Cancel any existing timer
-+      if (feedback_timer_->IsRunning()) {
-+        feedback_timer_->Stop();
-+      }
++  // Remember the result for repeated copies of the same page. The key
++  // (contents + navigation entry id) was recorded in OnCopyContent().
++  extraction_cache_text_ = extracted_text;
++  extraction_cache_time_ = base::TimeTicks::Now();
 +
-+      // Start timer to hide message after 2.5 seconds
-+      feedback_timer_->Start(FROM_HERE, base::Seconds(2.5),
-+          base::BindOnce(&ThirdPartyLlmPanelCoordinator::HideFeedbackLabel,
-+                         weak_factory_.GetWeakPtr()));
++  CopyExtractedText(extracted_text);
++}
++
++void ThirdPartyLlmPanelCoordinator::CopyExtractedText(
++    const std::u16string& extracted_text) {
++  // Format the final output
++  std::u16string formatted_output = u"----------- WEB PAGE -----------\n\n";
++  formatted_output += u"TITLE: " + page_title_ + u"\n\n";
++  formatted_output += u"URL: " + base::UTF8ToUTF16(page_url_.spec()) + u"\n\n";
++  formatted_output += u"CONTENT:\n\n" + extracted_text;
++  formatted_output += u" ------------------------------------\n\n";
++  formatted_output += u"USER PROMPT:\n\n";
++
++  // Copy to clipboard
++  ui::ScopedClipboardWriter clipboard_writer(ui::ClipboardBuffer::kCopyPaste);
++  clipboard_writer.WriteText(formatted_output);
++
++  browseros_metrics::BrowserOSMetrics::Log("llmchat.content.copied");
++
++  // Show feedback message
++  if (copy_feedback_label_) {
++    copy_feedback_label_->SetText(u"Content copied to clipboard");
++    copy_feedback_label_->SetVisible(true);
++
++    // Cancel any existing timer
++    if (feedback_timer_->IsRunning()) {
++      feedback_timer_->Stop();
 +    }
++
++    // Start timer to hide message after 2.5 seconds
++    feedback_timer_->Start(FROM_HERE, base::Seconds(2.5),
++        base::BindOnce(&ThirdPartyLlmPanelCoordinator::HideFeedbackLabel,
++                       weak_factory_.GetWeakPtr()));
 +  }
 +}
 +
@@ -765,6 +1343,15 @@ index 0000000000000..f87c563fdd645
 +  if (observed_view == web_view_) {
 +    // Just clear our pointer. DO NOT call methods on the view being destroyed!
 +    web_view_ = nullptr;
++
++    // The side panel is closing. Mark the contents hidden and start the
++    // idle-discard clock so a panel left closed does not keep a renderer
++    // alive indefinitely.
++    if (owned_web_contents_) {
++      owned_web_contents_->WasHidden();
++      panel_hidden_time_ = base::TimeTicks::Now();
++      ScheduleIdleDiscardSweep();
++    }
 +  }
 +
 +  if (observed_view == menu_button_) {
@@ -776,91 +1363,6 @@ index 0000000000000..f87c563fdd645
 +}
 +
 +
-+void ThirdPartyLlmPanelCoordinator::ExtractTextFromNodeData(
-+    const ui::AXNodeData* node,
-+    const std::map<ui::AXNodeID, const ui::AXNodeData*>& node_map,
-+    std::u16string* output) {
-+  if (!node || !output) {
-+    return;
-+  }
-+  
-+  // Skip UI elements and navigation
-+  if (node->role == ax::mojom::Role::kButton ||
-+      node->role == ax::mojom::Role::kNavigation ||
-+      node->role == ax::mojom::Role::kBanner ||
-+      node->role == ax::mojom::Role::kComplementary ||
-+      node->role == ax::mojom::Role::kContentInfo ||
-+      node->role == ax::mojom::Role::kForm ||
-+      node->role == ax::mojom::Role::kSearch ||
-+      node->role == ax::mojom::Role::kMenu ||
-+      node->role == ax::mojom::Role::kMenuBar ||
-+      node->role == ax::mojom::Role::kMenuItem ||
-+      node->role == ax::mojom::Role::kToolbar) {
-+    // For these elements, still traverse children but don't extract their text
-+    for (ui::AXNodeID child_id : node->child_ids) {
-+      auto it = node_map.find(child_id);
-+      if (it != node_map.end()) {
-+        ExtractTextFromNodeData(it->second, node_map, output);
-+      }
-+    }
-+    return;
-+  }
-+  
-+  // Check if this is a text-containing element
-+  bool is_text_element = (node->role == ax::mojom::Role::kStaticText ||
-+                         node->role == ax::mojom::Role::kInlineTextBox);
-+  
-+  // Extract text if this is a text element
-+  if (is_text_element) {
-+    std::u16string text;
-+    if (node->HasStringAttribute(ax::mojom::StringAttribute::kName)) {
-+      text = node->GetString16Attribute(ax::mojom::StringAttribute::kName);
-+    }
-+    
-+    if (text.empty() && node->HasStringAttribute(ax::mojom::StringAttribute::kValue)) {
-+      text = node->GetString16Attribute(ax::mojom::StringAttribute::kValue);
-+    }
-+    
-+    if (!text.empty()) {
-+      // Add appropriate spacing
-+      if (!output->empty() && output->back() != ' ' && output->back() != '\n') {
-+        *output += u" ";
-+      }
-+      *output += text;
-+    }
-+  }
-+  
-+  // Handle line breaks
-+  if (node->role == ax::mojom::Role::kLineBreak) {
-+    *output += u"\n";
-+  }
-+  
-+  // Add paragraph breaks for block-level elements
-+  bool needs_paragraph_break = (node->role == ax::mojom::Role::kParagraph ||
-+                               node->role == ax::mojom::Role::kHeading ||
-+                               node->role == ax::mojom::Role::kListItem ||
-+                               node->role == ax::mojom::Role::kBlockquote ||
-+                               node->role == ax::mojom::Role::kArticle ||
-+                               node->role == ax::mojom::Role::kSection);
-+  
-+  if (needs_paragraph_break && !output->empty() && output->back() != '\n') {
-+    *output += u"\n\n";
-+  }
-+  
-+  // Recursively process children for all elements
-+  for (ui::AXNodeID child_id : node->child_ids) {
-+    auto it = node_map.find(child_id);
-+    if (it != node_map.end()) {
-+      ExtractTextFromNodeData(it->second, node_map, output);
-+    }
-+  }
-+  
-+  // Add paragraph break after block-level elements if they had content
-+  if (needs_paragraph_break && !output->empty() && output->back() != '\n') {
-+    *output += u"\n\n";
-+  }
-+}
-+
 +bool ThirdPartyLlmPanelCoordinator::HandleKeyboardEvent(
 +    content::WebContents* source,
 +    const input::NativeWebKeyboardEvent& event) {
@@ -923,17 +1425,9 @@ index 0000000000000..f87c563fdd645
 +            << " video: " << (request.video_type !=
 +                blink::mojom::MediaStreamType::NO_SERVICE);
 +
-+  // Check if this is one of our known LLM providers by comparing against all providers
++  // Check if this is one of our known LLM providers
 +  const GURL origin_url = request.url_origin.GetURL();
-+  bool is_known_llm = false;
-+
-+  // Check all LLM providers
-+  for (const auto& provider : providers_) {
-+    if (origin_url.host() == provider.url.host()) {
-+      is_known_llm = true;
-+      break;
-+    }
-+  }
++  const bool is_known_llm = IsTrustedLlmHost(origin_url);
 +
 +  if (is_known_llm) {
 +    // Auto-grant permission for known LLM sites in the side panel
@@ -977,19 +1471,15 @@ index 0000000000000..f87c563fdd645
 +    content::RenderFrameHost* render_frame_host,
 +    const url::Origin& security_origin,
 +    blink::mojom::MediaStreamType type) {
-+  // Check if this is a trusted LLM site using our existing provider list
-+  const GURL origin_url = security_origin.GetURL();
-+
-+  // Check all LLM providers
-+  for (const auto& provider : providers_) {
-+    if (origin_url.host() == provider.url.host()) {
-+      // Auto-grant permission check for trusted LLM sites
-+      VLOG(2) << "[browseros] Media permission check for trusted LLM origin: "
-+              << security_origin.Serialize()
-+              << " type: " << static_cast<int>(type)
-+              << " result: true (auto-granted)";
-+      return true;
-+    }
++  // Check if this is a trusted LLM site using our existing provider list.
++  // This fires on every voice-input utterance, so it is a set lookup.
++  if (IsTrustedLlmHost(security_origin.GetURL())) {
++    // Auto-grant permission check for trusted LLM sites
++    VLOG(2) << "[browseros] Media permission check for trusted LLM origin: "
++            << security_origin.Serialize()
++            << " type: " << static_cast<int>(type)
++            << " result: true (auto-granted)";
++    return true;
 +  }
 +
 +  // For non-LLM sites, check Chrome's stored permissions
@@ -1024,6 +1514,11 @@ index 0000000000000..f87c563fdd645
 +  // Calculate next provider (cycle through all providers)
 +  size_t next_provider_index = (current_provider_index_ + 1) % providers_.size();
 +
++  // Start connection setup for the target now; the handshake proceeds in
++  // parallel with the WebContents swap below, so a target with no warm
++  // contents doesn't serialize DNS/TCP/TLS behind the switch.
++  PreconnectProvider(next_provider_index);
++
 +  // Update the provider selector
 +  // Combobox selection changes made programmatically do NOT invoke the
 +  // `SetCallback` observer, so we must call `OnProviderChanged()` manually
@@ -1037,7 +1532,12 @@ index 0000000000000..f87c563fdd645
 +void ThirdPartyLlmPanelCoordinator::DidFinishLoad(
 +    content::RenderFrameHost* render_frame_host,
 +    const GURL& validated_url) {
-+  // Nothing to do on page load
++  // A load in the observed contents is a natural point to drop cached
++  // extraction state; the navigation entry id in the cache key already
++  // covers navigations in the article tab itself.
++  extraction_cache_text_.clear();
++  extraction_cache_contents_.reset();
++  extraction_cache_nav_id_ = 0;
 +}
 +
 +void ThirdPartyLlmPanelCoordinator::CleanupWebContents() {
@@ -1051,8 +1551,10 @@ index 0000000000000..f87c563fdd645
 +    web_view_->SetWebContents(nullptr);
 +  }
 +
-+  // Destroy the WebContents we own
++  // Destroy the WebContents we own, including the warm provider pool
 +  owned_web_contents_.reset();
++  warm_contents_.clear();
++  discard_timer_.Stop();
 +
 +  // Stop observing
 +  Observe(nullptr);
@@ -1078,30 +1580,35 @@ index 0000000000000..f87c563fdd645
 +    return;
 +  }
 +  
-+  // Create menu model
-+  menu_model_ = std::make_unique<ui::SimpleMenuModel>(this);
-+  menu_model_->AddItemWithIcon(
-+      IDC_COPY_CONTENT, 
-+      u"Copy webpage to clipboard",
-+      ui::ImageModel::FromVectorIcon(vector_icons::kContentCopyIcon));
-+  menu_model_->AddItemWithIcon(
-+      IDC_SCREENSHOT,
-+      u"Screenshot webpage and copy",
-+      ui::ImageModel::FromVectorIcon(vector_icons::kPhotoChromeRefreshIcon));
-+  menu_model_->AddItemWithIcon(
-+      IDC_REFRESH,
-+      u"Reset LLM chat",
-+      ui::ImageModel::FromVectorIcon(vector_icons::kReloadIcon));
-+  menu_model_->AddItemWithIcon(
-+      IDC_OPEN_IN_NEW_TAB,
-+      u"Open in new tab",
-+      ui::ImageModel::FromVectorIcon(vector_icons::kLaunchIcon));
-+  menu_model_->AddSeparator(ui::NORMAL_SEPARATOR);
-+  menu_model_->AddItemWithIcon(
-+      IDC_CLASH_OF_GPTS,
-+      u"Popout LLM Hub",
-+      ui::ImageModel::FromVectorIcon(kTabGroupIcon));
-+  
++  // The item set is static, so build the model (and its icon models) on
++  // first open and reuse it; reopening the menu then does no
++  // construction work.
++  if (!menu_model_) {
++    menu_model_ = std::make_unique<ui::SimpleMenuModel>(this);
++    menu_model_->AddItemWithIcon(
++        IDC_COPY_CONTENT,
++        u"Copy webpage to clipboard",
++        ui::ImageModel::FromVectorIcon(vector_icons::kContentCopyIcon));
++    menu_model_->AddItemWithIcon(
++        IDC_SCREENSHOT,
++        u"Screenshot webpage and copy",
++        ui::ImageModel::FromVectorIcon(vector_icons::kPhotoChromeRefreshIcon));
++    menu_model_->AddItemWithIcon(
++        IDC_REFRESH,
++        u"Reset LLM chat",
++        ui::ImageModel::FromVectorIcon(vector_icons::kReloadIcon));
++    menu_model_->AddItemWithIcon(
++        IDC_OPEN_IN_NEW_TAB,
++        u"Open in new tab",
++        ui::ImageModel::FromVectorIcon(vector_icons::kLaunchIcon));
++    menu_model_->AddSeparator(ui::NORMAL_SEPARATOR);
++    menu_model_->AddItemWithIcon(
++        IDC_CLASH_OF_GPTS,
++        u"Popout LLM Hub",
++        ui::ImageModel::FromVectorIcon(kTabGroupIcon));
++  }
++
++
 +  // Create and run menu
 +  menu_runner_ = std::make_unique<views::MenuRunner>(
 +      menu_model_.get(), views::MenuRunner::HAS_MNEMONICS);
@@ -1153,7 +1660,7 @@ index 0000000000000..f87c563fdd645
 +    case IDC_CLASH_OF_GPTS:
 +      if (Browser* browser = BrowserList::GetInstance()->GetLastActive()) {
 +        if (auto* coordinator =
-+                browser->browser_window_features()->clash_of_gpts_coordinator()) {
++                ClashOfGptsCoordinator::GetOrCreateForBrowser(browser)) {
 +          coordinator->Show();
 +        }
 +      }
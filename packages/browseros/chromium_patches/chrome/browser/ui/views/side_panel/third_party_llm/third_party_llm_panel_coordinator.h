@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.h b/chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.h
 new file mode 100644
-index 0000000000000..ef7c13f156ea7
+index 0000000000000..f0a1554ba7407
 --- /dev/null
 +++ b/chrome/browser/ui/views/side_panel/third_party_llm/third_party_llm_panel_coordinator.h
-@@ -0,0 +1,237 @@
+@@ -0,0 +1,329 @@
 +// Copyright 2026 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -14,11 +14,14 @@ index 0000000000000..ef7c13f156ea7
 +#include <map>
 +#include <string>
 +
++#include "base/containers/flat_set.h"
++#include "base/memory/memory_pressure_listener.h"
 +#include "base/memory/raw_ptr.h"
 +#include "base/memory/raw_ref.h"
 +#include "base/memory/weak_ptr.h"
 +#include "base/scoped_multi_source_observation.h"
 +#include "base/scoped_observation.h"
++#include "base/time/time.h"
 +#include "base/timer/timer.h"
 +#include "chrome/browser/ui/browser_list_observer.h"
 +#include "chrome/browser/profiles/profile_observer.h"
@@ -36,13 +39,11 @@ index 0000000000000..ef7c13f156ea7
 +#include "ui/views/view_observer.h"
 +#include "ui/menus/simple_menu_model.h"
 +
-+namespace gfx {
-+class Image;
-+}  // namespace gfx
-+
++class Browser;
 +class BrowserList;
 +class Profile;
 +class SidePanelEntryScope;
++class SkBitmap;
 +class SidePanelRegistry;
 +class TabStripModel;
 +
@@ -61,7 +62,6 @@ index 0000000000000..ef7c13f156ea7
 +}  // namespace content
 +
 +namespace ui {
-+struct AXNodeData;
 +struct AXTreeUpdate;
 +}  // namespace ui
 +
@@ -95,7 +95,18 @@ index 0000000000000..ef7c13f156ea7
 +  ThirdPartyLlmPanelCoordinator& operator=(const ThirdPartyLlmPanelCoordinator&) = delete;
 +  ~ThirdPartyLlmPanelCoordinator() override;
 +
-+  void CreateAndRegisterEntry(SidePanelRegistry* global_registry);
++  // Returns |browser|'s coordinator, constructing it on first use and
++  // installing it in the window's BrowserWindowFeatures. Construction is
++  // deferred out of window creation because most windows never open the
++  // panel. Returns nullptr when the feature is disabled.
++  static ThirdPartyLlmPanelCoordinator* GetOrCreateForBrowser(Browser* browser);
++
++  // Registers the side panel entry in |browser|'s window registry. Only the
++  // entry (a factory callback) is registered here; the coordinator itself,
++  // with its provider and pref loading, is created when the panel is first
++  // shown.
++  static void CreateAndRegisterEntry(Browser* browser,
++                                     SidePanelRegistry* global_registry);
 +
 +  // Registers user preferences
 +  static void RegisterProfilePrefs(user_prefs::PrefRegistrySyncable* registry);
@@ -159,17 +170,40 @@ index 0000000000000..ef7c13f156ea7
 +  std::unique_ptr<views::View> CreateThirdPartyLlmWebView(
 +      SidePanelEntryScope& scope);
 +
++  // Creates (if needed), navigates, and attaches the panel WebContents to
++  // web_view_. Runs inline when warm contents exist; on a cold open it is
++  // posted at idle priority so the panel shell paints before the renderer
++  // spawn. No-op if the panel closed before the task ran.
++  void AttachWebContentsToPanel();
++
 +  void OnProviderChanged();
 +  void OnRefreshContent();
 +  void OnOpenInNewTab();
 +  void OnCopyContent();
 +  void OnScreenshotContent();
-+  void OnAccessibilityTreeReceived(ui::AXTreeUpdate& update);
-+  void OnScreenshotCaptured(const gfx::Image& image);
-+  void ExtractTextFromNodeData(
-+      const ui::AXNodeData* node,
-+      const std::map<ui::AXNodeID, const ui::AXNodeData*>& node_map,
-+      std::u16string* output);
++  // |contents| and |nav_id| identify the request this snapshot answers;
++  // they are carried through to OnTextExtracted() so a reply for a page
++  // the user has since left can be dropped.
++  void OnAccessibilityTreeReceived(base::WeakPtr<content::WebContents> contents,
++                                   int nav_id,
++                                   ui::AXTreeUpdate& update);
++  // Reply from the thread-pool text extraction; caches the result and
++  // writes it to the clipboard, unless the extraction key no longer
++  // matches the one recorded by the latest OnCopyContent().
++  void OnTextExtracted(base::WeakPtr<content::WebContents> contents,
++                       int nav_id,
++                       std::u16string extracted_text);
++  // Receives the viz readback for a screenshot; the bitmap shares the
++  // readback buffer via its pixel ref, so passing it around is not a
++  // frame copy.
++  void OnScreenshotCaptured(const SkBitmap& bitmap);
++  // Reply from the thread-pool clipboard conversion; writes the bitmap to
++  // the clipboard and shows the feedback label.
++  void OnScreenshotReadyForClipboard(SkBitmap bitmap);
++  // Formats |extracted_text| with the stored title/URL, writes it to the
++  // clipboard and shows the feedback label. Shared by the snapshot reply
++  // and the cache hit path in OnCopyContent().
++  void CopyExtractedText(const std::u16string& extracted_text);
 +  void HideFeedbackLabel();
 +  void ShowOptionsMenu();
 +
@@ -178,6 +212,10 @@ index 0000000000000..ef7c13f156ea7
 +  void LoadProvidersFromPrefs();
 +  void SaveProvidersToPrefs();
 +
++  // Returns whether |origin_url| belongs to a configured LLM provider.
++  // Backed by |provider_hosts_|.
++  bool IsTrustedLlmHost(const GURL& origin_url) const;
++
 +  // Executes the actual provider switch after all sanity checks. Should only
 +  // be called on the UI thread.  Uses |provider_change_in_progress_| to avoid
 +  // reentrancy.
@@ -186,6 +224,27 @@ index 0000000000000..ef7c13f156ea7
 +  // Clean up WebContents early to avoid shutdown crashes.
 +  void CleanupWebContents();
 +
++  // Pre-creates hidden, background-loading WebContents for recently used
++  // providers (bounded by the pool size) so switching to them is instant.
++  void PrewarmRecentProviders();
++
++  // Warms DNS+TCP+TLS to a provider's origin through the loading
++  // predictor so an upcoming navigation there skips connection setup.
++  // No-op when the provider has a warm contents holding live connections.
++  void PreconnectProvider(size_t provider_index);
++
++  // Drops the warm provider pool when the system is under memory pressure.
++  void OnMemoryPressure(
++      base::MemoryPressureListener::MemoryPressureLevel level);
++
++  // Memory Saver integration: when the user has Memory Saver enabled,
++  // warm pool entries (and the panel's own contents once the side panel
++  // has been closed for a while) are discarded after the configured
++  // discard timeout. Discarded providers come back on demand through the
++  // normal last_urls_ restore path.
++  void ScheduleIdleDiscardSweep();
++  void DiscardIdleContents();
++
 +  const raw_ref<Profile> profile_;
 +  const raw_ref<TabStripModel> tab_strip_model_;
 +
@@ -193,6 +252,12 @@ index 0000000000000..ef7c13f156ea7
 +  std::vector<LlmProviderInfo> providers_;
 +  size_t current_provider_index_ = 0;
 +
++  // Hosts of the configured providers, rebuilt whenever the provider prefs
++  // reload. The media permission hooks fire on every voice-input utterance,
++  // so the trusted-origin decision is a set lookup here instead of a scan
++  // over |providers_|.
++  base::flat_set<std::string> provider_hosts_;
++
 +  // UI elements
 +  raw_ptr<views::WebView> web_view_ = nullptr;
 +  raw_ptr<views::Combobox> provider_selector_ = nullptr;
@@ -203,6 +268,24 @@ index 0000000000000..ef7c13f156ea7
 +  // when we call SetWebContents with externally created WebContents
 +  std::unique_ptr<content::WebContents> owned_web_contents_;
 +
++  // Warm pool: hidden, already-loaded WebContents for other providers,
++  // keyed by provider index. The outgoing contents is parked here on a
++  // provider switch and swapped back in instantly when the user returns.
++  // Bounded (LRU-evicted) and dropped entirely under memory pressure.
++  struct WarmEntry {
++    std::unique_ptr<content::WebContents> contents;
++    base::TimeTicks last_used;
++  };
++  std::map<size_t, WarmEntry> warm_contents_;
++
++  std::unique_ptr<base::MemoryPressureListener> memory_pressure_listener_;
++
++  // Fires the next idle-discard sweep; see DiscardIdleContents().
++  base::OneShotTimer discard_timer_;
++
++  // When the side panel view went away. Null while the panel is showing.
++  base::TimeTicks panel_hidden_time_;
++
 +  // Store the last URL for each provider to restore state
 +  std::map<size_t, GURL> last_urls_;
 +  
@@ -212,6 +295,15 @@ index 0000000000000..ef7c13f156ea7
 +  // Temporary storage for page info during copy
 +  std::u16string page_title_;
 +  GURL page_url_;
++
++  // Result of the last successful text extraction, keyed by the tab and
++  // its committed navigation entry so repeated copies of an unchanged
++  // page skip the AX tree serialization. A navigation in the tab changes
++  // the entry id, which invalidates the cache implicitly.
++  base::WeakPtr<content::WebContents> extraction_cache_contents_;
++  int extraction_cache_nav_id_ = 0;
++  std::u16string extraction_cache_text_;
++  base::TimeTicks extraction_cache_time_;
 +  
 +  // Handler for unhandled keyboard events
 +  views::UnhandledKeyboardEventHandler unhandled_keyboard_event_handler_;
@@ -0,0 +1,326 @@
+diff --git a/chrome/browser/ui/webui/browseros_perf/browseros_perf_ui.cc b/chrome/browser/ui/webui/browseros_perf/browseros_perf_ui.cc
+new file mode 100644
+index 0000000000000..1717733a229f1
+--- /dev/null
++++ b/chrome/browser/ui/webui/browseros_perf/browseros_perf_ui.cc
+@@ -0,0 +1,320 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#include "chrome/browser/ui/webui/browseros_perf/browseros_perf_ui.h"
++
++#include <memory>
++#include <string>
++#include <utility>
++#include <vector>
++
++#include "base/containers/span.h"
++#include "base/json/json_writer.h"
++#include "base/memory/ref_counted_memory.h"
++#include "base/metrics/histogram_base.h"
++#include "base/metrics/histogram_samples.h"
++#include "base/metrics/statistics_recorder.h"
++#include "base/strings/strcat.h"
++#include "base/values.h"
++#include "chrome/common/webui_url_constants.h"
++#include "content/public/browser/web_contents.h"
++#include "content/public/browser/web_ui.h"
++#include "content/public/browser/web_ui_data_source.h"
++#include "services/network/public/mojom/content_security_policy.mojom.h"
++
++namespace {
++
++// The page polls this path for a fresh counter snapshot.
++constexpr char kStatsPath[] = "stats.json";
++
++// One recorded histogram bucket; percentiles are interpolated from the
++// bucket minimums, which is the same resolution UMA itself has.
++struct Bucket {
++  int64_t min = 0;
++  int64_t count = 0;
++};
++
++std::vector<Bucket> GetBuckets(const base::HistogramSamples& samples) {
++  std::vector<Bucket> buckets;
++  for (auto it = samples.Iterator(); !it->Done(); it->Next()) {
++    base::HistogramBase::Sample32 min;
++    int64_t max;
++    base::HistogramBase::Count32 count;
++    it->Get(&min, &max, &count);
++    if (count > 0) {
++      buckets.push_back({min, count});
++    }
++  }
++  return buckets;
++}
++
++int64_t Percentile(const std::vector<Bucket>& buckets,
++                   int64_t total,
++                   int pct) {
++  const int64_t target = total * pct / 100;
++  int64_t seen = 0;
++  for (const Bucket& bucket : buckets) {
++    seen += bucket.count;
++    if (seen > target) {
++      return bucket.min;
++    }
++  }
++  return buckets.empty() ? 0 : buckets.back().min;
++}
++
++// Snapshot of a timing histogram: sample count, mean and rolling
++// percentiles in milliseconds. Returns an empty dict when the histogram
++// has not been recorded yet this session.
++base::Value::Dict SnapshotTiming(const std::string& name) {
++  base::Value::Dict out;
++  base::HistogramBase* histogram =
++      base::StatisticsRecorder::FindHistogram(name);
++  if (!histogram) {
++    return out;
++  }
++  std::unique_ptr<base::HistogramSamples> samples =
++      histogram->SnapshotSamples();
++  const int64_t count = samples->TotalCount();
++  if (count == 0) {
++    return out;
++  }
++  const std::vector<Bucket> buckets = GetBuckets(*samples);
++  out.Set("count", static_cast<double>(count));
++  out.Set("mean_ms", static_cast<double>(samples->sum()) / count);
++  out.Set("p50_ms", static_cast<double>(Percentile(buckets, count, 50)));
++  out.Set("p90_ms", static_cast<double>(Percentile(buckets, count, 90)));
++  out.Set("p99_ms", static_cast<double>(Percentile(buckets, count, 99)));
++  return out;
++}
++
++// Snapshot of a boolean histogram as a rate: how often "true" was
++// recorded. Used for the change-detection TimedOut histograms.
++base::Value::Dict SnapshotBooleanRate(const std::string& name) {
++  base::Value::Dict out;
++  base::HistogramBase* histogram =
++      base::StatisticsRecorder::FindHistogram(name);
++  if (!histogram) {
++    return out;
++  }
++  std::unique_ptr<base::HistogramSamples> samples =
++      histogram->SnapshotSamples();
++  const int64_t count = samples->TotalCount();
++  if (count == 0) {
++    return out;
++  }
++  int64_t true_count = 0;
++  for (const Bucket& bucket : GetBuckets(*samples)) {
++    if (bucket.min != 0) {
++      true_count += bucket.count;
++    }
++  }
++  out.Set("count", static_cast<double>(count));
++  out.Set("rate", static_cast<double>(true_count) / count);
++  return out;
++}
++
++// Builds the counter snapshot the page renders. Reading the in-process
++// histograms means every number here is exactly what this session has
++// reported to UMA - no second bookkeeping path to drift.
++std::string BuildStatsJson() {
++  base::Value::Dict stats;
++
++  // Snapshot pipeline latency, keyed like LogApiTiming keys them.
++  base::Value::Dict api;
++  for (const char* function :
++       {"GetInteractiveSnapshot", "GetAccessibilityTree", "CaptureScreenshot",
++        "CaptureWithSnapshot"}) {
++    base::Value::Dict timing = SnapshotTiming(
++        base::StrCat({"BrowserOS.Api.", function, ".Duration"}));
++    if (!timing.empty()) {
++      api.Set(function, std::move(timing));
++    }
++  }
++  stats.Set("api_latency", std::move(api));
++
++  // Change detection: timeout rate and settled wait time per action type.
++  base::Value::Dict detection;
++  for (const char* action :
++       {"Click", "Type", "Clear", "Scroll", "KeySequence", "ClickCoordinates",
++        "TypeAtCoordinates", "WaitForStable"}) {
++    base::Value::Dict entry;
++    base::Value::Dict timed_out = SnapshotBooleanRate(
++        base::StrCat({"BrowserOS.ChangeDetection.", action, ".TimedOut"}));
++    if (timed_out.empty()) {
++      continue;
++    }
++    entry.Set("timed_out", std::move(timed_out));
++    base::Value::Dict wait = SnapshotTiming(
++        base::StrCat({"BrowserOS.ChangeDetection.", action, ".WaitTime"}));
++    if (!wait.empty()) {
++      entry.Set("wait", std::move(wait));
++    }
++    detection.Set(action, std::move(entry));
++  }
++  stats.Set("change_detection", std::move(detection));
++
++  // Server manager: loopback health-check round trip.
++  base::Value::Dict server;
++  base::Value::Dict rtt =
++      SnapshotTiming("BrowserOS.Server.HealthCheck.Rtt");
++  if (!rtt.empty()) {
++    server.Set("health_check_rtt", std::move(rtt));
++  }
++  stats.Set("server", std::move(server));
++
++  // Queues. snapshot_depth is the thread-pool runner's depth (recorded
++  // per posted task, so the percentiles describe the depth a newly posted
++  // snapshot sees); scheduler_depth and scheduler_wait come from the
++  // cross-tab agent scheduler - how many heavy operations were queued
++  // behind the concurrency cap and how long they waited for a slot (ms).
++  base::Value::Dict queue;
++  base::Value::Dict depth = SnapshotTiming("BrowserOS.Snapshot.QueueDepth");
++  if (!depth.empty()) {
++    queue.Set("snapshot_depth", std::move(depth));
++  }
++  base::Value::Dict scheduler_depth =
++      SnapshotTiming("BrowserOS.Agent.Scheduler.QueueDepth");
++  if (!scheduler_depth.empty()) {
++    queue.Set("scheduler_depth", std::move(scheduler_depth));
++  }
++  base::Value::Dict scheduler_wait =
++      SnapshotTiming("BrowserOS.Agent.Scheduler.QueueWait");
++  if (!scheduler_wait.empty()) {
++    queue.Set("scheduler_wait_ms", std::move(scheduler_wait));
++  }
++  stats.Set("queue", std::move(queue));
++
++  return base::WriteJson(stats).value_or("{}");
++}
++
++// The shell page: renders the stats snapshot as tables and re-polls
++// every couple of seconds.
++constexpr char kHtmlContent[] = R"(
++<!DOCTYPE html>
++<html>
++<head>
++  <meta charset="utf-8">
++  <title>BrowserOS Perf</title>
++  <style>
++    body { font-family: system-ui, -apple-system, sans-serif; margin: 24px;
++           background: #fafafa; color: #202124; }
++    h1 { font-size: 20px; }
++    h2 { font-size: 15px; margin: 20px 0 6px; }
++    table { border-collapse: collapse; min-width: 520px; }
++    th, td { border: 1px solid #dadce0; padding: 4px 10px;
++             font-size: 13px; text-align: right; }
++    th:first-child, td:first-child { text-align: left; }
++    th { background: #f1f3f4; }
++    .empty { color: #80868b; font-size: 13px; }
++    #updated { color: #80868b; font-size: 12px; }
++  </style>
++</head>
++<body>
++  <h1>BrowserOS performance counters</h1>
++  <div id="updated"></div>
++  <div id="content"></div>
++  <script>
++    function fmt(v) {
++      return v === undefined ? '-' : Number(v).toFixed(1);
++    }
++    function timingTable(title, rows, unit) {
++      const keys = Object.keys(rows);
++      if (keys.length === 0) {
++        return '<h2>' + title + '</h2><div class="empty">no samples yet</div>';
++      }
++      let html = '<h2>' + title + '</h2><table><tr><th></th><th>count</th>' +
++                 '<th>mean</th><th>p50</th><th>p90</th><th>p99</th></tr>';
++      for (const key of keys) {
++        const t = rows[key];
++        html += '<tr><td>' + key + '</td><td>' + (t.count || 0) + '</td><td>' +
++                fmt(t.mean_ms) + unit + '</td><td>' + fmt(t.p50_ms) + unit +
++                '</td><td>' + fmt(t.p90_ms) + unit + '</td><td>' +
++                fmt(t.p99_ms) + unit + '</td></tr>';
++      }
++      return html + '</table>';
++    }
++    function detectionTable(rows) {
++      const keys = Object.keys(rows);
++      if (keys.length === 0) {
++        return '<h2>Change detection</h2>' +
++               '<div class="empty">no windows yet</div>';
++      }
++      let html = '<h2>Change detection</h2><table><tr><th>action</th>' +
++                 '<th>windows</th><th>success</th><th>wait p50</th>' +
++                 '<th>wait p99</th></tr>';
++      for (const key of keys) {
++        const e = rows[key];
++        const wait = e.wait || {};
++        html += '<tr><td>' + key + '</td><td>' + e.timed_out.count +
++                '</td><td>' + ((1 - e.timed_out.rate) * 100).toFixed(1) +
++                '%</td><td>' + fmt(wait.p50_ms) + 'ms</td><td>' +
++                fmt(wait.p99_ms) + 'ms</td></tr>';
++      }
++      return html + '</table>';
++    }
++    async function refresh() {
++      const response = await fetch('stats.json');
++      const stats = await response.json();
++      document.getElementById('content').innerHTML =
++          timingTable('API latency', stats.api_latency, 'ms') +
++          detectionTable(stats.change_detection) +
++          timingTable('Server', stats.server, 'ms') +
++          timingTable('Queues', stats.queue, '');
++      document.getElementById('updated').textContent =
++          'updated ' + new Date().toLocaleTimeString();
++    }
++    refresh();
++    setInterval(refresh, 2000);
++  </script>
++</body>
++</html>
++)";
++
++}  // namespace
++
++BrowserOSPerfUIConfig::BrowserOSPerfUIConfig()
++    : content::WebUIConfig(content::kChromeUIScheme,
++                           chrome::kChromeUIBrowserOSPerfHost) {}
++
++BrowserOSPerfUIConfig::~BrowserOSPerfUIConfig() = default;
++
++std::unique_ptr<content::WebUIController>
++BrowserOSPerfUIConfig::CreateWebUIController(content::WebUI* web_ui,
++                                             const GURL& url) {
++  return std::make_unique<BrowserOSPerfUI>(web_ui);
++}
++
++BrowserOSPerfUI::BrowserOSPerfUI(content::WebUI* web_ui)
++    : content::WebUIController(web_ui) {
++  content::WebUIDataSource* source = content::WebUIDataSource::CreateAndAdd(
++      web_ui->GetWebContents()->GetBrowserContext(),
++      chrome::kChromeUIBrowserOSPerfHost);
++
++  // Serve the static shell for the root and a fresh histogram snapshot
++  // for stats.json; each poll re-reads the recorder, so the page is live
++  // without any push plumbing.
++  source->SetRequestFilter(
++      base::BindRepeating([](const std::string& path) {
++        return path.empty() || path == "/" || path == kStatsPath;
++      }),
++      base::BindRepeating(
++          [](const std::string& path,
++             content::WebUIDataSource::GotDataCallback callback) {
++            if (path == kStatsPath) {
++              std::move(callback).Run(
++                  base::MakeRefCounted<base::RefCountedString>(
++                      BuildStatsJson()));
++              return;
++            }
++            std::move(callback).Run(
++                base::MakeRefCounted<base::RefCountedStaticMemory>(
++                    base::byte_span_from_cstring(kHtmlContent)));
++          }));
++
++  source->OverrideContentSecurityPolicy(
++      network::mojom::CSPDirectiveName::ScriptSrc,
++      "script-src 'self' 'unsafe-inline';");
++}
++
++BrowserOSPerfUI::~BrowserOSPerfUI() = default;
@@ -0,0 +1,44 @@
+diff --git a/chrome/browser/ui/webui/browseros_perf/browseros_perf_ui.h b/chrome/browser/ui/webui/browseros_perf/browseros_perf_ui.h
+new file mode 100644
+index 0000000000000..316b0eee6a650
+--- /dev/null
++++ b/chrome/browser/ui/webui/browseros_perf/browseros_perf_ui.h
+@@ -0,0 +1,38 @@
++// Copyright 2025 The Chromium Authors
++// Use of this source code is governed by a BSD-style license that can be
++// found in the LICENSE file.
++
++#ifndef CHROME_BROWSER_UI_WEBUI_BROWSEROS_PERF_BROWSEROS_PERF_UI_H_
++#define CHROME_BROWSER_UI_WEBUI_BROWSEROS_PERF_BROWSEROS_PERF_UI_H_
++
++#include "content/public/browser/web_ui_controller.h"
++#include "content/public/browser/webui_config.h"
++
++// WebUI config for chrome://browseros-perf
++class BrowserOSPerfUIConfig : public content::WebUIConfig {
++ public:
++  BrowserOSPerfUIConfig();
++  ~BrowserOSPerfUIConfig() override;
++
++  // content::WebUIConfig:
++  std::unique_ptr<content::WebUIController> CreateWebUIController(
++      content::WebUI* web_ui,
++      const GURL& url) override;
++};
++
++// WebUI controller for chrome://browseros-perf. Shows live BrowserOS
++// performance counters - snapshot latency percentiles, change-detection
++// success rates, server health-check round trips and snapshot queue
++// depths - by snapshotting this process's histograms, so the numbers a
++// slow agent is experiencing are readable in a tab instead of by
++// grepping VLOG output on the machine.
++class BrowserOSPerfUI : public content::WebUIController {
++ public:
++  explicit BrowserOSPerfUI(content::WebUI* web_ui);
++  ~BrowserOSPerfUI() override;
++
++  BrowserOSPerfUI(const BrowserOSPerfUI&) = delete;
++  BrowserOSPerfUI& operator=(const BrowserOSPerfUI&) = delete;
++};
++
++#endif  // CHROME_BROWSER_UI_WEBUI_BROWSEROS_PERF_BROWSEROS_PERF_UI_H_
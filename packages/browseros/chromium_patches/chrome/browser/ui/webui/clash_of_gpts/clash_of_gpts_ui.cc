@@ -1,9 +1,9 @@
 diff --git a/chrome/browser/ui/webui/clash_of_gpts/clash_of_gpts_ui.cc b/chrome/browser/ui/webui/clash_of_gpts/clash_of_gpts_ui.cc
 new file mode 100644
-index 0000000000000..ce25eefa09ff9
+index 0000000000000..bae16126cc06f
 --- /dev/null
 +++ b/chrome/browser/ui/webui/clash_of_gpts/clash_of_gpts_ui.cc
-@@ -0,0 +1,104 @@
+@@ -0,0 +1,109 @@
 +// Copyright 2025 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -12,6 +12,7 @@ index 0000000000000..ce25eefa09ff9
 +
 +#include <memory>
 +
++#include "base/containers/span.h"
 +#include "base/memory/ref_counted_memory.h"
 +#include "chrome/browser/profiles/profile.h"
 +#include "chrome/browser/ui/browser.h"
@@ -82,17 +83,18 @@ index 0000000000000..ce25eefa09ff9
 +</html>
 +)";
 +
-+  // Use a lambda to provide the HTML content
++  // Use a lambda to provide the HTML content. The page is a constant, so
++  // every request is answered from the same static buffer with no
++  // per-open copy.
 +  source->SetRequestFilter(
-+      base::BindRepeating([](const std::string& path) { 
-+        return path.empty() || path == "/"; 
++      base::BindRepeating([](const std::string& path) {
++        return path.empty() || path == "/";
 +      }),
 +      base::BindRepeating([](const std::string& path,
 +                            content::WebUIDataSource::GotDataCallback callback) {
-+        std::string data(kHtmlContent);
-+        auto ref_bytes = base::MakeRefCounted<base::RefCountedBytes>(
-+            std::vector<uint8_t>(data.begin(), data.end()));
-+        std::move(callback).Run(ref_bytes);
++        std::move(callback).Run(
++            base::MakeRefCounted<base::RefCountedStaticMemory>(
++                base::byte_span_from_cstring(kHtmlContent)));
 +      }));
 +  
 +  // Set CSP
@@ -103,7 +105,10 @@ index 0000000000000..ce25eefa09ff9
 +  // Open the Clash of GPTs window
 +  Browser* browser = chrome::FindBrowserWithTab(web_ui->GetWebContents());
 +  if (browser) {
-+    browser->browser_window_features()->clash_of_gpts_coordinator()->Show();
++    if (auto* coordinator =
++            ClashOfGptsCoordinator::GetOrCreateForBrowser(browser)) {
++      coordinator->Show();
++    }
 +  }
 +}
 +
@@ -1,13 +1,19 @@
 diff --git a/chrome/browser/ui/webui/nxtscape_first_run.h b/chrome/browser/ui/webui/nxtscape_first_run.h
 new file mode 100644
-index 0000000000000..69b8e5a79f6fd
+index 0000000000000..371075d4a566e
 --- /dev/null
 +++ b/chrome/browser/ui/webui/nxtscape_first_run.h
-@@ -0,0 +1,358 @@
+@@ -0,0 +1,379 @@
 +#ifndef CHROME_BROWSER_UI_WEBUI_NXTSCAPE_FIRST_RUN_H_
 +#define CHROME_BROWSER_UI_WEBUI_NXTSCAPE_FIRST_RUN_H_
 +
++#include <memory>
++
++#include "base/containers/span.h"
++#include "base/functional/callback_helpers.h"
 +#include "base/memory/ref_counted_memory.h"
++#include "chrome/browser/browser_process.h"
++#include "chrome/browser/importer/importer_list.h"
 +#include "chrome/browser/profiles/profile.h"
 +#include "content/public/browser/url_data_source.h"
 +#include "content/public/browser/web_ui.h"
@@ -54,7 +60,9 @@ index 0000000000000..69b8e5a79f6fd
 +void UFRDataSource::StartDataRequest(const GURL& url,
 +                                    const content::WebContents::Getter& wc_getter,
 +                                    GotDataCallback callback) {
-+  std::string source = R"(
++  // The page is constant, so every request is answered from the same
++  // static buffer instead of copying the literal into a fresh string.
++  static constexpr char kFirstRunHtml[] = R"(
 +<!DOCTYPE html>
 +<html lang="en">
 +<head>
@@ -343,7 +351,8 @@ index 0000000000000..69b8e5a79f6fd
 +</body>
 +</html>
 +  )";
-+  std::move(callback).Run(base::MakeRefCounted<base::RefCountedString>(std::move(source)));
++  std::move(callback).Run(base::MakeRefCounted<base::RefCountedStaticMemory>(
++      base::byte_span_from_cstring(kFirstRunHtml)));
 +}
 +
 +class NxtscapeFirstRun;
@@ -356,9 +365,21 @@ index 0000000000000..69b8e5a79f6fd
 + public:
 +  NxtscapeFirstRun(content::WebUI* web_ui) : content::WebUIController(web_ui) {
 +    content::URLDataSource::Add(Profile::FromWebUI(web_ui), std::make_unique<UFRDataSource>());
++    // The page's step 1 sends the user to chrome://settings/importData,
++    // where source-profile detection (probing installed browsers' profile
++    // directories) is the slow half on a cold disk. Run a detection pass
++    // now, concurrent with the page render, so the paths are hot in the
++    // OS caches by the time the import dialog does its own.
++    importer_list_ = std::make_unique<ImporterList>();
++    importer_list_->DetectSourceProfiles(
++        g_browser_process->GetApplicationLocale(),
++        /*include_interactive_profiles=*/false, base::DoNothing());
 +  }
 +  NxtscapeFirstRun(const NxtscapeFirstRun&) = delete;
 +  NxtscapeFirstRun& operator=(const NxtscapeFirstRun&) = delete;
++
++ private:
++  std::unique_ptr<ImporterList> importer_list_;
 +};
 +
 +#endif  // CHROME_BROWSER_UI_WEBUI_NXTSCAPE_FIRST_RUN_H_
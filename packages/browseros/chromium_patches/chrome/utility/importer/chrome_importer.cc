@@ -1,9 +1,9 @@
 diff --git a/chrome/utility/importer/chrome_importer.cc b/chrome/utility/importer/chrome_importer.cc
 new file mode 100644
-index 0000000000000..5b121cca3a62c
+index 0000000000000..15a8f9ba34bdf
 --- /dev/null
 +++ b/chrome/utility/importer/chrome_importer.cc
-@@ -0,0 +1,591 @@
+@@ -0,0 +1,730 @@
 +// Copyright 2023 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -11,13 +11,22 @@ index 0000000000000..5b121cca3a62c
 +#include "chrome/utility/importer/chrome_importer.h"
 +
 +#include <memory>
++#include <optional>
 +#include <string>
++#include <string_view>
 +#include <utility>
 +
++#include "base/barrier_closure.h"
 +#include "base/files/file_util.h"
++#include "base/files/memory_mapped_file.h"
++#include "base/functional/bind.h"
 +#include "base/json/json_reader.h"
++#include "base/synchronization/waitable_event.h"
++#include "base/task/task_traits.h"
++#include "base/task/thread_pool.h"
 +#include "base/strings/string_util.h"
 +#include "base/strings/utf_string_conversions.h"
++#include "base/threading/thread_restrictions.h"
 +#include "base/time/time.h"
 +#include "chrome/common/importer/importer_autofill_form_data_entry.h"
 +#include "chrome/common/importer/importer_bridge.h"
@@ -38,6 +47,12 @@ index 0000000000000..5b121cca3a62c
 +// Database tag for Chrome importer
 +inline constexpr sql::Database::Tag kDatabaseTag{"ChromeImporter"};
 +
++// Number of history rows handed to the profile writer per batch. Large
++// profiles (hundreds of thousands of visits) previously accumulated every
++// row before a single hand-off, so the destination could not start
++// committing until the whole source database had been read.
++inline constexpr size_t kHistoryBatchSize = 5000;
++
 +// Checks if a URL has a valid scheme that we allow to import
 +bool CanImportURL(const GURL& url) {
 +  return true;
@@ -57,39 +72,58 @@ index 0000000000000..5b121cca3a62c
 +
 +  bridge_->NotifyStarted();
 +
-+  if ((items & user_data_importer::HISTORY) && !cancelled()) {
-+    bridge_->NotifyItemStarted(user_data_importer::HISTORY);
-+    ImportHistory();
-+    bridge_->NotifyItemEnded(user_data_importer::HISTORY);
-+  }
-+
-+  if ((items & user_data_importer::FAVORITES) && !cancelled()) {
-+    bridge_->NotifyItemStarted(user_data_importer::FAVORITES);
-+    ImportBookmarks();
-+    bridge_->NotifyItemEnded(user_data_importer::FAVORITES);
-+  }
-+
-+  if ((items & user_data_importer::PASSWORDS) && !cancelled()) {
-+    bridge_->NotifyItemStarted(user_data_importer::PASSWORDS);
-+    ImportPasswords();
-+    bridge_->NotifyItemEnded(user_data_importer::PASSWORDS);
-+  }
-+
-+  if ((items & user_data_importer::AUTOFILL_FORM_DATA) && !cancelled()) {
-+    bridge_->NotifyItemStarted(user_data_importer::AUTOFILL_FORM_DATA);
-+    ImportAutofillFormData();
-+    bridge_->NotifyItemEnded(user_data_importer::AUTOFILL_FORM_DATA);
-+  }
-+
-+  if ((items & user_data_importer::EXTENSIONS) && !cancelled()) {
-+    bridge_->NotifyItemStarted(user_data_importer::EXTENSIONS);
-+    ImportExtensions();
-+    bridge_->NotifyItemEnded(user_data_importer::EXTENSIONS);
++  // Each data type reads its own temp copy of a distinct source file and
++  // the bridge proxies results to the browser over a thread-safe remote,
++  // so the phases are independent: fan them out to the worker pool and
++  // stream each type's results to the profile writer as it finishes
++  // instead of serializing the whole import. Per-type progress still
++  // arrives through NotifyItemStarted/NotifyItemEnded, and each phase
++  // checks cancelled() as it runs.
++  struct Phase {
++    user_data_importer::ImportItem item;
++    void (ChromeImporter::*run)();
++  };
++  static constexpr Phase kPhases[] = {
++      {user_data_importer::HISTORY, &ChromeImporter::ImportHistory},
++      {user_data_importer::FAVORITES, &ChromeImporter::ImportBookmarks},
++      {user_data_importer::PASSWORDS, &ChromeImporter::ImportPasswords},
++      {user_data_importer::AUTOFILL_FORM_DATA,
++       &ChromeImporter::ImportAutofillFormData},
++      {user_data_importer::EXTENSIONS, &ChromeImporter::ImportExtensions},
++  };
++
++  std::vector<Phase> phases;
++  for (const Phase& phase : kPhases) {
++    if (items & phase.item)
++      phases.push_back(phase);
++  }
++
++  if (!phases.empty() && !cancelled()) {
++    base::WaitableEvent done;
++    base::RepeatingClosure barrier = base::BarrierClosure(
++        phases.size(),
++        base::BindOnce(&base::WaitableEvent::Signal, base::Unretained(&done)));
++    for (const Phase& phase : phases) {
++      base::ThreadPool::PostTask(
++          FROM_HERE, {base::MayBlock(), base::TaskPriority::USER_VISIBLE},
++          base::BindOnce(&ChromeImporter::RunImportPhase,
++                         base::Unretained(this), phase.item, phase.run)
++              .Then(barrier));
++    }
++    done.Wait();
 +  }
 +
 +  bridge_->NotifyEnded();
 +}
 +
++void ChromeImporter::RunImportPhase(user_data_importer::ImportItem item,
++                                    void (ChromeImporter::*phase)()) {
++  bridge_->NotifyItemStarted(item);
++  if (!cancelled())
++    (this->*phase)();
++  bridge_->NotifyItemEnded(item);
++}
++
 +void ChromeImporter::ImportHistory() {
 +  // Keep only essential logging for startup and completion
 +  LOG(INFO) << "ChromeImporter: Starting history import";
@@ -143,7 +177,13 @@ index 0000000000000..5b121cca3a62c
 +  s.BindInt64(3, ui::PAGE_TRANSITION_MANUAL_SUBFRAME);
 +  s.BindInt64(4, ui::PAGE_TRANSITION_KEYWORD_GENERATED);
 +
++  // Stream rows to the profile writer in fixed-size batches, reusing the
++  // single prepared statement across all of them. Each batch becomes one
++  // write on the destination, and the destination commits earlier batches
++  // while we are still stepping through the source database.
 +  std::vector<user_data_importer::ImporterURLRow> rows;
++  rows.reserve(kHistoryBatchSize);
++  size_t total_rows = 0;
 +
 +  while (s.Step() && !cancelled()) {
 +    GURL url(s.ColumnString(0));
@@ -161,13 +201,22 @@ index 0000000000000..5b121cca3a62c
 +    row.visit_count = s.ColumnInt(4);
 +
 +    rows.push_back(row);
-+  }
 +
-+  // Keep only the summary log
-+  LOG(INFO) << "ChromeImporter: Found " << rows.size() << " history items";
++    if (rows.size() >= kHistoryBatchSize) {
++      total_rows += rows.size();
++      bridge_->SetHistoryItems(rows, user_data_importer::VISIT_SOURCE_CHROME_IMPORTED);
++      rows.clear();
++    }
++  }
 +
 +  if (!rows.empty() && !cancelled()) {
++    total_rows += rows.size();
 +    bridge_->SetHistoryItems(rows, user_data_importer::VISIT_SOURCE_CHROME_IMPORTED);
++  }
++
++  // Keep only the summary log
++  LOG(INFO) << "ChromeImporter: Found " << total_rows << " history items";
++  if (total_rows > 0) {
 +    LOG(INFO) << "ChromeImporter: History import complete";
 +  }
 +
@@ -231,7 +280,7 @@ index 0000000000000..5b121cca3a62c
 +    std::vector<std::u16string> path;
 +    const std::string* name = bookmark_bar->FindString("name");
 +    path.push_back(base::UTF8ToUTF16(name ? *name : "Bookmarks Bar"));
-+    RecursiveReadBookmarksFolder(bookmark_bar, path, true, &bookmarks);
++    ReadBookmarksFolder(bookmark_bar, path, true, &bookmarks);
 +  }
 +
 +  // Import other bookmarks
@@ -240,7 +289,7 @@ index 0000000000000..5b121cca3a62c
 +    std::vector<std::u16string> path;
 +    const std::string* name = other->FindString("name");
 +    path.push_back(base::UTF8ToUTF16(name ? *name : "Other Bookmarks"));
-+    RecursiveReadBookmarksFolder(other, path, false, &bookmarks);
++    ReadBookmarksFolder(other, path, false, &bookmarks);
 +  }
 +
 +  // Write bookmarks to profile
@@ -295,44 +344,93 @@ index 0000000000000..5b121cca3a62c
 +    sql::Database* db,
 +    const FaviconMap& favicon_map,
 +    favicon_base::FaviconUsageDataList* favicons) {
++  // Bulk-read every referenced favicon bitmap in a single pass instead of
++  // issuing one lookup per icon id.
 +  const char query[] =
-+      "SELECT f.url, fb.image_data "
++      "SELECT f.id, f.url, fb.image_data "
 +      "FROM favicons f "
 +      "JOIN favicon_bitmaps fb "
-+      "ON f.id = fb.icon_id "
-+      "WHERE f.id = ?";
++      "ON f.id = fb.icon_id";
 +  sql::Statement s(db->GetUniqueStatement(query));
 +
 +  if (!s.is_valid())
 +    return;
 +
-+  for (const auto& entry : favicon_map) {
-+    s.BindInt64(0, entry.first);
-+    if (s.Step()) {
-+      favicon_base::FaviconUsageData usage;
++  struct PendingFavicon {
++    GURL favicon_url;
++    std::set<GURL> urls;
++    std::vector<uint8_t> data;
++  };
++  std::vector<PendingFavicon> pending;
++  std::set<int64_t> loaded_icon_ids;
 +
-+      usage.favicon_url = GURL(s.ColumnString(0));
-+      if (!usage.favicon_url.is_valid())
-+        continue;  // Skip favicons with invalid URLs
++  while (s.Step() && !cancelled()) {
++    int64_t icon_id = s.ColumnInt64(0);
++    auto it = favicon_map.find(icon_id);
++    if (it == favicon_map.end())
++      continue;  // Not referenced by any imported bookmark
 +
-+      std::vector<uint8_t> data;
-+      s.ColumnBlobAsVector(1, &data);
-+      if (data.empty())
-+        continue;  // Skip empty data
++    // The bitmaps table holds one row per resolution; keep the first, as
++    // the per-id lookup did.
++    if (!loaded_icon_ids.insert(icon_id).second)
++      continue;
 +
-+      auto decoded_data = importer::ReencodeFavicon(base::span(data));
-+      if (!decoded_data)
-+        continue;  // Unable to decode
++    GURL favicon_url(s.ColumnString(1));
++    if (!favicon_url.is_valid())
++      continue;  // Skip favicons with invalid URLs
 +
-+      usage.urls = entry.second;
-+      usage.png_data = std::move(decoded_data).value();
-+      favicons->push_back(usage);
-+    }
-+    s.Reset(true);
++    std::vector<uint8_t> data;
++    s.ColumnBlobAsVector(2, &data);
++    if (data.empty())
++      continue;  // Skip empty data
++
++    pending.push_back({std::move(favicon_url), it->second, std::move(data)});
++  }
++
++  if (pending.empty() || cancelled())
++    return;
++
++  // Re-encoding is pure CPU work on independent blobs, so fan it out to
++  // the worker pool and block this thread (which may already block on
++  // file IO) until the last result lands.
++  std::vector<std::optional<std::vector<uint8_t>>> reencoded(pending.size());
++  base::WaitableEvent done;
++  base::RepeatingClosure barrier = base::BarrierClosure(
++      pending.size(),
++      base::BindOnce(&base::WaitableEvent::Signal, base::Unretained(&done)));
++  for (size_t i = 0; i < pending.size(); ++i) {
++    base::ThreadPool::PostTask(
++        FROM_HERE, {base::TaskPriority::USER_VISIBLE},
++        base::BindOnce(
++            [](const std::vector<uint8_t>& data,
++               std::optional<std::vector<uint8_t>>* out,
++               base::RepeatingClosure barrier) {
++              *out = importer::ReencodeFavicon(base::span(data));
++              barrier.Run();
++            },
++            std::cref(pending[i].data), base::Unretained(&reencoded[i]),
++            barrier));
++  }
++  {
++    // This runs on one of StartImport's MayBlock phase tasks; joining the
++    // re-encode pool needs an explicit sync-primitives allowance there.
++    base::ScopedAllowBaseSyncPrimitives allow_wait;
++    done.Wait();
++  }
++
++  for (size_t i = 0; i < pending.size(); ++i) {
++    if (!reencoded[i])
++      continue;  // Unable to decode
++
++    favicon_base::FaviconUsageData usage;
++    usage.favicon_url = std::move(pending[i].favicon_url);
++    usage.urls = std::move(pending[i].urls);
++    usage.png_data = std::move(*reencoded[i]);
++    favicons->push_back(std::move(usage));
 +  }
 +}
 +
-+void ChromeImporter::RecursiveReadBookmarksFolder(
++void ChromeImporter::ReadBookmarksFolder(
 +    const base::Value::Dict* folder,
 +    const std::vector<std::u16string>& parent_path,
 +    bool is_in_toolbar,
@@ -345,43 +443,67 @@ index 0000000000000..5b121cca3a62c
 +  if (!children)
 +    return;
 +
-+  for (const auto& value : *children) {
++  // Pre-order walk with an explicit stack so deep folder hierarchies
++  // neither recurse per folder nor grow the native stack; the output
++  // vector is grown once per folder instead of per entry.
++  struct Frame {
++    const base::Value::List* children;
++    size_t index;
++    std::vector<std::u16string> path;
++  };
++  std::vector<Frame> stack;
++  stack.push_back({children, 0, parent_path});
++  bookmarks->reserve(bookmarks->size() + children->size());
++
++  while (!stack.empty()) {
++    Frame& frame = stack.back();
++    if (frame.index >= frame.children->size()) {
++      stack.pop_back();
++      continue;
++    }
++
++    const base::Value& value = (*frame.children)[frame.index++];
 +    if (!value.is_dict())
 +      continue;
 +
-+    const std::string* type = value.GetDict().FindString("type");
++    const base::Value::Dict& dict = value.GetDict();
++    const std::string* type = dict.FindString("type");
 +    if (!type)
 +      continue;
 +
-+    const std::string* name = value.GetDict().FindString("name");
++    const std::string* name = dict.FindString("name");
 +    std::u16string title = base::UTF8ToUTF16(name ? *name : std::string());
 +
-+    const std::string* date_added = value.GetDict().FindString("date_added");
++    const std::string* date_added = dict.FindString("date_added");
 +    int64_t date_added_val = date_added ? std::stoll(*date_added) : 0;
 +
 +    if (*type == "folder") {
-+      // Process folder
-+      std::vector<std::u16string> path = parent_path;
-+      path.push_back(title);
++      const base::Value::List* inner_children = dict.FindList("children");
 +
-+      // Check if this is an empty folder to add it as an entry
-+      const base::Value::List* inner_children = value.GetDict().FindList("children");
++      // Record empty folders as entries so they survive the import
 +      if (inner_children && inner_children->empty()) {
 +        user_data_importer::ImportedBookmarkEntry entry;
 +        entry.is_folder = true;
 +        entry.in_toolbar = is_in_toolbar;
 +        entry.url = GURL();
-+        entry.path = parent_path;
++        entry.path = frame.path;
 +        entry.title = title;
 +        entry.creation_time = ChromeTimeToBaseTime(date_added_val);
 +        bookmarks->push_back(entry);
 +      }
 +
-+      // Process subfolders and entries
-+      RecursiveReadBookmarksFolder(&value.GetDict(), path, is_in_toolbar, bookmarks);
++      // Descend into non-empty subfolders before the remaining siblings,
++      // matching the recursive traversal order. Note: pushing may
++      // invalidate |frame|.
++      if (inner_children && !inner_children->empty()) {
++        std::vector<std::u16string> path = frame.path;
++        path.push_back(title);
++        bookmarks->reserve(bookmarks->size() + inner_children->size());
++        stack.push_back({inner_children, 0, std::move(path)});
++      }
 +    } else if (*type == "url") {
 +      // Process bookmark URL
-+      const std::string* url_str = value.GetDict().FindString("url");
++      const std::string* url_str = dict.FindString("url");
 +      if (!url_str)
 +        continue;
 +
@@ -393,7 +515,7 @@ index 0000000000000..5b121cca3a62c
 +      entry.is_folder = false;
 +      entry.in_toolbar = is_in_toolbar;
 +      entry.url = url;
-+      entry.path = parent_path;
++      entry.path = frame.path;
 +      entry.title = title;
 +      entry.creation_time = ChromeTimeToBaseTime(date_added_val);
 +
@@ -463,7 +585,19 @@ index 0000000000000..5b121cca3a62c
 +    return;
 +  }
 +
++  // The whole table is handed to the profile writer as one batch; size
++  // the batch up front and move rows into it so large profiles don't pay
++  // per-row reallocations and string copies.
++  int64_t row_count = 0;
++  {
++    sql::Statement count(
++        db.GetUniqueStatement("SELECT COUNT(*) FROM autofill"));
++    if (count.Step())
++      row_count = count.ColumnInt64(0);
++  }
++
 +  std::vector<ImporterAutofillFormDataEntry> form_entries;
++  form_entries.reserve(static_cast<size_t>(row_count));
 +  while (s.Step() && !cancelled()) {
 +    ImporterAutofillFormDataEntry form_entry;
 +    form_entry.name = s.ColumnString16(0);
@@ -472,7 +606,7 @@ index 0000000000000..5b121cca3a62c
 +    form_entry.first_used = ChromeTimeToBaseTime(s.ColumnInt64(3));
 +    form_entry.last_used = ChromeTimeToBaseTime(s.ColumnInt64(4));
 +
-+    form_entries.push_back(form_entry);
++    form_entries.push_back(std::move(form_entry));
 +  }
 +
 +  if (!form_entries.empty() && !cancelled()) {
@@ -533,12 +667,17 @@ index 0000000000000..5b121cca3a62c
 +    const base::FilePath& preferences_path) {
 +  std::vector<std::string> extension_ids;
 +
-+  std::string preferences_content;
-+  if (!base::ReadFileToString(preferences_path, &preferences_content)) {
-+    LOG(ERROR) << "ChromeImporter: Failed to read " << preferences_path.value();
++  // Map the file instead of copying it into a string; Preferences is
++  // often several MB and is only needed for the duration of the parse.
++  base::MemoryMappedFile preferences_file;
++  if (!preferences_file.Initialize(preferences_path)) {
++    LOG(ERROR) << "ChromeImporter: Failed to map " << preferences_path.value();
 +    return extension_ids;
 +  }
 +
++  std::string_view preferences_content(
++      reinterpret_cast<const char*>(preferences_file.data()),
++      preferences_file.length());
 +  std::optional<base::Value::Dict> preferences =
 +      base::JSONReader::ReadDict(preferences_content, base::JSON_PARSE_CHROMIUM_EXTENSIONS);
 +  if (!preferences) {
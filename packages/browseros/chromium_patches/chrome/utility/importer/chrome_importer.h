@@ -1,9 +1,9 @@
 diff --git a/chrome/utility/importer/chrome_importer.h b/chrome/utility/importer/chrome_importer.h
 new file mode 100644
-index 0000000000000..d4a0d85ea9c03
+index 0000000000000..75f2ce1fd216e
 --- /dev/null
 +++ b/chrome/utility/importer/chrome_importer.h
-@@ -0,0 +1,82 @@
+@@ -0,0 +1,88 @@
 +// Copyright 2023 The Chromium Authors
 +// Use of this source code is governed by a BSD-style license that can be
 +// found in the LICENSE file.
@@ -55,6 +55,11 @@ index 0000000000000..d4a0d85ea9c03
 +  void ImportExtensions();
 +  void ImportPasswordsFromFile(const base::FilePath& password_filename);
 +
++  // Runs one import phase on a worker, bracketed by the per-item progress
++  // notifications. Phases run concurrently; see StartImport().
++  void RunImportPhase(user_data_importer::ImportItem item,
++                      void (ChromeImporter::*phase)());
++
 +  // Helper function to convert Chrome's time format to base::Time
 +  base::Time ChromeTimeToBaseTime(int64_t time);
 +
@@ -71,8 +76,9 @@ index 0000000000000..d4a0d85ea9c03
 +                       const FaviconMap& favicon_map,
 +                       favicon_base::FaviconUsageDataList* favicons);
 +
-+  // Recursively reads a bookmarks folder from the JSON structure
-+  void RecursiveReadBookmarksFolder(
++  // Reads a bookmarks folder (and everything below it) from the JSON
++  // structure, iteratively, in the same pre-order the old recursion used
++  void ReadBookmarksFolder(
 +      const base::Value::Dict* folder,
 +      const std::vector<std::u16string>& parent_path,
 +      bool is_in_toolbar,
@@ -2,7 +2,7 @@ diff --git a/extensions/browser/extension_function_histogram_value.h b/extension
 index 6d9bd29ae220f..040d7493d5fd6 100644
 --- a/extensions/browser/extension_function_histogram_value.h
 +++ b/extensions/browser/extension_function_histogram_value.h
-@@ -2011,6 +2011,30 @@ enum HistogramValue {
+@@ -2011,6 +2011,41 @@ enum HistogramValue {
    DEVELOPERPRIVATE_SHOWSITESETTINGS = 1948,
    ACCESSIBILITY_PRIVATE_PROCESSPENDINGSPOKENFEEDBACKEVENT = 1949,
    ACCESSIBILITY_PRIVATE_ENABLESPOKENFEEDBACKMV3KEYHANDLING = 1950,
@@ -30,6 +30,17 @@ index 6d9bd29ae220f..040d7493d5fd6 100644
 +  SIDEPANEL_BROWSEROSTOGGLE = 1972,
 +  SIDEPANEL_BROWSEROSISOPEN = 1973,
 +  BROWSER_OS_GETBROWSEROSVERSIONNUMBER = 1974,
++  BROWSER_OS_GETSNAPSHOTBINARY = 1975,
++  BROWSER_OS_PERFORMACTIONS = 1976,
++  BROWSER_OS_GETSNAPSHOTS = 1977,
++  BROWSER_OS_WATCHCHANGES = 1978,
++  BROWSER_OS_UNWATCHCHANGES = 1979,
++  BROWSER_OS_DRAINCHANGES = 1980,
++  BROWSER_OS_GETSNAPSHOTMARKDOWN = 1981,
++  BROWSER_OS_WAITFORSTABLE = 1982,
++  BROWSER_OS_GETCONTENTFINGERPRINT = 1983,
++  BROWSER_OS_CAPTUREWITHSNAPSHOT = 1984,
++  BROWSER_OS_SETAGENTACTIVE = 1985,
    // Last entry: Add new entries above, then run:
    // tools/metrics/histograms/update_extension_histograms.py
    ENUM_BOUNDARY